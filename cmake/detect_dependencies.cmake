@@ -157,6 +157,16 @@ if(RapidJSON_FOUND AND NOT TARGET RapidJSON::RapidJSON)
 endif()
 
 
+# ###############################
+# ####   zlib
+# ###############################
+find_package(ZLIB REQUIRED)
+
+if(ZLIB_FOUND)
+    message(STATUS "Found zlib ${ZLIB_VERSION_STRING}")
+endif(ZLIB_FOUND)
+
+
 # ###############################
 # ####   Python support
 # ###############################
@@ -35,6 +35,7 @@
 #include <map>
 #include <ostream>
 #include <set>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -791,6 +792,7 @@ namespace hal
 
         /**
          * Simplifies the Boolean function.
+         * Results are memoized in the process-wide `SimplificationCache`, which can be cleared or disabled if required.
          * 
          * @returns The simplified Boolean function.
          */
@@ -867,6 +869,18 @@ namespace hal
          */
         Result<std::vector<std::vector<Value>>> compute_truth_table(const std::vector<std::string>& ordered_variables = {}, bool remove_unknown_variables = false) const;
 
+        /**
+         * Computes the truth table outputs for a Boolean function that comprises <= 20 single-bit variables as packed bit vectors.
+         * Row `r` assigns bit `i` of `r` to the `i`-th variable and is stored in bit `r % 64` of word `r / 64`.
+         * All rows are evaluated word-parallel, i.e., 64 rows at once.
+         * \warning The generation of the truth table is exponential in the number of parameters.
+         * 
+         * @param[in] ordered_variables - A vector describing the order of input variables used to generate the truth table. Defaults to an empty vector.
+         * @param[in] remove_unknown_variables - Set `true` to remove variables from the truth table that are not present within the Boolean function, `false` otherwise. Defaults to `false`.
+         * @returns Ok() and one packed bit vector per output bit on success, an error otherwise (e.g., if the truth table contains `X` or `Z` values).
+         */
+        Result<std::vector<std::vector<u64>>> compute_packed_truth_table(const std::vector<std::string>& ordered_variables = {}, bool remove_unknown_variables = false) const;
+
         /**
          * Prints the truth table for a Boolean function that comprises <= 10 single-bit variables.
          * \warning The generation of the truth table is exponential in the number of parameters.
@@ -980,6 +994,21 @@ namespace hal
      * i.e. no separation from operation / operand nodes via inheritance, due to 
      * optimization reasons to keep node data closely together and prevent the 
      * use of smart pointers to manage memory safely.
+     * 
+     * A node occupies exactly 8 bytes and owns no heap memory, so the node list
+     * of a Boolean function is a single contiguous arena that is copied with a
+     * plain memcpy. Variable names are interned into a process-wide table and
+     * referred to by their ID. Constants of up to 16 bits are packed into the
+     * node in dual-rail encoding (2 bits per value), wider constants are interned
+     * as well. As interned values are unique, two nodes are equal if and only if 
+     * their type, size, and data are equal.
+     *
+     * Since nodes do not know which netlist or function they belong to, the
+     * intern tables cannot be scoped to either of them and are never shrunk.
+     * They are bounded by the number of distinct variable names and wide
+     * constants created during the lifetime of the process, which is small
+     * compared to the number of nodes referring to them. Resolving a variable
+     * name or constant does not take a lock.
      *
      * @ingroup netlist
      */
@@ -993,12 +1022,11 @@ namespace hal
         u16 type;
         /// The bit-size of the node.
         u16 size;
-        /// The (optional) constant value of the node.
-        std::vector<BooleanFunction::Value> constant{};
-        /// The (optional) index value of the node.
-        u16 index{};
-        /// The (optional) variable name of the node.
-        std::string variable{};
+        /// The (optional) payload of the node, i.e., the index value, the interned variable ID, or the packed or interned constant value.
+        u32 data{};
+
+        /// The maximum size of constants that are packed into the node instead of being interned.
+        static constexpr u16 MAX_PACKED_CONSTANT_SIZE = 16;
 
         ////////////////////////////////////////////////////////////////////////
         // Constructors, Destructors, Operators
@@ -1205,15 +1233,40 @@ namespace hal
          */
         bool is_commutative() const;
 
+        /**
+         * Get the constant value of a node of type `Constant` without checking its type.
+         * 
+         * @returns The constant value, or an unspecified value if the node is not of type `Constant`.
+         */
+        std::vector<Value> constant() const;
+
+        /**
+         * Get the index value of a node of type `Index` without checking its type.
+         * 
+         * @returns The index value, or an unspecified value if the node is not of type `Index`.
+         */
+        u16 index() const;
+
+        /**
+         * Get the variable name of a node of type `Variable` without checking its type.
+         * The returned reference stays valid for the lifetime of the process.
+         * 
+         * @returns The variable name, or an unspecified value if the node is not of type `Variable`.
+         */
+        const std::string& variable() const;
+
     private:
         ////////////////////////////////////////////////////////////////////////
         // Constructors, Destructors, Operators
         ////////////////////////////////////////////////////////////////////////
 
         /// constructor to initialize all Node fields
-        Node(u16 _type, u16 _size, std::vector<BooleanFunction::Value> _constant, u16 _index, std::string variable);
+        Node(u16 _type, u16 _size, u32 _data);
     };
 
+    static_assert(sizeof(BooleanFunction::Node) == 8, "Boolean function nodes must remain 8 bytes");
+    static_assert(std::is_trivially_copyable_v<BooleanFunction::Node>, "Boolean function nodes must remain trivially copyable");
+
     /**
      * Holds all node types available in a Boolean function.
      *
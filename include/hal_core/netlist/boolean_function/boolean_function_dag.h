@@ -0,0 +1,229 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+
+#include <limits>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A BooleanFunctionDAG stores Boolean functions as a directed acyclic graph of hash-consed nodes.
+     * Structurally identical sub-expressions are stored exactly once in a shared node table, i.e., adding the same operation 
+     * on the same operands twice yields the same node ID.
+     * In contrast to the reverse-polish notation of a `BooleanFunction`, reconvergent logic therefore does not need to be 
+     * duplicated, which keeps the size of functions such as combined subgraph functions linear in the size of the subgraph.
+     *
+     * Node IDs are assigned in creation order and operands are always created before the nodes using them, so iterating 
+     * node IDs in ascending order is a valid topological order.
+     * Nodes are never removed from the table; functions that are no longer needed simply become unreachable.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API BooleanFunctionDAG final
+    {
+    public:
+        /// The ID of a node within the DAG.
+        using NodeId = u32;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Constructors, Destructors, Operators
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Constructs an empty DAG.
+         */
+        BooleanFunctionDAG() = default;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Interface
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Adds a node with the given operands to the DAG.
+         * If a structurally identical node already exists, its ID is returned instead.
+         * 
+         * @param[in] node - The node.
+         * @param[in] operands - The IDs of the operands of the node, must match the arity of the node.
+         * @returns The ID of the node on success, an error otherwise.
+         */
+        Result<NodeId> add_node(const BooleanFunction::Node& node, const std::vector<NodeId>& operands = {});
+
+        /**
+         * Adds a Boolean function given in reverse-polish notation to the DAG.
+         * Variables contained in `bindings` are not added as variable nodes but are replaced by the bound nodes instead, which allows 
+         * to compose functions within the DAG without ever expanding them.
+         * 
+         * @param[in] function - The Boolean function.
+         * @param[in] bindings - A map from variable names to the IDs of the nodes they are bound to. Defaults to an empty map.
+         * @returns The ID of the root node of the function on success, an error otherwise.
+         */
+        Result<NodeId> add(const BooleanFunction& function, const std::unordered_map<std::string, NodeId>& bindings = {});
+
+        /**
+         * Converts the function rooted at the given node back into its reverse-polish notation.
+         * As shared nodes are duplicated during conversion, the result may be exponentially larger than the DAG.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @param[in] max_size - The maximum number of nodes of the resulting Boolean function. Defaults to no limit.
+         * @returns The Boolean function on success, an error otherwise.
+         */
+        Result<BooleanFunction> to_boolean_function(NodeId root, u64 max_size = std::numeric_limits<u64>::max()) const;
+
+        /**
+         * Get the node with the given ID.
+         * 
+         * @param[in] id - The ID of the node.
+         * @returns The node.
+         */
+        const BooleanFunction::Node& get_node(NodeId id) const;
+
+        /**
+         * Get the operands of the node with the given ID.
+         * 
+         * @param[in] id - The ID of the node.
+         * @returns The IDs of the operands.
+         */
+        const std::vector<NodeId>& get_operands(NodeId id) const;
+
+        /**
+         * Get the total number of nodes stored in the DAG.
+         * 
+         * @returns The number of nodes.
+         */
+        u32 size() const;
+
+        /**
+         * Get the number of distinct nodes reachable from the given node, i.e., the size of the function within the DAG.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @returns The number of reachable nodes.
+         */
+        u32 get_size(NodeId root) const;
+
+        /**
+         * Get the number of nodes of the function rooted at the given node when converted into reverse-polish notation.
+         * The value saturates at the maximum of a `u64`.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @returns The size of the expanded function.
+         */
+        u64 get_expanded_size(NodeId root) const;
+
+        /**
+         * Get the names of all variables of the function rooted at the given node.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @returns The variable names.
+         */
+        std::set<std::string> get_variable_names(NodeId root) const;
+
+        /**
+         * Substitutes variables of the function rooted at the given node with other nodes of the DAG.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @param[in] substitutions - A map from variable names to the IDs of the nodes replacing them.
+         * @returns The ID of the root node of the substituted function on success, an error otherwise.
+         */
+        Result<NodeId> substitute(NodeId root, const std::unordered_map<std::string, NodeId>& substitutions);
+
+        /**
+         * Simplifies the function rooted at the given node using the local simplification rules of the symbolic execution engine.
+         * The nodes are simplified bottom-up, each with a bounded view of its operands, so that the cost of the simplification 
+         * stays linear in the size of the DAG instead of the size of the expanded function.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @returns The ID of the root node of the simplified function on success, an error otherwise.
+         */
+        Result<NodeId> simplify(NodeId root);
+
+        /**
+         * Evaluates the function rooted at the given node for the given input assignment.
+         * Every node is evaluated exactly once.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @param[in] inputs - A map from variable names to values.
+         * @returns The value of the function on success, an error otherwise.
+         */
+        Result<std::vector<BooleanFunction::Value>> evaluate(NodeId root, const std::unordered_map<std::string, std::vector<BooleanFunction::Value>>& inputs) const;
+
+        /**
+         * Removes all nodes from the DAG.
+         * All previously returned node IDs become invalid.
+         */
+        void clear();
+
+    private:
+        ////////////////////////////////////////////////////////////////////////
+        // Internal Interface
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Computes the structural hash of a node and its operands.
+         * 
+         * @param[in] node - The node.
+         * @param[in] operands - The IDs of the operands.
+         * @returns The hash value.
+         */
+        static u64 hash(const BooleanFunction::Node& node, const std::vector<NodeId>& operands);
+
+        /**
+         * Get the IDs of all nodes reachable from the given node in ascending, i.e., topological, order.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @returns The node IDs.
+         */
+        std::vector<NodeId> get_reachable_nodes(NodeId root) const;
+
+        /**
+         * Appends the reverse-polish notation of the function rooted at the given node to a vector of nodes.
+         * 
+         * @param[in] root - The ID of the root node.
+         * @param[inout] nodes - The vector to append the nodes to.
+         */
+        void append_nodes(NodeId root, std::vector<BooleanFunction::Node>& nodes) const;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Member
+        ////////////////////////////////////////////////////////////////////////
+
+        /// refers to the node table
+        std::vector<BooleanFunction::Node> m_nodes;
+        /// refers to the operands of each node
+        std::vector<std::vector<NodeId>> m_operands;
+        /// refers to the expanded size of each node, saturating at the maximum of a u64
+        std::vector<u64> m_expanded_sizes;
+        /// refers to the unique table mapping structural hashes to the IDs of all nodes with that hash
+        std::unordered_multimap<u64, NodeId> m_unique_table;
+    };
+}    // namespace hal
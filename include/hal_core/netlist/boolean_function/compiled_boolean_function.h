@@ -0,0 +1,290 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A CompiledBooleanFunction is a Boolean function that has been lowered from its reverse-polish notation
+     * into a flat, register-based program. 
+     * The program is built once and then evaluates up to 64 input assignments at once, each bit of a register 
+     * holding the value of one assignment. 
+     * In contrast to `BooleanFunction::evaluate`, no symbolic execution takes place, which makes it suitable 
+     * for hot loops that evaluate the same function over and over again.
+     *
+     * Bits are stored in dual-rail encoding, i.e., every bit comes with an additional 'unknown' bit so 
+     * that `X` and `Z` values are propagated with the same semantics as the constant propagation of the 
+     * symbolic execution engine.
+     * Variables that are not assigned a value are treated as `X`.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API CompiledBooleanFunction final
+    {
+    public:
+        /// The number of assignments that are evaluated in parallel.
+        static constexpr u32 LANES = 64;
+
+        /// The maximum number of single-bit input variables supported for truth table generation.
+        static constexpr u32 MAX_TRUTH_TABLE_VARIABLES = 20;
+
+        /**
+         * A bitsliced dual-rail word holding a single bit for each of the 64 evaluated assignments.
+         * A known bit is encoded as `unknown = 0` with its logic value in `value`.
+         * An `X` is encoded as `unknown = 1, value = 0`, a `Z` as `unknown = 1, value = 1`.
+         */
+        struct Word
+        {
+            /// The logic values of the 64 assignments.
+            u64 value = 0;
+            /// The unknown mask of the 64 assignments.
+            u64 unknown = 0;
+
+            /**
+             * Creates a word that holds the given value in all of its lanes.
+             * 
+             * @param[in] v - The value.
+             * @returns The word.
+             */
+            static Word broadcast(BooleanFunction::Value v);
+
+            /**
+             * Get the value of a single lane of the word.
+             * 
+             * @param[in] lane - The lane in `[0, 63]`.
+             * @returns The value.
+             */
+            BooleanFunction::Value get(u32 lane) const;
+
+            /**
+             * Set the value of a single lane of the word.
+             * 
+             * @param[in] lane - The lane in `[0, 63]`.
+             * @param[in] v - The value.
+             */
+            void set(u32 lane, BooleanFunction::Value v);
+
+            /**
+             * Checks whether two words are equal.
+             * 
+             * @param[in] other - The other word.
+             * @returns `true` if both words are equal, `false` otherwise.
+             */
+            bool operator==(const Word& other) const;
+
+            /**
+             * Checks whether two words are unequal.
+             * 
+             * @param[in] other - The other word.
+             * @returns `true` if both words are unequal, `false` otherwise.
+             */
+            bool operator!=(const Word& other) const;
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Constructors / Factories
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Constructs an empty compiled Boolean function that always evaluates to a single `X`.
+         */
+        CompiledBooleanFunction();
+
+        /**
+         * Compiles a Boolean function into a register-based program.
+         * The input words of the program are laid out in the order of the given variables, each variable occupying as many consecutive words as its bit-size (LSB first).
+         * If no variable order is given, the variables of the function are used in lexicographical order.
+         * Division and remainder operations are not supported.
+         * 
+         * @param[in] function - The Boolean function to compile.
+         * @param[in] ordered_variables - The order of the input variables. Must contain all variables of the function. Defaults to an empty vector.
+         * @returns Ok() and the compiled Boolean function on success, an error otherwise.
+         */
+        static Result<CompiledBooleanFunction> compile(const BooleanFunction& function, const std::vector<std::string>& ordered_variables = {});
+
+        ////////////////////////////////////////////////////////////////////////
+        // Interface
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Get the input variables of the program in the order in which they are laid out.
+         * 
+         * @returns The input variables.
+         */
+        const std::vector<std::string>& get_variables() const;
+
+        /**
+         * Get the bit-size of each input variable in the order of `get_variables()`.
+         * 
+         * @returns The bit-sizes of the input variables.
+         */
+        const std::vector<u16>& get_variable_sizes() const;
+
+        /**
+         * Get the number of input words expected by the bitsliced evaluation, i.e., the sum of all variable bit-sizes.
+         * 
+         * @returns The number of input words.
+         */
+        u32 get_input_size() const;
+
+        /**
+         * Get the bit-size of the compiled Boolean function, i.e., the number of output words.
+         * 
+         * @returns The bit-size.
+         */
+        u16 size() const;
+
+        /**
+         * Get the number of instructions of the compiled program.
+         * 
+         * @returns The number of instructions.
+         */
+        u32 get_instruction_count() const;
+
+        /**
+         * Evaluates the program for 64 assignments at once.
+         * Both `inputs` and `outputs` are bitsliced, i.e., lane `i` of every word belongs to the `i`-th assignment.
+         * The registers are kept in a buffer that is reused by all evaluations on the calling thread.
+         * 
+         * @param[in] inputs - The input words in the layout described by `get_variables()`. Must hold at least `get_input_size()` words.
+         * @param[out] outputs - The output words (LSB first). Must hold at least `size()` words.
+         */
+        void evaluate(const Word* inputs, Word* outputs) const;
+
+        /**
+         * Evaluates the program for 64 assignments at once using a caller-owned register file.
+         * Reusing the same register file across calls avoids any allocation within hot loops.
+         * 
+         * @param[in] inputs - The input words in the layout described by `get_variables()`. Must hold at least `get_input_size()` words.
+         * @param[out] outputs - The output words (LSB first). Must hold at least `size()` words.
+         * @param[in,out] registers - The register file, which is enlarged if it is too small for the program.
+         */
+        void evaluate(const Word* inputs, Word* outputs, std::vector<Word>& registers) const;
+
+        /**
+         * Evaluates the program for 64 assignments at once.
+         * 
+         * @param[in] inputs - The input words in the layout described by `get_variables()`.
+         * @returns Ok() and the output words (LSB first) on success, an error otherwise.
+         */
+        Result<std::vector<Word>> evaluate(const std::vector<Word>& inputs) const;
+
+        /**
+         * Evaluates a single-bit compiled Boolean function using the given input values.
+         * 
+         * @param[in] inputs - A map from variable name to input value.
+         * @returns Ok() and the resulting value on success, an error otherwise.
+         */
+        Result<BooleanFunction::Value> evaluate(const std::unordered_map<std::string, BooleanFunction::Value>& inputs) const;
+
+        /**
+         * Evaluates the compiled Boolean function using the given multi-bit input values.
+         * 
+         * @param[in] inputs - A map from variable name to a vector of input values.
+         * @returns Ok() and the resulting value on success, an error otherwise.
+         */
+        Result<std::vector<BooleanFunction::Value>> evaluate(const std::unordered_map<std::string, std::vector<BooleanFunction::Value>>& inputs) const;
+
+        /**
+         * Computes the truth table of a compiled Boolean function that comprises <= 20 single-bit input variables.
+         * All rows are evaluated word-parallel, i.e., 64 rows per program execution.
+         * Row `r` assigns bit `i` of `r` to the `i`-th input variable and is stored in lane `r % 64` of word `r / 64`.
+         * For less than 6 input variables, the lanes beyond the last row are set to `0`.
+         * \warning The generation of the truth table is exponential in the number of input variables.
+         * 
+         * @returns Ok() and one packed vector of words per output bit (LSB first) on success, an error otherwise.
+         */
+        Result<std::vector<std::vector<Word>>> compute_truth_table() const;
+
+    private:
+        ////////////////////////////////////////////////////////////////////////
+        // Internal Interface
+        ////////////////////////////////////////////////////////////////////////
+
+        /// The operations of the register machine.
+        enum class OpCode : u16
+        {
+            Mov,
+            Fill,
+            And,
+            Or,
+            Xor,
+            Not,
+            Ite,
+            Add,
+            Sub,
+            Mul,
+            Eq,
+            Ult,
+            Ule,
+            Slt,
+            Sle
+        };
+
+        /// A single instruction operating on `size` consecutive registers starting at the respective register indices.
+        struct Instruction
+        {
+            OpCode opcode;
+            u16 size;
+            u32 dst;
+            u32 src0;
+            u32 src1;
+            u32 src2;
+        };
+
+        /// Executes the program on the given register file.
+        void execute(Word* registers) const;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Member
+        ////////////////////////////////////////////////////////////////////////
+
+        /// refers to the ordered input variables
+        std::vector<std::string> m_variables;
+        /// refers to the bit-sizes of the input variables
+        std::vector<u16> m_variable_sizes;
+        /// refers to the number of input registers
+        u32 m_input_size = 0;
+        /// refers to the initial values of the constant registers that follow the input registers
+        std::vector<Word> m_constants;
+        /// refers to the total number of registers
+        u32 m_register_count = 0;
+        /// refers to the first register of the output
+        u32 m_output = 0;
+        /// refers to the bit-size of the output
+        u16 m_output_size = 0;
+        /// refers to the program
+        std::vector<Instruction> m_program;
+    };
+}    // namespace hal
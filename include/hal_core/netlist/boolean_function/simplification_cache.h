@@ -0,0 +1,194 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A SimplificationCache memoizes the results of simplifying Boolean functions.
+     * 
+     * Functions are looked up by a structural hash of their canonical form, in which all variables are renamed to placeholders
+     * that are numbered by the lexicographic rank of the original variable names.
+     * Hence, functions that only differ in the naming of their variables share a cache entry as long as the renaming preserves 
+     * the relative order of the names, e.g., `net_1 & net_2` and `net_7 & net_8`.
+     * Since the simplification rules only ever compare variables by name, the canonical form is always simplified instead of 
+     * the original function, which guarantees that results are identical regardless of whether they come from the cache.
+     *
+     * The cache holds at most a configurable number of entries and evicts the least recently used entry once the capacity is exceeded.
+     * All member functions are thread-safe.
+     * A process-wide instance is used by `BooleanFunction::simplify`.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API SimplificationCache final
+    {
+    public:
+        /// The default maximum number of cache entries.
+        static constexpr u64 DEFAULT_CAPACITY = 1 << 16;
+
+        /**
+         * Counters describing the effectiveness of a cache.
+         */
+        struct Statistics
+        {
+            /// The number of lookups answered from the cache.
+            u64 hits = 0;
+            /// The number of lookups that required a simplification.
+            u64 misses = 0;
+            /// The number of entries evicted due to the capacity limit.
+            u64 evictions = 0;
+            /// The current number of entries.
+            u64 entries = 0;
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Constructors, Destructors, Operators
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Constructs an empty cache.
+         * 
+         * @param[in] capacity - The maximum number of entries.
+         */
+        explicit SimplificationCache(u64 capacity = DEFAULT_CAPACITY);
+
+        SimplificationCache(const SimplificationCache&)            = delete;
+        SimplificationCache& operator=(const SimplificationCache&) = delete;
+
+        /**
+         * Get the process-wide cache used by `BooleanFunction::simplify`.
+         * 
+         * @returns The process-wide cache.
+         */
+        static SimplificationCache& get_global_cache();
+
+        ////////////////////////////////////////////////////////////////////////
+        // Interface
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Simplifies a Boolean function, reusing a cached result if one exists.
+         * On a miss, the simplifier is invoked on the canonical form of the function and its result is stored in the cache.
+         * If the cache is disabled, the simplifier is invoked on the function itself.
+         * 
+         * @param[in] function - The Boolean function to simplify.
+         * @param[in] simplifier - The simplification to apply.
+         * @returns The simplified Boolean function.
+         */
+        BooleanFunction simplify(const BooleanFunction& function, const std::function<BooleanFunction(const BooleanFunction&)>& simplifier);
+
+        /**
+         * Removes all entries from the cache and resets its counters.
+         */
+        void clear();
+
+        /**
+         * Get the counters of the cache.
+         * 
+         * @returns The statistics of the cache.
+         */
+        Statistics get_statistics() const;
+
+        /**
+         * Set the maximum number of entries.
+         * Excess entries are evicted immediately. 
+         * A capacity of 0 effectively disables caching.
+         * 
+         * @param[in] capacity - The maximum number of entries.
+         */
+        void set_capacity(u64 capacity);
+
+        /**
+         * Get the maximum number of entries.
+         * 
+         * @returns The maximum number of entries.
+         */
+        u64 get_capacity() const;
+
+        /**
+         * Enable or disable the cache.
+         * While disabled, `simplify` neither reads nor writes entries and the counters are not updated.
+         * 
+         * @param[in] enable - Set `true` to enable the cache, `false` to disable it.
+         */
+        void set_enabled(bool enable);
+
+        /**
+         * Check whether the cache is enabled.
+         * 
+         * @returns `true` if the cache is enabled, `false` otherwise.
+         */
+        bool is_enabled() const;
+
+    private:
+        /**
+         * A cache entry mapping the nodes of a canonical function to the nodes of its simplification.
+         */
+        struct Entry
+        {
+            /// The structural hash of the canonical function.
+            u64 hash;
+            /// The nodes of the canonical function.
+            std::vector<BooleanFunction::Node> key;
+            /// The nodes of the simplified canonical function.
+            std::vector<BooleanFunction::Node> value;
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Internal Interface
+        ////////////////////////////////////////////////////////////////////////
+
+        static u64 hash(const std::vector<BooleanFunction::Node>& nodes);
+        std::list<Entry>::iterator find(u64 hash, const std::vector<BooleanFunction::Node>& key);
+        void evict(u64 capacity);
+
+        ////////////////////////////////////////////////////////////////////////
+        // Member
+        ////////////////////////////////////////////////////////////////////////
+
+        /// refers to the mutex guarding all members
+        mutable std::mutex m_mutex;
+        /// refers to the entries ordered from most to least recently used
+        std::list<Entry> m_entries;
+        /// refers to the index mapping structural hashes to entries
+        std::unordered_multimap<u64, std::list<Entry>::iterator> m_index;
+        /// refers to the maximum number of entries
+        u64 m_capacity;
+        /// refers to whether the cache is enabled
+        bool m_enabled = true;
+        /// refers to the cache counters
+        Statistics m_statistics;
+    };
+}    // namespace hal
@@ -31,6 +31,32 @@ namespace hal
 {
     namespace SMT
     {
+        /**
+         * Represents the statistics collected while processing a batch of SMT queries.
+         * All times are given in milliseconds.
+         */
+        struct BatchStatistics final
+        {
+            /// The number of workers that processed the batch.
+            u32 workers = 0;
+            /// The number of queries in the batch.
+            u64 queries = 0;
+            /// The number of queries that did not yield a result within the timeout, i.e., that returned an unknown result.
+            u64 timeouts = 0;
+            /// The number of queries that failed with an error.
+            u64 errors = 0;
+            /// The time from submitting the batch until all queries have been processed.
+            double wall_time = 0;
+            /// The accumulated time queries waited for a free worker.
+            double total_queue_time = 0;
+            /// The longest time a single query waited for a free worker.
+            double max_queue_time = 0;
+            /// The accumulated time spent solving queries.
+            double total_solve_time = 0;
+            /// The longest time spent solving a single query.
+            double max_solve_time = 0;
+        };
+
         /**
 		 * Provides an interface to query SMT solvers for a list of constraints, i.e. 
 		 * statements that have to be equal. To this end, we translate constraints
@@ -95,6 +121,23 @@ namespace hal
 			 */
             Result<SolverResult> query(const QueryConfig& config = QueryConfig()) const;
 
+            /**
+             * Queries an SMT solver for each of the given constraint sets using a bounded pool of worker threads.
+             * The timeout of the query configuration applies to each query individually and the results are returned in the order of the constraint sets.
+             * When querying the linked Z3 library, each worker keeps a single solver session alive for all of its queries and resets it after each query.
+             * Hence, variables are declared per query and independent constraint sets may use the same variable name with different sizes.
+             *
+             * @param[in] constraint_sets - The independent constraint sets to query.
+             * @param[in] config - The SMT solver query configuration.
+             * @param[in] num_workers - The maximum number of workers, `0` to use one worker per hardware thread.
+             * @param[out] statistics - The (optional) statistics of the batch.
+             * @returns A vector containing the result of each query, either OK() and the result or Err().
+             */
+            static std::vector<Result<SolverResult>> query_batch(const std::vector<std::vector<Constraint>>& constraint_sets,
+                                                                 const QueryConfig& config   = QueryConfig(),
+                                                                 u32 num_workers             = 0,
+                                                                 BatchStatistics* statistics = nullptr);
+
             /**
 			 * Queries a local SMT solver with the specified query configuration.
 			 *
@@ -0,0 +1,231 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/types.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    namespace SMT
+    {
+        /**
+         * Provides a persistent, incremental interface to the linked Z3 library.
+         * 
+         * In contrast to the Solver, a session keeps a single solver instance alive across queries.
+         * Constraints are translated directly into the Z3 expression representation instead of SMT-LIB v2 strings
+         * and are asserted incrementally, so that learned facts and the internal bit-blasting state of the solver are
+         * retained between queries. Scopes can be opened and closed via push() and pop() to retract constraints again.
+         * Translated Boolean functions and variables are cached by the session and Z3 internally hash-conses all terms
+         * of its context, hence common sub-terms of consecutive queries are only translated and bit-blasted once.
+         * 
+         * The session honors the model generation and timeout settings of the query configuration, while the solver
+         * type and call are ignored since the session always uses the linked Z3 library in-process.
+         */
+        class NETLIST_API SolverSession final
+        {
+        public:
+            ////////////////////////////////////////////////////////////////////////
+            // Constructors, Destructors, Operators
+            ////////////////////////////////////////////////////////////////////////
+
+            /**
+             * Constructs a solver session with the specified query configuration.
+             *
+             * @param[in] config - The SMT solver query configuration.
+             */
+            explicit SolverSession(const QueryConfig& config = QueryConfig());
+
+            /**
+             * Destructs the solver session and releases the solver instance.
+             */
+            ~SolverSession();
+
+            /**
+             * Solver sessions cannot be copied, since each session owns its solver instance.
+             */
+            SolverSession(const SolverSession&) = delete;
+
+            /**
+             * Moves a solver session including its solver instance, its active constraints, and its caches.
+             *
+             * @param[in] other - The solver session to move from.
+             */
+            SolverSession(SolverSession&& other) = default;
+
+            /**
+             * Solver sessions cannot be copied, since each session owns its solver instance.
+             */
+            SolverSession& operator=(const SolverSession&) = delete;
+
+            /**
+             * Solver sessions cannot be move-assigned, since the cached terms of the replaced session would outlive its context.
+             */
+            SolverSession& operator=(SolverSession&&) = delete;
+
+            ////////////////////////////////////////////////////////////////////////
+            // Interface
+            ////////////////////////////////////////////////////////////////////////
+
+            /**
+             * Returns the query configuration of the session.
+             *
+             * @returns The query configuration.
+             */
+            const QueryConfig& get_config() const;
+
+            /**
+             * Adds a constraint to the current scope of the session.
+             * The constraint remains active until the scope is closed using pop().
+             * A variable name must always be used with the same size within a session.
+             *
+             * @param[in] constraint - The constraint.
+             * @returns Ok() on success, Err() otherwise.
+             */
+            Result<std::monostate> add_constraint(const Constraint& constraint);
+
+            /**
+             * Adds a vector of constraints to the current scope of the session.
+             * Either all constraints are added or, in case one of them cannot be translated, none of them.
+             *
+             * @param[in] constraints - The constraints.
+             * @returns Ok() on success, Err() otherwise.
+             */
+            Result<std::monostate> add_constraints(const std::vector<Constraint>& constraints);
+
+            /**
+             * Opens a new scope. All constraints added afterwards are retracted by the matching call to pop().
+             */
+            void push();
+
+            /**
+             * Closes the specified number of scopes and retracts all constraints that have been added within them.
+             *
+             * @param[in] levels - The number of scopes to close.
+             * @returns Ok() on success, Err() if fewer scopes are open.
+             */
+            Result<std::monostate> pop(u32 levels = 1);
+
+            /**
+             * Returns the number of currently open scopes.
+             *
+             * @returns The number of open scopes.
+             */
+            u32 get_scope_level() const;
+
+            /**
+             * Checks the satisfiability of all active constraints of the session.
+             * Additional assumptions are only considered for this query and are retracted afterwards.
+             *
+             * @param[in] assumptions - The (optional) constraints that are only active during this query.
+             * @returns OK() and the result on success, Err() otherwise.
+             */
+            Result<SolverResult> query(const std::vector<Constraint>& assumptions = {});
+
+            /**
+             * Removes all constraints and scopes from the session while keeping the solver instance alive.
+             * Declared variables and cached terms are discarded as well, so that variable names may be used with a different size afterwards.
+             */
+            void reset();
+
+            /**
+             * Returns the number of queries issued within this session.
+             *
+             * @returns The number of queries.
+             */
+            u64 get_query_count() const;
+
+            /**
+             * Returns the number of Boolean function translations that have been served from the term cache.
+             *
+             * @returns The number of cache hits.
+             */
+            u64 get_term_cache_hits() const;
+
+            /**
+             * Returns the number of Boolean function translations that had to be computed.
+             *
+             * @returns The number of cache misses.
+             */
+            u64 get_term_cache_misses() const;
+
+            /**
+             * Clears the cache of translated Boolean functions.
+             */
+            void clear_term_cache();
+
+        private:
+            ////////////////////////////////////////////////////////////////////////
+            // Member
+            ////////////////////////////////////////////////////////////////////////
+
+            /// refers to the query configuration of the session
+            QueryConfig m_config;
+            /// refers to the Z3 context owning all terms of the session
+            std::unique_ptr<z3::context> m_context;
+            /// refers to the incremental Z3 solver instance
+            std::unique_ptr<z3::solver> m_solver;
+            /// refers to the variables declared within the session indexed by name
+            std::map<std::string, z3::expr> m_variables;
+            /// refers to the cache of already translated Boolean functions
+            std::map<BooleanFunction, z3::expr> m_term_cache;
+            /// refers to the number of open scopes
+            u32 m_scope_level = 0;
+            /// refers to the number of queries
+            u64 m_query_count = 0;
+            /// refers to the number of term cache hits
+            u64 m_term_cache_hits = 0;
+            /// refers to the number of term cache misses
+            u64 m_term_cache_misses = 0;
+
+            ////////////////////////////////////////////////////////////////////////
+            // Internal Interface
+            ////////////////////////////////////////////////////////////////////////
+
+            /**
+             * Translates a Boolean function into a Z3 bit-vector expression of the session context.
+             *
+             * @param[in] function - The Boolean function.
+             * @returns OK() and the Z3 expression on success, Err() otherwise.
+             */
+            Result<z3::expr> translate(const BooleanFunction& function);
+
+            /**
+             * Translates a constraint into a Z3 Boolean expression of the session context.
+             *
+             * @param[in] constraint - The constraint.
+             * @returns OK() and the Z3 expression on success, Err() otherwise.
+             */
+            Result<z3::expr> translate(const Constraint& constraint);
+        };
+    }    // namespace SMT
+}    // namespace hal
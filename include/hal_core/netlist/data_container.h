@@ -26,7 +26,9 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/netlist/data_value.h"
 
+#include <atomic>
 #include <map>
 #include <tuple>
 #include <vector>
@@ -34,7 +36,9 @@
 namespace hal
 {
     /**
-     * Container to hold data that is associated with an entity.
+     * Container to hold data that is associated with an entity.<br>
+     * Categories, keys, and types are stored as interned symbols and values are stored as typed data values, see DataSymbol and DataValue.
+     * All entries are kept in a single vector sorted by category and key.
      *
      * @ingroup netlist
      */
@@ -46,6 +50,36 @@ namespace hal
          */
         DataContainer() = default;
 
+        /**
+         * Construct a copy of a data container, loading its deferred data entries beforehand.
+         *
+         * @param[in] other - The data container to copy.
+         */
+        DataContainer(const DataContainer& other);
+
+        /**
+         * Construct a data container from another one, loading its deferred data entries beforehand.
+         *
+         * @param[in] other - The data container to move from.
+         */
+        DataContainer(DataContainer&& other);
+
+        /**
+         * Replace the data entries of the container by a copy of the entries of another one, loading the deferred data entries of both containers beforehand.
+         *
+         * @param[in] other - The data container to copy.
+         * @returns The data container.
+         */
+        DataContainer& operator=(const DataContainer& other);
+
+        /**
+         * Replace the data entries of the container by the entries of another one, loading the deferred data entries of both containers beforehand.
+         *
+         * @param[in] other - The data container to move from.
+         * @returns The data container.
+         */
+        DataContainer& operator=(DataContainer&& other);
+
         virtual ~DataContainer() = default;
 
         /**
@@ -77,6 +111,18 @@ namespace hal
         */
         bool set_data(const std::string& category, const std::string& key, const std::string& data_type, const std::string& value, const bool log_with_info_level = false);
 
+        /**
+        * Add a typed data entry.<br>
+        * May overwrite an existing entry.
+        *
+        * @param[in] category - The data category.
+        * @param[in] key - The data key.
+        * @param[in] data_type - The data type.
+        * @param[in] value - The data value.
+        * @returns True on success, false otherwise.
+        */
+        bool set_data(const DataSymbol& category, const DataSymbol& key, const DataSymbol& data_type, DataValue value);
+
         /**
          * Determine whether an entry of given category and key exists.
          * 
@@ -95,6 +141,31 @@ namespace hal
          */
         std::tuple<std::string, std::string> get_data(const std::string& category, const std::string& key) const;
 
+        /**
+         * Get the typed value of the data entry specified by the given category and key.
+         *
+         * @param[in] category - The data category.
+         * @param[in] key - The data key.
+         * @returns The value on success, a nullptr if no such entry exists.
+         */
+        const DataValue* get_data_value(const DataSymbol& category, const DataSymbol& key) const;
+
+        /**
+         * Get the type of the data entry specified by the given category and key.
+         *
+         * @param[in] category - The data category.
+         * @param[in] key - The data key.
+         * @returns The type on success, the empty symbol if no such entry exists.
+         */
+        DataSymbol get_data_type(const DataSymbol& category, const DataSymbol& key) const;
+
+        /**
+         * Get the number of stored data entries.
+         *
+         * @returns The number of entries.
+         */
+        u32 get_num_data_entries() const;
+
         /**
          * Delete a data entry.
          *
@@ -106,11 +177,12 @@ namespace hal
         bool delete_data(const std::string& category, const std::string& key, const bool log_with_info_level = false);
 
         /**
-         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.
+         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.<br>
+         * The map is assembled on every call.
          *
          * @returns The stored data as a map.
          */
-        const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& get_data_map() const;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_data_map() const;
 
         /**
          * Overwrite the existing data with a new map from ((1) category, (2) key) to ((1) type, (2) value).
@@ -120,6 +192,45 @@ namespace hal
         void set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map);
 
     protected:
-        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
+        friend class Netlist;
+
+        struct DataEntry
+        {
+            DataSymbol category;
+            DataSymbol key;
+            DataSymbol type;
+            DataValue value;
+        };
+
+        // sorted by category and key
+        std::vector<DataEntry> m_data;
+
+        // set while the entries are yet to be loaded from file, see Netlist::defer_data
+        mutable std::atomic<bool> m_data_deferred = false;
+
+        std::vector<DataEntry>::const_iterator find_entry(const DataSymbol& category, const DataSymbol& key) const;
+
+        /**
+         * Load the deferred data entries of the container, called at most once before the entries are accessed for the first time.
+         */
+        virtual void load_deferred_data() const
+        {
+        }
+
+        /**
+         * Called after the data entries of the container have been changed.
+         */
+        virtual void notify_data_changed()
+        {
+        }
+
+    private:
+        void load_data() const
+        {
+            if (m_data_deferred)
+            {
+                load_deferred_data();
+            }
+        }
     };
 }    // namespace hal
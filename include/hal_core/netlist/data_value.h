@@ -0,0 +1,251 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/enums.h"
+
+#include <map>
+#include <optional>
+#include <string>
+
+namespace hal
+{
+    /**
+     * An interned string as used for the categories, keys, and types of data entries.<br>
+     * Every distinct string is stored only once for the lifetime of the process, hence symbols can be copied and compared in constant time.
+     * As symbols do not know which netlist they belong to, the symbol table is shared by all netlists and never shrinks.
+     * It is bounded by the number of distinct categories, keys, and types, which data entries of different objects largely share.
+     * Interning symbols is thread-safe, resolving a symbol to its string does not take a lock.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API DataSymbol
+    {
+    public:
+        /**
+         * Construct the symbol of the empty string.
+         */
+        DataSymbol() = default;
+
+        /**
+         * Construct the symbol of the given string, interning the string if it has not been interned before.
+         *
+         * @param[in] str - The string.
+         */
+        explicit DataSymbol(const std::string& str);
+
+        /**
+         * Get the symbol of the given string without interning it.
+         *
+         * @param[in] str - The string.
+         * @returns The symbol if the string has been interned before, an empty optional otherwise.
+         */
+        static std::optional<DataSymbol> find(const std::string& str);
+
+        /**
+         * Get the interned string.
+         *
+         * @returns The string.
+         */
+        const std::string& str() const;
+
+        /**
+         * Get the unique ID of the symbol.<br>
+         * IDs are assigned in the order in which strings are interned, the empty string has ID 0.
+         *
+         * @returns The ID.
+         */
+        u32 get_id() const
+        {
+            return m_id;
+        }
+
+        /**
+         * Check whether the symbol is the symbol of the empty string.
+         *
+         * @returns True if the symbol is empty, false otherwise.
+         */
+        bool empty() const
+        {
+            return m_id == 0;
+        }
+
+        bool operator==(const DataSymbol& other) const
+        {
+            return m_id == other.m_id;
+        }
+
+        bool operator!=(const DataSymbol& other) const
+        {
+            return m_id != other.m_id;
+        }
+
+        bool operator<(const DataSymbol& other) const
+        {
+            return m_id < other.m_id;
+        }
+
+    private:
+        u32 m_id = 0;
+    };
+
+    /**
+     * A typed data value.<br>
+     * Integers and hexadecimal bit-vectors are stored in binary form, strings are stored as is.
+     * Values of up to 8 characters or 16 hexadecimal digits are stored inline without allocating memory.
+     * Every value converts back to exactly the string it was created from.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API DataValue
+    {
+    public:
+        /**
+         * The representation of a data value.
+         */
+        enum class Kind : u8
+        {
+            string,
+            integer,
+            bit_vector
+        };
+
+        /**
+         * Construct an empty string value.
+         */
+        DataValue();
+
+        /**
+         * Construct a string value.
+         *
+         * @param[in] value - The string.
+         */
+        explicit DataValue(const std::string& value);
+
+        /**
+         * Construct an integer value.
+         *
+         * @param[in] value - The integer.
+         */
+        explicit DataValue(i64 value);
+
+        /**
+         * Parse a value given as string according to its data type.<br>
+         * Values of type 'integer' in canonical decimal notation are stored as integers and values of type 'bit_vector' consisting of either lower-case or upper-case hexadecimal digits are stored as bit-vectors.
+         * All other values are stored as strings.
+         *
+         * @param[in] data_type - The data type.
+         * @param[in] value - The value as string.
+         * @returns The value.
+         */
+        static DataValue from_string(const std::string& data_type, const std::string& value);
+
+        DataValue(const DataValue& other);
+        DataValue(DataValue&& other) noexcept;
+        DataValue& operator=(const DataValue& other);
+        DataValue& operator=(DataValue&& other) noexcept;
+        ~DataValue();
+
+        /**
+         * Check whether two values are equal, i.e., whether they convert to the same string.
+         *
+         * @param[in] other - The value to compare against.
+         * @returns True if both values are equal, false otherwise.
+         */
+        bool operator==(const DataValue& other) const;
+
+        /**
+         * Check whether two values are unequal.
+         *
+         * @param[in] other - The value to compare against.
+         * @returns True if both values are unequal, false otherwise.
+         */
+        bool operator!=(const DataValue& other) const;
+
+        /**
+         * Get the representation of the value.
+         *
+         * @returns The kind of the value.
+         */
+        Kind get_kind() const;
+
+        /**
+         * Get the integer of an integer value.
+         *
+         * @returns The integer, or 0 if the value is not an integer.
+         */
+        i64 get_integer() const;
+
+        /**
+         * Get the number of hexadecimal digits of a bit-vector value.
+         *
+         * @returns The number of digits, or 0 if the value is not a bit-vector.
+         */
+        u32 get_num_digits() const;
+
+        /**
+         * Get a hexadecimal digit of a bit-vector value.
+         *
+         * @param[in] index - The index of the digit, starting at the least significant digit.
+         * @returns The digit, or 0 if the value is not a bit-vector or the index is out of range.
+         */
+        u8 get_digit(u32 index) const;
+
+        /**
+         * Convert the value to the string it was created from.
+         *
+         * @returns The value as string.
+         */
+        std::string to_string() const;
+
+    private:
+        static constexpr u32 INLINE_CHARS  = 8;
+        static constexpr u32 INLINE_DIGITS = 16;
+
+        // number of characters of a string or number of digits of a bit-vector
+        u32 m_size = 0;
+        Kind m_kind;
+        bool m_upper_case = false;
+
+        union
+        {
+            i64 m_integer;
+            u64 m_digits;
+            char m_chars[INLINE_CHARS];
+            char* m_heap_chars;
+            u64* m_heap_digits;
+        };
+
+        bool is_inline() const;
+        u32 get_num_heap_words() const;
+        void copy_from(const DataValue& other);
+        void release();
+    };
+
+    template<>
+    std::map<DataValue::Kind, std::string> EnumStrings<DataValue::Kind>::data;
+}    // namespace hal
@@ -27,6 +27,7 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_snapshot.h"
 #include "hal_core/utilities/result.h"
 
 #include <optional>
@@ -233,6 +234,75 @@ namespace hal
         Result<std::set<Gate*>>
             get_next_combinational_gates(const Gate* gate, bool successors, const std::set<PinType>& forbidden_pins = {}, std::unordered_map<const Net*, std::set<Gate*>>* cache = nullptr) const;
 
+        /**
+         * Starting from the given net, traverse the connectivity snapshot and return only the next layer of sequential successor/predecessor gates.
+         * Traverse over gates that are not sequential until a sequential gate is found.
+         * Stop traversal at all sequential gates, but only adds those to the result that have not been reached through a pin of one of the forbidden types.
+         * Yields the same result as the netlist-based variant, but does not touch the netlist objects during traversal and may hence be called concurrently on a shared snapshot.
+         * 
+         * @param[in] snapshot - A snapshot of the netlist.
+         * @param[in] net - Start net.
+         * @param[in] successors - Set `true` to get successors, set `false` to get predecessors.
+         * @param[in] forbidden_pins - Sequential gates reached through these pins will not be part of the result.
+         * @returns The next sequential gates on success, an error otherwise.
+         */
+        Result<std::set<Gate*>> get_next_sequential_gates(const NetlistSnapshot& snapshot, const Net* net, bool successors, const std::set<PinType>& forbidden_pins = {}) const;
+
+        /**
+         * Starting from the given gate, traverse the connectivity snapshot and return only the next layer of sequential successor/predecessor gates.
+         * Traverse over gates that are not sequential until a sequential gate is found.
+         * Stop traversal at all sequential gates, but only adds those to the result that have not been reached through a pin of one of the forbidden types.
+         * Yields the same result as the netlist-based variant, but does not touch the netlist objects during traversal and may hence be called concurrently on a shared snapshot.
+         * 
+         * @param[in] snapshot - A snapshot of the netlist.
+         * @param[in] gate - Start gate.
+         * @param[in] successors - Set `true` to get successors, set `false` to get predecessors.
+         * @param[in] forbidden_pins - Sequential gates reached through these pins will not be part of the result.
+         * @returns The next sequential gates on success, an error otherwise.
+         */
+        Result<std::set<Gate*>> get_next_sequential_gates(const NetlistSnapshot& snapshot, const Gate* gate, bool successors, const std::set<PinType>& forbidden_pins = {}) const;
+
+        /**
+         * Get the next sequential gates for all sequential gates in the netlist by traversing the connectivity snapshot.
+         * Compute a map from a sequential gate to all its successors.
+         * Stop traversal at all sequential gates, but only adds those to the result that have not been reached through a pin of one of the forbidden types.
+         * The sequential gates are distributed across the given number of worker threads.
+         * 
+         * @param[in] snapshot - A snapshot of the netlist.
+         * @param[in] successors - Set `true` to get successors, set `false` to get predecessors.
+         * @param[in] forbidden_pins - Sequential gates reached through these pins will not be part of the result.
+         * @param[in] num_workers - The maximum number of worker threads, `0` to use one thread per hardware thread. Defaults to `0`.
+         * @returns A map from each sequential gate to all its sequential successors on success, an error otherwise.
+         */
+        Result<std::map<Gate*, std::set<Gate*>>>
+            get_next_sequential_gates_map(const NetlistSnapshot& snapshot, bool successors, const std::set<PinType>& forbidden_pins, u32 num_workers = 0) const;
+
+        /**
+         * Starting from the given net, traverse the connectivity snapshot and return all combinational successor/predecessor gates.
+         * Continue traversal as long as further combinational gates are found and stop at gates that are not combinational.
+         * All combinational gates found during traversal are added to the result.
+         * 
+         * @param[in] snapshot - A snapshot of the netlist.
+         * @param[in] net - Start net.
+         * @param[in] successors - Set `true` to get successors, set `false` to get predecessors.
+         * @param[in] forbidden_pins - Gates reached through these pins will not be part of the result.
+         * @returns The next combinational gates on success, an error otherwise.
+         */
+        Result<std::set<Gate*>> get_next_combinational_gates(const NetlistSnapshot& snapshot, const Net* net, bool successors, const std::set<PinType>& forbidden_pins = {}) const;
+
+        /**
+         * Starting from the given gate, traverse the connectivity snapshot and return all combinational successor/predecessor gates.
+         * Continue traversal as long as further combinational gates are found and stop at gates that are not combinational.
+         * All combinational gates found during traversal are added to the result.
+         * 
+         * @param[in] snapshot - A snapshot of the netlist.
+         * @param[in] gate - Start gate.
+         * @param[in] successors - Set `true` to get successors, set `false` to get predecessors.
+         * @param[in] forbidden_pins - Gates reached through these pins will not be part of the result.
+         * @returns The next combinational gates on success, an error otherwise.
+         */
+        Result<std::set<Gate*>> get_next_combinational_gates(const NetlistSnapshot& snapshot, const Gate* gate, bool successors, const std::set<PinType>& forbidden_pins = {}) const;
+
         /**
          * Find the length of shortest path (i.e., the result set with the lowest number of gates) that connects the start gate with the end gate. 
          * If there is no such path an empty optional is returned.
@@ -27,6 +27,7 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/boolean_function_dag.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/result.h"
 
@@ -141,6 +142,59 @@ namespace hal
          */
         Result<BooleanFunction> get_subgraph_function(const Module* subgraph_module, const Net* subgraph_output) const;
 
+        /**
+         * Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net as a node of a hash-consed DAG.
+         * In contrast to `get_subgraph_function`, the function of every gate is added to the DAG exactly once, so reconvergent logic does not blow up the size of the result.
+         * The variables of the resulting Boolean function are created from the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable`.
+         * Utilizes a cache for speedup on consecutive calls. The cache must only be used together with the same DAG.
+         * 
+         * @param[in] subgraph_gates - The gates making up the subgraph to consider.
+         * @param[in] subgraph_output - The subgraph oputput net for which to generate the Boolean function.
+         * @param[inout] dag - The DAG to add the Boolean function to.
+         * @param[inout] cache - Cache to speed up computations. The cache is filled by this function.
+         * @return The ID of the root node of the combined Boolean function within the DAG on success, an error otherwise.
+         */
+        Result<BooleanFunctionDAG::NodeId> get_subgraph_function_dag(const std::vector<const Gate*>& subgraph_gates,
+                                                                     const Net* subgraph_output,
+                                                                     BooleanFunctionDAG& dag,
+                                                                     std::map<std::pair<u32, const GatePin*>, BooleanFunctionDAG::NodeId>& cache) const;
+
+        /**
+         * Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net as a node of a hash-consed DAG.
+         * In contrast to `get_subgraph_function`, the function of every gate is added to the DAG exactly once, so reconvergent logic does not blow up the size of the result.
+         * The variables of the resulting Boolean function are created from the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable`.
+         * 
+         * @param[in] subgraph_gates - The gates making up the subgraph to consider.
+         * @param[in] subgraph_output - The subgraph oputput net for which to generate the Boolean function.
+         * @param[inout] dag - The DAG to add the Boolean function to.
+         * @return The ID of the root node of the combined Boolean function within the DAG on success, an error otherwise.
+         */
+        Result<BooleanFunctionDAG::NodeId> get_subgraph_function_dag(const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output, BooleanFunctionDAG& dag) const;
+
+        /**
+         * Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net as a node of a hash-consed DAG.
+         * In contrast to `get_subgraph_function`, the function of every gate is added to the DAG exactly once, so reconvergent logic does not blow up the size of the result.
+         * The variables of the resulting Boolean function are created from the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable`.
+         * 
+         * @param[in] subgraph_gates - The gates making up the subgraph to consider.
+         * @param[in] subgraph_output - The subgraph oputput net for which to generate the Boolean function.
+         * @param[inout] dag - The DAG to add the Boolean function to.
+         * @return The ID of the root node of the combined Boolean function within the DAG on success, an error otherwise.
+         */
+        Result<BooleanFunctionDAG::NodeId> get_subgraph_function_dag(const std::vector<Gate*>& subgraph_gates, const Net* subgraph_output, BooleanFunctionDAG& dag) const;
+
+        /**
+         * Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net as a node of a hash-consed DAG.
+         * In contrast to `get_subgraph_function`, the function of every gate is added to the DAG exactly once, so reconvergent logic does not blow up the size of the result.
+         * The variables of the resulting Boolean function are created from the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable`.
+         * 
+         * @param[in] subgraph_module - The module making up the subgraph to consider.
+         * @param[in] subgraph_output - The subgraph oputput net for which to generate the Boolean function.
+         * @param[inout] dag - The DAG to add the Boolean function to.
+         * @return The ID of the root node of the combined Boolean function within the DAG on success, an error otherwise.
+         */
+        Result<BooleanFunctionDAG::NodeId> get_subgraph_function_dag(const Module* subgraph_module, const Net* subgraph_output, BooleanFunctionDAG& dag) const;
+
         /**
          * Get the inputs of the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
          * This does not actually build the boolean function but only determines the inputs the subgraph function would have, which is a lot faster.
@@ -29,6 +29,8 @@
 #include "hal_core/utilities/enums.h"
 
 #include <iostream>
+#include <unordered_map>
+#include <vector>
 
 namespace hal
 {
@@ -142,9 +144,56 @@ namespace hal
     template<>
     std::map<GroupingEvent::event, std::string> EnumStrings<GroupingEvent::event>::data;
 
+    /**
+     * An event as delivered to batch callbacks.<br>
+     * While an event batch is in progress, all occurrences of the same event for the same object are coalesced into a single batched event that lists their associated data.
+     * Hence, subscribers should query the current state of the object instead of replaying the individual changes.
+     * The object of a `removed` event has already been deleted and must not be dereferenced, use the object ID instead.
+     */
+    template<typename EventType, typename ObjectType>
+    struct BatchedEvent
+    {
+        /// The event that occurred.
+        EventType event;
+
+        /// The affected object.
+        ObjectType* object;
+
+        /// The ID of the affected object.
+        u32 object_id;
+
+        /// The associated data of all coalesced occurrences in order of occurrence, with consecutive duplicates removed.
+        std::vector<u32> associated_data;
+    };
+
+    using NetlistBatchedEvent  = BatchedEvent<NetlistEvent::event, Netlist>;
+    using ModuleBatchedEvent   = BatchedEvent<ModuleEvent::event, Module>;
+    using GateBatchedEvent     = BatchedEvent<GateEvent::event, Gate>;
+    using NetBatchedEvent      = BatchedEvent<NetEvent::event, Net>;
+    using GroupingBatchedEvent = BatchedEvent<GroupingEvent::event, Grouping>;
+
     class EventHandler
     {
     private:
+        template<typename EventType, typename ObjectType>
+        class EventQueue
+        {
+        public:
+            void push(EventType ev, ObjectType* object, u32 object_id, u32 associated_data, bool created, bool removed);
+            std::vector<BatchedEvent<EventType, ObjectType>> take();
+
+        private:
+            struct PendingObject
+            {
+                bool created = false;
+                std::vector<u32> indices;
+            };
+
+            std::vector<BatchedEvent<EventType, ObjectType>> m_events;
+            std::vector<bool> m_cancelled;
+            std::unordered_map<const ObjectType*, PendingObject> m_objects;
+        };
+
         CallbackHook<void(NetlistEvent::event, Netlist*, u32)> m_netlist_callback;
         CallbackHook<void(ModuleEvent::event, Module*, u32)> m_module_callback;
         CallbackHook<void(GateEvent::event, Gate*, u32)> m_gate_callback;
@@ -156,6 +205,18 @@ namespace hal
         bool net_event_enabled;
         bool grouping_event_enabled;
 
+        CallbackHook<void(const std::vector<NetlistBatchedEvent>&)> m_netlist_batch_callback;
+        CallbackHook<void(const std::vector<ModuleBatchedEvent>&)> m_module_batch_callback;
+        CallbackHook<void(const std::vector<GateBatchedEvent>&)> m_gate_batch_callback;
+        CallbackHook<void(const std::vector<NetBatchedEvent>&)> m_net_batch_callback;
+        CallbackHook<void(const std::vector<GroupingBatchedEvent>&)> m_grouping_batch_callback;
+        EventQueue<NetlistEvent::event, Netlist> m_netlist_queue;
+        EventQueue<ModuleEvent::event, Module> m_module_queue;
+        EventQueue<GateEvent::event, Gate> m_gate_queue;
+        EventQueue<NetEvent::event, Net> m_net_queue;
+        EventQueue<GroupingEvent::event, Grouping> m_grouping_queue;
+        u32 m_batch_depth = 0;
+
     public:
         EventHandler();
 
@@ -253,11 +314,77 @@ namespace hal
         NETLIST_API void register_callback(const std::string& name, std::function<void(GroupingEvent::event e, Grouping* grouping, u32 associated_data)> function);
 
         /**
-         * Removes a callback function.
+         * Registers a batch callback function.<br>
+         * While an event batch is in progress, the function is called once with all coalesced events when the outermost batch ends, otherwise it is called for every single event.
+         *
+         * @param[in] name - name of the callback, used for callback removal.
+         * @param[in] function - The batch callback function.
+         */
+        NETLIST_API void register_batch_callback(const std::string& name, std::function<void(const std::vector<NetlistBatchedEvent>& events)> function);
+
+        /**
+         * Registers a batch callback function.<br>
+         * While an event batch is in progress, the function is called once with all coalesced events when the outermost batch ends, otherwise it is called for every single event.
+         *
+         * @param[in] name - name of the callback, used for callback removal.
+         * @param[in] function - The batch callback function.
+         */
+        NETLIST_API void register_batch_callback(const std::string& name, std::function<void(const std::vector<ModuleBatchedEvent>& events)> function);
+
+        /**
+         * Registers a batch callback function.<br>
+         * While an event batch is in progress, the function is called once with all coalesced events when the outermost batch ends, otherwise it is called for every single event.
+         *
+         * @param[in] name - name of the callback, used for callback removal.
+         * @param[in] function - The batch callback function.
+         */
+        NETLIST_API void register_batch_callback(const std::string& name, std::function<void(const std::vector<GateBatchedEvent>& events)> function);
+
+        /**
+         * Registers a batch callback function.<br>
+         * While an event batch is in progress, the function is called once with all coalesced events when the outermost batch ends, otherwise it is called for every single event.
+         *
+         * @param[in] name - name of the callback, used for callback removal.
+         * @param[in] function - The batch callback function.
+         */
+        NETLIST_API void register_batch_callback(const std::string& name, std::function<void(const std::vector<NetBatchedEvent>& events)> function);
+
+        /**
+         * Registers a batch callback function.<br>
+         * While an event batch is in progress, the function is called once with all coalesced events when the outermost batch ends, otherwise it is called for every single event.
+         *
+         * @param[in] name - name of the callback, used for callback removal.
+         * @param[in] function - The batch callback function.
+         */
+        NETLIST_API void register_batch_callback(const std::string& name, std::function<void(const std::vector<GroupingBatchedEvent>& events)> function);
+
+        /**
+         * Removes a callback function, including batch callback functions of that name.
          *
          * @param[in] name - name of the callback.
          */
         NETLIST_API void unregister_callback(const std::string& name);
 
+        /**
+         * Begins an event batch.<br>
+         * Per-event callbacks are still executed immediately, but the events for batch callbacks are queued per event type and coalesced until the outermost batch ends.
+         * Events of objects that are created and removed within the batch are dropped, and only the `removed` event remains for objects removed within the batch.
+         * Batches may be nested.
+         */
+        NETLIST_API void begin_batch();
+
+        /**
+         * Ends an event batch that has been started using `EventHandler::begin_batch`.<br>
+         * If this ends the outermost batch, the queued events are delivered to the batch callbacks, ordered by netlist, gate, net, module, and grouping events.
+         */
+        NETLIST_API void end_batch();
+
+        /**
+         * Check whether an event batch is in progress.
+         *
+         * @returns `true` if an event batch is in progress, `false` otherwise.
+         */
+        NETLIST_API bool is_batch_active() const;
+
     };    // class event_handler
 }    // namespace hal
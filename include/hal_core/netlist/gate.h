@@ -31,6 +31,7 @@
 #include "hal_core/netlist/endpoint.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/utilities/range.h"
 
 #include <functional>
 #include <map>
@@ -485,6 +486,60 @@ namespace hal
          */
         Endpoint* get_predecessor(const GatePin* pin) const;
 
+        /**
+         * Maps a fan-in endpoint of a gate to the source endpoints of the connected net.
+         */
+        struct NetSources
+        {
+            Range<std::vector<Endpoint*>::const_iterator> operator()(const Endpoint* ep) const;
+        };
+
+        /**
+         * Maps a fan-out endpoint of a gate to the destination endpoints of the connected net.
+         */
+        struct NetDestinations
+        {
+            Range<std::vector<Endpoint*>::const_iterator> operator()(const Endpoint* ep) const;
+        };
+
+        /**
+         * Adapts a filter on the gate's pin and a neighboring endpoint to the fan-in/fan-out endpoint of the gate and the neighboring endpoint.
+         */
+        template<typename Filter>
+        struct PinFilter
+        {
+            Filter filter;
+
+            template<typename E>
+            bool operator()(E* gate_ep, E* ep) const
+            {
+                return filter(gate_ep->get_pin(), ep);
+            }
+        };
+
+        /**
+         * Get a view on all direct predecessor endpoints of the gate that does not copy the endpoints.<br>
+         * Predecessors are visited in the order of the gate's fan-in endpoints and may contain the same endpoint multiple times if it drives multiple input pins of the gate.
+         * The view must not be used after the connections of the gate or its fan-in nets have been modified.
+         *
+         * @returns A range of predecessor endpoints.
+         */
+        FlattenedRange<std::vector<Endpoint*>::const_iterator, NetSources, AcceptAll> get_predecessors_view() const;
+
+        /**
+         * Get a view on all direct predecessor endpoints of the gate that does not copy the endpoints.<br>
+         * The filter is evaluated lazily during iteration such that the range only contains the endpoints matching the specified condition.
+         * The view must not be used after the connections of the gate or its fan-in nets have been modified.
+         *
+         * @param[in] filter - A filter callable as `bool(const GatePin* pin, Endpoint* ep)`, evaluated on the gate's input pin as well as the predecessor endpoint.
+         * @returns A filtered range of predecessor endpoints.
+         */
+        template<typename Filter>
+        FlattenedRange<std::vector<Endpoint*>::const_iterator, NetSources, PinFilter<Filter>> get_predecessors_view(Filter filter) const
+        {
+            return FlattenedRange<std::vector<Endpoint*>::const_iterator, NetSources, PinFilter<Filter>>(m_in_endpoints.begin(), m_in_endpoints.end(), NetSources(), PinFilter<Filter>{std::move(filter)});
+        }
+
         /**
          * Get a vector of all unique successor gates of the gate. 
          * The optional filter is evaluated on every candidate such that the result only contains those matching the specified condition.
@@ -521,6 +576,29 @@ namespace hal
          */
         Endpoint* get_successor(const GatePin* pin) const;
 
+        /**
+         * Get a view on all direct successor endpoints of the gate that does not copy the endpoints.<br>
+         * Successors are visited in the order of the gate's fan-out endpoints.
+         * The view must not be used after the connections of the gate or its fan-out nets have been modified.
+         *
+         * @returns A range of successor endpoints.
+         */
+        FlattenedRange<std::vector<Endpoint*>::const_iterator, NetDestinations, AcceptAll> get_successors_view() const;
+
+        /**
+         * Get a view on all direct successor endpoints of the gate that does not copy the endpoints.<br>
+         * The filter is evaluated lazily during iteration such that the range only contains the endpoints matching the specified condition.
+         * The view must not be used after the connections of the gate or its fan-out nets have been modified.
+         *
+         * @param[in] filter - A filter callable as `bool(const GatePin* pin, Endpoint* ep)`, evaluated on the gate's output pin as well as the successor endpoint.
+         * @returns A filtered range of successor endpoints.
+         */
+        template<typename Filter>
+        FlattenedRange<std::vector<Endpoint*>::const_iterator, NetDestinations, PinFilter<Filter>> get_successors_view(Filter filter) const
+        {
+            return FlattenedRange<std::vector<Endpoint*>::const_iterator, NetDestinations, PinFilter<Filter>>(m_out_endpoints.begin(), m_out_endpoints.end(), NetDestinations(), PinFilter<Filter>{std::move(filter)});
+        }
+
         /**
          * Get the INIT data of the gate, if available. 
          * An error is returned in case the gate does not hold any INIT data.
@@ -549,6 +627,9 @@ namespace hal
 
         BooleanFunction get_lut_function(const GatePin* pin) const;
 
+        void load_deferred_data() const override;
+        void notify_data_changed() override;
+
         /* pointer to corresponding netlist parent */
         NetlistInternalManager* m_internal_manager;
 
@@ -29,6 +29,7 @@ namespace hal
 {
     /**
      * A set of available properties for a gate type.
+     * New properties must be inserted before `c_lut`, which has to remain the last property as NetlistSnapshot packs all properties into a 64-bit mask.
      */
     enum class GateTypeProperty
     {
@@ -28,6 +28,7 @@
 #include "hal_core/netlist/boolean_function.h"
 #include "hal_core/netlist/gate_library/enums/gate_type_property.h"
 #include "hal_core/netlist/gate_library/gate_type_component/gate_type_component.h"
+#include "hal_core/netlist/id_allocator.h"
 #include "hal_core/netlist/pins/gate_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
@@ -453,12 +454,8 @@ namespace hal
         std::unique_ptr<GateTypeComponent> m_component;
 
         // pins
-        u32 m_next_pin_id;
-        std::set<u32> m_used_pin_ids;
-        std::set<u32> m_free_pin_ids;
-        u32 m_next_pin_group_id;
-        std::set<u32> m_used_pin_group_ids;
-        std::set<u32> m_free_pin_group_ids;
+        IdAllocator m_pin_ids;
+        IdAllocator m_pin_group_ids;
 
         std::vector<std::unique_ptr<GatePin>> m_pins;
         std::unordered_map<u32, GatePin*> m_pins_map;
@@ -0,0 +1,182 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <set>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * An IdAllocator keeps track of the IDs used by one kind of netlist object, e.g., the gates of a netlist or the pins of a module.
+     * 
+     * Used and freed IDs are stored in paged bitmaps, so marking an ID as used or free does not allocate memory as long as 
+     * its page already exists and only touches a single word.
+     * Freed IDs are additionally kept in a min-heap, so the smallest freed ID can be handed out again in logarithmic time.
+     * Heap entries that were reused in the meantime are discarded lazily.
+     * 
+     * IDs are handed out with the same semantics as the former set-based bookkeeping: the smallest freed ID is reused first, 
+     * otherwise the next ID following the highest ID handed out so far is returned.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API IdAllocator final
+    {
+    public:
+        ////////////////////////////////////////////////////////////////////////
+        // Constructors, Destructors, Operators
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Constructs an allocator without any used IDs that starts handing out IDs at 1.
+         */
+        IdAllocator() = default;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Interface
+        ////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Get an ID that is currently unused.
+         * The ID is not marked as used until it is reserved.
+         * 
+         * @returns The smallest freed ID if there is one, the next unused ID otherwise.
+         */
+        u32 get_unique_id();
+
+        /**
+         * Check whether an ID is currently used.
+         * 
+         * @param[in] id - The ID.
+         * @returns `true` if the ID is used, `false` otherwise.
+         */
+        bool is_used(u32 id) const;
+
+        /**
+         * Mark an ID as used.
+         * 
+         * @param[in] id - The ID.
+         * @returns `true` on success, `false` if the ID was already in use.
+         */
+        bool reserve(u32 id);
+
+        /**
+         * Mark an ID as unused and remember it for reuse.
+         * 
+         * @param[in] id - The ID.
+         * @returns `true` on success, `false` if the ID was not in use.
+         */
+        bool release(u32 id);
+
+        /**
+         * Get the ID following the highest ID handed out so far.
+         * 
+         * @returns The next ID.
+         */
+        u32 get_next_id() const;
+
+        /**
+         * Set the ID following the highest ID handed out so far.
+         * 
+         * @param[in] id - The next ID.
+         */
+        void set_next_id(u32 id);
+
+        /**
+         * Get the number of used IDs.
+         * 
+         * @returns The number of used IDs.
+         */
+        u32 get_num_used_ids() const;
+
+        /**
+         * Get all currently used IDs.
+         * 
+         * @returns The used IDs.
+         */
+        std::set<u32> get_used_ids() const;
+
+        /**
+         * Replace the set of currently used IDs.
+         * 
+         * @param[in] ids - The used IDs.
+         */
+        void set_used_ids(const std::set<u32>& ids);
+
+        /**
+         * Get all IDs that have previously been used but been freed ever since.
+         * 
+         * @returns The freed IDs.
+         */
+        std::set<u32> get_free_ids() const;
+
+        /**
+         * Replace the set of IDs that have previously been used but been freed ever since.
+         * 
+         * @param[in] ids - The freed IDs.
+         */
+        void set_free_ids(const std::set<u32>& ids);
+
+    private:
+        /**
+         * A bitmap that allocates its words in pages on first write, so that sparse high IDs do not require dense storage of all lower IDs.
+         */
+        class PagedBitmap
+        {
+        public:
+            bool test(u32 index) const;
+            bool set(u32 index);
+            bool reset(u32 index);
+            void clear();
+            std::set<u32> to_set() const;
+
+        private:
+            /// The number of bits of a page.
+            static constexpr u32 PAGE_BITS = 1 << 16;
+
+            /// refers to the pages of the bitmap, empty pages have not been written yet
+            std::vector<std::vector<u64>> m_pages;
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Member
+        ////////////////////////////////////////////////////////////////////////
+
+        /// refers to the ID following the highest ID handed out so far
+        u32 m_next_id = 1;
+        /// refers to the number of used IDs
+        u32 m_num_used = 0;
+        /// refers to the bitmap of used IDs
+        PagedBitmap m_used;
+        /// refers to the bitmap of freed IDs
+        PagedBitmap m_free;
+        /// refers to the number of freed IDs
+        u32 m_num_free = 0;
+        /// refers to a min-heap of freed IDs that may contain stale entries for IDs that have been reused
+        std::vector<u32> m_free_heap;
+    };
+}    // namespace hal
@@ -0,0 +1,181 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * An IdIndex stores non-owning pointers to netlist objects in a dense vector and maps object IDs to their position in that vector.
+     * 
+     * The mapping is a paged table indexed by ID, so lookups by ID are two array accesses and sparse high IDs only allocate the 
+     * pages they fall into.
+     * Removing an object moves the last object into its position, i.e., the order of the vector is not preserved.
+     *
+     * @ingroup netlist
+     */
+    template<typename T>
+    class IdIndex final
+    {
+    public:
+        using const_iterator = typename std::vector<T*>::const_iterator;
+
+        /**
+         * Get the object with the given ID.
+         * 
+         * @param[in] id - The ID.
+         * @returns The object, or a `nullptr` if there is no object with that ID.
+         */
+        T* get(u32 id) const
+        {
+            const u32 page = id / PAGE_SIZE;
+            if (page >= m_positions.size() || m_positions[page] == nullptr)
+            {
+                return nullptr;
+            }
+            const u32 position = m_positions[page][id % PAGE_SIZE];
+            return (position == INVALID_POSITION) ? nullptr : m_objects[position];
+        }
+
+        /**
+         * Reserve storage for the given number of objects.
+         *
+         * @param[in] size - The number of objects.
+         */
+        void reserve(u64 size)
+        {
+            m_objects.reserve(size);
+            m_ids.reserve(size);
+        }
+
+        /**
+         * Add an object under the given ID.
+         * Any object previously stored under that ID is replaced.
+         * 
+         * @param[in] id - The ID.
+         * @param[in] object - The object.
+         */
+        void insert(u32 id, T* object)
+        {
+            u32& position = position_of(id);
+            if (position != INVALID_POSITION)
+            {
+                m_objects[position] = object;
+                return;
+            }
+            position = m_objects.size();
+            m_objects.push_back(object);
+            m_ids.push_back(id);
+        }
+
+        /**
+         * Remove the object with the given ID.
+         * 
+         * @param[in] id - The ID.
+         * @returns `true` if an object was removed, `false` if there was no object with that ID.
+         */
+        bool erase(u32 id)
+        {
+            if (get(id) == nullptr)
+            {
+                return false;
+            }
+            u32& position        = position_of(id);
+            const u32 last_id    = m_ids.back();
+            m_objects[position]  = m_objects.back();
+            m_ids[position]      = last_id;
+            position_of(last_id) = position;
+            position             = INVALID_POSITION;
+            m_objects.pop_back();
+            m_ids.pop_back();
+            return true;
+        }
+
+        /**
+         * Get all objects.
+         * 
+         * @returns A vector of objects.
+         */
+        const std::vector<T*>& get_objects() const
+        {
+            return m_objects;
+        }
+
+        /**
+         * Get the number of objects.
+         * 
+         * @returns The number of objects.
+         */
+        u64 size() const
+        {
+            return m_objects.size();
+        }
+
+        const_iterator begin() const
+        {
+            return m_objects.begin();
+        }
+
+        const_iterator end() const
+        {
+            return m_objects.end();
+        }
+
+    private:
+        /// The number of IDs per page of the position table.
+        static constexpr u32 PAGE_SIZE = 1 << 14;
+
+        /// Marks an ID without object.
+        static constexpr u32 INVALID_POSITION = std::numeric_limits<u32>::max();
+
+        u32& position_of(u32 id)
+        {
+            const u32 page = id / PAGE_SIZE;
+            if (page >= m_positions.size())
+            {
+                m_positions.resize(page + 1);
+            }
+            if (m_positions[page] == nullptr)
+            {
+                m_positions[page] = std::make_unique<u32[]>(PAGE_SIZE);
+                std::fill_n(m_positions[page].get(), PAGE_SIZE, INVALID_POSITION);
+            }
+            return m_positions[page][id % PAGE_SIZE];
+        }
+
+        /// refers to the objects
+        std::vector<T*> m_objects;
+        /// refers to the ID of each object
+        std::vector<u32> m_ids;
+        /// refers to the pages of the table mapping IDs to positions within the object vector
+        std::vector<std::unique_ptr<u32[]>> m_positions;
+    };
+}    // namespace hal
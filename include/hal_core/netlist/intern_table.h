@@ -0,0 +1,163 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace hal
+{
+    /**
+     * An InternTable assigns a unique and stable 32-bit ID to every distinct value, so that values can be stored and compared by their ID.
+     *
+     * IDs are assigned in the order in which values are interned, starting at 0.
+     * Values are never removed, so the table grows with the number of distinct values interned over its lifetime and references
+     * to interned values stay valid until the table is destroyed.
+     * Interning and searching a value takes a shared lock and, only for values that have not been interned before, an exclusive lock.
+     * Resolving an ID to its value does not lock at all, since the values are referenced from chunks that are never moved once published.
+     *
+     * @ingroup netlist
+     */
+    template<typename T, typename Hash = std::hash<T>>
+    class InternTable final
+    {
+    public:
+        /// The number of values referenced by the first chunk, each following chunk references twice as many values as its predecessor.
+        static constexpr u64 FIRST_CHUNK_SIZE = 1024;
+
+        /**
+         * Constructs an empty table.
+         */
+        InternTable() = default;
+
+        /**
+         * Destructs the table and all interned values.
+         */
+        ~InternTable()
+        {
+            for (auto& chunk : m_chunks)
+            {
+                delete[] chunk.load(std::memory_order_relaxed);
+            }
+        }
+
+        InternTable(const InternTable&)            = delete;
+        InternTable(InternTable&&)                 = delete;
+        InternTable& operator=(const InternTable&) = delete;
+        InternTable& operator=(InternTable&&)      = delete;
+
+        /**
+         * Get the ID of a value, interning the value if it has not been interned before.
+         *
+         * @param[in] value - The value.
+         * @returns The ID of the value.
+         */
+        u32 intern(const T& value)
+        {
+            if (const auto id = find(value); id.has_value())
+            {
+                return id.value();
+            }
+
+            std::unique_lock lock(m_mutex);
+            const auto [it, inserted] = m_ids.emplace(value, static_cast<u32>(m_ids.size()));
+            if (inserted)
+            {
+                const auto [chunk_index, offset] = locate(it->second);
+                const T** chunk                  = m_chunks[chunk_index].load(std::memory_order_relaxed);
+                if (chunk == nullptr)
+                {
+                    chunk = new const T*[FIRST_CHUNK_SIZE << chunk_index];
+                    m_chunks[chunk_index].store(chunk, std::memory_order_release);
+                }
+                // keys of an unordered_map are never moved, so the pointer stays valid across rehashing
+                chunk[offset] = &it->first;
+            }
+            return it->second;
+        }
+
+        /**
+         * Get the ID of a value without interning it.
+         *
+         * @param[in] value - The value.
+         * @returns The ID if the value has been interned before, an empty optional otherwise.
+         */
+        std::optional<u32> find(const T& value) const
+        {
+            std::shared_lock lock(m_mutex);
+            if (const auto it = m_ids.find(value); it != m_ids.end())
+            {
+                return it->second;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Get the value of an ID that has been returned by `intern`.
+         *
+         * @param[in] id - The ID.
+         * @returns The interned value.
+         */
+        const T& get(u32 id) const
+        {
+            const auto [chunk_index, offset] = locate(id);
+            return *m_chunks[chunk_index].load(std::memory_order_acquire)[offset];
+        }
+
+        /**
+         * Get the number of interned values.
+         *
+         * @returns The number of values.
+         */
+        u32 size() const
+        {
+            std::shared_lock lock(m_mutex);
+            return m_ids.size();
+        }
+
+    private:
+        /// 32-bit IDs are covered by chunks of 2^10 to 2^32 values
+        static constexpr u32 NUM_CHUNKS = 23;
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<T, u32, Hash> m_ids;
+        std::array<std::atomic<const T**>, NUM_CHUNKS> m_chunks = {};
+
+        static std::pair<u32, u64> locate(u32 id)
+        {
+            const u64 position = u64(id) + FIRST_CHUNK_SIZE;
+            const u32 msb      = 63 - __builtin_clzll(position);
+            return {msb - 10, position - (u64(1) << msb)};
+        }
+    };
+}    // namespace hal
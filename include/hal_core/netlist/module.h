@@ -32,9 +32,11 @@
 #include "hal_core/netlist/gate_library/enums/pin_type.h"
 #include "hal_core/netlist/gate_library/enums/pin_event.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/id_allocator.h"
 #include "hal_core/netlist/pins/module_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
+#include "hal_core/utilities/range.h"
 #include "hal_core/utilities/result.h"
 
 #include <functional>
@@ -681,6 +683,89 @@ namespace hal
          */
         std::vector<Gate*> get_gates(const std::function<bool(Gate*)>& filter, bool recursive = false) const;
 
+        /**
+         * Iterates over the gates of a module and, if requested, the gates of all its submodules.<br>
+         * Modules are visited in depth-first pre-order, i.e., in the same order as returned by `Module::get_gates`.
+         * The iterator navigates using the parent of each module and therefore does not allocate memory.
+         */
+        class NETLIST_API GateIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = Gate*;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = Gate* const*;
+            using reference         = Gate* const&;
+
+            GateIterator(const Module* root, const Module* current, bool recursive);
+
+            reference operator*() const
+            {
+                return m_current->m_gates[m_index];
+            }
+
+            GateIterator& operator++()
+            {
+                if (++m_index >= m_current->m_gates.size())
+                {
+                    skip_exhausted();
+                }
+                return *this;
+            }
+
+            GateIterator operator++(int)
+            {
+                GateIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const GateIterator& other) const
+            {
+                return m_current == other.m_current && m_index == other.m_index;
+            }
+
+            bool operator!=(const GateIterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            void skip_exhausted();
+            const Module* next_module(const Module* module) const;
+
+            const Module* m_root;
+            const Module* m_current;
+            u32 m_index = 0;
+            bool m_recursive;
+        };
+
+        /**
+         * Get a view on the gates contained within the module that does not copy the gates.<br>
+         * If `recursive` is `true`, gates in submodules are considered as well.
+         * The view must not be used after gates have been assigned to or removed from the module or its submodules.
+         *
+         * @param[in] recursive - Set to `true` to also consider gates in submodules, `false` otherwise. Defaults to `false`.
+         * @returns A range of gates.
+         */
+        Range<GateIterator> get_gates_view(bool recursive = false) const;
+
+        /**
+         * Get a view on the gates contained within the module that does not copy the gates.<br>
+         * The filter is evaluated lazily during iteration such that the range only contains the gates matching the specified condition.
+         * If `recursive` is `true`, gates in submodules are considered as well.
+         * The view must not be used after gates have been assigned to or removed from the module or its submodules.
+         *
+         * @param[in] filter - A filter callable as `bool(Gate* gate)`.
+         * @param[in] recursive - Set to `true` to also consider gates in submodules, `false` otherwise. Defaults to `false`.
+         * @returns A filtered range of gates.
+         */
+        template<typename Filter>
+        FilteredRange<GateIterator, Filter> get_gates_view(Filter filter, bool recursive = false) const
+        {
+            return FilteredRange<GateIterator, Filter>(GateIterator(this, this, recursive), GateIterator(this, nullptr, recursive), std::move(filter));
+        }
+
         /**
          * Get the event handler connected to module
          * @return The event handler;
@@ -702,6 +787,12 @@ namespace hal
             bool has_external_destination;
         };
 
+        struct NetEndpointCounts
+        {
+            u32 num_sources      = 0;
+            u32 num_destinations = 0;
+        };
+
         std::string m_name;
         std::string m_type;
 
@@ -714,14 +805,12 @@ namespace hal
         Module* m_parent;
         std::unordered_map<u32, Module*> m_submodules_map;
         std::vector<Module*> m_submodules;
+        /// position of the module within the submodules of its parent, allows to advance to the next sibling in constant time
+        u32 m_submodule_index = 0;
 
         // pins
-        u32 m_next_pin_id;
-        std::set<u32> m_used_pin_ids;
-        std::set<u32> m_free_pin_ids;
-        u32 m_next_pin_group_id;
-        std::set<u32> m_used_pin_group_ids;
-        std::set<u32> m_free_pin_group_ids;
+        IdAllocator m_pin_ids;
+        IdAllocator m_pin_group_ids;
 
         u32 m_next_input_index  = 0;
         u32 m_next_inout_index  = 0;
@@ -744,9 +833,14 @@ namespace hal
         std::unordered_set<Net*> m_output_nets;
         std::unordered_set<Net*> m_internal_nets;
 
+        /* number of sources and destinations of each net at gates of the module or its submodules, not maintained for the top module */
+        std::unordered_map<Net*, NetEndpointCounts> m_net_endpoint_counts;
+
         EventHandler* m_event_handler;
 
-        NetConnectivity check_net_endpoints(const Net* net) const;
+        void notify_data_changed() override;
+        void count_net_endpoints(Net* net, i32 num_sources, i32 num_destinations);
+        NetConnectivity check_net_endpoints(Net* net) const;
         Result<std::monostate> check_net(Net* net, bool recursive = false);
         bool assign_pin_net(const u32 pin_id, Net* net, PinDirection direction);
         bool remove_pin_net(Net* net);
@@ -0,0 +1,128 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A NameIndex maps names to the IDs of the netlist objects carrying that name.<br>
+     * Besides exact lookups, the index answers wildcard pattern queries using a trigram index, i.e., a map from every three-character substring to the names containing it.
+     * A pattern may contain `*` to match any sequence of characters and `?` to match any single character, e.g., `*reg*` finds all names containing `reg`.
+     * Patterns containing at least three consecutive literal characters are answered by only checking the names that contain all trigrams of the least frequent literal, all other patterns check every name.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NameIndex final
+    {
+    public:
+        /**
+         * Add an object to the index.
+         *
+         * @param[in] id - The ID of the object.
+         * @param[in] name - The name of the object.
+         */
+        void insert(u32 id, const std::string& name);
+
+        /**
+         * Remove an object from the index.
+         *
+         * @param[in] id - The ID of the object.
+         * @returns `true` if the object was removed, `false` if it was not part of the index.
+         */
+        bool erase(u32 id);
+
+        /**
+         * Change the name of an object within the index.
+         *
+         * @param[in] id - The ID of the object.
+         * @param[in] name - The new name of the object.
+         */
+        void rename(u32 id, const std::string& name);
+
+        /**
+         * Remove all objects from the index.
+         */
+        void clear();
+
+        /**
+         * Get the IDs of all objects with the given name.
+         *
+         * @param[in] name - The name.
+         * @returns A vector of object IDs in no particular order.
+         */
+        std::vector<u32> find(const std::string& name) const;
+
+        /**
+         * Get the IDs of all objects with a name matching the given wildcard pattern.
+         *
+         * @param[in] pattern - The pattern.
+         * @returns A vector of object IDs in no particular order.
+         */
+        std::vector<u32> find_pattern(const std::string& pattern) const;
+
+        /**
+         * Get the number of objects within the index.
+         *
+         * @returns The number of objects.
+         */
+        u64 size() const;
+
+        /**
+         * Check whether a name matches a wildcard pattern, where `*` matches any sequence of characters and `?` matches any single character.
+         *
+         * @param[in] pattern - The pattern.
+         * @param[in] name - The name.
+         * @returns `true` if the name matches the pattern, `false` otherwise.
+         */
+        static bool matches_pattern(const std::string& pattern, const std::string& name);
+
+    private:
+        static constexpr u32 INVALID_NAME = std::numeric_limits<u32>::max();
+
+        u32 add_name(const std::string& name);
+        void compact();
+
+        /// maps every distinct name to its position in the name vectors
+        std::unordered_map<std::string, u32> m_name_indices;
+        /// refers to the key of every name within the name map
+        std::vector<const std::string*> m_names;
+        /// refers to the IDs of the objects carrying every name
+        std::vector<std::vector<u32>> m_objects;
+        /// refers to the name of every object by object ID
+        std::vector<u32> m_name_of;
+        /// maps trigrams to the names containing them, names without objects are only removed on compaction
+        std::unordered_map<u32, std::vector<u32>> m_trigrams;
+
+        u64 m_num_objects     = 0;
+        u32 m_num_empty_names = 0;
+    };
+}    // namespace hal
@@ -30,6 +30,7 @@
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/pins/gate_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
+#include "hal_core/utilities/range.h"
 #include "hal_core/utilities/result.h"
 
 #include <functional>
@@ -226,6 +227,28 @@ namespace hal
          */
         std::vector<Endpoint*> get_sources(const std::function<bool(Endpoint* ep)>& filter = nullptr) const;
 
+        /**
+         * Get a view on the sources of the net that does not copy the endpoints.<br>
+         * The view must not be used after the sources of the net have been modified.
+         *
+         * @returns A range of source endpoints.
+         */
+        Range<std::vector<Endpoint*>::const_iterator> get_sources_view() const;
+
+        /**
+         * Get a view on the sources of the net that does not copy the endpoints.<br>
+         * The filter is evaluated lazily during iteration such that the range only contains the endpoints matching the specified condition.
+         * The view must not be used after the sources of the net have been modified.
+         *
+         * @param[in] filter - A filter callable as `bool(Endpoint* ep)`.
+         * @returns A filtered range of source endpoints.
+         */
+        template<typename Filter>
+        FilteredRange<std::vector<Endpoint*>::const_iterator, Filter> get_sources_view(Filter filter) const
+        {
+            return FilteredRange<std::vector<Endpoint*>::const_iterator, Filter>(m_sources_raw.begin(), m_sources_raw.end(), std::move(filter));
+        }
+
         /*
          *      dst specific functions
          */
@@ -336,6 +359,28 @@ namespace hal
          */
         std::vector<Endpoint*> get_destinations(const std::function<bool(Endpoint* ep)>& filter = nullptr) const;
 
+        /**
+         * Get a view on the destinations of the net that does not copy the endpoints.<br>
+         * The view must not be used after the destinations of the net have been modified.
+         *
+         * @returns A range of destination endpoints.
+         */
+        Range<std::vector<Endpoint*>::const_iterator> get_destinations_view() const;
+
+        /**
+         * Get a view on the destinations of the net that does not copy the endpoints.<br>
+         * The filter is evaluated lazily during iteration such that the range only contains the endpoints matching the specified condition.
+         * The view must not be used after the destinations of the net have been modified.
+         *
+         * @param[in] filter - A filter callable as `bool(Endpoint* ep)`.
+         * @returns A filtered range of destination endpoints.
+         */
+        template<typename Filter>
+        FilteredRange<std::vector<Endpoint*>::const_iterator, Filter> get_destinations_view(Filter filter) const
+        {
+            return FilteredRange<std::vector<Endpoint*>::const_iterator, Filter>(m_destinations_raw.begin(), m_destinations_raw.end(), std::move(filter));
+        }
+
         /**
          * Check whether the net is unrouted, i.e., it has no source or no destination.
          *
@@ -401,6 +446,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistSnapshot;
         explicit Net(NetlistInternalManager* internal_manager, EventHandler* event_handler, const u32 id, const std::string& name = "");
 
         Net(const Net&)            = delete;
@@ -408,6 +454,9 @@ namespace hal
         Net& operator=(const Net&) = delete;
         Net& operator=(Net&&)      = delete;
 
+        void load_deferred_data() const override;
+        void notify_data_changed() override;
+
         NetlistInternalManager* m_internal_manager;
 
         /* stores the id of the net */
@@ -419,9 +468,7 @@ namespace hal
         /* grouping */
         Grouping* m_grouping = nullptr;
 
-        /* stores the dst gate and pin id of the dst gate */
-        std::vector<std::unique_ptr<Endpoint>> m_destinations;
-        std::vector<std::unique_ptr<Endpoint>> m_sources;
+        /* stores the dst gate and pin id of the dst gate, endpoints are owned by the object pool of the internal manager */
         std::vector<Endpoint*> m_destinations_raw;
         std::vector<Endpoint*> m_sources_raw;
 
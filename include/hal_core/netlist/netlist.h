@@ -28,9 +28,15 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/id_allocator.h"
+#include "hal_core/netlist/id_index.h"
+#include "hal_core/utilities/range.h"
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -46,9 +52,15 @@ namespace hal
     class Module;
     class Grouping;
     class Endpoint;
+    class NameIndex;
+    class DataContainer;
 
     /**
-     * Netlist class containing information about the netlist including its gates, modules, nets, and groupings as well as the underlying gate library.
+     * Netlist class containing information about the netlist including its gates, modules, nets, and groupings as well as the underlying gate library.<br>
+     * All const member functions of the netlist and its gates, nets, modules, and groupings, including the computation of Boolean functions, may be called from multiple threads at the same time, as long as the netlist is not modified concurrently.
+     * Modifications require exclusive access. Threads that read the netlist while another thread may modify it have to hold the shared lock returned by `Netlist::acquire_read_lock`, and the modifying thread has to hold the exclusive lock returned by `Netlist::acquire_write_lock`.
+     * These locks are advisory: no member function acquires them on its own, hence they only exclude each other for threads that all follow this protocol.
+     * Loading deferred modules and groupings on first access is an exception to the read-only const functions, see `Netlist::defer_modules`.
      *
      * @ingroup netlist
      */
@@ -150,11 +162,13 @@ namespace hal
         const GateLibrary* get_gate_library() const;
 
         /**
-         * Create a deep copy of the netlist.
+         * Create a deep copy of the netlist.<br>
+         * The gates and nets of the netlist can be copied by multiple threads.
          * 
+         * @param[in] num_workers - The maximum number of threads used to copy the netlist, `0` to use one thread per hardware thread. Defaults to `1`.
          * @returns The copy of the netlist on success, an error otherwise.
          */
-        Result<std::unique_ptr<Netlist>> copy() const;
+        Result<std::unique_ptr<Netlist>> copy(u32 num_workers = 1) const;
 
         /*
          * ################################################################
@@ -234,6 +248,39 @@ namespace hal
          */
         std::vector<Gate*> get_gates(const std::function<bool(const Gate*)>& filter) const;
 
+        /**
+         * Get all gates with the given name.<br>
+         * If the name index is enabled, see `Netlist::enable_name_index`, the gates are looked up in the index, otherwise all gates are checked.
+         *
+         * @param[in] name - The name.
+         * @return A vector of gates sorted by ID.
+         */
+        std::vector<Gate*> get_gates_by_name(const std::string& name) const;
+
+        /**
+         * Get all gates with a name matching the given wildcard pattern, where `*` matches any sequence of characters and `?` matches any single character.<br>
+         * If the name index is enabled, see `Netlist::enable_name_index`, only gates sharing a substring of at least three characters with the pattern are checked, otherwise all gates are checked.
+         *
+         * @param[in] pattern - The pattern, e.g., `*reg*` for all gates with a name containing `reg`.
+         * @return A vector of gates sorted by ID.
+         */
+        std::vector<Gate*> get_gates_by_name_pattern(const std::string& pattern) const;
+
+        /**
+         * Get a view on all gates contained within the netlist that does not copy the gates.<br>
+         * The filter is evaluated lazily during iteration such that the range only contains gates matching the specified condition.
+         * The view must not be used after gates have been created or deleted.
+         *
+         * @param[in] filter - A filter callable as `bool(const Gate* gate)`.
+         * @return A filtered range of gates.
+         */
+        template<typename Filter>
+        FilteredRange<std::vector<Gate*>::const_iterator, Filter> get_gates_view(Filter filter) const
+        {
+            const std::vector<Gate*>& gates = get_gates();
+            return FilteredRange<std::vector<Gate*>::const_iterator, Filter>(gates.begin(), gates.end(), std::move(filter));
+        }
+
         /**
          * Mark a gate as a global VCC gate.
          *
@@ -368,6 +415,39 @@ namespace hal
          */
         std::vector<Net*> get_nets(const std::function<bool(const Net*)>& filter) const;
 
+        /**
+         * Get all nets with the given name.<br>
+         * If the name index is enabled, see `Netlist::enable_name_index`, the nets are looked up in the index, otherwise all nets are checked.
+         *
+         * @param[in] name - The name.
+         * @return A vector of nets sorted by ID.
+         */
+        std::vector<Net*> get_nets_by_name(const std::string& name) const;
+
+        /**
+         * Get all nets with a name matching the given wildcard pattern, where `*` matches any sequence of characters and `?` matches any single character.<br>
+         * If the name index is enabled, see `Netlist::enable_name_index`, only nets sharing a substring of at least three characters with the pattern are checked, otherwise all nets are checked.
+         *
+         * @param[in] pattern - The pattern, e.g., `*reg*` for all nets with a name containing `reg`.
+         * @return A vector of nets sorted by ID.
+         */
+        std::vector<Net*> get_nets_by_name_pattern(const std::string& pattern) const;
+
+        /**
+         * Get a view on all nets contained within the netlist that does not copy the nets.<br>
+         * The filter is evaluated lazily during iteration such that the range only contains nets matching the specified condition.
+         * The view must not be used after nets have been created or deleted.
+         *
+         * @param[in] filter - A filter callable as `bool(const Net* net)`.
+         * @return A filtered range of nets.
+         */
+        template<typename Filter>
+        FilteredRange<std::vector<Net*>::const_iterator, Filter> get_nets_view(Filter filter) const
+        {
+            const std::vector<Net*>& nets = get_nets();
+            return FilteredRange<std::vector<Net*>::const_iterator, Filter>(nets.begin(), nets.end(), std::move(filter));
+        }
+
         /**
          * Mark a net as a global input net.
          *
@@ -452,6 +532,51 @@ namespace hal
          */
         void enable_automatic_net_checks(bool enable_checks = true);
 
+        /**
+         * Begin a bulk edit of the netlist.<br>
+         * While a bulk edit is in progress, adding or removing sources and destinations of nets, marking global nets, and moving gates or modules between modules does not update the input, output, and internal nets of the affected modules.
+         * Also, the events for added or removed net sources and destinations are held back.
+         * When the outermost bulk edit ends, every affected net is classified once for all affected modules and the held back events are sent, with events of endpoints that have been added and removed again being dropped.
+         * Furthermore, an event batch of the netlist's event handler is in progress for the duration of the bulk edit, see `EventHandler::begin_batch`.
+         * Bulk edits may be nested. Consider using a `NetlistBulkEdit` to end the bulk edit automatically when leaving a scope.
+         * \warning{\b WARNING: the input, output, and internal nets and the pins of modules may be outdated while a bulk edit is in progress.}
+         */
+        void begin_bulk_edit();
+
+        /**
+         * End a bulk edit of the netlist that has been started using `Netlist::begin_bulk_edit`.<br>
+         * If this ends the outermost bulk edit, all deferred module net updates are performed, all held back events are sent, and the event batch is delivered.
+         *
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> end_bulk_edit();
+
+        /**
+         * Check whether a bulk edit is in progress.
+         *
+         * @returns `true` if a bulk edit is in progress, `false` otherwise.
+         */
+        bool is_bulk_edit_active() const;
+
+        /**
+         * Acquire shared read access to the netlist, which is released when the returned lock is destroyed.<br>
+         * Any number of threads may hold read access at the same time, but no thread may hold it while another thread holds write access.
+         * Read access is only required if another thread may modify the netlist at the same time.
+         * The lock is advisory and does not prevent modifications by threads that do not acquire write access first.
+         *
+         * @returns The shared lock.
+         */
+        std::shared_lock<std::shared_mutex> acquire_read_lock() const;
+
+        /**
+         * Acquire exclusive write access to the netlist, which is released when the returned lock is destroyed.<br>
+         * Blocks until all threads have released their read or write access.
+         * A thread must not acquire access again while holding write access.
+         *
+         * @returns The exclusive lock.
+         */
+        std::unique_lock<std::shared_mutex> acquire_write_lock() const;
+
         /*
          * ################################################################
          *      module functions
@@ -529,6 +654,24 @@ namespace hal
          */
         std::vector<Module*> get_modules(const std::function<bool(const Module*)>& filter) const;
 
+        /**
+         * Get all modules with the given name.<br>
+         * If the name index is enabled, see `Netlist::enable_name_index`, the modules are looked up in the index, otherwise all modules are checked.
+         *
+         * @param[in] name - The name.
+         * @return A vector of modules sorted by ID.
+         */
+        std::vector<Module*> get_modules_by_name(const std::string& name) const;
+
+        /**
+         * Get all modules with a name matching the given wildcard pattern, where `*` matches any sequence of characters and `?` matches any single character.<br>
+         * If the name index is enabled, see `Netlist::enable_name_index`, only modules sharing a substring of at least three characters with the pattern are checked, otherwise all modules are checked.
+         *
+         * @param[in] pattern - The pattern, e.g., `*reg*` for all modules with a name containing `reg`.
+         * @return A vector of modules sorted by ID.
+         */
+        std::vector<Module*> get_modules_by_name_pattern(const std::string& pattern) const;
+
         /**
          * Get the top module of the netlist.
          *
@@ -789,18 +932,87 @@ namespace hal
          */
         EventHandler* get_event_handler() const;
 
+        /**
+         * Get the number of changes to the data entries of gates, nets, and modules of the netlist.<br>
+         * Changing data entries does not send any events, hence this counter allows to detect such changes, e.g., when saving the netlist incrementally.
+         * Loading deferred data entries does not count as a change.
+         *
+         * @returns The number of data changes.
+         */
+        u64 get_num_data_changes() const;
+
         /*
          * ################################################################
          *      utility functions
          * ################################################################
          */
 
+        /**
+         * Enable or disable the name index of the netlist.<br>
+         * The name index maps the names of all gates, nets, and modules to the respective objects and speeds up `Netlist::get_gates_by_name`, `Netlist::get_gates_by_name_pattern`, and their counterparts for nets and modules.
+         * It is built when enabled and kept up to date through the `created`, `removed`, and `name_changed` events of gates, nets, and modules.
+         * Hence, gates, nets, and modules must not be created, deleted, or renamed while events are disabled, since the index would become stale.
+         * Lookups skip objects that no longer exist or whose name no longer matches, but objects missing from a stale index are not found. Disabling and enabling the name index again rebuilds it.
+         * 
+         * @param[in] enable - Set `true` to enable the name index, `false` to disable and free it.
+         */
+        void enable_name_index(bool enable = true);
+
+        /**
+         * Check whether the name index of the netlist is enabled.
+         * 
+         * @returns `true` if the name index is enabled, `false` otherwise.
+         */
+        bool is_name_index_enabled() const;
+
         /**
          * Clear all internal caches of the netlist.<br>
          * In a typical application, calling this function is not required.
          */
         void clear_caches();
 
+        /**
+         * Defer creating the modules of the netlist until the module hierarchy is accessed for the first time, e.g., by `Netlist::get_modules`, `Netlist::get_top_module`, or `Gate::get_module`.<br>
+         * Until then, all gates are part of the top module. Used by the lazy mode of the netlist deserializers, see `netlist_serializer::ReadOptions`.<br>
+         * The loader is called with automatic net checks disabled and has to update the nets of the modules it creates.<br>
+         * Loading the modules modifies the netlist and sends the respective events, although it may be triggered by a const function.
+         * Hence, if multiple threads access the netlist, the module hierarchy must be accessed for the first time while holding write access, see `Netlist::acquire_write_lock`, e.g., by calling `Netlist::load_deferred_content`.
+         *
+         * @param[in] loader - The function that creates the modules, which is called at most once.
+         */
+        void defer_modules(const std::function<bool(Netlist*)>& loader);
+
+        /**
+         * Defer creating the groupings of the netlist until they are accessed for the first time, e.g., by `Netlist::get_groupings` or `Gate::get_grouping`.<br>
+         * Like loading deferred modules, loading the groupings modifies the netlist and sends events, hence the same restrictions regarding concurrent access apply, see `Netlist::defer_modules`.
+         *
+         * @param[in] loader - The function that creates the groupings, which is called at most once.
+         */
+        void defer_groupings(const std::function<bool(Netlist*)>& loader);
+
+        /**
+         * Defer loading the data entries of the given gates and nets until the data of the respective gate or net is accessed for the first time.<br>
+         * Loading the data entries does not send any events and only modifies the respective gate or net, hence they may be loaded while multiple threads read the netlist.
+         *
+         * @param[in] containers - The gates and nets.
+         * @param[in] loader - The function that adds the data entries to a single gate or net, which is called at most once per gate or net.
+         */
+        void defer_data(const std::vector<DataContainer*>& containers, const std::function<bool(DataContainer*)>& loader);
+
+        /**
+         * Check whether parts of the netlist have been deferred and not been loaded yet, see `Netlist::defer_modules`, `Netlist::defer_groupings`, and `Netlist::defer_data`.
+         *
+         * @returns `true` if parts of the netlist have not been loaded yet, `false` otherwise.
+         */
+        bool has_deferred_content() const;
+
+        /**
+         * Load all deferred parts of the netlist at once, e.g., before the file they are loaded from is overwritten.
+         *
+         * @returns `true` on success, `false` otherwise.
+         */
+        bool load_deferred_content() const;
+
         /**
          * Load the locations of the gates in the netlist from their associated data using the specified category and identifier.
          * If no parameter is given, the data is querried using the default category and identifier stored with the gate library.
@@ -833,19 +1045,14 @@ namespace hal
         /* the event handler associated with the netlist */
         std::unique_ptr<EventHandler> m_event_handler;
 
+        /* synchronizes readers and writers that access the netlist concurrently */
+        mutable std::shared_mutex m_access_mutex;
+
         /* stores the auto generated ids for fast next id */
-        u32 m_next_gate_id;
-        std::set<u32> m_used_gate_ids;
-        std::set<u32> m_free_gate_ids;
-        u32 m_next_net_id;
-        std::set<u32> m_used_net_ids;
-        std::set<u32> m_free_net_ids;
-        u32 m_next_module_id;
-        std::set<u32> m_used_module_ids;
-        std::set<u32> m_free_module_ids;
-        u32 m_next_grouping_id;
-        std::set<u32> m_used_grouping_ids;
-        std::set<u32> m_free_grouping_ids;
+        IdAllocator m_gate_ids;
+        IdAllocator m_net_ids;
+        IdAllocator m_module_ids;
+        IdAllocator m_grouping_ids;
 
         /* stores the modules */
         Module* m_top_module;
@@ -853,15 +1060,11 @@ namespace hal
         std::unordered_set<const Module*> m_modules_set;
         std::vector<Module*> m_modules;
 
-        /* stores the nets */
-        std::unordered_map<u32, std::unique_ptr<Net>> m_nets_map;
-        std::unordered_set<const Net*> m_nets_set;
-        std::vector<Net*> m_nets;
+        /* stores the nets, which are owned by the object pool of the internal manager */
+        IdIndex<Net> m_nets;
 
-        /* stores the gates */
-        std::unordered_map<u32, std::unique_ptr<Gate>> m_gates_map;
-        std::unordered_set<const Gate*> m_gates_set;
-        std::vector<Gate*> m_gates;
+        /* stores the gates, which are owned by the object pool of the internal manager */
+        IdIndex<Gate> m_gates;
 
         /* stores the groupings */
         std::unordered_map<u32, std::unique_ptr<Grouping>> m_groupings_map;
@@ -873,5 +1076,27 @@ namespace hal
         std::vector<Net*> m_global_output_nets;
         std::vector<Gate*> m_gnd_gates;
         std::vector<Gate*> m_vcc_gates;
+
+        /* stores the optional name indices, all of which are set while the name index is enabled */
+        std::unique_ptr<NameIndex> m_gate_name_index;
+        std::unique_ptr<NameIndex> m_net_name_index;
+        std::unique_ptr<NameIndex> m_module_name_index;
+
+        /* loaders of the deferred parts of the netlist, the loaders run while holding the mutex */
+        mutable std::recursive_mutex m_deferred_mutex;
+        mutable std::atomic<bool> m_has_deferred_modules   = false;
+        mutable std::atomic<bool> m_has_deferred_groupings = false;
+        mutable std::atomic<u32> m_num_deferred_data       = 0;
+        mutable std::function<bool(Netlist*)> m_modules_loader;
+        mutable std::function<bool(Netlist*)> m_groupings_loader;
+        mutable std::function<bool(DataContainer*)> m_data_loader;
+        mutable const DataContainer* m_loading_data = nullptr;
+
+        mutable u64 m_num_data_changes = 0;
+
+        bool load_deferred_modules() const;
+        bool load_deferred_groupings() const;
+        bool load_deferred_data(const DataContainer* container) const;
+        void notify_data_changed(const DataContainer* container);
     };
 }    // namespace hal
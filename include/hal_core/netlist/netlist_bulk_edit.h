@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+namespace hal
+{
+    class Netlist;
+
+    /**
+     * A scoped bulk edit of a netlist.<br>
+     * Begins a bulk edit of the netlist on construction and ends it on destruction, unless it has been committed before.
+     * See `Netlist::begin_bulk_edit` for the effects of a bulk edit.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NetlistBulkEdit
+    {
+    public:
+        /**
+         * Construct a new NetlistBulkEdit object and begin a bulk edit of the given netlist.
+         *
+         * @param[in] netlist - The netlist to edit.
+         */
+        explicit NetlistBulkEdit(Netlist* netlist);
+
+        /**
+         * End the bulk edit if it has not been committed yet.
+         * Errors are logged.
+         */
+        ~NetlistBulkEdit();
+
+        NetlistBulkEdit(const NetlistBulkEdit&)            = delete;
+        NetlistBulkEdit& operator=(const NetlistBulkEdit&) = delete;
+
+        /**
+         * End the bulk edit, thereby updating the module nets and sending the held back events if this is the outermost bulk edit.<br>
+         * Calling this function more than once has no effect.
+         *
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> commit();
+
+    private:
+        Netlist* m_netlist;
+        bool m_committed = false;
+    };
+}    // namespace hal
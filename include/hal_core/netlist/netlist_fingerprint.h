@@ -0,0 +1,178 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace hal
+{
+    class Gate;
+    class Module;
+    class Net;
+    class Netlist;
+
+    /**
+     * An incrementally maintained structural hash of a netlist.<br>
+     * The fingerprint assigns a hash to every gate, net, and module of the netlist and combines them into a hash of the entire netlist.
+     * The hash of a gate covers its ID, name, type, location, custom Boolean functions, GND/VCC flags, and the pins and net IDs of its endpoints.
+     * The hash of a net covers its ID, name, and global input/output flags, its connections are covered by the hashes of the connected gates.
+     * The hash of a module covers its ID, name, type, parent, pin groups, pins, and the hashes of its gates and submodules.
+     * The hashes only depend on the netlist contents and not on memory addresses, hence equal netlists yield equal hashes, even if they are held by different processes.<br>
+     * The fingerprint subscribes to the events of the netlist and only recomputes the hashes of objects that have been changed since the last query.
+     * Hence, changes made while events are disabled are not tracked, and changes to net endpoints held back by a bulk edit are only tracked after the bulk edit has ended.
+     * Data entries are not covered by the fingerprint, since changing them does not send any events.
+     * Groupings are not covered either, since they are annotations rather than part of the netlist structure and are not compared by `Netlist::operator==`.<br>
+     * The fingerprint may be queried from multiple threads at the same time, as long as the netlist is not modified concurrently.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NetlistFingerprint final
+    {
+    public:
+        /**
+         * Compute the fingerprint of the given netlist and start tracking its changes.<br>
+         * The fingerprint must be destroyed before the netlist.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] num_workers - The maximum number of threads used to compute the initial hashes, `0` to use one thread per hardware thread.
+         */
+        explicit NetlistFingerprint(Netlist* netlist, u32 num_workers = 0);
+
+        ~NetlistFingerprint();
+
+        NetlistFingerprint(const NetlistFingerprint&) = delete;
+        NetlistFingerprint& operator=(const NetlistFingerprint&) = delete;
+
+        /**
+         * Get the netlist of the fingerprint.
+         *
+         * @returns The netlist.
+         */
+        Netlist* get_netlist() const;
+
+        /**
+         * Get the hash of the entire netlist.<br>
+         * Unequal hashes imply that the netlists differ in their structure, while equal hashes indicate structural equality with high probability.
+         *
+         * @returns The hash of the netlist.
+         */
+        u64 get_hash() const;
+
+        /**
+         * Get the hash of the given gate.
+         *
+         * @param[in] gate - The gate.
+         * @returns The hash of the gate, or `0` if the gate is not part of the netlist.
+         */
+        u64 get_gate_hash(const Gate* gate) const;
+
+        /**
+         * Get the hash of the given net.
+         *
+         * @param[in] net - The net.
+         * @returns The hash of the net, or `0` if the net is not part of the netlist.
+         */
+        u64 get_net_hash(const Net* net) const;
+
+        /**
+         * Get the hash of the given module including all of its gates and submodules.<br>
+         * Module hashes are cached and only recomputed for modules that contain a changed object.
+         *
+         * @param[in] module - The module.
+         * @returns The hash of the module, or `0` if the module is not part of the netlist.
+         */
+        u64 get_module_hash(const Module* module) const;
+
+        /**
+         * Get the number of tracked changes to the netlist.<br>
+         * The counter is increased by every event that affects the fingerprint and can be used to check in constant time whether the netlist has been changed since a previous analysis.
+         *
+         * @returns The number of changes.
+         */
+        u64 get_modification_count() const;
+
+        /**
+         * Get a hash of the structure of the given module that does not depend on IDs or names.<br>
+         * The hash is computed from the gate types and the pin-level connections of all gates within the module and its submodules, using a fixed number of neighborhood refinement rounds.
+         * The module hierarchy below the given module is not taken into account.
+         * Two modules implementing the same circuit yield the same hash, e.g., multiple instances of the same hardware block.
+         * The hash is computed from scratch on every call.
+         *
+         * @param[in] module - The module.
+         * @returns The structure hash of the module.
+         */
+        u64 get_module_structure_hash(const Module* module) const;
+
+        /**
+         * Get groups of modules that share the same structure hash, i.e., modules that are likely instances of the same circuit.<br>
+         * The top module is not considered. Groups are sorted by the smallest module ID within each group and modules within a group are sorted by ID.
+         *
+         * @param[in] num_workers - The maximum number of threads used to compute the structure hashes, `0` to use one thread per hardware thread.
+         * @returns A vector of groups, each containing at least two modules.
+         */
+        std::vector<std::vector<Module*>> get_duplicate_modules(u32 num_workers = 0) const;
+
+    private:
+        void update() const;
+        void invalidate_module(const Module* module);
+        void mark_gate(u32 gate_id);
+        u64 compute_gate_hash(const Gate* gate) const;
+        u64 compute_net_hash(const Net* net) const;
+        u64 compute_module_hash(const Module* module) const;
+        u64 compute_recursive_module_hash(const Module* module) const;
+
+        Netlist* m_netlist;
+        std::string m_callback_name;
+
+        mutable std::mutex m_mutex;
+        u64 m_modification_count = 0;
+
+        // hashes are stored by object ID, an entry of `0` denotes an object that does not exist
+        mutable std::vector<u64> m_gate_hashes;
+        mutable std::vector<u64> m_net_hashes;
+        mutable std::unordered_map<u32, u64> m_module_hashes;
+        mutable std::unordered_map<u32, u64> m_recursive_module_hashes;
+
+        // sums of all gate, net, and module hashes, wrapping on overflow
+        mutable u64 m_gate_sum   = 0;
+        mutable u64 m_net_sum    = 0;
+        mutable u64 m_module_sum = 0;
+
+        mutable std::unordered_set<u32> m_dirty_gates;
+        mutable std::unordered_set<u32> m_dirty_nets;
+        mutable std::unordered_set<u32> m_dirty_modules;
+
+        std::unordered_set<u32> m_global_input_nets;
+        std::unordered_set<u32> m_global_output_nets;
+        std::unordered_set<u32> m_gnd_gates;
+        std::unordered_set<u32> m_vcc_gates;
+    };
+}    // namespace hal
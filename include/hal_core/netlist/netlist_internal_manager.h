@@ -26,10 +26,18 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/netlist/endpoint.h"
 #include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/object_pool.h"
 #include "hal_core/netlist/pins/gate_pin.h"
 
 #include <map>
+#include <shared_mutex>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace hal
@@ -42,6 +50,7 @@ namespace hal
     class Module;
     class Endpoint;
     class Grouping;
+    class DataContainer;
     class BooleanFunction;
 
     /**
@@ -59,11 +68,16 @@ namespace hal
         Netlist* m_netlist;
         EventHandler* m_event_handler;
 
+        // object storage
+        ObjectPool<Gate> m_gate_pool;
+        ObjectPool<Net> m_net_pool;
+        ObjectPool<Endpoint> m_endpoint_pool;
+
         explicit NetlistInternalManager(Netlist* nl, EventHandler* eh);
         ~NetlistInternalManager() = default;
 
         // netlist functions
-        Result<std::unique_ptr<Netlist>> copy_netlist(const Netlist* nl) const;
+        Result<std::unique_ptr<Netlist>> copy_netlist(const Netlist* nl, u32 num_workers) const;
 
         // gate functions
         Gate* create_gate(u32 id, GateType* gt, const std::string& name, i32 x, i32 y);
@@ -95,8 +109,43 @@ namespace hal
         bool grouping_assign_module(Grouping* grouping, Module* module, bool force = false);
         bool grouping_remove_module(Grouping* grouping, Module* module);
 
+        // bulk edit functions
+        struct PendingNetUpdate
+        {
+            struct Event
+            {
+                NetEvent::event event;
+                u32 gate_id;
+                bool cancelled;
+            };
+
+            bool needs_check = false;
+            std::unordered_set<u32> module_ids;
+            std::vector<Event> events;
+            std::map<std::tuple<u32, bool, const GatePin*>, std::vector<u32>> pending_additions;
+        };
+
+        void begin_bulk_edit();
+        Result<std::monostate> end_bulk_edit();
+        void bulk_edit_mark_net(Net* net, const Module* module);
+        void bulk_edit_add_event(Net* net, NetEvent::event ev, u32 gate_id, const GatePin* pin);
+        Result<std::monostate> bulk_edit_check_net(Net* net, PendingNetUpdate& update);
+        void bulk_edit_send_events(Net* net, PendingNetUpdate& update);
+        void bulk_edit_flush_net(Net* net);
+        u32 m_bulk_edit_depth = 0;
+        std::unordered_map<u32, PendingNetUpdate> m_bulk_edit_nets;
+        std::vector<u32> m_bulk_edit_order;
+
+        // deferred loading functions
+        void load_deferred_modules() const;
+        void load_deferred_groupings() const;
+        void load_deferred_data(const DataContainer* container) const;
+        void notify_data_changed(const DataContainer* container);
+
         // caches
         void clear_caches();
+        // LUT functions are computed by const accessors, hence the cache may be accessed by multiple threads at the same time
+        mutable std::shared_mutex m_lut_function_cache_mutex;
         mutable std::map<std::pair<std::vector<GatePin*>, u64>, BooleanFunction> m_lut_function_cache;
         bool m_net_checks_enabled = true;
     };
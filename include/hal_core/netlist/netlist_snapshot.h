@@ -0,0 +1,251 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/gate_library/enums/gate_type_property.h"
+#include "hal_core/netlist/gate_library/enums/pin_type.h"
+
+#include <limits>
+#include <vector>
+
+namespace hal
+{
+    class Gate;
+    class GatePin;
+    class Net;
+    class Netlist;
+
+    /**
+     * An immutable snapshot of the connectivity of a netlist.<br>
+     * Gates and nets are assigned dense indices and their connections are stored in compressed sparse row (CSR) arrays together with the type of the connecting pin.
+     * Additionally, the properties of the gate type of every gate are stored as a bitmask.
+     * Once built, the snapshot can be queried from any number of threads without locking or allocating memory.
+     * The snapshot does not track later modifications of the netlist and must be rebuilt after the netlist has been changed.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NetlistSnapshot final
+    {
+    public:
+        /**
+         * The index returned for gates and nets that are not part of the snapshot.
+         */
+        static constexpr u32 INVALID_INDEX = std::numeric_limits<u32>::max();
+
+        /**
+         * A connection between a gate and a net through a gate pin.
+         */
+        struct Connection
+        {
+            /**
+             * The index of the connected gate when queried for a net, or the index of the connected net when queried for a gate.
+             */
+            u32 index;
+
+            /**
+             * The type of the gate pin.
+             */
+            PinType pin_type;
+
+            /**
+             * The gate pin.
+             */
+            const GatePin* pin;
+        };
+
+        /**
+         * A contiguous, read-only range of connections.
+         */
+        class ConnectionRange
+        {
+        public:
+            ConnectionRange(const Connection* begin, const Connection* end) : m_begin(begin), m_end(end)
+            {
+            }
+
+            const Connection* begin() const
+            {
+                return m_begin;
+            }
+
+            const Connection* end() const
+            {
+                return m_end;
+            }
+
+            u32 size() const
+            {
+                return static_cast<u32>(m_end - m_begin);
+            }
+
+            bool empty() const
+            {
+                return m_begin == m_end;
+            }
+
+            const Connection& operator[](u32 i) const
+            {
+                return m_begin[i];
+            }
+
+        private:
+            const Connection* m_begin;
+            const Connection* m_end;
+        };
+
+        /**
+         * Build a snapshot of the connectivity of the given netlist.<br>
+         * The netlist must not be modified while the snapshot is built.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] num_workers - The maximum number of threads used to build the snapshot, `0` to use one thread per hardware thread.
+         */
+        explicit NetlistSnapshot(const Netlist& netlist, u32 num_workers = 0);
+
+        /**
+         * Get the netlist the snapshot has been built from.
+         *
+         * @returns The netlist.
+         */
+        const Netlist& get_netlist() const;
+
+        /**
+         * Get the number of gates in the snapshot.
+         *
+         * @returns The number of gates.
+         */
+        u32 get_num_gates() const;
+
+        /**
+         * Get the number of nets in the snapshot.
+         *
+         * @returns The number of nets.
+         */
+        u32 get_num_nets() const;
+
+        /**
+         * Get the gate at the given index.
+         *
+         * @param[in] gate_index - The index of the gate.
+         * @returns The gate.
+         */
+        Gate* get_gate(u32 gate_index) const;
+
+        /**
+         * Get the net at the given index.
+         *
+         * @param[in] net_index - The index of the net.
+         * @returns The net.
+         */
+        Net* get_net(u32 net_index) const;
+
+        /**
+         * Get the index of the given gate.
+         *
+         * @param[in] gate - The gate.
+         * @returns The index of the gate, or `NetlistSnapshot::INVALID_INDEX` if the gate is not part of the snapshot.
+         */
+        u32 get_gate_index(const Gate* gate) const;
+
+        /**
+         * Get the index of the given net.
+         *
+         * @param[in] net - The net.
+         * @returns The index of the net, or `NetlistSnapshot::INVALID_INDEX` if the net is not part of the snapshot.
+         */
+        u32 get_net_index(const Net* net) const;
+
+        /**
+         * Get the properties of the gate type of the gate at the given index as a bitmask, in which bit `i` is set if the gate type has the property with value `i`.
+         *
+         * @param[in] gate_index - The index of the gate.
+         * @returns The property bitmask.
+         */
+        u64 get_gate_properties(u32 gate_index) const;
+
+        /**
+         * Check whether the gate type of the gate at the given index has the given property.
+         *
+         * @param[in] gate_index - The index of the gate.
+         * @param[in] property - The property.
+         * @returns `true` if the gate type has the property, `false` otherwise.
+         */
+        bool has_gate_property(u32 gate_index, GateTypeProperty property) const;
+
+        /**
+         * Get the connections of the gate at the given index to its fan-in nets.
+         *
+         * @param[in] gate_index - The index of the gate.
+         * @returns The connections, each referring to a net.
+         */
+        ConnectionRange get_fan_in(u32 gate_index) const;
+
+        /**
+         * Get the connections of the gate at the given index to its fan-out nets.
+         *
+         * @param[in] gate_index - The index of the gate.
+         * @returns The connections, each referring to a net.
+         */
+        ConnectionRange get_fan_out(u32 gate_index) const;
+
+        /**
+         * Get the connections of the net at the given index to its source gates.
+         *
+         * @param[in] net_index - The index of the net.
+         * @returns The connections, each referring to a gate.
+         */
+        ConnectionRange get_sources(u32 net_index) const;
+
+        /**
+         * Get the connections of the net at the given index to its destination gates.
+         *
+         * @param[in] net_index - The index of the net.
+         * @returns The connections, each referring to a gate.
+         */
+        ConnectionRange get_destinations(u32 net_index) const;
+
+    private:
+        const Netlist* m_netlist;
+
+        std::vector<Gate*> m_gates;
+        std::vector<Net*> m_nets;
+        std::vector<u32> m_gate_indices;
+        std::vector<u32> m_net_indices;
+        std::vector<u64> m_gate_properties;
+        // c_lut is the last gate type property, so every property has its own bit in the mask
+        static_assert(static_cast<u32>(GateTypeProperty::c_lut) < 64, "gate type properties do not fit into a 64-bit mask");
+
+        std::vector<u32> m_fan_in_offsets;
+        std::vector<Connection> m_fan_in;
+        std::vector<u32> m_fan_out_offsets;
+        std::vector<Connection> m_fan_out;
+        std::vector<u32> m_source_offsets;
+        std::vector<Connection> m_sources;
+        std::vector<u32> m_destination_offsets;
+        std::vector<Connection> m_destinations;
+    };
+}    // namespace hal
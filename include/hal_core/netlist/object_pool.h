@@ -0,0 +1,233 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * An ObjectPool allocates objects of a single type from slabs of contiguous memory instead of individual heap allocations.
+     * 
+     * Slabs grow geometrically up to a maximum size and are never released before the pool is destroyed, so objects created 
+     * in sequence end up next to each other in memory.
+     * Slots of destroyed objects are reused for subsequently created objects.
+     * Membership of an object can be checked from its address alone, i.e., without dereferencing the pointer, which allows
+     * to safely reject pointers to objects that have been destroyed already.
+     * 
+     * Since the constructors of netlist objects are private, objects are constructed by the caller using placement new on a slot 
+     * obtained from `allocate`.
+     *
+     * @ingroup netlist
+     */
+    template<typename T>
+    class ObjectPool final
+    {
+    public:
+        /// The number of slots of the first slab.
+        static constexpr u32 MIN_SLAB_SIZE = 64;
+
+        /// The maximum number of slots of a slab.
+        static constexpr u32 MAX_SLAB_SIZE = 1 << 16;
+
+        ObjectPool() = default;
+
+        ~ObjectPool()
+        {
+            clear();
+        }
+
+        ObjectPool(const ObjectPool&)            = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /**
+         * Get an uninitialized slot for a new object and mark it as live.
+         * The caller must construct the object in the slot using placement new before the slot is used in any other way.
+         * 
+         * @returns The slot.
+         */
+        void* allocate()
+        {
+            Slot* slot;
+            if (!m_free_slots.empty())
+            {
+                slot = m_free_slots.back();
+                m_free_slots.pop_back();
+            }
+            else
+            {
+                if (m_slabs.empty() || m_slabs.back().used == m_slabs.back().capacity)
+                {
+                    add_slab();
+                }
+                auto& slab = m_slabs.back();
+                slot       = slab.slots.get() + slab.used++;
+            }
+
+            auto [slab, index] = locate(slot);
+            slab->live[index / 64] |= u64(1) << (index % 64);
+            m_size++;
+            return slot;
+        }
+
+        /**
+         * Destroy an object of the pool and release its slot for reuse.
+         * 
+         * @param[in] object - The object.
+         * @returns `true` on success, `false` if the object is not a live object of the pool.
+         */
+        bool destroy(T* object)
+        {
+            auto [slab, index] = locate(object);
+            if (slab == nullptr || ((slab->live[index / 64] >> (index % 64)) & 1) == 0)
+            {
+                return false;
+            }
+
+            object->~T();
+            slab->live[index / 64] &= ~(u64(1) << (index % 64));
+            m_free_slots.push_back(reinterpret_cast<Slot*>(object));
+            m_size--;
+            return true;
+        }
+
+        /**
+         * Check whether an object is a live object of the pool.
+         * The object is not dereferenced.
+         * 
+         * @param[in] object - The object.
+         * @returns `true` if the object is a live object of the pool, `false` otherwise.
+         */
+        bool contains(const T* object) const
+        {
+            auto [slab, index] = locate(object);
+            return slab != nullptr && ((slab->live[index / 64] >> (index % 64)) & 1) != 0;
+        }
+
+        /**
+         * Get the number of live objects.
+         * 
+         * @returns The number of live objects.
+         */
+        u64 size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * Destroy all live objects and release the memory of the pool.
+         */
+        void clear()
+        {
+            for (auto& slab : m_slabs)
+            {
+                for (u32 w = 0; w < slab.live.size(); w++)
+                {
+                    for (u64 word = slab.live[w]; word != 0; word &= word - 1)
+                    {
+                        reinterpret_cast<T*>(slab.slots.get() + w * 64 + __builtin_ctzll(word))->~T();
+                    }
+                }
+            }
+            m_slabs.clear();
+            m_slab_ranges.clear();
+            m_free_slots.clear();
+            m_size = 0;
+        }
+
+    private:
+        /**
+         * Raw storage for a single object.
+         */
+        struct alignas(T) Slot
+        {
+            std::byte data[sizeof(T)];
+        };
+
+        /**
+         * A contiguous block of slots with a bitmap of its live slots.
+         */
+        struct Slab
+        {
+            /// The slots of the slab.
+            std::unique_ptr<Slot[]> slots;
+            /// The number of slots of the slab.
+            u32 capacity;
+            /// The number of slots that have been handed out at least once.
+            u32 used;
+            /// The bitmap of live slots.
+            std::vector<u64> live;
+        };
+
+        void add_slab()
+        {
+            const u32 capacity = m_slabs.empty() ? MIN_SLAB_SIZE : std::min(m_slabs.back().capacity * 2, MAX_SLAB_SIZE);
+            m_slabs.push_back(Slab{std::unique_ptr<Slot[]>(new Slot[capacity]), capacity, 0, std::vector<u64>((capacity + 63) / 64, 0)});
+
+            const auto* begin = m_slabs.back().slots.get();
+            const auto it     = std::upper_bound(m_slab_ranges.begin(), m_slab_ranges.end(), begin, [](const Slot* ptr, const auto& range) { return std::less<const Slot*>()(ptr, range.first); });
+            m_slab_ranges.insert(it, {begin, m_slabs.size() - 1});
+        }
+
+        std::pair<Slab*, u32> locate(const void* ptr) const
+        {
+            // find the last slab starting at or before the address, using std::less for a total order on pointers
+            const auto* slot = static_cast<const Slot*>(ptr);
+            auto it          = std::upper_bound(m_slab_ranges.begin(), m_slab_ranges.end(), slot, [](const Slot* p, const auto& range) { return std::less<const Slot*>()(p, range.first); });
+            if (it == m_slab_ranges.begin())
+            {
+                return {nullptr, 0};
+            }
+            --it;
+
+            auto* slab                 = const_cast<Slab*>(&m_slabs[it->second]);
+            const auto begin           = reinterpret_cast<std::uintptr_t>(slab->slots.get());
+            const auto address         = reinterpret_cast<std::uintptr_t>(ptr);
+            const std::uintptr_t bytes = std::uintptr_t(slab->capacity) * sizeof(Slot);
+            if (address - begin >= bytes || (address - begin) % sizeof(Slot) != 0)
+            {
+                return {nullptr, 0};
+            }
+            return {slab, static_cast<u32>((address - begin) / sizeof(Slot))};
+        }
+
+        /// refers to the slabs in creation order
+        std::vector<Slab> m_slabs;
+        /// refers to the start addresses of all slabs in ascending order together with the index of the respective slab
+        std::vector<std::pair<const Slot*, u64>> m_slab_ranges;
+        /// refers to the slots of destroyed objects that can be reused
+        std::vector<Slot*> m_free_slots;
+        /// refers to the number of live objects
+        u64 m_size = 0;
+    };
+}    // namespace hal
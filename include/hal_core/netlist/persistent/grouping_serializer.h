@@ -53,5 +53,14 @@ namespace hal {
          * @param[in] loaddir Project directory to load file from
          */
         void deserialize(Netlist* netlist, const std::filesystem::path& loaddir) override;
+
+    private:
+        /**
+         * Create the groupings stored in a groupings file, either immediately or deferred if the netlist is read lazily
+         * @param[in] netlist Target netlist to restore groupings
+         * @param[in] groupingFilePath Path to the groupings file
+         * @return True on success, false otherwise
+         */
+        static bool deserialize_groupings(Netlist* netlist, const std::filesystem::path& groupingFilePath);
     };
 }
@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+
+#include <filesystem>
+#include <memory>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+
+    class GateLibrary;
+
+    /**
+     * @file
+     *
+     * \namespace netlist_binary_serializer
+     * @ingroup persistent
+     */
+
+    namespace netlist_binary_serializer
+    {
+        /**
+         * The version of the binary container format.
+         * Files of any other version are rejected.
+         */
+        constexpr u32 FORMAT_VERSION = 1;
+
+        /**
+         * Serializes a netlist into a binary `.hal` file.<br>
+         * The file is a versioned container holding a string table and fixed-width records of gates, nets, endpoints, modules, pins, data entries, and the nodes of custom Boolean functions.
+         * All names are stored only once within the string table and referred to by their index.
+         *
+         * @param[in] netlist - The netlist to serialize.
+         * @param[in] hal_file - The path to the `.hal` file.
+         * @returns `true` on success, `false` otherwise.
+         */
+        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file);
+
+        /**
+         * Deserializes a netlist from a binary `.hal` file using the provided gate library.
+         * If no gate library is provided, the gate library path stored within the file is used.<br>
+         * The file is memory-mapped and the netlist is instantiated directly from its records, i.e., no text is parsed.
+         *
+         * @param[in] hal_file - The path to the `.hal` file.
+         * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
+         * @returns The deserialized netlist on success, a `nullptr` otherwise.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gate_lib = nullptr);
+
+        /**
+         * Deserializes a netlist from a binary `.hal` file using the provided gate library and the given options.
+         * In lazy mode, the file stays mapped until all modules and data entries have been loaded from their records.
+         *
+         * @param[in] hal_file - The path to the `.hal` file.
+         * @param[in] gate_lib - The gate library, may be a `nullptr`.
+         * @param[in] options - The options for reading the file.
+         * @returns The deserialized netlist on success, a `nullptr` otherwise.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gate_lib, const netlist_serializer::ReadOptions& options);
+
+        /**
+         * Checks whether the given file starts with the header of the binary format.
+         *
+         * @param[in] hal_file - The path to the file.
+         * @returns `true` if the file is a binary `.hal` file, `false` otherwise.
+         */
+        NETLIST_API bool is_binary_file(const std::filesystem::path& hal_file);
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
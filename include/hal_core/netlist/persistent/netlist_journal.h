@@ -0,0 +1,121 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+
+#include <memory>
+#include <string>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+
+    /**
+     * Tracks the gates, nets, and modules of a netlist that have been changed since the last checkpoint, such that only these objects need to be written when saving the netlist.<br>
+     * The journal subscribes to the events of the netlist, hence changes made while events are disabled are not tracked, and changes to net endpoints held back by a bulk edit are only tracked after the bulk edit has ended.
+     * Changes to data entries do not send any events, hence the journal only detects that some data entries have changed, see `NetlistJournal::has_data_changes`.
+     * Groupings are not tracked, since they are written entirely whenever the project is saved.<br>
+     * The journal detaches itself when the netlist is destroyed and may therefore outlive the netlist.
+     *
+     * @ingroup persistent
+     */
+    class NETLIST_API NetlistJournal final
+    {
+    public:
+        /**
+         * Start tracking the changes to the given netlist.
+         *
+         * @param[in] netlist - The netlist.
+         */
+        explicit NetlistJournal(Netlist* netlist);
+
+        ~NetlistJournal();
+
+        NetlistJournal(const NetlistJournal&) = delete;
+        NetlistJournal& operator=(const NetlistJournal&) = delete;
+
+        /**
+         * Get the netlist of the journal.
+         *
+         * @returns The netlist.
+         */
+        Netlist* get_netlist() const;
+
+        /**
+         * Check whether the netlist of the journal still exists.
+         *
+         * @returns `true` if the netlist still exists, `false` otherwise.
+         */
+        bool is_attached() const;
+
+        /**
+         * Check whether the netlist or its gates, nets, or modules have been changed since the last checkpoint.
+         *
+         * @returns `true` if there are changes, `false` otherwise.
+         */
+        bool has_changes() const;
+
+        /**
+         * Check whether data entries of gates, nets, or modules have been changed since the last checkpoint.<br>
+         * These changes cannot be attributed to individual objects and are not written by `NetlistJournal::append_to_file`, hence the netlist has to be saved entirely instead.
+         *
+         * @returns `true` if there are data changes, `false` otherwise.
+         */
+        bool has_data_changes() const;
+
+        /**
+         * Get the changes to the netlist since the last checkpoint.
+         *
+         * @returns The changes.
+         */
+        netlist_serializer::NetlistChanges get_changes() const;
+
+        /**
+         * Append the changes since the last checkpoint to a journal file and start a new checkpoint on success.<br>
+         * Nothing is written if there are no changes.
+         *
+         * @param[in] journal_file - The path to the journal file.
+         * @returns `true` on success, `false` otherwise.
+         */
+        bool append_to_file(const std::filesystem::path& journal_file);
+
+        /**
+         * Start a new checkpoint, discarding all changes tracked so far, e.g., after the netlist has been saved entirely.
+         */
+        void clear();
+
+    private:
+        Netlist* m_netlist;
+        std::string m_callback_name;
+        u64 m_num_data_changes;
+
+        // owned by the callbacks, which are destroyed together with the event handler of the netlist
+        std::weak_ptr<netlist_serializer::NetlistChanges> m_changes;
+    };
+}    // namespace hal
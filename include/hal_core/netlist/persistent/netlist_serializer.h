@@ -27,6 +27,9 @@
 
 #include "hal_core/defines.h"
 
+#include <functional>
+#include <set>
+
 namespace hal
 {
     /* forward declaration */
@@ -43,19 +46,68 @@ namespace hal
 
     namespace netlist_serializer
     {
+        /**
+         * The formats of a `.hal` file.
+         */
+        enum class Format
+        {
+            json,  /**< Human-readable JSON document. */
+            binary /**< Memory-mappable binary container, see `netlist_binary_serializer`. */
+        };
+
+        /**
+         * Options for writing a `.hal` file.
+         */
+        struct WriteOptions
+        {
+            /// The format of the `.hal` file.
+            Format format = Format::json;
+            /// Indent JSON files for readability instead of writing them compactly.
+            bool pretty = false;
+            /// Compress JSON files using gzip. Compressed files are detected automatically when deserializing.
+            bool compress = false;
+            /// Called repeatedly while writing a JSON file with the number of gates, nets, and modules written so far and their total number.
+            std::function<void(u64 written, u64 total)> progress_callback;
+        };
+
+        /**
+         * Options for reading a `.hal` file.
+         */
+        struct ReadOptions
+        {
+            /// Load the module hierarchy and the data entries of gates and nets only once they are accessed for the first time, see `Netlist::defer_modules` and `Netlist::defer_data`.
+            /// The content is read from the recorded positions within the `.hal` file, hence the file must not be modified while content is still deferred.
+            bool lazy = false;
+        };
 
         /**
          * Serializes a netlist into a `.hal` file.
          *
          * @param[in] netlist - The netlist to serialize.
          * @param[in] hal_file - The path to the `.hal` file.
+         * @param[in] format - The format of the `.hal` file. Defaults to `Format::json`.
          * @returns `true` on success, `false` otherwise.
          */
-        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file);
+        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file, Format format = Format::json);
+
+        /**
+         * Serializes a netlist into a `.hal` file using the given options.
+         * JSON files are written while traversing the netlist through a fixed-size buffer, so the document is never held in memory as a whole.
+         * The netlist is only read, hence the function may run on a background thread as long as the netlist is not modified in the meantime.
+         *
+         * @param[in] netlist - The netlist to serialize.
+         * @param[in] hal_file - The path to the `.hal` file.
+         * @param[in] options - The options for writing the file.
+         * @returns `true` on success, `false` otherwise.
+         */
+        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file, const WriteOptions& options);
 
         /**
          * Deserializes a netlist from a `.hal` file using the provided gate library.
          * If no gate library is provided, a gate library path must be specified within the `.hal` file.
+         * The format of the file is detected automatically, including gzip-compressed JSON files.
+         * JSON files are read in a single streaming pass that creates gates, nets, and modules while reading and parses the Boolean functions of gates in parallel.
+         * Files written by serializer versions prior to 13 are read into a JSON document first.
          *
          * @param[in] hal_file - The path to the `.hal` file.
          * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
@@ -63,9 +115,62 @@ namespace hal
          */
         NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gate_lib = nullptr);
 
+        /**
+         * Deserializes a netlist from a `.hal` file using the provided gate library and the given options.
+         * If no gate library is provided, a gate library path must be specified within the `.hal` file.<br>
+         * In lazy mode, the modules and the data entries of gates and nets are skipped while reading and only their positions within the file are recorded.
+         * Files that require the DOM-based loader are always read completely.
+         *
+         * @param[in] hal_file - The path to the `.hal` file.
+         * @param[in] gate_lib - The gate library, may be a `nullptr`.
+         * @param[in] options - The options for reading the file.
+         * @returns The deserialized netlist on success, a `nullptr` otherwise.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gate_lib, const ReadOptions& options);
+
+        /**
+         * The objects of a netlist that changed since the last checkpoint of a journal, see `NetlistJournal`.
+         */
+        struct NetlistChanges
+        {
+            /// Whether the ID, the names, the input file, or the GND, VCC, global input, or global output markings of the netlist changed.
+            bool netlist = false;
+            /// The IDs of the gates that were created, changed, or removed.
+            std::set<u32> gates;
+            /// The IDs of the nets that were created, changed, or removed.
+            std::set<u32> nets;
+            /// The IDs of the modules that were created, changed, or removed.
+            std::set<u32> modules;
+        };
+
+        /**
+         * Appends an entry to a journal file that records the current state of the given changed objects of a netlist.
+         * Objects that no longer exist are recorded as removed.
+         * Each entry is written as a single line of JSON, using the same representation of gates, nets, and modules as a JSON `.hal` file.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] changes - The changed objects.
+         * @param[in] journal_file - The path to the journal file, which is created if it does not exist.
+         * @returns `true` on success, `false` otherwise.
+         */
+        NETLIST_API bool append_to_journal(const Netlist* netlist, const NetlistChanges& changes, const std::filesystem::path& journal_file);
+
+        /**
+         * Deserializes a netlist from a `.hal` file and replays the entries of a journal file on top of it.
+         * The entries are merged into the netlist file in order, after which the resulting netlist is created in a single pass.
+         * A truncated last entry, as left by an interrupted write, is skipped.
+         *
+         * @param[in] hal_file - The path to the `.hal` file the journal is based on.
+         * @param[in] journal_file - The path to the journal file.
+         * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
+         * @returns The deserialized netlist on success, a `nullptr` otherwise.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_journal(const std::filesystem::path& hal_file, const std::filesystem::path& journal_file, GateLibrary* gate_lib = nullptr);
+
         /**
          * Deserializes a string which contains a netlist in HAL-(JSON)-format using the provided gate library.
          * If no gate library is provided, a gate library path must be specified within the string.
+         * The string is read in the same way as a JSON `.hal` file.
          *
          * @param[in] hal_string - The string containing the netlist in HAL-(JSON)-format.
          * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
@@ -27,6 +27,8 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_journal.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/utilities/json_write_document.h"
 #include "hal_core/utilities/project_directory.h"
 
@@ -69,6 +71,13 @@ namespace hal
         std::string m_proj_file;
         std::string m_netlist_file;
         std::string m_gatelib_path;
+        netlist_serializer::WriteOptions m_netlist_write_options;
+        netlist_serializer::ReadOptions m_netlist_read_options;
+        bool m_journal_enabled;
+        u32 m_journal_compaction_threshold;
+        u32 m_num_journal_entries;
+        std::string m_journal_file;
+        std::unique_ptr<NetlistJournal> m_netlist_journal;
         std::unordered_map<std::string, ProjectSerializer*> m_serializer;
         std::unordered_map<std::string, std::string> m_filename;
 
@@ -152,6 +161,83 @@ namespace hal
          */
         void set_gate_library_path(const std::string& gl_path);
 
+        /**
+         * Set the format in which the netlist is saved by `ProjectManager::serialize_project`.
+         * Projects are opened regardless of the format of their netlist file.
+         *
+         * @param[in] format - The netlist file format.
+         */
+        void set_netlist_format(netlist_serializer::Format format);
+
+        /**
+         * Get the format in which the netlist is saved by `ProjectManager::serialize_project`.
+         *
+         * @return The netlist file format.
+         */
+        netlist_serializer::Format get_netlist_format() const;
+
+        /**
+         * Set the options used to write the netlist file in `ProjectManager::serialize_project`, including the format of the file.
+         *
+         * @param[in] options - The netlist write options.
+         */
+        void set_netlist_write_options(const netlist_serializer::WriteOptions& options);
+
+        /**
+         * Get the options used to write the netlist file in `ProjectManager::serialize_project`.
+         *
+         * @return The netlist write options.
+         */
+        const netlist_serializer::WriteOptions& get_netlist_write_options() const;
+
+        /**
+         * Set the options used to read the netlist file when opening a project.<br>
+         * In lazy mode, the groupings of the project are read once they are accessed for the first time as well.
+         * A netlist that has to be restored from a journal is always read completely.
+         *
+         * @param[in] options - The netlist read options.
+         */
+        void set_netlist_read_options(const netlist_serializer::ReadOptions& options);
+
+        /**
+         * Get the options used to read the netlist file when opening a project.
+         *
+         * @return The netlist read options.
+         */
+        const netlist_serializer::ReadOptions& get_netlist_read_options() const;
+
+        /**
+         * Enable or disable journaled saving of the netlist in `ProjectManager::serialize_project`.<br>
+         * If enabled, saving the project appends the gates, nets, and modules that have been changed since the last save to a journal file next to the netlist file instead of rewriting the entire netlist file.
+         * The netlist file is rewritten and the journal is removed once the journal holds `ProjectManager::get_journal_compaction_threshold` entries, as well as on every autosave.
+         * Changes to data entries and groupings are not tracked, hence they only become persistent with the next full save.
+         * Disabled by default.
+         *
+         * @param[in] enable - `true` to enable journaled saving, `false` to disable it.
+         */
+        void set_journal_enabled(bool enable);
+
+        /**
+         * Check whether journaled saving of the netlist is enabled.
+         *
+         * @return `true` if journaled saving is enabled, `false` otherwise.
+         */
+        bool is_journal_enabled() const;
+
+        /**
+         * Set the number of journal entries after which the netlist file is rewritten entirely on the next save.
+         *
+         * @param[in] threshold - The maximum number of journal entries.
+         */
+        void set_journal_compaction_threshold(u32 threshold);
+
+        /**
+         * Get the number of journal entries after which the netlist file is rewritten entirely on the next save.
+         *
+         * @return The maximum number of journal entries.
+         */
+        u32 get_journal_compaction_threshold() const;
+
         /**
          * Serialize the netlist and all dependent data to the project directory.
          *
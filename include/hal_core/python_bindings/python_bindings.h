@@ -28,6 +28,7 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/boolean_function.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
 #include "hal_core/netlist/boolean_function/symbolic_state.h"
 #include "hal_core/netlist/boolean_function/types.h"
@@ -48,6 +49,8 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/netlist_fingerprint.h"
+#include "hal_core/netlist/netlist_snapshot.h"
 #include "hal_core/netlist/netlist_utils.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
@@ -327,6 +330,20 @@ namespace hal
      */
     void netlist_traversal_decorator_init(py::module& m);
 
+    /**
+     * Initializes Python bindings for the HAL netlist snapshot in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void netlist_snapshot_init(py::module& m);
+
+    /**
+     * Initializes Python bindings for the HAL netlist fingerprint in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void netlist_fingerprint_init(py::module& m);
+
     /**
      * Initializes Python bindings for the HAL LogManager in a python module.
      *
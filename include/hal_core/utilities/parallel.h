@@ -0,0 +1,134 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * @ingroup utilities
+     */
+    namespace utils
+    {
+        /**
+         * Get the number of worker threads to use for a requested number of workers.
+         *
+         * @param[in] num_workers - The requested number of workers, 0 to use one worker per hardware thread.
+         * @returns The number of workers, which is at least 1.
+         */
+        inline u32 get_num_workers(u32 num_workers)
+        {
+            if (num_workers == 0)
+            {
+                num_workers = std::thread::hardware_concurrency();
+            }
+            return std::max(1u, num_workers);
+        }
+
+        /**
+         * Call a function for every index in `[0, size)` using multiple worker threads, passing state that is local to the calling worker.<br>
+         * Each worker creates its state once before processing its first index, which allows to reuse scratch memory across indices.
+         * The indices are handed out to the workers in chunks to keep the shared counter cold.
+         * The function may be called from multiple threads at the same time, but is called exactly once for every index.
+         *
+         * @param[in] num_workers - The maximum number of workers, 0 to use one worker per hardware thread.
+         * @param[in] size - The number of indices.
+         * @param[in] chunk_size - The number of consecutive indices handed out to a worker at once.
+         * @param[in] make_state - The function creating the state of a worker.
+         * @param[in] f - The function to call with the state of the worker and the index for every index.
+         */
+        template<typename S, typename F>
+        void run_in_chunks(u32 num_workers, u32 size, u32 chunk_size, const S& make_state, const F& f)
+        {
+            const u32 num_chunks = (size + chunk_size - 1) / chunk_size;
+            num_workers          = std::min(get_num_workers(num_workers), std::max(1u, num_chunks));
+
+            std::atomic<u32> next_chunk = 0;
+            auto worker                 = [&]() {
+                u32 c = next_chunk++;
+                if (c >= num_chunks)
+                {
+                    return;
+                }
+
+                auto state = make_state();
+                for (; c < num_chunks; c = next_chunk++)
+                {
+                    const u32 end = std::min(size, (c + 1) * chunk_size);
+                    for (u32 i = c * chunk_size; i < end; i++)
+                    {
+                        f(state, i);
+                    }
+                }
+            };
+
+            if (num_workers == 1)
+            {
+                worker();
+                return;
+            }
+
+            std::vector<std::thread> workers;
+            workers.reserve(num_workers);
+            for (u32 i = 0; i < num_workers; i++)
+            {
+                workers.emplace_back(worker);
+            }
+            for (auto& t : workers)
+            {
+                t.join();
+            }
+        }
+
+        /**
+         * Call a function for every index in `[0, size)` using multiple worker threads.<br>
+         * The indices are handed out to the workers in chunks to keep the shared counter cold.
+         * The function may be called from multiple threads at the same time, but is called exactly once for every index.
+         *
+         * @param[in] num_workers - The maximum number of workers, 0 to use one worker per hardware thread.
+         * @param[in] size - The number of indices.
+         * @param[in] chunk_size - The number of consecutive indices handed out to a worker at once.
+         * @param[in] f - The function to call for every index.
+         */
+        template<typename F>
+        void run_in_chunks(u32 num_workers, u32 size, u32 chunk_size, const F& f)
+        {
+            run_in_chunks(
+                num_workers, size, chunk_size, []() { return std::monostate(); }, [&f](std::monostate&, u32 i) { f(i); });
+        }
+    }    // namespace utils
+}    // namespace hal
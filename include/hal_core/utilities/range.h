@@ -0,0 +1,463 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A lightweight, non-owning view on a sequence of elements given by a pair of iterators.<br>
+     * Ranges are returned by the view functions of the netlist classes, e.g., `Net::get_sources_view`, to iterate over netlist objects without copying them into a new vector.
+     * A range refers to the containers of the object it has been obtained from and must not be used after that object has been modified or destroyed.
+     *
+     * @ingroup utilities
+     */
+    template<typename Iterator>
+    class Range
+    {
+    public:
+        using iterator   = Iterator;
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+        /**
+         * Construct a range from a pair of iterators.
+         *
+         * @param[in] begin - The iterator to the first element.
+         * @param[in] end - The iterator past the last element.
+         */
+        Range(Iterator begin, Iterator end) : m_begin(std::move(begin)), m_end(std::move(end))
+        {
+        }
+
+        /**
+         * Get the iterator to the first element.
+         *
+         * @returns The iterator.
+         */
+        Iterator begin() const
+        {
+            return m_begin;
+        }
+
+        /**
+         * Get the iterator past the last element.
+         *
+         * @returns The iterator.
+         */
+        Iterator end() const
+        {
+            return m_end;
+        }
+
+        /**
+         * Check whether the range is empty.
+         *
+         * @returns `true` if the range contains no elements, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return !(m_begin != m_end);
+        }
+
+        /**
+         * Get the number of elements in the range.<br>
+         * Unless the range is backed by random access iterators, this iterates over the whole range.
+         *
+         * @returns The number of elements.
+         */
+        u32 size() const
+        {
+            return (u32)std::distance(m_begin, m_end);
+        }
+
+        /**
+         * Copy the elements of the range into a vector.
+         *
+         * @returns A vector containing the elements.
+         */
+        std::vector<value_type> to_vector() const
+        {
+            return std::vector<value_type>(m_begin, m_end);
+        }
+
+    private:
+        Iterator m_begin;
+        Iterator m_end;
+    };
+
+    /**
+     * An iterator that skips all elements of an underlying iterator for which the filter evaluates to `false`.
+     *
+     * @ingroup utilities
+     */
+    template<typename Iterator, typename Filter>
+    class FilterIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename std::iterator_traits<Iterator>::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = typename std::iterator_traits<Iterator>::pointer;
+        using reference         = typename std::iterator_traits<Iterator>::reference;
+
+        FilterIterator(Iterator it, Iterator end, const Filter* filter) : m_it(std::move(it)), m_end(std::move(end)), m_filter(filter)
+        {
+            skip();
+        }
+
+        reference operator*() const
+        {
+            return *m_it;
+        }
+
+        FilterIterator& operator++()
+        {
+            ++m_it;
+            skip();
+            return *this;
+        }
+
+        FilterIterator operator++(int)
+        {
+            FilterIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const FilterIterator& other) const
+        {
+            return m_it == other.m_it;
+        }
+
+        bool operator!=(const FilterIterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        void skip()
+        {
+            while (m_it != m_end && !(*m_filter)(*m_it))
+            {
+                ++m_it;
+            }
+        }
+
+        Iterator m_it;
+        Iterator m_end;
+        const Filter* m_filter;
+    };
+
+    /**
+     * A range that only contains the elements of an underlying range for which the filter evaluates to `true`.<br>
+     * The filter is stored within the range and evaluated lazily during iteration, hence iterators of the range must not outlive it.
+     *
+     * @ingroup utilities
+     */
+    template<typename Iterator, typename Filter>
+    class FilteredRange
+    {
+    public:
+        using iterator   = FilterIterator<Iterator, Filter>;
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+        /**
+         * Construct a filtered range.
+         *
+         * @param[in] begin - The iterator to the first element of the underlying range.
+         * @param[in] end - The iterator past the last element of the underlying range.
+         * @param[in] filter - The filter that must evaluate to `true` for an element to be part of the range.
+         */
+        FilteredRange(Iterator begin, Iterator end, Filter filter) : m_begin(std::move(begin)), m_end(std::move(end)), m_filter(std::move(filter))
+        {
+        }
+
+        FilteredRange(const FilteredRange& other) : m_begin(other.m_begin), m_end(other.m_end), m_filter(other.m_filter)
+        {
+        }
+
+        FilteredRange& operator=(const FilteredRange&) = delete;
+
+        /**
+         * Get the iterator to the first element.
+         *
+         * @returns The iterator.
+         */
+        iterator begin() const
+        {
+            return iterator(m_begin, m_end, &m_filter);
+        }
+
+        /**
+         * Get the iterator past the last element.
+         *
+         * @returns The iterator.
+         */
+        iterator end() const
+        {
+            return iterator(m_end, m_end, &m_filter);
+        }
+
+        /**
+         * Check whether the range is empty.
+         *
+         * @returns `true` if the range contains no elements, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return begin() == end();
+        }
+
+        /**
+         * Get the number of elements in the range by iterating over it.
+         *
+         * @returns The number of elements.
+         */
+        u32 size() const
+        {
+            return (u32)std::distance(begin(), end());
+        }
+
+        /**
+         * Copy the elements of the range into a vector.
+         *
+         * @returns A vector containing the elements.
+         */
+        std::vector<value_type> to_vector() const
+        {
+            return std::vector<value_type>(begin(), end());
+        }
+
+    private:
+        Iterator m_begin;
+        Iterator m_end;
+        Filter m_filter;
+    };
+
+    /**
+     * An iterator that concatenates the inner ranges obtained by expanding every element of an outer iterator.<br>
+     * The filter is evaluated on pairs of outer and inner elements and skips all inner elements for which it evaluates to `false`.
+     *
+     * @ingroup utilities
+     */
+    template<typename OuterIterator, typename Expand, typename Filter>
+    class FlattenIterator
+    {
+        using outer_reference = typename std::iterator_traits<OuterIterator>::reference;
+        using InnerRange      = std::invoke_result_t<const Expand&, outer_reference>;
+        using InnerIterator   = decltype(std::declval<const InnerRange&>().begin());
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename std::iterator_traits<InnerIterator>::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = typename std::iterator_traits<InnerIterator>::pointer;
+        using reference         = typename std::iterator_traits<InnerIterator>::reference;
+
+        FlattenIterator(OuterIterator outer, OuterIterator outer_end, const Expand* expand, const Filter* filter) : m_outer(std::move(outer)), m_outer_end(std::move(outer_end)), m_expand(expand), m_filter(filter)
+        {
+            if (m_outer != m_outer_end)
+            {
+                enter();
+                skip();
+            }
+        }
+
+        reference operator*() const
+        {
+            return *m_inner;
+        }
+
+        FlattenIterator& operator++()
+        {
+            ++m_inner;
+            skip();
+            return *this;
+        }
+
+        FlattenIterator operator++(int)
+        {
+            FlattenIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const FlattenIterator& other) const
+        {
+            return m_outer == other.m_outer && (m_outer == m_outer_end || m_inner == other.m_inner);
+        }
+
+        bool operator!=(const FlattenIterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        void enter()
+        {
+            const InnerRange inner = (*m_expand)(*m_outer);
+            m_inner                = inner.begin();
+            m_inner_end            = inner.end();
+        }
+
+        // advances to the next inner element accepted by the filter, moving on to the next outer element whenever an inner range is exhausted
+        void skip()
+        {
+            while (true)
+            {
+                while (m_inner != m_inner_end)
+                {
+                    if ((*m_filter)(*m_outer, *m_inner))
+                    {
+                        return;
+                    }
+                    ++m_inner;
+                }
+
+                if (++m_outer == m_outer_end)
+                {
+                    return;
+                }
+                enter();
+            }
+        }
+
+        OuterIterator m_outer;
+        OuterIterator m_outer_end;
+        InnerIterator m_inner     = {};
+        InnerIterator m_inner_end = {};
+        const Expand* m_expand;
+        const Filter* m_filter;
+    };
+
+    /**
+     * A range that concatenates the inner ranges obtained by expanding every element of an outer range, e.g., all source endpoints of all fan-in nets of a gate.<br>
+     * Expansion and filter are stored within the range and evaluated lazily during iteration, hence iterators of the range must not outlive it.
+     *
+     * @ingroup utilities
+     */
+    template<typename OuterIterator, typename Expand, typename Filter>
+    class FlattenedRange
+    {
+    public:
+        using iterator   = FlattenIterator<OuterIterator, Expand, Filter>;
+        using value_type = typename iterator::value_type;
+
+        /**
+         * Construct a flattened range.
+         *
+         * @param[in] begin - The iterator to the first element of the outer range.
+         * @param[in] end - The iterator past the last element of the outer range.
+         * @param[in] expand - The function that returns the inner range of an outer element.
+         * @param[in] filter - The filter that must evaluate to `true` on an outer and an inner element for the inner element to be part of the range.
+         */
+        FlattenedRange(OuterIterator begin, OuterIterator end, Expand expand, Filter filter)
+            : m_begin(std::move(begin)), m_end(std::move(end)), m_expand(std::move(expand)), m_filter(std::move(filter))
+        {
+        }
+
+        FlattenedRange(const FlattenedRange& other) : m_begin(other.m_begin), m_end(other.m_end), m_expand(other.m_expand), m_filter(other.m_filter)
+        {
+        }
+
+        FlattenedRange& operator=(const FlattenedRange&) = delete;
+
+        /**
+         * Get the iterator to the first element.
+         *
+         * @returns The iterator.
+         */
+        iterator begin() const
+        {
+            return iterator(m_begin, m_end, &m_expand, &m_filter);
+        }
+
+        /**
+         * Get the iterator past the last element.
+         *
+         * @returns The iterator.
+         */
+        iterator end() const
+        {
+            return iterator(m_end, m_end, &m_expand, &m_filter);
+        }
+
+        /**
+         * Check whether the range is empty.
+         *
+         * @returns `true` if the range contains no elements, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return begin() == end();
+        }
+
+        /**
+         * Get the number of elements in the range by iterating over it.
+         *
+         * @returns The number of elements.
+         */
+        u32 size() const
+        {
+            return (u32)std::distance(begin(), end());
+        }
+
+        /**
+         * Copy the elements of the range into a vector.
+         *
+         * @returns A vector containing the elements.
+         */
+        std::vector<value_type> to_vector() const
+        {
+            return std::vector<value_type>(begin(), end());
+        }
+
+    private:
+        OuterIterator m_begin;
+        OuterIterator m_end;
+        Expand m_expand;
+        Filter m_filter;
+    };
+
+    /**
+     * A filter that accepts every element.
+     *
+     * @ingroup utilities
+     */
+    struct AcceptAll
+    {
+        template<typename... Args>
+        constexpr bool operator()(Args&&...) const
+        {
+            return true;
+        }
+    };
+}    // namespace hal
@@ -74,7 +74,7 @@ namespace hal
 
         /**
          * Generates the function of the net using only the given gates.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
@@ -85,7 +85,7 @@ namespace hal
 
         /**
          * Generates the function of the dataport net of the given flip-flop.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
          *
          * @param[in] gate - Pointer to the flip-flop which data input net is used to build the Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
@@ -95,7 +95,7 @@ namespace hal
 
         /**
          * Generates the function of the net using only the given gates.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
@@ -105,7 +105,7 @@ namespace hal
 
         /**
          * Generates the function of the dataport net of the given flip-flop.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
          *
          * @param[in] gate - Pointer to the flip-flop which data input net is used to build the Boolean function.
          * @returns A map from the nets that appear in the function of the data net to their Boolean influence on said function on success, an error otherwise.
@@ -117,9 +117,10 @@ namespace hal
          *
          * @param[in] netlist - The netlist to extract the dependency matrix from.
          * @param[in] with_boolean_influence - True -- set Boolean influence, False -- sets 1.0 if connection between FFs
+         * @param[in] num_threads - The number of threads used to compute the Boolean influences, `0` to use one thread per hardware thread.
          * @returns A pair consisting of std::map<u32, Gate*>, which includes the mapping from the original gate
          *          IDs to the ones in the matrix, and a std::vector<std::vector<double>, which is the ff dependency matrix
          */
-        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* netlist, bool with_boolean_influence);
+        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* netlist, bool with_boolean_influence, u32 num_threads = 0);
     }    // namespace boolean_influence
 }    // namespace hal
\ No newline at end of file
@@ -122,8 +122,7 @@ namespace hal
             py::arg("bf"),
             py::arg("num_evaluations") = 32000,
             R"(
-            The Boolean function gets translated to a z3::expr and afterwards efficient c code.
-            The program is compiled and executed many times to measure the Boolean influence of each input variable.
+            The Boolean function gets compiled in-process and evaluated for many random input assignments, 64 at a time, to measure the Boolean influence of each input variable.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :param int num_evaluations: The amount of evaluations that are performed for each input variable.
@@ -176,7 +175,7 @@ namespace hal
             py::arg("num_evaluations") = 32000,
             R"(
             Generates the function of the net using only the given gates.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
 
             :param list[hal_py.Gate] gates: The gates of the subcircuit.
             :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
@@ -203,7 +202,7 @@ namespace hal
             py::arg("num_evaluations") = 32000,
             R"(
             Generates the function of the dataport net of the given flip-flop.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
 
             :param hal_py.Gate gate: The flip-flop which data input net is used to build the boolean function.
             :param int num_evaluations: The amount of evaluations that are performed for each input variable.
@@ -227,8 +226,7 @@ namespace hal
             },
             py::arg("bf"),
             R"(
-            The Boolean function gets translated to a z3::expr and afterwards efficient c code.
-            The program is compiled and executed exactly once for every possible input mapping to accurately determine the boolean influence of each variable.
+            The Boolean function gets compiled in-process and evaluated exactly once for every possible input mapping, 64 at a time, to accurately determine the boolean influence of each variable.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :returns: A dict from the variables that appear in the function to their Boolean influence on said function on success, None otherwise.
@@ -253,7 +251,7 @@ namespace hal
             py::arg("start_net"),
             R"(
             Generates the function of the net using only the given gates.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
 
             :param list[hal_py.Gate] gates: The gates of the subcircuit.
             :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
@@ -278,7 +276,7 @@ namespace hal
             py::arg("gate"),
             R"(
             Generates the function of the dataport net of the given flip-flop.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled in-process and evaluated for 64 input assignments at once.
 
             :param hal_py.Gate gate: The flip-flop which data input net is used to build the boolean function.
             :returns: A dict from the nets that appear in the function of the data net to their Boolean influence on said function on success, None otherwise.
@@ -287,8 +285,8 @@ namespace hal
 
         m.def(
             "get_ff_dependency_matrix",
-            [](const Netlist* nl, bool with_boolean_influence) -> std::optional<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> {
-                const auto res = boolean_influence::get_ff_dependency_matrix(nl, with_boolean_influence);
+            [](const Netlist* nl, bool with_boolean_influence, u32 num_threads) -> std::optional<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> {
+                const auto res = boolean_influence::get_ff_dependency_matrix(nl, with_boolean_influence, num_threads);
                 if (res.is_ok())
                 {
                     return res.get();
@@ -301,11 +299,13 @@ namespace hal
             },
             py::arg("netlist"),
             py::arg("with_boolean_influence"),
+            py::arg("num_threads") = 0,
             R"(
             Get the FF dependency matrix of a netlist, with or without boolean influences.
 
             :param hal_py.Netlist netlist: The netlist to extract the dependency matrix from.
             :param bool with_boolean_influence: True -- set boolean influence, False -- sets 1.0 if connection between FFs
+            :param int num_threads: The number of threads used to compute the Boolean influences, 0 to use one thread per hardware thread.
             :returns: A pair consisting of std::map<u32, Gate*>, which includes the mapping from the original gate
             :rtype: pair(dict(int, hal_py.Gate), list[list[double]])
         )");
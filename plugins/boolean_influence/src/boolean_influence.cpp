@@ -1,6 +1,7 @@
 #include "boolean_influence/boolean_influence.h"
 
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/netlist_traversal_decorator.h"
 #include "hal_core/netlist/gate.h"
@@ -9,8 +10,9 @@
 #include "z3_utils/subgraph_function_generation.h"
 #include "z3_utils/z3_utils.h"
 
-#include <filesystem>
-#include <fstream>
+#include <atomic>
+#include <optional>
+#include <thread>
 
 namespace hal
 {
@@ -18,108 +20,6 @@ namespace hal
     {
         namespace
         {
-            const std::string probabilistic_function = R"(
-#include <stdbool.h> 
-#include <stdio.h>
-#include <stdlib.h>
-
-static unsigned long x=123456789, y=362436069, z=521288629;
-
-// period 2^96-1
-unsigned long xorshf96(void) {          
-    unsigned long t;
-
-    x ^= x << 16;
-    x ^= x >> 5;
-    x ^= x << 1;
-
-    t = x;
-    x = y;
-    y = z;
-    z = t ^ x ^ y;
-
-    return z;
-}
-
-<C_FUNCTION>
-
-const int input_size = <INPUT_SIZE>;
-
-void build_values(bool* values) {
-    for (int i = 0; i < input_size; i++) {
-        bool random_value = xorshf96() % 2;
-        values[i] = random_value;
-    }
-
-    return;
-}
-
-int main(int argc, char *argv[]) {
-    unsigned long long b     = strtoull(argv[1], 0, 10);
-    unsigned long long num   = strtoull(argv[2], 0, 10);
-    unsigned long long count = 0;
-
-    bool values[input_size];
-    for (unsigned long long i = 0; i < num; i++) {
-        build_values(values);
-
-        values[b] = true;
-        bool r1 = func(values);
-
-        values[b] = false;
-        bool r2 = func(values);
-
-        if (r1 != r2) {
-            count++;
-        }
-    }
-
-    printf("%lld\n", count);
-
-    return int(count);
-})";
-
-            const std::string deterministic_function = R"(
-#include <stdbool.h> 
-#include <stdio.h>
-#include <stdlib.h>
-
-<C_FUNCTION>
-
-const int input_size = <INPUT_SIZE>;
-
-void build_values(bool* values, unsigned long long val) {
-    for (int idx = 0; idx < input_size; idx++) {
-        values[idx] = (val >> idx) & 0x1;
-    }
-
-    return;
-}
-
-int main(int argc, char *argv[]) {
-    unsigned long long b     = strtoull(argv[1], 0, 10);
-    unsigned long long count = 0;
-
-    bool values[input_size];
-    for (unsigned long long i = 0; i < (1 << input_size); i++) {
-        build_values(values, i);
-
-        values[b] = true;
-        bool r1 = func(values);
-
-        values[b] = false;
-        bool r2 = func(values);
-
-        if (r1 != r2) {
-            count++;
-        }
-    }
-
-    printf("%lld\n", count);
-
-    return int(count);
-})";
-
             // period 2^96-1
             unsigned long xorshf96(u64& x, u64& y, u64& z)
             {
@@ -137,164 +37,133 @@ int main(int argc, char *argv[]) {
                 return z;
             }
 
-            Result<std::unordered_map<std::string, double>> get_boolean_influence_internal(const z3::expr& expr, const u32 num_evaluations, const bool deterministic)
+            /**
+             * Computes the Boolean influence of every input variable using 64 evaluations per pass of the compiled function.
+             * In the probabilistic mode, the input assignments are drawn from the xorshf96 generator in the same order as the formerly generated C program,
+             * i.e., all variables in alphabetical order for one evaluation after another, so that the results are identical.
+             * In the deterministic mode, all 2^n input assignments are enumerated.
+             *
+             * @param[in] bf - The Boolean function.
+             * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable in the probabilistic mode.
+             * @param[in] deterministic - Set `true` to enumerate all input assignments, `false` to draw random input assignments.
+             * @returns A map from the variables that appear in the function to their Boolean influence on said function on success, an error otherwise.
+             */
+            Result<std::unordered_map<std::string, double>> get_boolean_influence_internal(const BooleanFunction& bf, const u32 num_evaluations, const bool deterministic)
             {
-                const auto to_replacement_var = [](const u32 var_idx) -> std::string { return "var_" + std::to_string(var_idx); };
-
-                const auto extract_index = [](const std::string& var) -> Result<u32> {
-                    if (!utils::starts_with(var, std::string("var_")))
-                    {
-                        return ERR("variable " + var + " does not start with prefix 'var_', so we cannot extract an index.");
-                    }
-
-                    try
-                    {
-                        return OK(u32(std::stoul(var.substr(4))));
-                    }
-                    catch (const std::invalid_argument& e)
-                    {
-                        return ERR("could not get index from string '" + var + "': " + e.what());
-                    }
-                    catch (const std::out_of_range& e)
-                    {
-                        return ERR("could not get index from string '" + var + "': " + e.what());
-                    }
-                };
-
-                const auto to_original_var = [extract_index](const std::string& replacement_var, const std::vector<std::string>& original_vars) -> Result<std::string> {
-                    const auto var_idx_res = extract_index(replacement_var);
-                    if (var_idx_res.is_error())
-                    {
-                        return ERR_APPEND(var_idx_res.get_error(), "unable to reconstruct original variable from replacement variable" + replacement_var + ": failed to extract index.");
-                    }
-                    const auto var_idx = var_idx_res.get();
-
-                    if (var_idx > original_vars.size())
-                    {
-                        return ERR("unable to reconstruct original variable from replacement variable" + replacement_var + ": extracted index " + std::to_string(var_idx)
-                                   + " is bigger than the size of the original vars (" + std::to_string(original_vars.size()) + ").");
-                    }
-
-                    return OK(original_vars.at(var_idx));
+                using Word = CompiledBooleanFunction::Word;
+
+                /// lane patterns enumerating the lowest six bits of the assignment counter
+                static constexpr u64 counter_patterns[6] = {
+                    0xAAAAAAAAAAAAAAAAull,
+                    0xCCCCCCCCCCCCCCCCull,
+                    0xF0F0F0F0F0F0F0F0ull,
+                    0xFF00FF00FF00FF00ull,
+                    0xFFFF0000FFFF0000ull,
+                    0xFFFFFFFF00000000ull,
                 };
 
                 std::unordered_map<std::string, double> influences;
 
-                // substitute all variables in the expression to be of the format var_<INDEX>.
-                // This allows for a more efficient translation into a c function
-                std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(expr));
+                const auto variable_names             = bf.get_variable_names();
+                const std::vector<std::string> inputs = utils::to_vector(variable_names);
 
-                if (input_vars.empty())
+                if (inputs.empty())
                 {
                     return OK(influences);
                 }
 
-                if (deterministic && input_vars.size() > 16)
+                if (deterministic && inputs.size() > 16)
                 {
-                    return ERR("unable to generate Boolean influence: Cannot evaluate Boolean function deterministically for more than 16 variables but got " + std::to_string(input_vars.size()));
+                    return ERR("unable to generate Boolean influence: Cannot evaluate Boolean function deterministically for more than 16 variables but got " + std::to_string(inputs.size()));
                 }
 
-                std::vector<std::string> replacement_vars;
-
-                z3::expr_vector from_vec(expr.ctx());
-                z3::expr_vector to_vec(expr.ctx());
-
-                for (u32 var_idx = 0; var_idx < input_vars.size(); var_idx++)
+                auto compiled_res = CompiledBooleanFunction::compile(bf, inputs);
+                if (compiled_res.is_error())
                 {
-                    replacement_vars.push_back(to_replacement_var(var_idx));
-
-                    z3::expr from = expr.ctx().bv_const(input_vars.at(var_idx).c_str(), 1);
-                    z3::expr to   = expr.ctx().bv_const(to_replacement_var(var_idx).c_str(), 1);
-
-                    from_vec.push_back(from);
-                    to_vec.push_back(to);
+                    return ERR_APPEND(compiled_res.get_error(), "unable to generate Boolean influence: failed to compile Boolean function");
                 }
+                const auto compiled = compiled_res.get();
 
-                auto replaced_e = expr;
-                replaced_e      = replaced_e.substitute(from_vec, to_vec);
-
-                // translate expression into a c program
-                auto directory_res = utils::get_unique_temp_directory("boolean_influence_");
-                if (directory_res.is_error())
+                for (u32 i = 0; i < inputs.size(); i++)
                 {
-                    return ERR_APPEND(directory_res.get_error(), "unable to generate Boolean influence: could not create temporary directory");
+                    if (compiled.get_variable_sizes().at(i) != 1)
+                    {
+                        return ERR("unable to generate Boolean influence: variable " + inputs.at(i) + " is not a single bit variable");
+                    }
                 }
-                const std::filesystem::path directory = directory_res.get();
-                std::filesystem::create_directory(directory);
-                const std::filesystem::path file_path = directory / "boolean_func.cpp";
 
-                std::string cpp_program = deterministic ? deterministic_function : probabilistic_function;
-                cpp_program             = utils::replace(cpp_program, std::string("<C_FUNCTION>"), z3_utils::to_cpp(replaced_e));
-                cpp_program             = utils::replace(cpp_program, std::string("<INPUT_SIZE>"), std::to_string(replacement_vars.size()));
+                const u64 real_evaluations = deterministic ? (1ull << inputs.size()) : num_evaluations;
 
-                // write cpp program to file
-                std::ofstream ofs(file_path);
-                if (!ofs.is_open())
-                {
-                    return ERR("unable to generate Boolean influence: could not open file " + file_path.string() + ".");
-                }
-                ofs << cpp_program;
+                std::vector<Word> values(inputs.size());
+                std::vector<Word> r1(compiled.size());
+                std::vector<Word> r2(compiled.size());
+                std::vector<u64> counts(inputs.size(), 0);
 
-                ofs.close();
+                u64 x = 123456789, y = 362436069, z = 521288629;
 
-                // compile the cpp file
-                const std::string program_name    = file_path.string().substr(0, file_path.string().size() - 4);
-                const std::string compile_command = "g++ -o " + program_name + " " + file_path.string() + " -O3";
-                int res                           = system(compile_command.c_str());
-                UNUSED(res);
-
-                // run boolean function program for every input
-                for (const auto& var : replacement_vars)
+                for (u64 offset = 0; offset < real_evaluations; offset += CompiledBooleanFunction::LANES)
                 {
-                    const auto idx_res = extract_index(var);
-                    if (idx_res.is_error())
-                    {
-                        return ERR_APPEND(idx_res.get_error(), "unable to generate Boolean influence: failed to extract index from variable " + var + ".");
-                    }
-                    const auto idx = idx_res.get();
-
-                    const std::string num_evaluations_str = deterministic ? "" : std::to_string(num_evaluations);
-
-                    const std::string run_command = program_name + " " + std::to_string(idx) + " " + num_evaluations_str + " 2>&1";
-
-                    std::array<char, 128> buffer;
-                    std::string result;
+                    const u64 lanes     = std::min<u64>(CompiledBooleanFunction::LANES, real_evaluations - offset);
+                    const u64 lane_mask = (lanes == CompiledBooleanFunction::LANES) ? ~0ull : ((1ull << lanes) - 1);
 
-                    FILE* pipe = popen(run_command.c_str(), "r");
-                    if (!pipe)
+                    // build values
+                    for (u32 idx = 0; idx < inputs.size(); idx++)
                     {
-                        return ERR("unable to generate Boolean influence: error during execution of compiled boolean program");
+                        values[idx] = Word();
+                        if (deterministic)
+                        {
+                            values[idx].value = (idx < 6) ? counter_patterns[idx] : (((offset >> idx) & 0x1) ? ~0ull : 0ull);
+                        }
                     }
-                    while (fgets(buffer.data(), 128, pipe) != NULL)
+                    if (!deterministic)
                     {
-                        result += buffer.data();
+                        for (u64 lane = 0; lane < lanes; lane++)
+                        {
+                            for (u32 idx = 0; idx < inputs.size(); idx++)
+                            {
+                                values[idx].value |= (u64)(xorshf96(x, y, z) % 2) << lane;
+                            }
+                        }
                     }
 
-                    pclose(pipe);
+                    // evaluate each variable fixed to 1 and to 0 and count the differing lanes
+                    for (u32 b = 0; b < inputs.size(); b++)
+                    {
+                        const auto value = values[b];
 
-                    const u32 count            = std::stoi(result);
-                    const u32 real_evaluations = deterministic ? (1 << input_vars.size()) : num_evaluations;
-                    double cv                  = (double)(count) / (double)(real_evaluations);
+                        values[b] = Word::broadcast(BooleanFunction::Value::ONE);
+                        compiled.evaluate(values.data(), r1.data());
 
-                    const auto org_var_res = to_original_var(var, input_vars);
-                    if (org_var_res.is_error())
-                    {
-                        return ERR_APPEND(org_var_res.get_error(), "unable to generate Boolean influence: failed to reconstruct original variable from replacement variable " + var + ".");
-                    }
-                    const auto org_var = org_var_res.get();
+                        values[b] = Word::broadcast(BooleanFunction::Value::ZERO);
+                        compiled.evaluate(values.data(), r2.data());
+
+                        values[b] = value;
 
-                    influences.insert({org_var, cv});
+                        u64 differing = 0;
+                        for (u32 i = 0; i < compiled.size(); i++)
+                        {
+                            differing |= (r1[i].value ^ r2[i].value) | (r1[i].unknown ^ r2[i].unknown);
+                        }
+                        counts[b] += __builtin_popcountll(differing & lane_mask);
+                    }
                 }
 
-                // delete files and temp directory
-                std::remove(file_path.string().c_str());
-                std::remove(program_name.c_str());
-                std::filesystem::remove(directory);
+                for (u32 b = 0; b < inputs.size(); b++)
+                {
+                    influences.insert({inputs.at(b), (double)(counts[b]) / (double)(real_evaluations)});
+                }
 
                 return OK(influences);
             }
 
-            Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_internal(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations, const bool deterministic)
+            /**
+             * Builds the Boolean function of the given subcircuit using z3 to simplify the functions of the individual gates.
+             *
+             * @param[in] gates - The gates of the subcircuit.
+             * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
+             * @returns The Boolean function of the start net on success, an error otherwise.
+             */
+            Result<BooleanFunction> get_subcircuit_function(const std::vector<Gate*>& gates, const Net* start_net)
             {
                 for (const auto* gate : gates)
                 {
@@ -305,38 +174,40 @@ int main(int argc, char *argv[]) {
                     }
                 }
 
-                // Generate function for the data port
-                auto ctx  = z3::context();
-                auto func = z3::expr(ctx);
-
-                if (!gates.empty())
+                // edge case if the gates are empty
+                if (gates.empty())
                 {
-                    const auto func_res = z3_utils::get_subgraph_z3_function(gates, start_net, ctx);
-                    if (func_res.is_error())
-                    {
-                        return ERR_APPEND(func_res.get_error(),
-                                          "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id())
-                                              + ": failed to build subgraph function");
-                    }
-                    func = func_res.get();
+                    return OK(BooleanFunction::Var(BooleanFunctionNetDecorator(*start_net).get_boolean_variable_name(), 1));
                 }
-                // edge case if the gates are empty
-                else
+
+                // Generate function for the data port
+                auto ctx            = z3::context();
+                const auto func_res = z3_utils::get_subgraph_z3_function(gates, start_net, ctx);
+                if (func_res.is_error())
                 {
-                    func = ctx.bv_const(BooleanFunctionNetDecorator(*start_net).get_boolean_variable_name().c_str(), 1);
+                    return ERR_APPEND(func_res.get_error(),
+                                      "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ": failed to build subgraph function");
                 }
 
-                // Generate Boolean influences
-                const auto inf_res = get_boolean_influence_internal(func, num_evaluations, deterministic);
-                if (inf_res.is_error())
+                auto bf_res = z3_utils::to_bf(func_res.get());
+                if (bf_res.is_error())
                 {
-                    return ERR_APPEND(inf_res.get_error(),
+                    return ERR_APPEND(bf_res.get_error(),
                                       "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id())
-                                          + ": failed to get boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ".");
+                                          + ": failed to translate subgraph function to Boolean function");
                 }
-                const std::unordered_map<std::string, double> var_names_to_inf = inf_res.get();
+                return bf_res;
+            }
 
-                // translate net_ids back to nets
+            /**
+             * Translates the Boolean influences of the variables of a subcircuit function back to the nets they represent.
+             *
+             * @param[in] start_net - The output net of the subcircuit.
+             * @param[in] var_names_to_inf - The Boolean influences of the variables.
+             * @returns A map from the nets to their Boolean influence on success, an error otherwise.
+             */
+            Result<std::map<Net*, double>> get_net_influences(const Net* start_net, const std::unordered_map<std::string, double>& var_names_to_inf)
+            {
                 std::map<Net*, double> nets_to_inf;
 
                 Netlist* nl = start_net->get_netlist();
@@ -357,7 +228,34 @@ int main(int argc, char *argv[]) {
                 return OK(nets_to_inf);
             }
 
-            Result<std::map<Net*, double>> get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic)
+            Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_internal(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations, const bool deterministic)
+            {
+                const auto func_res = get_subcircuit_function(gates, start_net);
+                if (func_res.is_error())
+                {
+                    return ERR(func_res.get_error());
+                }
+
+                // Generate Boolean influences
+                const auto inf_res = get_boolean_influence_internal(func_res.get(), num_evaluations, deterministic);
+                if (inf_res.is_error())
+                {
+                    return ERR_APPEND(inf_res.get_error(),
+                                      "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id())
+                                          + ": failed to get boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ".");
+                }
+
+                // translate net_ids back to nets
+                return get_net_influences(start_net, inf_res.get());
+            }
+
+            /**
+             * Determines the data net of a flip-flop and the combinational gates in front of it.
+             *
+             * @param[in] gate - Pointer to the flip-flop.
+             * @returns The combinational gates and the data net on success, an error otherwise.
+             */
+            Result<std::pair<std::vector<Gate*>, const Net*>> get_data_subcircuit(const Gate* gate)
             {
                 if (!gate->get_type()->has_property(GateTypeProperty::ff))
                 {
@@ -388,7 +286,18 @@ int main(int argc, char *argv[]) {
                     return ERR_APPEND(function_gates_res.get_error(),
                                       "unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": failed to get combinational fan-in gates.");
                 }
-                const auto function_gates = utils::to_vector(function_gates_res.get());
+
+                return OK({utils::to_vector(function_gates_res.get()), data_net});
+            }
+
+            Result<std::map<Net*, double>> get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic)
+            {
+                const auto subcircuit_res = get_data_subcircuit(gate);
+                if (subcircuit_res.is_error())
+                {
+                    return ERR(subcircuit_res.get_error());
+                }
+                const auto& [function_gates, data_net] = subcircuit_res.get();
 
                 // Generate Boolean influences
                 const auto inf_res = get_boolean_influences_of_subcircuit_internal(function_gates, data_net, num_evaluations, deterministic);
@@ -406,28 +315,34 @@ int main(int argc, char *argv[]) {
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations)
         {
-            auto ctx         = z3::context();
-            const auto z3_bf = z3_utils::from_bf(bf, ctx);
-
-            return get_boolean_influence(z3_bf, num_evaluations);
+            return get_boolean_influence_internal(bf, num_evaluations, false);
         }
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence(const z3::expr& expr, const u32 num_evaluations)
         {
-            return get_boolean_influence_internal(expr, num_evaluations, false);
+            const auto bf_res = z3_utils::to_bf(expr);
+            if (bf_res.is_error())
+            {
+                return ERR_APPEND(bf_res.get_error(), "unable to generate Boolean influence: failed to translate z3 expression to Boolean function");
+            }
+
+            return get_boolean_influence_internal(bf_res.get(), num_evaluations, false);
         }
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const BooleanFunction& bf)
         {
-            auto ctx         = z3::context();
-            const auto z3_bf = z3_utils::from_bf(bf, ctx);
-
-            return get_boolean_influence_deterministic(z3_bf);
+            return get_boolean_influence_internal(bf, 0, true);
         }
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const z3::expr& expr)
         {
-            return get_boolean_influence_internal(expr, 0, true);
+            const auto bf_res = z3_utils::to_bf(expr);
+            if (bf_res.is_error())
+            {
+                return ERR_APPEND(bf_res.get_error(), "unable to generate Boolean influence: failed to translate z3 expression to Boolean function");
+            }
+
+            return get_boolean_influence_internal(bf_res.get(), 0, true);
         }
 
         Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations)
@@ -583,13 +498,13 @@ int main(int argc, char *argv[]) {
             return OK(influences);
         }
 
-        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* nl, bool with_boolean_influence)
+        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* nl, bool with_boolean_influence, u32 num_threads)
         {
             std::map<u32, Gate*> matrix_id_to_gate;
             std::map<Gate*, u32> gate_to_matrix_id;
             std::vector<std::vector<double>> matrix;
 
-            std::unordered_map<const Net*, std::set<Gate*>>* cache;
+            std::unordered_map<const Net*, std::set<Gate*>> cache;
 
             u32 matrix_gates = 0;
             for (const auto& gate : nl->get_gates())
@@ -603,40 +518,103 @@ int main(int argc, char *argv[]) {
                 matrix_gates++;
             }
 
-            u32 status_counter = 0;
-            for (const auto& [id, gate] : matrix_id_to_gate)
+            // the Boolean influences only depend on the data functions of the flip-flops, hence they are computed in parallel after the functions have been extracted from the netlist
+            std::vector<std::map<Net*, double>> boolean_influences(matrix_gates);
+            if (with_boolean_influence)
             {
-                if (status_counter % 100 == 0)
+                std::vector<const Net*> data_nets;
+                std::vector<BooleanFunction> data_functions;
+                for (const auto& [id, gate] : matrix_id_to_gate)
+                {
+                    const auto subcircuit_res = get_data_subcircuit(gate);
+                    if (subcircuit_res.is_error())
+                    {
+                        return ERR_APPEND(subcircuit_res.get_error(),
+                                          "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                                              + ".");
+                    }
+                    const auto& [function_gates, data_net] = subcircuit_res.get();
+
+                    auto func_res = get_subcircuit_function(function_gates, data_net);
+                    if (func_res.is_error())
+                    {
+                        return ERR_APPEND(func_res.get_error(),
+                                          "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                                              + ".");
+                    }
+                    data_nets.push_back(data_net);
+                    data_functions.push_back(func_res.get());
+                }
+
+                if (num_threads == 0)
                 {
-                    log_info("boolean_influence", "status {}/{} processed", status_counter, matrix_id_to_gate.size());
+                    num_threads = std::max(1u, std::thread::hardware_concurrency());
                 }
-                status_counter++;
-                std::vector<double> line_of_matrix;
+                num_threads = std::max(1u, std::min(num_threads, matrix_gates));
 
-                std::set<u32> gates_to_add;
-                const auto next_seq_gates = NetlistTraversalDecorator(*nl).get_next_sequential_gates(gate, false, {}, cache);
-                if (next_seq_gates.is_error())
+                std::vector<std::optional<Result<std::unordered_map<std::string, double>>>> inf_results(matrix_gates);
+                std::atomic<u32> next_gate      = 0;
+                std::atomic<u32> status_counter = 0;
+
+                auto worker = [&]() {
+                    for (u32 i = next_gate++; i < matrix_gates; i = next_gate++)
+                    {
+                        if (const u32 processed = status_counter++; processed % 100 == 0)
+                        {
+                            log_info("boolean_influence", "status {}/{} processed", processed, matrix_gates);
+                        }
+                        inf_results[i] = get_boolean_influence_internal(data_functions[i], 32000, false);
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                for (u32 i = 0; i < num_threads; i++)
                 {
-                    return ERR_APPEND(next_seq_gates.get_error(),
-                                      "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
-                                          + ": failed to get next sequential gates.");
+                    workers.emplace_back(worker);
                 }
-                for (const auto& pred_gate : next_seq_gates.get())
+                for (auto& thread : workers)
                 {
-                    gates_to_add.insert(gate_to_matrix_id[pred_gate]);
+                    thread.join();
                 }
-                std::map<Net*, double> boolean_influence_for_gate;
-                if (with_boolean_influence)
+
+                for (u32 i = 0; i < matrix_gates; i++)
                 {
-                    const auto inf_res = get_boolean_influences_of_gate(gate);
+                    const Gate* gate = matrix_id_to_gate.at(i);
+                    if (inf_results[i]->is_error())
+                    {
+                        return ERR_APPEND(inf_results[i]->get_error(),
+                                          "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                                              + ".");
+                    }
+
+                    const auto inf_res = get_net_influences(data_nets[i], inf_results[i]->get());
                     if (inf_res.is_error())
                     {
                         return ERR_APPEND(inf_res.get_error(),
                                           "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
                                               + ".");
                     }
-                    boolean_influence_for_gate = inf_res.get();
+                    boolean_influences[i] = inf_res.get();
+                }
+            }
+
+            for (const auto& [id, gate] : matrix_id_to_gate)
+            {
+                std::vector<double> line_of_matrix;
+
+                std::set<u32> gates_to_add;
+                const auto next_seq_gates = NetlistTraversalDecorator(*nl).get_next_sequential_gates(gate, false, {}, &cache);
+                if (next_seq_gates.is_error())
+                {
+                    return ERR_APPEND(next_seq_gates.get_error(),
+                                      "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                                          + ": failed to get next sequential gates.");
+                }
+                for (const auto& pred_gate : next_seq_gates.get())
+                {
+                    gates_to_add.insert(gate_to_matrix_id[pred_gate]);
                 }
+                auto& boolean_influence_for_gate = boolean_influences.at(id);
 
                 for (u32 i = 0; i < matrix_gates; i++)
                 {
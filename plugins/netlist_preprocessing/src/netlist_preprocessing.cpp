@@ -10,6 +10,7 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_bulk_edit.h"
 #include "hal_core/utilities/token_stream.h"
 #include "nlohmann/json.hpp"
 #include "rapidjson/document.h"
@@ -26,6 +27,8 @@ namespace hal
     {
         Result<u32> remove_unused_lut_inputs(Netlist* nl)
         {
+            NetlistBulkEdit bulk_edit(nl);
+
             u32 num_eps = 0;
 
             // get net connected to GND
@@ -85,6 +88,11 @@ namespace hal
                 }
             }
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not remove unused LUT endpoints from netlist with ID " + std::to_string(nl->get_id()) + ": failed to update module nets");
+            }
+
             log_info("netlist_preprocessing", "removed {} unused LUT endpoints from netlist with ID {}.", num_eps, nl->get_id());
             return OK(num_eps);
         }
@@ -378,12 +386,16 @@ namespace hal
 
         Result<u32> remove_redundant_gates(Netlist* nl, const std::function<bool(const Gate*)>& filter)
         {
+            NetlistBulkEdit bulk_edit(nl);
+
             auto config = hal::SMT::QueryConfig();
 
 #ifdef BITWUZLA_LIBRARY
             auto s_type = hal::SMT::SolverType::Bitwuzla;
             auto s_call = hal::SMT::SolverCall::Library;
             config      = config.with_solver(s_type).with_call(s_call);
+#else
+            config = config.with_call(hal::SMT::SolverCall::Library);
 #endif
             struct GateFingerprint
             {
@@ -466,6 +478,7 @@ namespace hal
                 }
 
                 std::vector<std::vector<Gate*>> duplicate_gates;
+                std::vector<std::vector<Gate*>> candidate_groups;
                 for (const auto& [fingerprint, gates] : fingerprinted_gates)
                 {
                     if (gates.size() == 1)
@@ -475,57 +488,95 @@ namespace hal
 
                     if (fingerprint.type->has_property(GateTypeProperty::combinational))
                     {
-                        std::set<const Gate*> visited;
-                        for (size_t i = 0; i < gates.size(); i++)
-                        {
-                            Gate* master_gate = gates.at(i);
-
-                            if (visited.find(master_gate) != visited.cend())
-                            {
-                                continue;
-                            }
+                        candidate_groups.push_back(gates);
+                    }
+                    else if (fingerprint.type->has_property(GateTypeProperty::ff))
+                    {
+                        duplicate_gates.push_back(std::move(gates));
+                    }
+                }
 
-                            std::vector<Gate*> current_duplicates = {master_gate};
+                // in each round, the first gate of every candidate group is compared against the remaining gates of its group
+                // all comparisons of a round are independent, hence they are solved as a single batch
+                while (!candidate_groups.empty())
+                {
+                    std::vector<std::vector<SMT::Constraint>> constraint_sets;
+                    std::vector<std::pair<size_t, size_t>> query_gate_indices;
+                    std::vector<std::vector<bool>> equal;
+                    for (size_t g = 0; g < candidate_groups.size(); g++)
+                    {
+                        const auto& gates = candidate_groups.at(g);
+                        Gate* master_gate = gates.front();
+                        equal.push_back(std::vector<bool>(gates.size(), true));
 
-                            for (size_t j = i + 1; j < gates.size(); j++)
+                        for (const auto* pin : master_gate->get_type()->get_output_pins())
+                        {
+                            const auto master_res = master_gate->get_resolved_boolean_function(pin);
+                            for (size_t j = 1; j < gates.size(); j++)
                             {
                                 Gate* current_gate = gates.at(j);
-                                bool equal         = true;
-                                for (const auto* pin : fingerprint.type->get_output_pins())
+                                if (master_res.is_error())
                                 {
-                                    const auto solver_res =
-                                        master_gate->get_resolved_boolean_function(pin)
-                                            .map<BooleanFunction>([pin, current_gate](BooleanFunction&& bf_master) {
-                                                return current_gate->get_resolved_boolean_function(pin).map<BooleanFunction>([bf_master = std::move(bf_master)](BooleanFunction&& bf_current) mutable {
-                                                    return BooleanFunction::Eq(std::move(bf_master), std::move(bf_current), 1);
-                                                });
-                                            })
-                                            .map<BooleanFunction>([](auto&& bf_eq) -> Result<BooleanFunction> { return BooleanFunction::Not(std::move(bf_eq), 1); })
-                                            .map<SMT::SolverResult>([&config](auto&& bf_not) -> Result<SMT::SolverResult> { return SMT::Solver({SMT::Constraint(std::move(bf_not))}).query(config); });
-
-                                    if (solver_res.is_error() || !solver_res.get().is_unsat())
-                                    {
-                                        equal = false;
-                                    }
+                                    equal[g][j] = false;
+                                    continue;
                                 }
 
-                                if (equal)
+                                const auto bf_res = current_gate->get_resolved_boolean_function(pin)
+                                                        .map<BooleanFunction>([&master_res](BooleanFunction&& bf_current) {
+                                                            return BooleanFunction::Eq(master_res.get().clone(), std::move(bf_current), 1);
+                                                        })
+                                                        .map<BooleanFunction>([](auto&& bf_eq) -> Result<BooleanFunction> { return BooleanFunction::Not(std::move(bf_eq), 1); });
+                                if (bf_res.is_error())
                                 {
-                                    current_duplicates.push_back(current_gate);
-                                    visited.insert(current_gate);
+                                    equal[g][j] = false;
+                                    continue;
                                 }
-                            }
 
-                            if (current_duplicates.size() > 1)
-                            {
-                                duplicate_gates.push_back(current_duplicates);
+                                constraint_sets.push_back({SMT::Constraint(bf_res.get().clone())});
+                                query_gate_indices.push_back({g, j});
                             }
                         }
                     }
-                    else if (fingerprint.type->has_property(GateTypeProperty::ff))
+
+                    const auto solver_results = SMT::Solver::query_batch(constraint_sets, config);
+                    for (size_t k = 0; k < solver_results.size(); k++)
                     {
-                        duplicate_gates.push_back(std::move(gates));
+                        if (solver_results.at(k).is_error() || !solver_results.at(k).get().is_unsat())
+                        {
+                            const auto& [g, j] = query_gate_indices.at(k);
+                            equal[g][j]        = false;
+                        }
+                    }
+
+                    std::vector<std::vector<Gate*>> next_candidate_groups;
+                    for (size_t g = 0; g < candidate_groups.size(); g++)
+                    {
+                        const auto& gates = candidate_groups.at(g);
+
+                        std::vector<Gate*> current_duplicates;
+                        std::vector<Gate*> remaining_gates;
+                        for (size_t j = 0; j < gates.size(); j++)
+                        {
+                            if (equal[g][j])
+                            {
+                                current_duplicates.push_back(gates.at(j));
+                            }
+                            else
+                            {
+                                remaining_gates.push_back(gates.at(j));
+                            }
+                        }
+
+                        if (current_duplicates.size() > 1)
+                        {
+                            duplicate_gates.push_back(std::move(current_duplicates));
+                        }
+                        if (remaining_gates.size() > 1)
+                        {
+                            next_candidate_groups.push_back(std::move(remaining_gates));
+                        }
                     }
+                    candidate_groups = std::move(next_candidate_groups);
                 }
 
                 std::set<Gate*> affected_gates;
@@ -615,12 +666,19 @@ namespace hal
 
             update_ff_replacements(ff_replacements);
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not remove redundant gates from netlist with ID " + std::to_string(nl->get_id()) + ": failed to update module nets");
+            }
+
             log_info("netlist_preprocessing", "removed {} redundant gates from netlist with ID {}.", num_gates, nl->get_id());
             return OK(num_gates);
         }
 
         Result<u32> remove_redundant_loops(Netlist* nl)
         {
+            NetlistBulkEdit bulk_edit(nl);
+
             struct LoopFingerprint
             {
                 std::map<const GateType*, u32> types;
@@ -879,12 +937,19 @@ namespace hal
 
             update_ff_replacements(ff_replacements);
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not remove redundant loops from netlist with ID " + std::to_string(nl->get_id()) + ": failed to update module nets");
+            }
+
             log_info("netlist_preprocessing", "removed {} redundant loops from netlist with ID {}.", num_gates, nl->get_id());
             return OK(num_gates);
         }
 
         Result<u32> remove_redundant_logic_trees(Netlist* nl)
         {
+            NetlistBulkEdit bulk_edit(nl);
+
             struct TreeFingerprint
             {
                 std::set<const Net*> external_inputs;
@@ -1018,11 +1083,18 @@ namespace hal
                 return ERR_APPEND(clean_up_res.get_error(), "Unable to remove redundant logic trees: failed to clean up dangling trees");
             }
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "Unable to remove redundant logic trees: failed to update module nets");
+            }
+
             return OK(clean_up_res.get() + counter);
         }
 
         Result<u32> remove_unconnected_gates(Netlist* nl)
         {
+            NetlistBulkEdit bulk_edit(nl);
+
             u32 num_gates = 0;
             std::vector<Gate*> to_delete;
             do
@@ -1059,6 +1131,11 @@ namespace hal
                 }
             } while (!to_delete.empty());
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not remove unconnected gates from netlist with ID " + std::to_string(nl->get_id()) + ": failed to update module nets");
+            }
+
             log_info("netlist_preprocessing", "removed {} unconnected gates from netlist with ID {}.", num_gates, nl->get_id());
             return OK(num_gates);
         }
@@ -1641,6 +1718,8 @@ namespace hal
                 return ERR("netlist is a nullptr");
             }
 
+            NetlistBulkEdit bulk_edit(nl);
+
             Net* gnd_net = nl->get_gnd_gates().empty() ? nullptr : nl->get_gnd_gates().front()->get_fan_out_nets().front();
             Net* vcc_net = nl->get_vcc_gates().empty() ? nullptr : nl->get_vcc_gates().front()->get_fan_out_nets().front();
 
@@ -1742,6 +1821,11 @@ namespace hal
                 total_replaced_dst_count += replaced_dst_count;
             }
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "unable to propagate constants: failed to update module nets");
+            }
+
             log_info("netlist_preprocessing", "replaced {} destinations with power/ground nets in total", total_replaced_dst_count);
             return OK(total_replaced_dst_count);
         }
@@ -1753,6 +1837,8 @@ namespace hal
                 return ERR("netlist is a nullptr");
             }
 
+            NetlistBulkEdit bulk_edit(nl);
+
             std::set<Gate*> gates_to_delete;
             for (auto* inv_gate : nl->get_gates([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::c_inverter); }))
             {
@@ -1828,6 +1914,11 @@ namespace hal
                 removed_ctr++;
             }
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "unable to remove consecutive inverters: failed to update module nets");
+            }
+
             return OK(removed_ctr);
         }
 
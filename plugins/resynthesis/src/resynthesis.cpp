@@ -8,6 +8,7 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_bulk_edit.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
 #include "hal_core/utilities/log.h"
@@ -210,6 +211,8 @@ namespace hal
 
         Result<std::monostate> delete_subgraph(Netlist* nl, const std::vector<Gate*> subgraph)
         {
+            NetlistBulkEdit bulk_edit(nl);
+
             // TODO currently only gates are deleted, not nets...
             for (const auto& g : subgraph)
             {
@@ -220,6 +223,11 @@ namespace hal
                 }
             }
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "unable to delete subgraph: failed to update module nets");
+            }
+
             return OK({});
         }
 
@@ -945,6 +953,7 @@ namespace hal
                 to_delete.push_back(g);
             }
 
+            NetlistBulkEdit bulk_edit(nl);
             for (const auto& g : to_delete)
             {
                 counter += 1;
@@ -954,6 +963,11 @@ namespace hal
                 }
             }
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "unable to re-synthesize gates: failed to update module nets");
+            }
+
             // delete the created directory and the contained files
             std::filesystem::remove_all(base_path);
 
@@ -1086,6 +1100,10 @@ namespace hal
 
             const auto dst_gl = dst_nl->get_gate_library();
 
+            // merging nets transfers module pins and therefore requires up-to-date module nets, so it is postponed until the bulk edit has been committed
+            NetlistBulkEdit bulk_edit(dst_nl);
+            std::vector<std::tuple<Net*, Net*, const Net*>> nets_to_merge;
+
             // add all gates of the source netlist to the destination netlist
             for (const auto src_g : src_nl->get_gates())
             {
@@ -1147,12 +1165,7 @@ namespace hal
 
                             for (u32 i = 1; i < net_connections.size(); i++)
                             {
-                                const auto& res = NetlistModificationDecorator(*dst_nl).connect_nets(new_net, net_connections.at(i));
-                                if (res.is_error())
-                                {
-                                    return ERR("unable to replace subgraph with netlist: failed to connect/merge all the net connections of net '" + src_n->get_name() + "' with ID "
-                                               + std::to_string(src_n->get_id()));
-                                }
+                                nets_to_merge.push_back({new_net, net_connections.at(i), src_n});
                             }
                         }
                         else
@@ -1213,6 +1226,21 @@ namespace hal
                 }
             }
 
+            if (const auto res = bulk_edit.commit(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "unable to replace subgraph with netlist: failed to update module nets");
+            }
+
+            for (const auto& [master_net, slave_net, src_n] : nets_to_merge)
+            {
+                const auto& res = NetlistModificationDecorator(*dst_nl).connect_nets(master_net, slave_net);
+                if (res.is_error())
+                {
+                    return ERR("unable to replace subgraph with netlist: failed to connect/merge all the net connections of net '" + src_n->get_name() + "' with ID "
+                               + std::to_string(src_n->get_id()));
+                }
+            }
+
             // delete subgraph gates if flag is set
             if (delete_subgraph_gates)
             {
@@ -312,16 +312,16 @@ namespace hal
                 {
                     case BooleanFunction::NodeType::Constant: {
                         std::string str;
-                        for (const auto& value : node.constant)
+                        for (const auto& value : node.constant())
                         {
                             str = enum_to_string(value) + str;
                         }
-                        return OK(std::to_string(node.constant.size()) + "'b" + str);
+                        return OK(std::to_string(node.size) + "'b" + str);
                     }
                     case BooleanFunction::NodeType::Index:
-                        return OK(std::to_string(node.index));
+                        return OK(std::to_string(node.index()));
                     case BooleanFunction::NodeType::Variable:
-                        return OK(node.variable);
+                        return OK(node.variable());
                     case BooleanFunction::NodeType::And:
                         return OK("(" + operands[0] + " & " + operands[1] + ")");
                     case BooleanFunction::NodeType::Not:
@@ -29,16 +29,17 @@ namespace hal
                 switch (node.type)
                 {
                     case BooleanFunction::NodeType::Index:
-                        return {true, context.bv_val(node.index, node.size)};
+                        return {true, context.bv_val(node.index(), node.size)};
                     case BooleanFunction::NodeType::Constant: {
                         std::vector<u8> bits;
-                        for (u32 i = 0; i < node.constant.size(); i++)
+                        const auto constant = node.constant();
+                        for (u32 i = 0; i < constant.size(); i++)
                         {
-                            if (node.constant.at(i) == BooleanFunction::Value::ONE)
+                            if (constant.at(i) == BooleanFunction::Value::ONE)
                             {
                                 bits.push_back(1);
                             }
-                            else if (node.constant.at(i) == BooleanFunction::Value::ZERO)
+                            else if (constant.at(i) == BooleanFunction::Value::ZERO)
                             {
                                 bits.push_back(0);
                             }
@@ -51,11 +52,11 @@ namespace hal
                         return {true, context.bv_val(bits.size(), reinterpret_cast<bool*>(bits.data()))};
                     }
                     case BooleanFunction::NodeType::Variable: {
-                        if (auto it = var2expr.find(node.variable); it != var2expr.end())
+                        if (auto it = var2expr.find(node.variable()); it != var2expr.end())
                         {
                             return {true, it->second};
                         }
-                        return {true, context.bv_const(node.variable.c_str(), node.size)};
+                        return {true, context.bv_const(node.variable().c_str(), node.size)};
                     }
 
                     case BooleanFunction::NodeType::And:
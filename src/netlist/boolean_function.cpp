@@ -1,8 +1,11 @@
 #include "hal_core/netlist/boolean_function.h"
 
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
 #include "hal_core/netlist/boolean_function/parser.h"
 #include "hal_core/netlist/boolean_function/simplification.h"
+#include "hal_core/netlist/boolean_function/simplification_cache.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
+#include "hal_core/netlist/intern_table.h"
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
 
@@ -889,7 +892,7 @@ namespace hal
         {
             if (node.is_variable())
             {
-                variable_names.insert(node.variable);
+                variable_names.insert(node.variable());
             }
         }
         return variable_names;
@@ -1082,11 +1085,13 @@ namespace hal
 
     BooleanFunction BooleanFunction::simplify() const
     {
-        auto simplified = Simplification::local_simplification(*this).map<BooleanFunction>([](const auto& s) { return Simplification::abc_simplification(s); }).map<BooleanFunction>([](const auto& s) {
-            return Simplification::local_simplification(s);
-        });
+        return SimplificationCache::get_global_cache().simplify(*this, [](const BooleanFunction& function) {
+            auto simplified = Simplification::local_simplification(function).map<BooleanFunction>([](const auto& s) { return Simplification::abc_simplification(s); }).map<BooleanFunction>([](const auto& s) {
+                return Simplification::local_simplification(s);
+            });
 
-        return (simplified.is_ok()) ? simplified.get() : this->clone();
+            return (simplified.is_ok()) ? simplified.get() : function.clone();
+        });
     }
 
     BooleanFunction BooleanFunction::simplify_local() const
@@ -1167,7 +1172,7 @@ namespace hal
         auto substitute_variable = [substitutions](const auto& node, auto&& operands) -> BooleanFunction {
             if (node.is_variable())
             {
-                if (auto repl_it = substitutions.find(node.variable); repl_it != substitutions.end())
+                if (auto repl_it = substitutions.find(node.variable()); repl_it != substitutions.end())
                 {
                     return repl_it->second.clone();
                 }
@@ -1260,7 +1265,7 @@ namespace hal
         {
             if (auto value = result.get(); value.is_constant())
             {
-                return OK(value.get_top_level_node().constant);
+                return OK(value.get_top_level_node().constant());
             }
             return OK(std::vector<BooleanFunction::Value>(this->size(), BooleanFunction::Value::X));
         }
@@ -1311,7 +1316,25 @@ namespace hal
 
         std::vector<std::vector<Value>> truth_table(this->size(), std::vector<Value>(1 << variables.size(), Value::ZERO));
 
-        // (5) iterate the truth-table rows and set each column accordingly
+        // (5) evaluate 64 rows at once using the compiled evaluator, which
+        //     fails for unsupported operations or incomplete variable orders
+        if (const auto compiled = CompiledBooleanFunction::compile(*this, variables); compiled.is_ok())
+        {
+            if (const auto packed = compiled.get().compute_truth_table(); packed.is_ok())
+            {
+                for (auto index = 0u; index < truth_table.size(); index++)
+                {
+                    const auto& column = packed.get().at(index);
+                    for (auto value = 0u; value < ((u32)1 << variables.size()); value++)
+                    {
+                        truth_table[index][value] = column[value >> 6].get(value & 0x3F);
+                    }
+                }
+                return OK(truth_table);
+            }
+        }
+
+        // (6) otherwise, iterate the truth-table rows and set each column accordingly
         for (auto value = 0u; value < ((u32)1 << variables.size()); value++)
         {
             std::unordered_map<std::string, std::vector<Value>> input;
@@ -1336,6 +1359,63 @@ namespace hal
         return OK(truth_table);
     }
 
+    Result<std::vector<std::vector<u64>>> BooleanFunction::compute_packed_truth_table(const std::vector<std::string>& ordered_variables, bool remove_unknown_variables) const
+    {
+        if (this->m_nodes.empty())
+        {
+            return ERR("could not compute packed truth table: Boolean function is empty");
+        }
+
+        // (1) select either parameter or the Boolean function variables
+        auto variable_names_in_function = this->get_variable_names();
+        auto variables                  = ordered_variables;
+        if (variables.empty())
+        {
+            variables = std::vector<std::string>(variable_names_in_function.begin(), variable_names_in_function.end());
+        }
+
+        // (2) remove any unknown variables from the truth table
+        if (remove_unknown_variables)
+        {
+            variables.erase(
+                std::remove_if(variables.begin(), variables.end(), [&variable_names_in_function](const auto& s) { return variable_names_in_function.find(s) == variable_names_in_function.end(); }),
+                variables.end());
+        }
+
+        // (3) compile the function and evaluate the rows word-parallel
+        const auto compiled = CompiledBooleanFunction::compile(*this, variables);
+        if (compiled.is_error())
+        {
+            return ERR_APPEND(compiled.get_error(), "could not compute packed truth table for Boolean function '" + this->to_string() + "': unable to compile Boolean function");
+        }
+
+        const auto packed = compiled.get().compute_truth_table();
+        if (packed.is_error())
+        {
+            return ERR_APPEND(packed.get_error(), "could not compute packed truth table for Boolean function '" + this->to_string() + "': unable to evaluate Boolean function");
+        }
+
+        // (4) strip the dual-rail encoding, which requires all values to be known
+        std::vector<std::vector<u64>> truth_table;
+        truth_table.reserve(packed.get().size());
+        for (const auto& column : packed.get())
+        {
+            std::vector<u64> bits;
+            bits.reserve(column.size());
+            for (const auto& word : column)
+            {
+                if (word.unknown != 0)
+                {
+                    return ERR("could not compute packed truth table for Boolean function '" + this->to_string() + "': truth table contains 'X' or 'Z' values");
+                }
+                bits.push_back(word.value);
+            }
+            truth_table.push_back(std::move(bits));
+        }
+
+        return OK(truth_table);
+    }
+
     Result<std::string> BooleanFunction::get_truth_table_as_string(const std::vector<std::string>& ordered_inputs, std::string function_name, bool remove_unknown_inputs) const
     {
         std::vector<std::string> inputs;
@@ -1440,24 +1520,25 @@ namespace hal
             switch (node.type)
             {
                 case BooleanFunction::NodeType::Index:
-                    return {true, context.bv_val(node.index, node.size)};
+                    return {true, context.bv_val(node.index(), node.size)};
                 case BooleanFunction::NodeType::Constant: {
                     // since our constants are defined as arbitrary bit-vectors,
                     // we have to concat each bit just to be on the safe side
-                    auto constant = context.bv_val(node.constant.front(), 1);
-                    for (u32 i = 1; i < node.constant.size(); i++)
+                    const auto values = node.constant();
+                    auto constant     = context.bv_val(values.front(), 1);
+                    for (u32 i = 1; i < values.size(); i++)
                     {
-                        const auto bit = node.constant.at(i);
+                        const auto bit = values.at(i);
                         constant       = z3::concat(context.bv_val(bit, 1), constant);
                     }
                     return {true, constant};
                 }
                 case BooleanFunction::NodeType::Variable: {
-                    if (auto it = var2expr.find(node.variable); it != var2expr.end())
+                    if (auto it = var2expr.find(node.variable()); it != var2expr.end())
                     {
                         return {true, it->second};
                     }
-                    return {true, context.bv_const(node.variable.c_str(), node.size)};
+                    return {true, context.bv_const(node.variable().c_str(), node.size)};
                 }
 
                 case BooleanFunction::NodeType::And:
@@ -1606,29 +1687,90 @@ namespace hal
         return coverage;
     }
 
+    namespace
+    {
+        struct ValueVectorHash
+        {
+            std::size_t operator()(const std::vector<BooleanFunction::Value>& values) const
+            {
+                std::size_t seed = values.size();
+                for (const auto value : values)
+                {
+                    seed ^= static_cast<std::size_t>(value) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+                }
+                return seed;
+            }
+        };
+
+        // the tables are intentionally leaked so that they outlive all static Boolean functions, see BooleanFunction::Node
+        InternTable<std::string>& variable_table()
+        {
+            static auto* table = new InternTable<std::string>();
+            return *table;
+        }
+
+        InternTable<std::vector<BooleanFunction::Value>, ValueVectorHash>& constant_table()
+        {
+            static auto* table = new InternTable<std::vector<BooleanFunction::Value>, ValueVectorHash>();
+            return *table;
+        }
+
+        // dual-rail encoding with the known value in the lower bit and the unknown flag in the upper bit
+        u32 pack_value(BooleanFunction::Value value)
+        {
+            switch (value)
+            {
+                case BooleanFunction::Value::ZERO:
+                    return 0b00;
+                case BooleanFunction::Value::ONE:
+                    return 0b01;
+                case BooleanFunction::Value::X:
+                    return 0b10;
+                default:
+                    return 0b11;
+            }
+        }
+
+        BooleanFunction::Value unpack_value(u32 data, u16 i)
+        {
+            static constexpr BooleanFunction::Value values[4] = {BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE, BooleanFunction::Value::X, BooleanFunction::Value::Z};
+            return values[(data >> (2 * i)) & 0b11];
+        }
+    }    // namespace
+
     BooleanFunction::Node BooleanFunction::Node::Operation(u16 _type, u16 _size)
     {
-        return Node(_type, _size, {}, {}, {});
+        return Node(_type, _size, 0);
     }
 
     BooleanFunction::Node BooleanFunction::Node::Constant(const std::vector<BooleanFunction::Value> _constant)
     {
-        return Node(NodeType::Constant, _constant.size(), _constant, {}, {});
+        if (_constant.size() > MAX_PACKED_CONSTANT_SIZE)
+        {
+            return Node(NodeType::Constant, _constant.size(), constant_table().intern(_constant));
+        }
+
+        u32 packed = 0;
+        for (u16 i = 0; i < _constant.size(); i++)
+        {
+            packed |= pack_value(_constant[i]) << (2 * i);
+        }
+        return Node(NodeType::Constant, _constant.size(), packed);
     }
 
     BooleanFunction::Node BooleanFunction::Node::Index(u16 _index, u16 _size)
     {
-        return Node(NodeType::Index, _size, {}, _index, {});
+        return Node(NodeType::Index, _size, _index);
     }
 
     BooleanFunction::Node BooleanFunction::Node::Variable(const std::string _variable, u16 _size)
     {
-        return Node(NodeType::Variable, _size, {}, {}, _variable);
+        return Node(NodeType::Variable, _size, variable_table().intern(_variable));
     }
 
     bool BooleanFunction::Node::operator==(const Node& other) const
     {
-        return std::tie(this->type, this->size, this->constant, this->index, this->variable) == std::tie(other.type, other.size, other.constant, other.index, other.variable);
+        return (this->type == other.type) && (this->size == other.size) && (this->data == other.data);
     }
 
     bool BooleanFunction::Node::operator!=(const Node& other) const
@@ -1638,12 +1780,74 @@ namespace hal
 
     bool BooleanFunction::Node::operator<(const Node& other) const
     {
-        return std::tie(this->type, this->size, this->constant, this->index, this->variable) < std::tie(other.type, other.size, other.constant, other.index, other.variable);
+        if (this->type != other.type)
+        {
+            return this->type < other.type;
+        }
+        if (this->size != other.size)
+        {
+            return this->size < other.size;
+        }
+        if (this->data == other.data)
+        {
+            return false;
+        }
+
+        // interned IDs are assigned in order of appearance, so the payloads are compared by their values to keep the order deterministic
+        switch (this->type)
+        {
+            case NodeType::Constant: {
+                if (this->size <= MAX_PACKED_CONSTANT_SIZE)
+                {
+                    for (u16 i = 0; i < this->size; i++)
+                    {
+                        if (const auto a = unpack_value(this->data, i), b = unpack_value(other.data, i); a != b)
+                        {
+                            return a < b;
+                        }
+                    }
+                    return false;
+                }
+                return constant_table().get(this->data) < constant_table().get(other.data);
+            }
+            case NodeType::Index:
+                return this->data < other.data;
+            case NodeType::Variable:
+                return this->variable() < other.variable();
+            default:
+                return false;
+        }
     }
 
     BooleanFunction::Node BooleanFunction::Node::clone() const
     {
-        return Node(this->type, this->size, this->constant, this->index, this->variable);
+        return *this;
+    }
+
+    std::vector<BooleanFunction::Value> BooleanFunction::Node::constant() const
+    {
+        if (this->size > MAX_PACKED_CONSTANT_SIZE)
+        {
+            return constant_table().get(this->data);
+        }
+
+        std::vector<BooleanFunction::Value> values;
+        values.reserve(this->size);
+        for (u16 i = 0; i < this->size; i++)
+        {
+            values.push_back(unpack_value(this->data, i));
+        }
+        return values;
+    }
+
+    u16 BooleanFunction::Node::index() const
+    {
+        return this->data;
+    }
+
+    const std::string& BooleanFunction::Node::variable() const
+    {
+        return variable_table().get(this->data);
     }
 
     std::string BooleanFunction::Node::to_string() const
@@ -1652,7 +1856,7 @@ namespace hal
         {
             case NodeType::Constant: {
                 std::string str;
-                for (const auto& value : this->constant)
+                for (const auto& value : this->constant())
                 {
                     str = enum_to_string(value) + str;
                 }
@@ -1660,9 +1864,9 @@ namespace hal
             }
 
             case NodeType::Index:
-                return std::to_string(this->index);
+                return std::to_string(this->index());
             case NodeType::Variable:
-                return this->variable;
+                return this->variable();
 
             case NodeType::And:
                 return "&";
@@ -1759,7 +1963,7 @@ namespace hal
 
     bool BooleanFunction::Node::has_constant_value(const std::vector<Value>& value) const
     {
-        return this->is_constant() && (this->constant == value);
+        return this->is_constant() && (this->size == value.size()) && (this->constant() == value);
     }
 
     bool BooleanFunction::Node::has_constant_value(u64 value) const
@@ -1771,11 +1975,11 @@ namespace hal
 
         auto bv_value = std::vector<BooleanFunction::Value>({});
         bv_value.reserve(this->size);
-        for (auto i = 0u; i < this->constant.size(); i++)
+        for (auto i = 0u; i < this->size; i++)
         {
-            bv_value.emplace_back((value & (1 << i)) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO);
+            bv_value.emplace_back((i < 64 && (value & ((u64)1 << i))) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO);
         }
-        return this->constant == bv_value;
+        return this->constant() == bv_value;
     }
 
     Result<std::vector<BooleanFunction::Value>> BooleanFunction::Node::get_constant_value() const
@@ -1785,7 +1989,7 @@ namespace hal
             return ERR("Node is not a constant");
         }
 
-        return OK(this->constant);
+        return OK(this->constant());
     }
 
     Result<u64> BooleanFunction::Node::get_constant_value_u64() const
@@ -1800,13 +2004,14 @@ namespace hal
             return ERR("Node constant has size > 64");
         }
 
-        if (std::any_of(this->constant.begin(), this->constant.end(), [](auto v) { return v != BooleanFunction::Value::ONE && v != BooleanFunction::Value::ZERO; }))
+        const auto constant = this->constant();
+        if (std::any_of(constant.begin(), constant.end(), [](auto v) { return v != BooleanFunction::Value::ONE && v != BooleanFunction::Value::ZERO; }))
         {
             return ERR("Node constant is undefined or high-impedance");
         }
 
         u64 val = 0;
-        for (auto it = this->constant.rbegin(); it != this->constant.rend(); it++)
+        for (auto it = constant.rbegin(); it != constant.rend(); it++)
         {
             val <<= 1;
             val |= *it;
@@ -1822,7 +2027,7 @@ namespace hal
 
     bool BooleanFunction::Node::has_index_value(u16 value) const
     {
-        return this->is_index() && (this->index == value);
+        return this->is_index() && (this->index() == value);
     }
 
     Result<u16> BooleanFunction::Node::get_index_value() const
@@ -1832,7 +2037,7 @@ namespace hal
             return ERR("Node is not an index");
         }
 
-        return OK(this->index);
+        return OK(this->index());
     }
 
     bool BooleanFunction::Node::is_variable() const
@@ -1842,7 +2047,7 @@ namespace hal
 
     bool BooleanFunction::Node::has_variable_name(const std::string& value) const
     {
-        return this->is_variable() && (this->variable == value);
+        return this->is_variable() && (this->variable() == value);
     }
 
     Result<std::string> BooleanFunction::Node::get_variable_name() const
@@ -1852,7 +2057,7 @@ namespace hal
             return ERR("Node is not a variable");
         }
 
-        return OK(this->variable);
+        return OK(this->variable());
     }
 
     bool BooleanFunction::Node::is_operation() const
@@ -1871,8 +2076,7 @@ namespace hal
                || (this->type == NodeType::Eq);
     }
 
-    BooleanFunction::Node::Node(u16 _type, u16 _size, std::vector<BooleanFunction::Value> _constant, u16 _index, std::string _variable)
-        : type(_type), size(_size), constant(_constant), index(_index), variable(_variable)
+    BooleanFunction::Node::Node(u16 _type, u16 _size, u32 _data) : type(_type), size(_size), data(_data)
     {
     }
 
@@ -0,0 +1,426 @@
+#include "hal_core/netlist/boolean_function/boolean_function_dag.h"
+
+#include "hal_core/netlist/boolean_function/symbolic_execution.h"
+
+namespace hal
+{
+    namespace
+    {
+        /// Prefix of the placeholder variables that stand in for DAG nodes during local simplification.
+        const std::string PLACEHOLDER_PREFIX = "__dag_node_";
+
+        /// Operands whose expanded size does not exceed this limit are inlined into the local view of a node during simplification.
+        constexpr u64 SIMPLIFICATION_INLINE_LIMIT = 16;
+
+        u64 saturating_add(u64 a, u64 b)
+        {
+            return (a > std::numeric_limits<u64>::max() - b) ? std::numeric_limits<u64>::max() : a + b;
+        }
+
+        void hash_combine(u64& seed, u64 value)
+        {
+            seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+    }    // namespace
+
+    Result<BooleanFunctionDAG::NodeId> BooleanFunctionDAG::add_node(const BooleanFunction::Node& node, const std::vector<NodeId>& operands)
+    {
+        if (node.get_arity() != operands.size())
+        {
+            return ERR("could not add node '" + node.to_string() + "' to DAG: expected " + std::to_string(node.get_arity()) + " operands but got " + std::to_string(operands.size()));
+        }
+
+        u64 expanded_size = 1;
+        for (const auto operand : operands)
+        {
+            if (operand >= m_nodes.size())
+            {
+                return ERR("could not add node '" + node.to_string() + "' to DAG: operand with ID " + std::to_string(operand) + " does not exist");
+            }
+            expanded_size = saturating_add(expanded_size, m_expanded_sizes[operand]);
+        }
+
+        const auto h            = hash(node, operands);
+        const auto [begin, end] = m_unique_table.equal_range(h);
+        for (auto it = begin; it != end; ++it)
+        {
+            if (m_operands[it->second] == operands && m_nodes[it->second] == node)
+            {
+                return OK(it->second);
+            }
+        }
+
+        const NodeId id = m_nodes.size();
+        m_nodes.push_back(node.clone());
+        m_operands.push_back(operands);
+        m_expanded_sizes.push_back(expanded_size);
+        m_unique_table.emplace(h, id);
+
+        return OK(id);
+    }
+
+    Result<BooleanFunctionDAG::NodeId> BooleanFunctionDAG::add(const BooleanFunction& function, const std::unordered_map<std::string, NodeId>& bindings)
+    {
+        if (function.is_empty())
+        {
+            return ERR("could not add Boolean function to DAG: function is empty");
+        }
+
+        std::vector<NodeId> stack;
+        for (const auto& node : function.get_nodes())
+        {
+            if (node.is_variable())
+            {
+                if (const auto it = bindings.find(node.variable()); it != bindings.end())
+                {
+                    if (it->second >= m_nodes.size())
+                    {
+                        return ERR("could not add Boolean function '" + function.to_string() + "' to DAG: variable '" + node.variable() + "' is bound to non-existing node with ID "
+                                   + std::to_string(it->second));
+                    }
+                    if (m_nodes[it->second].size != node.size)
+                    {
+                        return ERR("could not add Boolean function '" + function.to_string() + "' to DAG: variable '" + node.variable() + "' of size " + std::to_string(node.size)
+                                   + " is bound to node of size " + std::to_string(m_nodes[it->second].size));
+                    }
+                    stack.push_back(it->second);
+                    continue;
+                }
+            }
+
+            const auto arity = node.get_arity();
+            if (stack.size() < arity)
+            {
+                return ERR("could not add Boolean function '" + function.to_string() + "' to DAG: stack is imbalanced");
+            }
+
+            std::vector<NodeId> operands(stack.end() - arity, stack.end());
+            stack.erase(stack.end() - arity, stack.end());
+
+            if (auto res = add_node(node, operands); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not add Boolean function '" + function.to_string() + "' to DAG: unable to add node");
+            }
+            else
+            {
+                stack.push_back(res.get());
+            }
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not add Boolean function '" + function.to_string() + "' to DAG: stack is imbalanced");
+        }
+
+        return OK(stack.back());
+    }
+
+    Result<BooleanFunction> BooleanFunctionDAG::to_boolean_function(NodeId root, u64 max_size) const
+    {
+        if (root >= m_nodes.size())
+        {
+            return ERR("could not convert DAG node with ID " + std::to_string(root) + " to Boolean function: node does not exist");
+        }
+        if (m_expanded_sizes[root] > max_size)
+        {
+            return ERR("could not convert DAG node with ID " + std::to_string(root) + " to Boolean function: expanded function exceeds the maximum size of " + std::to_string(max_size)
+                       + " nodes");
+        }
+
+        std::vector<BooleanFunction::Node> nodes;
+        nodes.reserve(m_expanded_sizes[root]);
+        append_nodes(root, nodes);
+
+        return BooleanFunction::build(std::move(nodes));
+    }
+
+    const BooleanFunction::Node& BooleanFunctionDAG::get_node(NodeId id) const
+    {
+        return m_nodes.at(id);
+    }
+
+    const std::vector<BooleanFunctionDAG::NodeId>& BooleanFunctionDAG::get_operands(NodeId id) const
+    {
+        return m_operands.at(id);
+    }
+
+    u32 BooleanFunctionDAG::size() const
+    {
+        return m_nodes.size();
+    }
+
+    u32 BooleanFunctionDAG::get_size(NodeId root) const
+    {
+        return get_reachable_nodes(root).size();
+    }
+
+    u64 BooleanFunctionDAG::get_expanded_size(NodeId root) const
+    {
+        return m_expanded_sizes.at(root);
+    }
+
+    std::set<std::string> BooleanFunctionDAG::get_variable_names(NodeId root) const
+    {
+        std::set<std::string> names;
+        for (const auto id : get_reachable_nodes(root))
+        {
+            if (m_nodes[id].is_variable())
+            {
+                names.insert(m_nodes[id].variable());
+            }
+        }
+        return names;
+    }
+
+    Result<BooleanFunctionDAG::NodeId> BooleanFunctionDAG::substitute(NodeId root, const std::unordered_map<std::string, NodeId>& substitutions)
+    {
+        if (root >= m_nodes.size())
+        {
+            return ERR("could not substitute variables of DAG node with ID " + std::to_string(root) + ": node does not exist");
+        }
+
+        std::unordered_map<NodeId, NodeId> replaced;
+        for (const auto id : get_reachable_nodes(root))
+        {
+            const auto node = m_nodes[id].clone();
+            if (node.is_variable())
+            {
+                if (const auto it = substitutions.find(node.variable()); it != substitutions.end())
+                {
+                    if (it->second >= m_nodes.size() || m_nodes[it->second].size != node.size)
+                    {
+                        return ERR("could not substitute variables of DAG node with ID " + std::to_string(root) + ": substitution for variable '" + node.variable()
+                                   + "' does not exist or is of different size");
+                    }
+                    replaced[id] = it->second;
+                    continue;
+                }
+            }
+
+            std::vector<NodeId> operands = m_operands[id];
+            bool changed                 = false;
+            for (auto& operand : operands)
+            {
+                if (const auto it = replaced.find(operand); it != replaced.end() && it->second != operand)
+                {
+                    operand = it->second;
+                    changed = true;
+                }
+            }
+
+            if (!changed)
+            {
+                replaced[id] = id;
+            }
+            else if (auto res = add_node(node, operands); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not substitute variables of DAG node with ID " + std::to_string(root) + ": unable to add node");
+            }
+            else
+            {
+                replaced[id] = res.get();
+            }
+        }
+
+        return OK(replaced.at(root));
+    }
+
+    Result<BooleanFunctionDAG::NodeId> BooleanFunctionDAG::simplify(NodeId root)
+    {
+        if (root >= m_nodes.size())
+        {
+            return ERR("could not simplify DAG node with ID " + std::to_string(root) + ": node does not exist");
+        }
+
+        const auto symbolic_execution = SMT::SymbolicExecution();
+
+        std::unordered_map<NodeId, NodeId> simplified;
+        for (const auto id : get_reachable_nodes(root))
+        {
+            if (m_operands[id].empty())
+            {
+                simplified[id] = id;
+                continue;
+            }
+
+            // build a local view of the node in which small operands are inlined and all others are replaced by placeholder variables
+            std::vector<BooleanFunction::Node> nodes;
+            std::unordered_map<std::string, NodeId> bindings;
+            for (const auto operand : m_operands[id])
+            {
+                const auto simplified_operand = simplified.at(operand);
+                if (m_expanded_sizes[simplified_operand] <= SIMPLIFICATION_INLINE_LIMIT)
+                {
+                    append_nodes(simplified_operand, nodes);
+                }
+                else
+                {
+                    const auto placeholder = PLACEHOLDER_PREFIX + std::to_string(simplified_operand);
+                    nodes.push_back(BooleanFunction::Node::Variable(placeholder, m_nodes[simplified_operand].size));
+                    bindings.emplace(placeholder, simplified_operand);
+                }
+            }
+            nodes.push_back(m_nodes[id].clone());
+
+            auto function = BooleanFunction::build(std::move(nodes));
+            if (function.is_error())
+            {
+                return ERR_APPEND(function.get_error(), "could not simplify DAG node with ID " + std::to_string(root) + ": unable to build local function of node with ID " + std::to_string(id));
+            }
+
+            auto result = symbolic_execution.evaluate(function.get());
+            if (result.is_error())
+            {
+                return ERR_APPEND(result.get_error(), "could not simplify DAG node with ID " + std::to_string(root) + ": unable to simplify local function of node with ID " + std::to_string(id));
+            }
+
+            if (auto res = add(result.get(), bindings); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not simplify DAG node with ID " + std::to_string(root) + ": unable to add simplified function of node with ID " + std::to_string(id));
+            }
+            else
+            {
+                simplified[id] = res.get();
+            }
+        }
+
+        return OK(simplified.at(root));
+    }
+
+    Result<std::vector<BooleanFunction::Value>> BooleanFunctionDAG::evaluate(NodeId root, const std::unordered_map<std::string, std::vector<BooleanFunction::Value>>& inputs) const
+    {
+        if (root >= m_nodes.size())
+        {
+            return ERR("could not evaluate DAG node with ID " + std::to_string(root) + ": node does not exist");
+        }
+
+        const auto symbolic_execution = SMT::SymbolicExecution();
+
+        // every node is reduced to either a constant or an index node
+        std::unordered_map<NodeId, BooleanFunction::Node> values;
+        for (const auto id : get_reachable_nodes(root))
+        {
+            const auto& node = m_nodes[id];
+            if (node.is_variable())
+            {
+                const auto it = inputs.find(node.variable());
+                if (it == inputs.end())
+                {
+                    return ERR("could not evaluate DAG node with ID " + std::to_string(root) + ": no value has been assigned to variable '" + node.variable() + "'");
+                }
+                if (it->second.size() != node.size)
+                {
+                    return ERR("could not evaluate DAG node with ID " + std::to_string(root) + ": value assigned to variable '" + node.variable() + "' is of size " + std::to_string(it->second.size())
+                               + " but variable is of size " + std::to_string(node.size));
+                }
+                values.emplace(id, BooleanFunction::Node::Constant(it->second));
+                continue;
+            }
+            if (m_operands[id].empty())
+            {
+                values.emplace(id, node.clone());
+                continue;
+            }
+
+            std::vector<BooleanFunction::Node> nodes;
+            for (const auto operand : m_operands[id])
+            {
+                nodes.push_back(values.at(operand).clone());
+            }
+            nodes.push_back(node.clone());
+
+            auto function = BooleanFunction::build(std::move(nodes));
+            if (function.is_error())
+            {
+                return ERR_APPEND(function.get_error(), "could not evaluate DAG node with ID " + std::to_string(root) + ": unable to build local function of node with ID " + std::to_string(id));
+            }
+
+            auto result = symbolic_execution.evaluate(function.get());
+            if (result.is_error())
+            {
+                return ERR_APPEND(result.get_error(), "could not evaluate DAG node with ID " + std::to_string(root) + ": unable to evaluate node with ID " + std::to_string(id));
+            }
+            if (!result.get().is_constant())
+            {
+                return ERR("could not evaluate DAG node with ID " + std::to_string(root) + ": node with ID " + std::to_string(id) + " did not evaluate to a constant");
+            }
+            values.emplace(id, result.get().get_top_level_node().clone());
+        }
+
+        return OK(values.at(root).constant());
+    }
+
+    void BooleanFunctionDAG::clear()
+    {
+        m_nodes.clear();
+        m_operands.clear();
+        m_expanded_sizes.clear();
+        m_unique_table.clear();
+    }
+
+    u64 BooleanFunctionDAG::hash(const BooleanFunction::Node& node, const std::vector<NodeId>& operands)
+    {
+        // interned variable names and constants are unique, so the payload of a node identifies it completely
+        u64 seed = (static_cast<u64>(node.type) << 48) | (static_cast<u64>(node.size) << 32) | node.data;
+        for (const auto operand : operands)
+        {
+            hash_combine(seed, operand);
+        }
+        return seed;
+    }
+
+    std::vector<BooleanFunctionDAG::NodeId> BooleanFunctionDAG::get_reachable_nodes(NodeId root) const
+    {
+        if (root >= m_nodes.size())
+        {
+            return {};
+        }
+
+        std::vector<bool> visited(root + 1, false);
+        std::vector<NodeId> stack = {root};
+        visited[root]             = true;
+        while (!stack.empty())
+        {
+            const auto id = stack.back();
+            stack.pop_back();
+            for (const auto operand : m_operands[id])
+            {
+                if (!visited[operand])
+                {
+                    visited[operand] = true;
+                    stack.push_back(operand);
+                }
+            }
+        }
+
+        std::vector<NodeId> reachable;
+        for (NodeId id = 0; id <= root; id++)
+        {
+            if (visited[id])
+            {
+                reachable.push_back(id);
+            }
+        }
+        return reachable;
+    }
+
+    void BooleanFunctionDAG::append_nodes(NodeId root, std::vector<BooleanFunction::Node>& nodes) const
+    {
+        // iterative post-order traversal, as deep DAGs would otherwise overflow the call stack
+        std::vector<std::pair<NodeId, u32>> stack = {{root, 0}};
+        while (!stack.empty())
+        {
+            auto& [id, next_operand] = stack.back();
+            if (next_operand < m_operands[id].size())
+            {
+                const auto operand = m_operands[id][next_operand++];
+                stack.push_back({operand, 0});
+            }
+            else
+            {
+                nodes.push_back(m_nodes[id].clone());
+                stack.pop_back();
+            }
+        }
+    }
+}    // namespace hal
@@ -0,0 +1,691 @@
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+
+#include <algorithm>
+#include <map>
+
+namespace hal
+{
+    namespace
+    {
+        /// Helper function to get a register file of at least the given size that is reused by all evaluations on the calling thread.
+        std::vector<CompiledBooleanFunction::Word>& get_thread_registers(u32 size)
+        {
+            thread_local std::vector<CompiledBooleanFunction::Word> registers;
+            if (registers.size() < size)
+            {
+                registers.resize(size);
+            }
+            return registers;
+        }
+
+        /// Helper function to check whether the trailing parameters of a node type are of type `Index`.
+        bool takes_index_operands(u16 type)
+        {
+            switch (type)
+            {
+                case BooleanFunction::NodeType::Slice:
+                case BooleanFunction::NodeType::Zext:
+                case BooleanFunction::NodeType::Sext:
+                case BooleanFunction::NodeType::Shl:
+                case BooleanFunction::NodeType::Lshr:
+                case BooleanFunction::NodeType::Ashr:
+                case BooleanFunction::NodeType::Rol:
+                case BooleanFunction::NodeType::Ror:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        /// Helper function to compute the OR of all unknown masks of two register spans, i.e., the lanes in which an arithmetic operation yields `X`.
+        u64 unknown_lanes(const CompiledBooleanFunction::Word* a, const CompiledBooleanFunction::Word* b, u16 size)
+        {
+            u64 unknown = 0;
+            for (u16 i = 0; i < size; i++)
+            {
+                unknown |= a[i].unknown | b[i].unknown;
+            }
+            return unknown;
+        }
+
+        /// Helper function to add (or subtract if `negate` is set) two bitsliced register spans using a ripple-carry adder.
+        void add(CompiledBooleanFunction::Word* dst, const CompiledBooleanFunction::Word* a, const CompiledBooleanFunction::Word* b, u16 size, bool negate)
+        {
+            const u64 unknown = unknown_lanes(a, b, size);
+            const u64 flip    = negate ? ~u64(0) : u64(0);
+
+            u64 carry = flip;
+            for (u16 i = 0; i < size; i++)
+            {
+                const u64 av = a[i].value;
+                const u64 bv = b[i].value ^ flip;
+                const u64 s  = av ^ bv ^ carry;
+                carry        = (av & bv) | (carry & (av ^ bv));
+                dst[i]       = {s & ~unknown, unknown};
+            }
+        }
+
+        /// Helper function to multiply two bitsliced register spans using shift-and-add.
+        void mul(CompiledBooleanFunction::Word* dst, const CompiledBooleanFunction::Word* a, const CompiledBooleanFunction::Word* b, u16 size)
+        {
+            const u64 unknown = unknown_lanes(a, b, size);
+
+            for (u16 i = 0; i < size; i++)
+            {
+                dst[i] = {0, 0};
+            }
+
+            for (u16 i = 0; i < size; i++)
+            {
+                const u64 ai = a[i].value;
+                u64 carry    = 0;
+                for (u16 j = 0; j < size - i; j++)
+                {
+                    const u64 acc    = dst[i + j].value;
+                    const u64 pp     = b[j].value & ai;
+                    dst[i + j].value = acc ^ pp ^ carry;
+                    carry            = (acc & pp) | (carry & (acc ^ pp));
+                }
+            }
+
+            for (u16 i = 0; i < size; i++)
+            {
+                dst[i] = {dst[i].value & ~unknown, unknown};
+            }
+        }
+
+        /// Helper function to compute the lanes in which two bitsliced register spans hold the same value (including `X` and `Z`).
+        u64 equal_lanes(const CompiledBooleanFunction::Word* a, const CompiledBooleanFunction::Word* b, u16 size)
+        {
+            u64 diff = 0;
+            for (u16 i = 0; i < size; i++)
+            {
+                diff |= (a[i].value ^ b[i].value) | (a[i].unknown ^ b[i].unknown);
+            }
+            return ~diff;
+        }
+
+        /// Helper function to compare two bitsliced register spans, producing a single result word.
+        CompiledBooleanFunction::Word compare(const CompiledBooleanFunction::Word* a, const CompiledBooleanFunction::Word* b, u16 size, bool is_signed, bool or_equal)
+        {
+            const u64 unknown = unknown_lanes(a, b, size);
+
+            // borrow of a - b, i.e., a < b (unsigned)
+            u64 borrow = 0;
+            u64 equal  = ~u64(0);
+            for (u16 i = 0; i < size; i++)
+            {
+                const u64 av = a[i].value;
+                const u64 bv = b[i].value;
+                borrow       = (~av & bv) | (~(av ^ bv) & borrow);
+                equal &= ~(av ^ bv);
+            }
+
+            u64 less = borrow;
+            if (is_signed)
+            {
+                const u64 am = a[size - 1].value;
+                const u64 bm = b[size - 1].value;
+                less         = (am & ~bm) | (~(am ^ bm) & borrow);
+            }
+            if (or_equal)
+            {
+                less |= equal;
+            }
+
+            return {less & ~unknown, unknown};
+        }
+    }    // namespace
+
+    CompiledBooleanFunction::Word CompiledBooleanFunction::Word::broadcast(BooleanFunction::Value v)
+    {
+        switch (v)
+        {
+            case BooleanFunction::Value::ZERO:
+                return {0, 0};
+            case BooleanFunction::Value::ONE:
+                return {~u64(0), 0};
+            case BooleanFunction::Value::Z:
+                return {~u64(0), ~u64(0)};
+            default:
+                return {0, ~u64(0)};
+        }
+    }
+
+    BooleanFunction::Value CompiledBooleanFunction::Word::get(u32 lane) const
+    {
+        const bool v = (value >> lane) & 1;
+        if ((unknown >> lane) & 1)
+        {
+            return v ? BooleanFunction::Value::Z : BooleanFunction::Value::X;
+        }
+        return v ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+    }
+
+    void CompiledBooleanFunction::Word::set(u32 lane, BooleanFunction::Value v)
+    {
+        const u64 mask = u64(1) << lane;
+        const Word w   = broadcast(v);
+        value          = (value & ~mask) | (w.value & mask);
+        unknown        = (unknown & ~mask) | (w.unknown & mask);
+    }
+
+    bool CompiledBooleanFunction::Word::operator==(const Word& other) const
+    {
+        return value == other.value && unknown == other.unknown;
+    }
+
+    bool CompiledBooleanFunction::Word::operator!=(const Word& other) const
+    {
+        return !(*this == other);
+    }
+
+    CompiledBooleanFunction::CompiledBooleanFunction() : m_constants({Word::broadcast(BooleanFunction::Value::X)}), m_register_count(1), m_output(0), m_output_size(1)
+    {
+    }
+
+    Result<CompiledBooleanFunction> CompiledBooleanFunction::compile(const BooleanFunction& function, const std::vector<std::string>& ordered_variables)
+    {
+        // (0) workaround to preserve the API functionality of BooleanFunction::evaluate
+        if (function.is_empty())
+        {
+            return OK(CompiledBooleanFunction());
+        }
+
+        const auto& nodes = function.get_nodes();
+
+        // (1) collect the variables and their sizes
+        std::map<std::string, u16> variable_sizes;
+        for (const auto& node : nodes)
+        {
+            if (node.is_variable())
+            {
+                if (const auto [it, inserted] = variable_sizes.emplace(node.variable(), node.size); !inserted && it->second != node.size)
+                {
+                    return ERR("could not compile Boolean function '" + function.to_string() + "': variable '" + node.variable() + "' is used with different bit-sizes");
+                }
+            }
+        }
+
+        CompiledBooleanFunction compiled;
+        compiled.m_constants.clear();
+
+        if (ordered_variables.empty())
+        {
+            for (const auto& [name, size] : variable_sizes)
+            {
+                compiled.m_variables.push_back(name);
+                compiled.m_variable_sizes.push_back(size);
+            }
+        }
+        else
+        {
+            compiled.m_variables = ordered_variables;
+            for (const auto& name : ordered_variables)
+            {
+                const auto it = variable_sizes.find(name);
+                compiled.m_variable_sizes.push_back((it != variable_sizes.end()) ? it->second : 1);
+            }
+        }
+
+        // (2) lay out the input registers
+        std::unordered_map<std::string, u32> variable_registers;
+        for (u32 i = 0; i < compiled.m_variables.size(); i++)
+        {
+            if (!variable_registers.emplace(compiled.m_variables[i], compiled.m_input_size).second)
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': variable '" + compiled.m_variables[i] + "' is contained more than once in the variable order");
+            }
+            compiled.m_input_size += compiled.m_variable_sizes[i];
+        }
+        for (const auto& [name, size] : variable_sizes)
+        {
+            if (variable_registers.find(name) == variable_registers.end())
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': variable '" + name + "' is missing from the variable order");
+            }
+        }
+
+        // (3) lay out the constant registers, the first one always holding a zero for zero-extension and shifts
+        compiled.m_constants.push_back(Word::broadcast(BooleanFunction::Value::ZERO));
+        for (const auto& node : nodes)
+        {
+            if (node.is_constant())
+            {
+                for (const auto& value : node.constant())
+                {
+                    compiled.m_constants.push_back(Word::broadcast(value));
+                }
+            }
+        }
+        const u32 zero            = compiled.m_input_size;
+        u32 next_constant         = zero + 1;
+        compiled.m_register_count = compiled.m_input_size + compiled.m_constants.size();
+
+        // (4) lower the reverse-polish notation into a register program
+        struct Operand
+        {
+            u32 reg;
+            u16 size;
+            u16 index;
+        };
+
+        auto allocate = [&compiled](u16 size) {
+            const u32 reg = compiled.m_register_count;
+            compiled.m_register_count += size;
+            return reg;
+        };
+        auto emit = [&compiled](OpCode opcode, u16 size, u32 dst, u32 src0, u32 src1 = 0, u32 src2 = 0) {
+            if (size != 0)
+            {
+                compiled.m_program.push_back({opcode, size, dst, src0, src1, src2});
+            }
+        };
+
+        std::vector<Operand> stack;
+        for (const auto& node : nodes)
+        {
+            const auto arity = node.get_arity();
+            if (stack.size() < arity)
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': stack is imbalanced");
+            }
+            std::vector<Operand> p(stack.end() - arity, stack.end());
+            stack.erase(stack.end() - arity, stack.end());
+
+            const u16 size = node.size;
+            for (u32 i = 0; i < p.size(); i++)
+            {
+                // index operands carry no registers and may only occur as trailing parameters of slices, extensions, and shifts
+                if ((p[i].size == 0) != (i > 0 && takes_index_operands(node.type)))
+                {
+                    return ERR("could not compile Boolean function '" + function.to_string() + "': invalid operand types for node '" + node.to_string() + "'");
+                }
+            }
+
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Constant: {
+                    stack.push_back({next_constant, size, 0});
+                    next_constant += size;
+                    break;
+                }
+                case BooleanFunction::NodeType::Index: {
+                    stack.push_back({0, 0, node.index()});
+                    break;
+                }
+                case BooleanFunction::NodeType::Variable: {
+                    stack.push_back({variable_registers.at(node.variable()), size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::And:
+                case BooleanFunction::NodeType::Or:
+                case BooleanFunction::NodeType::Xor:
+                case BooleanFunction::NodeType::Add:
+                case BooleanFunction::NodeType::Sub:
+                case BooleanFunction::NodeType::Mul: {
+                    static const std::map<u16, OpCode> opcodes = {{BooleanFunction::NodeType::And, OpCode::And},
+                                                                  {BooleanFunction::NodeType::Or, OpCode::Or},
+                                                                  {BooleanFunction::NodeType::Xor, OpCode::Xor},
+                                                                  {BooleanFunction::NodeType::Add, OpCode::Add},
+                                                                  {BooleanFunction::NodeType::Sub, OpCode::Sub},
+                                                                  {BooleanFunction::NodeType::Mul, OpCode::Mul}};
+                    const u32 dst = allocate(size);
+                    emit(opcodes.at(node.type), size, dst, p[0].reg, p[1].reg);
+                    stack.push_back({dst, size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Not: {
+                    const u32 dst = allocate(size);
+                    emit(OpCode::Not, size, dst, p[0].reg);
+                    stack.push_back({dst, size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Eq:
+                case BooleanFunction::NodeType::Ult:
+                case BooleanFunction::NodeType::Ule:
+                case BooleanFunction::NodeType::Slt:
+                case BooleanFunction::NodeType::Sle: {
+                    static const std::map<u16, OpCode> opcodes = {{BooleanFunction::NodeType::Eq, OpCode::Eq},
+                                                                  {BooleanFunction::NodeType::Ult, OpCode::Ult},
+                                                                  {BooleanFunction::NodeType::Ule, OpCode::Ule},
+                                                                  {BooleanFunction::NodeType::Slt, OpCode::Slt},
+                                                                  {BooleanFunction::NodeType::Sle, OpCode::Sle}};
+                    const u32 dst = allocate(1);
+                    emit(opcodes.at(node.type), p[0].size, dst, p[0].reg, p[1].reg);
+                    stack.push_back({dst, 1, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Ite: {
+                    const u32 dst = allocate(size);
+                    emit(OpCode::Ite, size, dst, p[0].reg, p[1].reg, p[2].reg);
+                    stack.push_back({dst, size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Concat: {
+                    // p[0] holds the MSBs, p[1] the LSBs
+                    const u32 dst = allocate(size);
+                    emit(OpCode::Mov, p[1].size, dst, p[1].reg);
+                    emit(OpCode::Mov, p[0].size, dst + p[1].size, p[0].reg);
+                    stack.push_back({dst, size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Slice: {
+                    // registers are never overwritten, hence a slice can simply alias its operand
+                    if (p[1].index > p[2].index || p[2].index >= p[0].size)
+                    {
+                        return ERR("could not compile Boolean function '" + function.to_string() + "': slice indices are out of bounds");
+                    }
+                    stack.push_back({p[0].reg + p[1].index, size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Zext:
+                case BooleanFunction::NodeType::Sext: {
+                    const u32 dst  = allocate(size);
+                    const u32 fill = (node.type == BooleanFunction::NodeType::Zext) ? zero : p[0].reg + p[0].size - 1;
+                    emit(OpCode::Mov, p[0].size, dst, p[0].reg);
+                    emit(OpCode::Fill, size - p[0].size, dst + p[0].size, fill);
+                    stack.push_back({dst, size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Shl:
+                case BooleanFunction::NodeType::Lshr:
+                case BooleanFunction::NodeType::Ashr: {
+                    const u32 dst   = allocate(size);
+                    const u16 shift = std::min(p[1].index, size);
+                    if (node.type == BooleanFunction::NodeType::Shl)
+                    {
+                        emit(OpCode::Fill, shift, dst, zero);
+                        emit(OpCode::Mov, size - shift, dst + shift, p[0].reg);
+                    }
+                    else
+                    {
+                        const u32 fill = (node.type == BooleanFunction::NodeType::Lshr) ? zero : p[0].reg + size - 1;
+                        emit(OpCode::Mov, size - shift, dst, p[0].reg + shift);
+                        emit(OpCode::Fill, shift, dst + size - shift, fill);
+                    }
+                    stack.push_back({dst, size, 0});
+                    break;
+                }
+                case BooleanFunction::NodeType::Rol:
+                case BooleanFunction::NodeType::Ror: {
+                    const u32 dst = allocate(size);
+                    u16 rotate    = p[1].index % size;
+                    if (node.type == BooleanFunction::NodeType::Ror)
+                    {
+                        rotate = (size - rotate) % size;
+                    }
+                    emit(OpCode::Mov, size - rotate, dst + rotate, p[0].reg);
+                    emit(OpCode::Mov, rotate, dst, p[0].reg + size - rotate);
+                    stack.push_back({dst, size, 0});
+                    break;
+                }
+                default:
+                    return ERR("could not compile Boolean function '" + function.to_string() + "': node type '" + node.to_string() + "' is not supported");
+            }
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not compile Boolean function '" + function.to_string() + "': stack is imbalanced");
+        }
+
+        compiled.m_output      = stack.back().reg;
+        compiled.m_output_size = stack.back().size;
+
+        return OK(compiled);
+    }
+
+    const std::vector<std::string>& CompiledBooleanFunction::get_variables() const
+    {
+        return m_variables;
+    }
+
+    const std::vector<u16>& CompiledBooleanFunction::get_variable_sizes() const
+    {
+        return m_variable_sizes;
+    }
+
+    u32 CompiledBooleanFunction::get_input_size() const
+    {
+        return m_input_size;
+    }
+
+    u16 CompiledBooleanFunction::size() const
+    {
+        return m_output_size;
+    }
+
+    u32 CompiledBooleanFunction::get_instruction_count() const
+    {
+        return m_program.size();
+    }
+
+    void CompiledBooleanFunction::evaluate(const Word* inputs, Word* outputs) const
+    {
+        evaluate(inputs, outputs, get_thread_registers(m_register_count));
+    }
+
+    void CompiledBooleanFunction::evaluate(const Word* inputs, Word* outputs, std::vector<Word>& registers) const
+    {
+        if (registers.size() < m_register_count)
+        {
+            registers.resize(m_register_count);
+        }
+        std::copy(inputs, inputs + m_input_size, registers.begin());
+        std::copy(m_constants.begin(), m_constants.end(), registers.begin() + m_input_size);
+
+        execute(registers.data());
+
+        std::copy(registers.begin() + m_output, registers.begin() + m_output + m_output_size, outputs);
+    }
+
+    Result<std::vector<CompiledBooleanFunction::Word>> CompiledBooleanFunction::evaluate(const std::vector<Word>& inputs) const
+    {
+        if (inputs.size() != m_input_size)
+        {
+            return ERR("could not evaluate compiled Boolean function: expected " + std::to_string(m_input_size) + " input words but got " + std::to_string(inputs.size()));
+        }
+
+        std::vector<Word> outputs(m_output_size);
+        evaluate(inputs.data(), outputs.data());
+        return OK(outputs);
+    }
+
+    Result<BooleanFunction::Value> CompiledBooleanFunction::evaluate(const std::unordered_map<std::string, BooleanFunction::Value>& inputs) const
+    {
+        if (m_output_size != 1)
+        {
+            return ERR("could not evaluate compiled Boolean function: using single-bit evaluation on a Boolean function of size " + std::to_string(m_output_size) + " is illegal");
+        }
+
+        std::unordered_map<std::string, std::vector<BooleanFunction::Value>> generic_inputs;
+        for (const auto& [name, value] : inputs)
+        {
+            generic_inputs.emplace(name, std::vector<BooleanFunction::Value>({value}));
+        }
+
+        if (auto res = evaluate(generic_inputs); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return OK(res.get().front());
+        }
+    }
+
+    Result<std::vector<BooleanFunction::Value>> CompiledBooleanFunction::evaluate(const std::unordered_map<std::string, std::vector<BooleanFunction::Value>>& inputs) const
+    {
+        std::vector<Word> words(m_input_size, Word::broadcast(BooleanFunction::Value::X));
+
+        u32 offset = 0;
+        for (u32 i = 0; i < m_variables.size(); i++)
+        {
+            if (const auto it = inputs.find(m_variables[i]); it != inputs.end())
+            {
+                if (it->second.size() != m_variable_sizes[i])
+                {
+                    return ERR("could not evaluate compiled Boolean function: the size of variable " + m_variables[i] + " with size " + std::to_string(m_variable_sizes[i])
+                               + " does not match the size of the provided input (" + std::to_string(it->second.size()) + ")");
+                }
+                for (u32 j = 0; j < it->second.size(); j++)
+                {
+                    words[offset + j] = Word::broadcast(it->second[j]);
+                }
+            }
+            offset += m_variable_sizes[i];
+        }
+
+        std::vector<Word> outputs(m_output_size);
+        evaluate(words.data(), outputs.data());
+
+        std::vector<BooleanFunction::Value> result;
+        result.reserve(m_output_size);
+        for (const auto& word : outputs)
+        {
+            result.push_back(word.get(0));
+        }
+        return OK(result);
+    }
+
+    Result<std::vector<std::vector<CompiledBooleanFunction::Word>>> CompiledBooleanFunction::compute_truth_table() const
+    {
+        // lane patterns of the six lowest input variables within a word of 64 rows
+        static constexpr u64 lane_patterns[6] = {
+            0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+        const u32 num_variables = m_variables.size();
+        if (num_variables > MAX_TRUTH_TABLE_VARIABLES)
+        {
+            return ERR("could not compute truth table: unable to generate truth-table with more than " + std::to_string(MAX_TRUTH_TABLE_VARIABLES) + " variables");
+        }
+        if (std::any_of(m_variable_sizes.begin(), m_variable_sizes.end(), [](const auto size) { return size != 1; }))
+        {
+            return ERR("could not compute truth table: unable to generate a truth-table for Boolean function with variables of > 1-bit");
+        }
+
+        const u64 num_words = (num_variables <= 6) ? 1 : (u64(1) << (num_variables - 6));
+        std::vector<std::vector<Word>> truth_table(m_output_size, std::vector<Word>(num_words));
+
+        // input and constant registers are never written by the program, hence the constants are only initialized once
+        std::vector<Word>& registers = get_thread_registers(m_register_count);
+        std::copy(m_constants.begin(), m_constants.end(), registers.begin() + m_input_size);
+        for (u32 i = 0; i < std::min(num_variables, 6u); i++)
+        {
+            registers[i] = {lane_patterns[i], 0};
+        }
+
+        for (u64 w = 0; w < num_words; w++)
+        {
+            for (u32 i = 6; i < num_variables; i++)
+            {
+                registers[i] = {((w >> (i - 6)) & 1) ? ~u64(0) : u64(0), 0};
+            }
+
+            execute(registers.data());
+
+            for (u32 o = 0; o < m_output_size; o++)
+            {
+                truth_table[o][w] = registers[m_output + o];
+            }
+        }
+
+        if (num_variables < 6)
+        {
+            const u64 mask = (u64(1) << (u64(1) << num_variables)) - 1;
+            for (auto& column : truth_table)
+            {
+                column.front().value &= mask;
+                column.front().unknown &= mask;
+            }
+        }
+
+        return OK(truth_table);
+    }
+
+    void CompiledBooleanFunction::execute(Word* r) const
+    {
+        for (const auto& instr : m_program)
+        {
+            Word* dst      = r + instr.dst;
+            const Word* a  = r + instr.src0;
+            const Word* b  = r + instr.src1;
+            const Word* c  = r + instr.src2;
+            const u16 size = instr.size;
+
+            switch (instr.opcode)
+            {
+                case OpCode::Mov:
+                    std::copy(a, a + size, dst);
+                    break;
+                case OpCode::Fill:
+                    std::fill(dst, dst + size, *a);
+                    break;
+                case OpCode::And:
+                    for (u16 i = 0; i < size; i++)
+                    {
+                        const u64 one  = (~a[i].unknown & a[i].value) & (~b[i].unknown & b[i].value);
+                        const u64 zero = (~a[i].unknown & ~a[i].value) | (~b[i].unknown & ~b[i].value);
+                        dst[i]         = {one, ~(one | zero)};
+                    }
+                    break;
+                case OpCode::Or:
+                    for (u16 i = 0; i < size; i++)
+                    {
+                        const u64 one  = (~a[i].unknown & a[i].value) | (~b[i].unknown & b[i].value);
+                        const u64 zero = (~a[i].unknown & ~a[i].value) & (~b[i].unknown & ~b[i].value);
+                        dst[i]         = {one, ~(one | zero)};
+                    }
+                    break;
+                case OpCode::Xor:
+                    for (u16 i = 0; i < size; i++)
+                    {
+                        const u64 unknown = a[i].unknown | b[i].unknown;
+                        dst[i]            = {(a[i].value ^ b[i].value) & ~unknown, unknown};
+                    }
+                    break;
+                case OpCode::Not:
+                    // unknown values (X and Z) are passed through unchanged
+                    for (u16 i = 0; i < size; i++)
+                    {
+                        dst[i] = {a[i].value ^ ~a[i].unknown, a[i].unknown};
+                    }
+                    break;
+                case OpCode::Ite: {
+                    const u64 is_one  = ~a->unknown & a->value;
+                    const u64 is_zero = ~a->unknown & ~a->value;
+                    for (u16 i = 0; i < size; i++)
+                    {
+                        dst[i] = {(is_one & b[i].value) | (is_zero & c[i].value), (is_one & b[i].unknown) | (is_zero & c[i].unknown) | a->unknown};
+                    }
+                    break;
+                }
+                case OpCode::Add:
+                    add(dst, a, b, size, false);
+                    break;
+                case OpCode::Sub:
+                    add(dst, a, b, size, true);
+                    break;
+                case OpCode::Mul:
+                    mul(dst, a, b, size);
+                    break;
+                case OpCode::Eq:
+                    *dst = {equal_lanes(a, b, size), 0};
+                    break;
+                case OpCode::Ult:
+                    *dst = compare(a, b, size, false, false);
+                    break;
+                case OpCode::Ule:
+                    *dst = compare(a, b, size, false, true);
+                    break;
+                case OpCode::Slt:
+                    *dst = compare(a, b, size, true, false);
+                    break;
+                case OpCode::Sle:
+                    *dst = compare(a, b, size, true, true);
+                    break;
+            }
+        }
+    }
+}    // namespace hal
@@ -615,7 +615,7 @@ namespace hal
                 switch (node.type)
                 {
                     case BooleanFunction::NodeType::Variable:
-                        return OK(input2abc.at(node.variable));
+                        return OK(input2abc.at(node.variable()));
 
                     case BooleanFunction::NodeType::And:
                         return OK(Abc_AigAnd((Abc_Aig_t*)network->pManFunc, operands[0], operands[1]));
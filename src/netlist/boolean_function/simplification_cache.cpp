@@ -0,0 +1,248 @@
+#include "hal_core/netlist/boolean_function/simplification_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+
+namespace hal
+{
+    namespace
+    {
+        /// Prefix of the placeholder variables that replace the original variables within the canonical form.
+        const std::string PLACEHOLDER_PREFIX = "__simplification_cache_";
+
+        /// The maximum number of distinct variables of a cacheable function, limited by the fixed width of the placeholder names.
+        constexpr u64 MAX_VARIABLES = 100000000;
+
+        void hash_combine(u64& seed, u64 value)
+        {
+            seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        /**
+         * The canonical form of a Boolean function.
+         */
+        struct CanonicalForm
+        {
+            /// The nodes of the function with all variables replaced by placeholders.
+            std::vector<BooleanFunction::Node> nodes;
+            /// The original variable names indexed by their rank.
+            std::vector<std::string> names;
+            /// Maps the interned placeholder names to the rank of the variable they replace.
+            std::unordered_map<u32, u32> ranks;
+        };
+
+        std::string get_placeholder_name(u32 rank)
+        {
+            // fixed-width numbering keeps the placeholders in the same lexicographic order as the names they replace
+            char buffer[16];
+            std::snprintf(buffer, sizeof(buffer), "%08u", rank);
+            return PLACEHOLDER_PREFIX + buffer;
+        }
+
+        bool canonicalize(const BooleanFunction& function, CanonicalForm& canonical)
+        {
+            const auto& nodes = function.get_nodes();
+            for (const auto& node : nodes)
+            {
+                if (node.is_variable())
+                {
+                    canonical.names.push_back(node.variable());
+                }
+            }
+            std::sort(canonical.names.begin(), canonical.names.end());
+            canonical.names.erase(std::unique(canonical.names.begin(), canonical.names.end()), canonical.names.end());
+
+            if (canonical.names.size() >= MAX_VARIABLES)
+            {
+                return false;
+            }
+
+            canonical.nodes.reserve(nodes.size());
+            for (const auto& node : nodes)
+            {
+                if (node.is_variable())
+                {
+                    const auto rank        = static_cast<u32>(std::lower_bound(canonical.names.begin(), canonical.names.end(), node.variable()) - canonical.names.begin());
+                    const auto placeholder = BooleanFunction::Node::Variable(get_placeholder_name(rank), node.size);
+                    canonical.ranks.emplace(placeholder.data, rank);
+                    canonical.nodes.push_back(placeholder);
+                }
+                else
+                {
+                    canonical.nodes.push_back(node);
+                }
+            }
+
+            return true;
+        }
+
+        std::vector<BooleanFunction::Node> restore(const std::vector<BooleanFunction::Node>& nodes, const CanonicalForm& canonical)
+        {
+            auto restored = nodes;
+            for (auto& node : restored)
+            {
+                if (node.is_variable())
+                {
+                    if (const auto it = canonical.ranks.find(node.data); it != canonical.ranks.end())
+                    {
+                        node = BooleanFunction::Node::Variable(canonical.names[it->second], node.size);
+                    }
+                }
+            }
+            return restored;
+        }
+    }    // namespace
+
+    SimplificationCache::SimplificationCache(u64 capacity) : m_capacity(capacity)
+    {
+    }
+
+    SimplificationCache& SimplificationCache::get_global_cache()
+    {
+        // intentionally leaked so that the cache outlives all static objects that might simplify functions during their destruction
+        static auto* cache = new SimplificationCache();
+        return *cache;
+    }
+
+    BooleanFunction SimplificationCache::simplify(const BooleanFunction& function, const std::function<BooleanFunction(const BooleanFunction&)>& simplifier)
+    {
+        if (!is_enabled())
+        {
+            return simplifier(function);
+        }
+
+        CanonicalForm canonical;
+        if (!canonicalize(function, canonical))
+        {
+            return simplifier(function);
+        }
+        const auto key_hash = hash(canonical.nodes);
+
+        std::vector<BooleanFunction::Node> simplified_nodes;
+        bool hit = false;
+        {
+            std::lock_guard lock(m_mutex);
+            if (const auto it = find(key_hash, canonical.nodes); it != m_entries.end())
+            {
+                m_entries.splice(m_entries.begin(), m_entries, it);
+                simplified_nodes = it->value;
+                m_statistics.hits++;
+                hit = true;
+            }
+            else
+            {
+                m_statistics.misses++;
+            }
+        }
+
+        if (!hit)
+        {
+            // simplification is run without holding the lock, so concurrent misses on the same function may both compute it
+            auto canonical_function = BooleanFunction::build(std::vector<BooleanFunction::Node>(canonical.nodes));
+            if (canonical_function.is_error())
+            {
+                return simplifier(function);
+            }
+            simplified_nodes = simplifier(canonical_function.get()).get_nodes();
+
+            std::lock_guard lock(m_mutex);
+            if (m_enabled && find(key_hash, canonical.nodes) == m_entries.end())
+            {
+                m_entries.push_front(Entry{key_hash, std::move(canonical.nodes), simplified_nodes});
+                m_index.emplace(key_hash, m_entries.begin());
+                evict(m_capacity);
+            }
+        }
+
+        if (auto res = BooleanFunction::build(restore(simplified_nodes, canonical)); res.is_ok())
+        {
+            return res.get();
+        }
+        return simplifier(function);
+    }
+
+    void SimplificationCache::clear()
+    {
+        std::lock_guard lock(m_mutex);
+        m_entries.clear();
+        m_index.clear();
+        m_statistics = Statistics();
+    }
+
+    SimplificationCache::Statistics SimplificationCache::get_statistics() const
+    {
+        std::lock_guard lock(m_mutex);
+        auto statistics    = m_statistics;
+        statistics.entries = m_entries.size();
+        return statistics;
+    }
+
+    void SimplificationCache::set_capacity(u64 capacity)
+    {
+        std::lock_guard lock(m_mutex);
+        m_capacity = capacity;
+        evict(m_capacity);
+    }
+
+    u64 SimplificationCache::get_capacity() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_capacity;
+    }
+
+    void SimplificationCache::set_enabled(bool enable)
+    {
+        std::lock_guard lock(m_mutex);
+        m_enabled = enable;
+    }
+
+    bool SimplificationCache::is_enabled() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_enabled;
+    }
+
+    u64 SimplificationCache::hash(const std::vector<BooleanFunction::Node>& nodes)
+    {
+        // interned variable names and constants are unique, so the payload of a node identifies it completely
+        u64 seed = nodes.size();
+        for (const auto& node : nodes)
+        {
+            hash_combine(seed, (static_cast<u64>(node.type) << 48) | (static_cast<u64>(node.size) << 32) | node.data);
+        }
+        return seed;
+    }
+
+    std::list<SimplificationCache::Entry>::iterator SimplificationCache::find(u64 key_hash, const std::vector<BooleanFunction::Node>& key)
+    {
+        const auto [begin, end] = m_index.equal_range(key_hash);
+        for (auto it = begin; it != end; ++it)
+        {
+            if (it->second->key == key)
+            {
+                return it->second;
+            }
+        }
+        return m_entries.end();
+    }
+
+    void SimplificationCache::evict(u64 capacity)
+    {
+        while (m_entries.size() > capacity)
+        {
+            const auto& entry       = m_entries.back();
+            const auto [begin, end] = m_index.equal_range(entry.hash);
+            for (auto it = begin; it != end; ++it)
+            {
+                if (it->second == std::prev(m_entries.end()))
+                {
+                    m_index.erase(it);
+                    break;
+                }
+            }
+            m_entries.pop_back();
+            m_statistics.evictions++;
+        }
+    }
+}    // namespace hal
@@ -1,11 +1,17 @@
 #include "hal_core/netlist/boolean_function/solver.h"
 
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/netlist/boolean_function/translator.h"
 #include "hal_core/netlist/boolean_function/types.h"
 #include "subprocess/process.h"
 
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <set>
+#include <thread>
 
 #ifdef BITWUZLA_LIBRARY
 #include "bitwuzla/cpp/bitwuzla.h"
@@ -18,7 +24,7 @@ namespace hal
     {
         namespace Z3
         {
-            bool is_linked = false;
+            bool is_linked = true;
 
             /// Checks whether a Z3 binary is available on the system.
             Result<std::string> query_binary_path()
@@ -97,9 +103,28 @@ namespace hal
 			 */
             Result<std::tuple<bool, std::string>> query_library(const std::string& input, const QueryConfig& config)
             {
-                UNUSED(input);
-                UNUSED(config);
-                return ERR("could not call Z3 solver library: Library call not implemented");
+                try
+                {
+                    z3::config cfg;
+                    cfg.set("timeout", (int)std::min<u64>(config.timeout_in_seconds * 1000, std::numeric_limits<int>::max()));
+                    z3::context context(cfg);
+
+                    // evaluate the SMT-LIB formula in-process instead of spawning a solver binary
+                    std::string output = Z3_eval_smtlib2_string(context, input.c_str());
+
+                    // Z3 reports errors within the output instead of throwing, e.g., for malformed input or unknown sorts.
+                    // An error preceding the satisfiability result means the query failed, whereas a failing request for the model of an
+                    // unsatisfiable query is reported after the result and handled by the result parser.
+                    if (const auto start = output.find_first_not_of(" \t\r\n"); start != std::string::npos && output.compare(start, 6, "(error") == 0)
+                    {
+                        return ERR("could not call Z3 solver library: " + output.substr(start));
+                    }
+                    return OK({false, output});
+                }
+                catch (const z3::exception& e)
+                {
+                    return ERR("could not call Z3 solver library: " + std::string(e.msg()));
+                }
             }
         }    // namespace Z3
 
@@ -384,7 +409,7 @@ namespace hal
                         return false;
                 }
             }
-            else if (call == SolverCall::Binary)
+            else if (call == SolverCall::Library)
             {
                 switch (auto it = type2link_status.find(type); it != type2link_status.end())
                 {
@@ -424,6 +449,106 @@ namespace hal
             }
         }
 
+        std::vector<Result<SolverResult>> Solver::query_batch(const std::vector<std::vector<Constraint>>& constraint_sets, const QueryConfig& config, u32 num_workers, BatchStatistics* statistics)
+        {
+            using clock = std::chrono::steady_clock;
+
+            const auto batch_start = clock::now();
+            const u64 num_queries  = constraint_sets.size();
+
+            if (num_workers == 0)
+            {
+                num_workers = std::max(1u, std::thread::hardware_concurrency());
+            }
+            num_workers = (u32)std::max<u64>(1, std::min<u64>(num_workers, num_queries));
+
+            // the linked Z3 library can answer all queries of a worker within a single solver instance
+            const bool use_session = config.local && (config.solver == SolverType::Z3) && (config.call == SolverCall::Library);
+
+            std::vector<std::optional<Result<SolverResult>>> results(num_queries);
+            std::vector<double> queue_times(num_queries, 0);
+            std::vector<double> solve_times(num_queries, 0);
+            std::atomic<u64> next_query = 0;
+
+            auto worker = [&]() {
+                std::unique_ptr<SolverSession> session;
+                if (use_session)
+                {
+                    session = std::make_unique<SolverSession>(config);
+                }
+
+                for (u64 i = next_query++; i < num_queries; i = next_query++)
+                {
+                    const auto solve_start = clock::now();
+                    if (session != nullptr)
+                    {
+                        results[i] = session->query(constraint_sets[i]);
+                        // the constraint sets are independent, hence variables must not be shared between them
+                        session->reset();
+                    }
+                    else
+                    {
+                        results[i] = Solver(constraint_sets[i]).query(config);
+                    }
+                    const auto solve_end = clock::now();
+
+                    queue_times[i] = std::chrono::duration<double, std::milli>(solve_start - batch_start).count();
+                    solve_times[i] = std::chrono::duration<double, std::milli>(solve_end - solve_start).count();
+                }
+            };
+
+            if (num_workers == 1)
+            {
+                worker();
+            }
+            else
+            {
+                std::vector<std::thread> workers;
+                workers.reserve(num_workers);
+                for (u32 i = 0; i < num_workers; i++)
+                {
+                    workers.emplace_back(worker);
+                }
+                for (auto& thread : workers)
+                {
+                    thread.join();
+                }
+            }
+
+            std::vector<Result<SolverResult>> ordered_results;
+            ordered_results.reserve(num_queries);
+            for (auto& result : results)
+            {
+                ordered_results.push_back(std::move(*result));
+            }
+
+            if (statistics != nullptr)
+            {
+                *statistics           = BatchStatistics();
+                statistics->workers   = num_workers;
+                statistics->queries   = num_queries;
+                statistics->wall_time = std::chrono::duration<double, std::milli>(clock::now() - batch_start).count();
+                for (u64 i = 0; i < num_queries; i++)
+                {
+                    if (ordered_results[i].is_error())
+                    {
+                        statistics->errors++;
+                    }
+                    else if (ordered_results[i].get().is_unknown())
+                    {
+                        statistics->timeouts++;
+                    }
+
+                    statistics->total_queue_time += queue_times[i];
+                    statistics->max_queue_time = std::max(statistics->max_queue_time, queue_times[i]);
+                    statistics->total_solve_time += solve_times[i];
+                    statistics->max_solve_time = std::max(statistics->max_solve_time, solve_times[i]);
+                }
+            }
+
+            return ordered_results;
+        }
+
         Result<SolverResult> Solver::query_local(const QueryConfig& config) const
         {
             auto input = Solver::translate_to_smt2(this->m_constraints, config);
@@ -474,7 +599,7 @@ namespace hal
                         {
                             if (node.is_variable())
                             {
-                                inputs.insert(std::make_tuple(node.variable, node.size));
+                                inputs.insert(std::make_tuple(node.variable(), node.size));
                             }
                         }
                     }
@@ -484,7 +609,7 @@ namespace hal
                         {
                             if (node.is_variable())
                             {
-                                inputs.insert(std::make_tuple(node.variable, node.size));
+                                inputs.insert(std::make_tuple(node.variable(), node.size));
                             }
                         }
                     }
@@ -0,0 +1,430 @@
+#include "hal_core/netlist/boolean_function/solver_session.h"
+
+#include <limits>
+
+namespace hal
+{
+    namespace SMT
+    {
+        namespace
+        {
+            /**
+             * Translates a constant node into a Z3 bit-vector numeral.
+             * Constants wider than 64 bits are assembled from 64-bit chunks.
+             *
+             * @param[in] context - The Z3 context.
+             * @param[in] node - The constant node.
+             * @returns OK() and the Z3 numeral on success, Err() otherwise.
+             */
+            Result<z3::expr> translate_constant(z3::context& context, const BooleanFunction::Node& node)
+            {
+                std::vector<z3::expr> chunks;
+                const auto values = node.constant();
+                for (u32 offset = 0; offset < values.size(); offset += 64)
+                {
+                    const u32 width = std::min<u32>(64, values.size() - offset);
+
+                    u64 value = 0;
+                    for (u32 i = 0; i < width; i++)
+                    {
+                        const auto bit = values.at(offset + i);
+                        if ((bit != BooleanFunction::Value::ZERO) && (bit != BooleanFunction::Value::ONE))
+                        {
+                            return ERR("could not translate constant '" + node.to_string() + "': constant contains undefined values");
+                        }
+                        value |= (u64)bit << i;
+                    }
+                    chunks.push_back(context.bv_val((uint64_t)value, width));
+                }
+
+                if (chunks.empty())
+                {
+                    return ERR("could not translate constant '" + node.to_string() + "': constant is empty");
+                }
+
+                auto constant = chunks.front();
+                for (u32 i = 1; i < chunks.size(); i++)
+                {
+                    constant = z3::concat(chunks.at(i), constant);
+                }
+                return OK(constant);
+            }
+
+            /**
+             * Converts a Z3 Boolean expression into a single-bit bit-vector as used for comparison nodes.
+             *
+             * @param[in] condition - The Z3 Boolean expression.
+             * @returns The single-bit bit-vector expression.
+             */
+            z3::expr to_bit(const z3::expr& condition)
+            {
+                auto& context = condition.ctx();
+                return z3::ite(condition, context.bv_val(1, 1), context.bv_val(0, 1));
+            }
+        }    // namespace
+
+        SolverSession::SolverSession(const QueryConfig& config)
+            : m_config(config), m_context(std::make_unique<z3::context>()), m_solver(std::make_unique<z3::solver>(*m_context))
+        {
+            z3::params params(*m_context);
+            params.set("timeout", (unsigned)std::min<u64>(config.timeout_in_seconds * 1000, std::numeric_limits<unsigned>::max()));
+            m_solver->set(params);
+        }
+
+        SolverSession::~SolverSession()
+        {
+            // terms have to be released before the context owning them
+            m_term_cache.clear();
+            m_variables.clear();
+            m_solver.reset();
+            m_context.reset();
+        }
+
+        const QueryConfig& SolverSession::get_config() const
+        {
+            return m_config;
+        }
+
+        Result<std::monostate> SolverSession::add_constraint(const Constraint& constraint)
+        {
+            auto expr = translate(constraint);
+            if (expr.is_error())
+            {
+                return ERR_APPEND(expr.get_error(), "could not add constraint to solver session: unable to translate constraint '" + constraint.to_string() + "'");
+            }
+
+            m_solver->add(expr.get());
+            return OK({});
+        }
+
+        Result<std::monostate> SolverSession::add_constraints(const std::vector<Constraint>& constraints)
+        {
+            std::vector<z3::expr> exprs;
+            exprs.reserve(constraints.size());
+            for (const auto& constraint : constraints)
+            {
+                auto expr = translate(constraint);
+                if (expr.is_error())
+                {
+                    return ERR_APPEND(expr.get_error(), "could not add constraints to solver session: unable to translate constraint '" + constraint.to_string() + "'");
+                }
+                exprs.push_back(expr.get());
+            }
+
+            for (const auto& expr : exprs)
+            {
+                m_solver->add(expr);
+            }
+            return OK({});
+        }
+
+        void SolverSession::push()
+        {
+            m_solver->push();
+            m_scope_level++;
+        }
+
+        Result<std::monostate> SolverSession::pop(u32 levels)
+        {
+            if (levels > m_scope_level)
+            {
+                return ERR("could not pop " + std::to_string(levels) + " scopes from solver session: only " + std::to_string(m_scope_level) + " scopes are open");
+            }
+
+            m_solver->pop(levels);
+            m_scope_level -= levels;
+            return OK({});
+        }
+
+        u32 SolverSession::get_scope_level() const
+        {
+            return m_scope_level;
+        }
+
+        Result<SolverResult> SolverSession::query(const std::vector<Constraint>& assumptions)
+        {
+            std::vector<z3::expr> exprs;
+            exprs.reserve(assumptions.size());
+            for (const auto& assumption : assumptions)
+            {
+                auto expr = translate(assumption);
+                if (expr.is_error())
+                {
+                    return ERR_APPEND(expr.get_error(), "could not query solver session: unable to translate assumption '" + assumption.to_string() + "'");
+                }
+                exprs.push_back(expr.get());
+            }
+
+            m_query_count++;
+
+            const bool has_assumptions = !exprs.empty();
+            if (has_assumptions)
+            {
+                m_solver->push();
+                for (const auto& expr : exprs)
+                {
+                    m_solver->add(expr);
+                }
+            }
+
+            Result<SolverResult> result = ERR("could not query solver session: no result available");
+            try
+            {
+                switch (m_solver->check())
+                {
+                    case z3::sat: {
+                        if (!m_config.generate_model)
+                        {
+                            result = OK(SolverResult::Sat());
+                            break;
+                        }
+
+                        const auto z3_model = m_solver->get_model();
+                        std::map<std::string, std::tuple<u64, u16>> model;
+                        for (u32 i = 0; i < z3_model.num_consts(); i++)
+                        {
+                            const auto decl   = z3_model.get_const_decl(i);
+                            const auto interp = z3_model.get_const_interp(decl);
+                            if (interp.is_bv() && interp.is_numeral() && (interp.get_sort().bv_size() <= 64))
+                            {
+                                model.emplace(decl.name().str(), std::make_tuple((u64)interp.get_numeral_uint64(), (u16)interp.get_sort().bv_size()));
+                            }
+                        }
+                        result = OK(SolverResult::Sat(Model(model)));
+                        break;
+                    }
+                    case z3::unsat:
+                        result = OK(SolverResult::UnSat());
+                        break;
+                    case z3::unknown:
+                        result = OK(SolverResult::Unknown());
+                        break;
+                }
+            }
+            catch (const z3::exception& e)
+            {
+                result = ERR("could not query solver session: " + std::string(e.msg()));
+            }
+
+            if (has_assumptions)
+            {
+                m_solver->pop();
+            }
+
+            return result;
+        }
+
+        void SolverSession::reset()
+        {
+            m_solver->reset();
+            m_scope_level = 0;
+            // cached terms refer to the declared variables, hence both are discarded together
+            m_term_cache.clear();
+            m_variables.clear();
+        }
+
+        u64 SolverSession::get_query_count() const
+        {
+            return m_query_count;
+        }
+
+        u64 SolverSession::get_term_cache_hits() const
+        {
+            return m_term_cache_hits;
+        }
+
+        u64 SolverSession::get_term_cache_misses() const
+        {
+            return m_term_cache_misses;
+        }
+
+        void SolverSession::clear_term_cache()
+        {
+            m_term_cache.clear();
+        }
+
+        Result<z3::expr> SolverSession::translate(const BooleanFunction& function)
+        {
+            if (auto it = m_term_cache.find(function); it != m_term_cache.end())
+            {
+                m_term_cache_hits++;
+                return OK(it->second);
+            }
+            m_term_cache_misses++;
+
+            auto& context = *m_context;
+
+            std::vector<z3::expr> stack;
+            for (const auto& node : function.get_nodes())
+            {
+                const auto arity = node.get_arity();
+                if (stack.size() < arity)
+                {
+                    return ERR("could not translate Boolean function '" + function.to_string() + "': stack is imbalanced");
+                }
+
+                std::vector<z3::expr> p(stack.end() - static_cast<i64>(arity), stack.end());
+                stack.erase(stack.end() - static_cast<i64>(arity), stack.end());
+
+                switch (node.type)
+                {
+                    case BooleanFunction::NodeType::Constant: {
+                        auto constant = translate_constant(context, node);
+                        if (constant.is_error())
+                        {
+                            return ERR_APPEND(constant.get_error(), "could not translate Boolean function '" + function.to_string() + "': unable to translate constant");
+                        }
+                        stack.push_back(constant.get());
+                        break;
+                    }
+                    case BooleanFunction::NodeType::Index:
+                        stack.push_back(context.bv_val((uint64_t)node.index(), 64));
+                        break;
+                    case BooleanFunction::NodeType::Variable: {
+                        // models are keyed by variable name, hence a name may only be used with a single size within a session
+                        auto it = m_variables.find(node.variable());
+                        if (it == m_variables.end())
+                        {
+                            it = m_variables.emplace(node.variable(), context.bv_const(node.variable().c_str(), node.size)).first;
+                        }
+                        else if (it->second.get_sort().bv_size() != node.size)
+                        {
+                            return ERR("could not translate Boolean function '" + function.to_string() + "': variable '" + node.variable() + "' of size " + std::to_string(node.size)
+                                       + " has already been declared with size " + std::to_string(it->second.get_sort().bv_size()) + " within the solver session");
+                        }
+                        stack.push_back(it->second);
+                        break;
+                    }
+
+                    case BooleanFunction::NodeType::And:
+                        stack.push_back(p[0] & p[1]);
+                        break;
+                    case BooleanFunction::NodeType::Or:
+                        stack.push_back(p[0] | p[1]);
+                        break;
+                    case BooleanFunction::NodeType::Not:
+                        stack.push_back(~p[0]);
+                        break;
+                    case BooleanFunction::NodeType::Xor:
+                        stack.push_back(p[0] ^ p[1]);
+                        break;
+
+                    case BooleanFunction::NodeType::Add:
+                        stack.push_back(p[0] + p[1]);
+                        break;
+                    case BooleanFunction::NodeType::Sub:
+                        stack.push_back(p[0] - p[1]);
+                        break;
+                    case BooleanFunction::NodeType::Mul:
+                        stack.push_back(p[0] * p[1]);
+                        break;
+                    case BooleanFunction::NodeType::Sdiv:
+                        stack.push_back(p[0] / p[1]);
+                        break;
+                    case BooleanFunction::NodeType::Udiv:
+                        stack.push_back(z3::udiv(p[0], p[1]));
+                        break;
+                    case BooleanFunction::NodeType::Srem:
+                        stack.push_back(z3::srem(p[0], p[1]));
+                        break;
+                    case BooleanFunction::NodeType::Urem:
+                        stack.push_back(z3::urem(p[0], p[1]));
+                        break;
+
+                    case BooleanFunction::NodeType::Concat:
+                        stack.push_back(z3::concat(p[0], p[1]));
+                        break;
+                    case BooleanFunction::NodeType::Slice:
+                        stack.push_back(p[0].extract(p[2].get_numeral_uint(), p[1].get_numeral_uint()));
+                        break;
+                    case BooleanFunction::NodeType::Zext:
+                        stack.push_back(z3::zext(p[0], node.size - p[0].get_sort().bv_size()));
+                        break;
+                    case BooleanFunction::NodeType::Sext:
+                        stack.push_back(z3::sext(p[0], node.size - p[0].get_sort().bv_size()));
+                        break;
+
+                    case BooleanFunction::NodeType::Shl:
+                        stack.push_back(z3::shl(p[0], context.bv_val(p[1].get_numeral_uint64(), node.size)));
+                        break;
+                    case BooleanFunction::NodeType::Lshr:
+                        stack.push_back(z3::lshr(p[0], context.bv_val(p[1].get_numeral_uint64(), node.size)));
+                        break;
+                    case BooleanFunction::NodeType::Ashr:
+                        stack.push_back(z3::ashr(p[0], context.bv_val(p[1].get_numeral_uint64(), node.size)));
+                        break;
+                    case BooleanFunction::NodeType::Rol:
+                        stack.push_back(p[0].rotate_left(p[1].get_numeral_uint()));
+                        break;
+                    case BooleanFunction::NodeType::Ror:
+                        stack.push_back(p[0].rotate_right(p[1].get_numeral_uint()));
+                        break;
+
+                    case BooleanFunction::NodeType::Eq:
+                        stack.push_back(to_bit(p[0] == p[1]));
+                        break;
+                    case BooleanFunction::NodeType::Sle:
+                        stack.push_back(to_bit(z3::sle(p[0], p[1])));
+                        break;
+                    case BooleanFunction::NodeType::Slt:
+                        stack.push_back(to_bit(z3::slt(p[0], p[1])));
+                        break;
+                    case BooleanFunction::NodeType::Ule:
+                        stack.push_back(to_bit(z3::ule(p[0], p[1])));
+                        break;
+                    case BooleanFunction::NodeType::Ult:
+                        stack.push_back(to_bit(z3::ult(p[0], p[1])));
+                        break;
+                    case BooleanFunction::NodeType::Ite:
+                        stack.push_back(z3::ite(p[0] == context.bv_val(1, 1), p[1], p[2]));
+                        break;
+
+                    default:
+                        return ERR("could not translate Boolean function '" + function.to_string() + "': not implemented for node type '" + node.to_string() + "'");
+                }
+            }
+
+            if (stack.size() != 1)
+            {
+                return ERR("could not translate Boolean function '" + function.to_string() + "': stack is imbalanced");
+            }
+
+            m_term_cache.emplace(function, stack.back());
+            return OK(stack.back());
+        }
+
+        Result<z3::expr> SolverSession::translate(const Constraint& constraint)
+        {
+            try
+            {
+                if (constraint.is_assignment())
+                {
+                    const auto assignment = constraint.get_assignment().get();
+
+                    auto lhs = translate(assignment->first);
+                    if (lhs.is_error())
+                    {
+                        return ERR_APPEND(lhs.get_error(), "could not translate constraint '" + constraint.to_string() + "': unable to translate left-hand side");
+                    }
+                    auto rhs = translate(assignment->second);
+                    if (rhs.is_error())
+                    {
+                        return ERR_APPEND(rhs.get_error(), "could not translate constraint '" + constraint.to_string() + "': unable to translate right-hand side");
+                    }
+                    return OK(lhs.get() == rhs.get());
+                }
+
+                auto function = translate(*constraint.get_function().get());
+                if (function.is_error())
+                {
+                    return ERR_APPEND(function.get_error(), "could not translate constraint '" + constraint.to_string() + "': unable to translate function");
+                }
+                return OK(function.get() == m_context->bv_val(1, 1));
+            }
+            catch (const z3::exception& e)
+            {
+                return ERR("could not translate constraint '" + constraint.to_string() + "': " + std::string(e.msg()));
+            }
+        }
+    }    // namespace SMT
+}    // namespace hal
@@ -695,13 +695,13 @@ namespace hal
             switch (node.type)
             {
                 case BooleanFunction::NodeType::Constant: {
-                    return OK(BooleanFunction::Const(node.constant));
+                    return OK(BooleanFunction::Const(node.constant()));
                 }
                 case BooleanFunction::NodeType::Index: {
-                    return OK(BooleanFunction::Index(node.index, node.size));
+                    return OK(BooleanFunction::Index(node.index(), node.size));
                 }
                 case BooleanFunction::NodeType::Variable: {
-                    return OK(this->state.get(BooleanFunction::Var(node.variable, node.size)));
+                    return OK(this->state.get(BooleanFunction::Var(node.variable(), node.size)));
                 }
                 case BooleanFunction::NodeType::And: {
                     // X & 0   =>   0
@@ -1432,7 +1432,7 @@ namespace hal
                 }
                 else
                 {
-                    const auto v = parameter.get_top_level_node().constant;
+                    const auto v = parameter.get_top_level_node().constant();
                     values.emplace_back(v);
                 }
             }
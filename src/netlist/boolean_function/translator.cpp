@@ -60,7 +60,7 @@ namespace hal
                 switch (node.type)
                 {
                     case BooleanFunction::NodeType::Constant: {
-                        if (auto str = const2str(node.constant); str.is_ok())
+                        if (auto str = const2str(node.constant()); str.is_ok())
                         {
                             return OK(std::string("(_ bv") + str.get() + " " + std::to_string(node.size) + ")");
                         }
@@ -68,9 +68,9 @@ namespace hal
                         return ERR("could not reduce into SMT-Lib v2 string: unable to translate constant '" + node.to_string() + "'");
                     }
                     case BooleanFunction::NodeType::Index:
-                        return OK(std::to_string(node.index));
+                        return OK(std::to_string(node.index()));
                     case BooleanFunction::NodeType::Variable:
-                        return OK(node.variable);
+                        return OK(node.variable());
 
                     case BooleanFunction::NodeType::And:
                         return OK("(bvand " + p[0] + " " + p[1] + ")");
@@ -101,9 +101,9 @@ namespace hal
                     case BooleanFunction::NodeType::Slice:
                         return OK("((_ extract " + p[2] + " " + p[1] + ") " + p[0] + ")");
                     case BooleanFunction::NodeType::Zext:
-                        return OK("((_ zero_extend " + std::to_string(node.size - function.get_nodes().at(index - 2).index) + ") " + p[0] + ")");
+                        return OK("((_ zero_extend " + std::to_string(node.size - function.get_nodes().at(index - 2).index()) + ") " + p[0] + ")");
                     case BooleanFunction::NodeType::Sext:
-                        return OK("((_ sign_extend " + std::to_string(node.size - function.get_nodes().at(index - 2).index) + ") " + p[0] + ")");
+                        return OK("((_ sign_extend " + std::to_string(node.size - function.get_nodes().at(index - 2).index()) + ") " + p[0] + ")");
 
                     case BooleanFunction::NodeType::Shl:
                         return OK("(bvshl " + p[0] + " (_ bv" + p[1] + " " + std::to_string(node.size) + "))");
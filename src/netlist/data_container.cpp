@@ -2,11 +2,78 @@
 
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+
 namespace hal
 {
+    namespace
+    {
+        struct EntryOrder
+        {
+            template<typename T>
+            bool operator()(const T& entry, const std::pair<DataSymbol, DataSymbol>& id) const
+            {
+                return std::tie(entry.category, entry.key) < std::tie(id.first, id.second);
+            }
+        };
+    }    // namespace
+
+    DataContainer::DataContainer(const DataContainer& other)
+    {
+        other.load_data();
+        m_data = other.m_data;
+    }
+
+    DataContainer::DataContainer(DataContainer&& other)
+    {
+        other.load_data();
+        m_data = std::move(other.m_data);
+    }
+
+    DataContainer& DataContainer::operator=(const DataContainer& other)
+    {
+        if (this != &other)
+        {
+            load_data();
+            other.load_data();
+            m_data = other.m_data;
+            notify_data_changed();
+        }
+        return *this;
+    }
+
+    DataContainer& DataContainer::operator=(DataContainer&& other)
+    {
+        if (this != &other)
+        {
+            load_data();
+            other.load_data();
+            m_data = std::move(other.m_data);
+            notify_data_changed();
+        }
+        return *this;
+    }
+
     bool DataContainer::operator==(const DataContainer& other) const
     {
-        return m_data == other.get_data_map();
+        load_data();
+        other.load_data();
+
+        if (m_data.size() != other.m_data.size())
+        {
+            return false;
+        }
+
+        for (u32 i = 0; i < m_data.size(); i++)
+        {
+            const DataEntry& a = m_data[i];
+            const DataEntry& b = other.m_data[i];
+            if (a.category != b.category || a.key != b.key || a.type != b.type || a.value != b.value)
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     bool DataContainer::operator!=(const DataContainer& other) const
@@ -22,7 +89,7 @@ namespace hal
             return false;
         }
 
-        m_data[std::make_tuple(category, key)] = std::make_tuple(value_data_type, value);
+        set_data(DataSymbol(category), DataSymbol(key), DataSymbol(value_data_type), DataValue::from_string(value_data_type, value));
 
         //notify_updated();
 
@@ -38,23 +105,58 @@ namespace hal
         return true;
     }
 
+    bool DataContainer::set_data(const DataSymbol& category, const DataSymbol& key, const DataSymbol& data_type, DataValue value)
+    {
+        load_data();
+
+        if (category.empty() || key.empty())
+        {
+            log_error("netlist", "key category or key is empty.");
+            return false;
+        }
+
+        auto it = std::lower_bound(m_data.begin(), m_data.end(), std::make_pair(category, key), EntryOrder());
+        if (it != m_data.end() && it->category == category && it->key == key)
+        {
+            it->type  = data_type;
+            it->value = std::move(value);
+        }
+        else
+        {
+            m_data.insert(it, DataEntry{category, key, data_type, std::move(value)});
+        }
+        notify_data_changed();
+
+        return true;
+    }
+
     bool DataContainer::delete_data(const std::string& category, const std::string& key, const bool log_with_info_level)
     {
+        load_data();
+
         if (category.empty() || key.empty())
         {
             log_error("netlist", "key category or key is empty.");
             return false;
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
+        const auto category_symbol = DataSymbol::find(category);
+        const auto key_symbol      = DataSymbol::find(key);
+        auto it                    = m_data.end();
+        if (category_symbol.has_value() && key_symbol.has_value())
+        {
+            it = m_data.begin() + (find_entry(category_symbol.value(), key_symbol.value()) - m_data.cbegin());
+        }
+
         if (it == m_data.end())
         {
             log_debug("netlist", "no key ('{}', '{}') found.", category, key);
             return true;
         }
 
-        auto deleted_value = std::get<1>(it->second);
+        auto deleted_value = it->value.to_string();
         m_data.erase(it);
+        notify_data_changed();
 
         //notify_updated();
 
@@ -69,14 +171,32 @@ namespace hal
         return true;
     }
 
-    const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& DataContainer::get_data_map() const
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> DataContainer::get_data_map() const
     {
-        return m_data;
+        load_data();
+
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> res;
+        for (const DataEntry& entry : m_data)
+        {
+            res.emplace(std::make_tuple(entry.category.str(), entry.key.str()), std::make_tuple(entry.type.str(), entry.value.to_string()));
+        }
+        return res;
     }
 
     void DataContainer::set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map)
     {
-        m_data = map;
+        load_data();
+
+        m_data.clear();
+        m_data.reserve(map.size());
+        for (const auto& [id, content] : map)
+        {
+            const auto& [category, key]    = id;
+            const auto& [data_type, value] = content;
+            m_data.push_back(DataEntry{DataSymbol(category), DataSymbol(key), DataSymbol(data_type), DataValue::from_string(data_type, value)});
+        }
+        std::sort(m_data.begin(), m_data.end(), [](const DataEntry& a, const DataEntry& b) { return std::tie(a.category, a.key) < std::tie(b.category, b.key); });
+        notify_data_changed();
     }
 
     bool DataContainer::has_data(const std::string& category, const std::string& key) const
@@ -86,29 +206,76 @@ namespace hal
             return false;
         }
 
-        if (auto it = m_data.find(std::make_tuple(category, key)); it == m_data.end())
+        const auto category_symbol = DataSymbol::find(category);
+        const auto key_symbol      = DataSymbol::find(key);
+        if (!category_symbol.has_value() || !key_symbol.has_value())
         {
             return false;
         }
 
-        return true;
+        return get_data_value(category_symbol.value(), key_symbol.value()) != nullptr;
     }
 
     std::tuple<std::string, std::string> DataContainer::get_data(const std::string& category, const std::string& key) const
     {
+        load_data();
+
         if (category.empty() || key.empty())
         {
             log_error("netlist", "key category or key is empty.");
             return std::make_tuple("", "");
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
-        if (it == m_data.end())
+        const auto category_symbol = DataSymbol::find(category);
+        const auto key_symbol      = DataSymbol::find(key);
+        if (category_symbol.has_value() && key_symbol.has_value())
         {
-            log_debug("netlist", "no value stored for key ('{}', '{}').", category, key);
-            return std::make_tuple("", "");
+            if (auto it = find_entry(category_symbol.value(), key_symbol.value()); it != m_data.end())
+            {
+                return std::make_tuple(it->type.str(), it->value.to_string());
+            }
+        }
+
+        log_debug("netlist", "no value stored for key ('{}', '{}').", category, key);
+        return std::make_tuple("", "");
+    }
+
+    const DataValue* DataContainer::get_data_value(const DataSymbol& category, const DataSymbol& key) const
+    {
+        load_data();
+
+        if (auto it = find_entry(category, key); it != m_data.end())
+        {
+            return &it->value;
+        }
+        return nullptr;
+    }
+
+    DataSymbol DataContainer::get_data_type(const DataSymbol& category, const DataSymbol& key) const
+    {
+        load_data();
+
+        if (auto it = find_entry(category, key); it != m_data.end())
+        {
+            return it->type;
         }
-        return it->second;
+        return DataSymbol();
+    }
+
+    u32 DataContainer::get_num_data_entries() const
+    {
+        load_data();
+
+        return m_data.size();
     }
 
+    std::vector<DataContainer::DataEntry>::const_iterator DataContainer::find_entry(const DataSymbol& category, const DataSymbol& key) const
+    {
+        auto it = std::lower_bound(m_data.begin(), m_data.end(), std::make_pair(category, key), EntryOrder());
+        if (it != m_data.end() && it->category == category && it->key == key)
+        {
+            return it;
+        }
+        return m_data.end();
+    }
 }    // namespace hal
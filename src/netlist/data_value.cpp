@@ -0,0 +1,331 @@
+#include "hal_core/netlist/data_value.h"
+
+#include "hal_core/netlist/intern_table.h"
+
+#include <cstring>
+
+namespace hal
+{
+    template<>
+    std::map<DataValue::Kind, std::string> EnumStrings<DataValue::Kind>::data = {{DataValue::Kind::string, "string"},
+                                                                                 {DataValue::Kind::integer, "integer"},
+                                                                                 {DataValue::Kind::bit_vector, "bit_vector"}};
+
+    namespace
+    {
+        InternTable<std::string>& get_symbol_table()
+        {
+            static InternTable<std::string> table;
+            // the empty symbol always has ID 0 so that default-constructed symbols are empty
+            static const u32 empty_id = table.intern(std::string());
+            (void)empty_id;
+            return table;
+        }
+
+        std::optional<i64> parse_integer(const std::string& value)
+        {
+            if (value.empty() || value.size() > 20)
+            {
+                return std::nullopt;
+            }
+
+            try
+            {
+                size_t pos    = 0;
+                const i64 res = std::stoll(value, &pos);
+                // only canonical notation converts back to the same string
+                if (pos == value.size() && std::to_string(res) == value)
+                {
+                    return res;
+                }
+            }
+            catch (const std::exception&)
+            {
+            }
+            return std::nullopt;
+        }
+
+        i32 parse_hex_digit(char c)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return c - '0';
+            }
+            if (c >= 'a' && c <= 'f')
+            {
+                return c - 'a' + 10;
+            }
+            if (c >= 'A' && c <= 'F')
+            {
+                return c - 'A' + 10;
+            }
+            return -1;
+        }
+    }    // namespace
+
+    DataSymbol::DataSymbol(const std::string& str) : m_id(get_symbol_table().intern(str))
+    {
+    }
+
+    std::optional<DataSymbol> DataSymbol::find(const std::string& str)
+    {
+        if (const auto id = get_symbol_table().find(str); id.has_value())
+        {
+            DataSymbol symbol;
+            symbol.m_id = id.value();
+            return symbol;
+        }
+        return std::nullopt;
+    }
+
+    const std::string& DataSymbol::str() const
+    {
+        return get_symbol_table().get(m_id);
+    }
+
+    DataValue::DataValue() : m_kind(Kind::string), m_digits(0)
+    {
+    }
+
+    DataValue::DataValue(const std::string& value) : m_size(value.size()), m_kind(Kind::string), m_digits(0)
+    {
+        if (is_inline())
+        {
+            std::memcpy(m_chars, value.data(), m_size);
+        }
+        else
+        {
+            m_heap_chars = new char[m_size];
+            std::memcpy(m_heap_chars, value.data(), m_size);
+        }
+    }
+
+    DataValue::DataValue(i64 value) : m_kind(Kind::integer), m_integer(value)
+    {
+    }
+
+    DataValue DataValue::from_string(const std::string& data_type, const std::string& value)
+    {
+        if (data_type == "integer")
+        {
+            if (const auto res = parse_integer(value); res.has_value())
+            {
+                return DataValue(res.value());
+            }
+        }
+        else if (data_type == "bit_vector" && !value.empty())
+        {
+            bool has_lower = false;
+            bool has_upper = false;
+            bool is_hex    = true;
+            for (char c : value)
+            {
+                if (parse_hex_digit(c) < 0)
+                {
+                    is_hex = false;
+                    break;
+                }
+                has_lower |= (c >= 'a' && c <= 'f');
+                has_upper |= (c >= 'A' && c <= 'F');
+            }
+
+            // mixed-case values would not convert back to the same string
+            if (is_hex && !(has_lower && has_upper))
+            {
+                DataValue res;
+                res.m_kind       = Kind::bit_vector;
+                res.m_size       = value.size();
+                res.m_upper_case = has_upper;
+
+                u64* words = &res.m_digits;
+                if (!res.is_inline())
+                {
+                    res.m_heap_digits = new u64[res.get_num_heap_words()]();
+                    words             = res.m_heap_digits;
+                }
+
+                for (u32 i = 0; i < res.m_size; i++)
+                {
+                    const u64 digit = parse_hex_digit(value[res.m_size - 1 - i]);
+                    words[i / INLINE_DIGITS] |= digit << (4 * (i % INLINE_DIGITS));
+                }
+                return res;
+            }
+        }
+
+        return DataValue(value);
+    }
+
+    DataValue::DataValue(const DataValue& other) : m_kind(Kind::string), m_digits(0)
+    {
+        copy_from(other);
+    }
+
+    DataValue::DataValue(DataValue&& other) noexcept : m_size(other.m_size), m_kind(other.m_kind), m_upper_case(other.m_upper_case), m_digits(other.m_digits)
+    {
+        other.m_size   = 0;
+        other.m_kind   = Kind::string;
+        other.m_digits = 0;
+    }
+
+    DataValue& DataValue::operator=(const DataValue& other)
+    {
+        if (this != &other)
+        {
+            release();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    DataValue& DataValue::operator=(DataValue&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            m_size         = other.m_size;
+            m_kind         = other.m_kind;
+            m_upper_case   = other.m_upper_case;
+            m_digits       = other.m_digits;
+            other.m_size   = 0;
+            other.m_kind   = Kind::string;
+            other.m_digits = 0;
+        }
+        return *this;
+    }
+
+    DataValue::~DataValue()
+    {
+        release();
+    }
+
+    bool DataValue::operator==(const DataValue& other) const
+    {
+        if (m_kind != other.m_kind || m_size != other.m_size || m_upper_case != other.m_upper_case)
+        {
+            // the same string may be stored in different representations depending on its data type
+            return (m_kind != other.m_kind) && to_string() == other.to_string();
+        }
+
+        if (is_inline())
+        {
+            return m_digits == other.m_digits;
+        }
+        if (m_kind == Kind::string)
+        {
+            return std::memcmp(m_heap_chars, other.m_heap_chars, m_size) == 0;
+        }
+        return std::memcmp(m_heap_digits, other.m_heap_digits, get_num_heap_words() * sizeof(u64)) == 0;
+    }
+
+    bool DataValue::operator!=(const DataValue& other) const
+    {
+        return !operator==(other);
+    }
+
+    DataValue::Kind DataValue::get_kind() const
+    {
+        return m_kind;
+    }
+
+    i64 DataValue::get_integer() const
+    {
+        return (m_kind == Kind::integer) ? m_integer : 0;
+    }
+
+    u32 DataValue::get_num_digits() const
+    {
+        return (m_kind == Kind::bit_vector) ? m_size : 0;
+    }
+
+    u8 DataValue::get_digit(u32 index) const
+    {
+        if (m_kind != Kind::bit_vector || index >= m_size)
+        {
+            return 0;
+        }
+
+        const u64 word = is_inline() ? m_digits : m_heap_digits[index / INLINE_DIGITS];
+        return (word >> (4 * (index % INLINE_DIGITS))) & 0xF;
+    }
+
+    std::string DataValue::to_string() const
+    {
+        switch (m_kind)
+        {
+            case Kind::integer:
+                return std::to_string(m_integer);
+            case Kind::bit_vector: {
+                const char* digits = m_upper_case ? "0123456789ABCDEF" : "0123456789abcdef";
+                std::string res(m_size, '0');
+                for (u32 i = 0; i < m_size; i++)
+                {
+                    res[m_size - 1 - i] = digits[get_digit(i)];
+                }
+                return res;
+            }
+            default:
+                return std::string(is_inline() ? m_chars : m_heap_chars, m_size);
+        }
+    }
+
+    bool DataValue::is_inline() const
+    {
+        switch (m_kind)
+        {
+            case Kind::integer:
+                return true;
+            case Kind::bit_vector:
+                return m_size <= INLINE_DIGITS;
+            default:
+                return m_size <= INLINE_CHARS;
+        }
+    }
+
+    u32 DataValue::get_num_heap_words() const
+    {
+        return (m_size + INLINE_DIGITS - 1) / INLINE_DIGITS;
+    }
+
+    void DataValue::copy_from(const DataValue& other)
+    {
+        m_size       = other.m_size;
+        m_kind       = other.m_kind;
+        m_upper_case = other.m_upper_case;
+        m_digits     = other.m_digits;
+
+        if (is_inline())
+        {
+            return;
+        }
+
+        if (m_kind == Kind::string)
+        {
+            m_heap_chars = new char[m_size];
+            std::memcpy(m_heap_chars, other.m_heap_chars, m_size);
+        }
+        else
+        {
+            m_heap_digits = new u64[get_num_heap_words()];
+            std::memcpy(m_heap_digits, other.m_heap_digits, get_num_heap_words() * sizeof(u64));
+        }
+    }
+
+    void DataValue::release()
+    {
+        if (!is_inline())
+        {
+            if (m_kind == Kind::string)
+            {
+                delete[] m_heap_chars;
+            }
+            else
+            {
+                delete[] m_heap_digits;
+            }
+        }
+        m_size   = 0;
+        m_kind   = Kind::string;
+        m_digits = 0;
+    }
+}    // namespace hal
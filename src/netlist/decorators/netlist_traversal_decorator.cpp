@@ -2,9 +2,151 @@
 
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/net.h"
+#include "hal_core/utilities/parallel.h"
 
 namespace hal
 {
+    namespace
+    {
+        // number of sequential gates handed out to a worker at once, kept small since each traversal may cover large parts of the netlist
+        constexpr u32 TRAVERSAL_CHUNK_SIZE = 16;
+
+        // traversal state on a connectivity snapshot, meant to be reused across calls of the same thread
+        class SnapshotTraversal
+        {
+        public:
+            SnapshotTraversal(const NetlistSnapshot& snapshot, bool successors, const std::set<PinType>& forbidden_pins)
+                : m_snapshot(snapshot), m_successors(successors), m_net_marks(snapshot.get_num_nets(), 0), m_gate_marks(snapshot.get_num_gates(), 0)
+            {
+                for (const auto pin_type : forbidden_pins)
+                {
+                    m_forbidden_pins |= u64(1) << static_cast<u32>(pin_type);
+                }
+            }
+
+            // starts a new traversal, the results of the previous one are discarded
+            void reset()
+            {
+                m_stack.clear();
+                m_result.clear();
+                m_epoch++;
+            }
+
+            // queues all exit nets of the given gate that are not reached through a forbidden pin
+            void push_exits(u32 gate_index)
+            {
+                for (const auto& exit : m_successors ? m_snapshot.get_fan_out(gate_index) : m_snapshot.get_fan_in(gate_index))
+                {
+                    if (!is_forbidden(exit.pin_type))
+                    {
+                        push_net(exit.index);
+                    }
+                }
+            }
+
+            void push_net(u32 net_index)
+            {
+                if (m_net_marks[net_index] != m_epoch)
+                {
+                    m_net_marks[net_index] = m_epoch;
+                    m_stack.push_back(net_index);
+                }
+            }
+
+            void run_sequential()
+            {
+                while (!m_stack.empty())
+                {
+                    const u32 current = m_stack.back();
+                    m_stack.pop_back();
+
+                    for (const auto& entry : m_successors ? m_snapshot.get_destinations(current) : m_snapshot.get_sources(current))
+                    {
+                        // stop traversal if gate is sequential
+                        if (m_snapshot.has_gate_property(entry.index, GateTypeProperty::sequential))
+                        {
+                            // only add gate to result if it has not been reached through a forbidden pin (e.g., control pin)
+                            if (!is_forbidden(entry.pin_type))
+                            {
+                                add_gate(entry.index);
+                            }
+                        }
+                        else
+                        {
+                            push_exits(entry.index);
+                        }
+                    }
+                }
+            }
+
+            void run_combinational()
+            {
+                while (!m_stack.empty())
+                {
+                    const u32 current = m_stack.back();
+                    m_stack.pop_back();
+
+                    for (const auto& entry : m_successors ? m_snapshot.get_destinations(current) : m_snapshot.get_sources(current))
+                    {
+                        // stop traversal if not combinational or on forbidden pins
+                        if (!m_snapshot.has_gate_property(entry.index, GateTypeProperty::combinational) || is_forbidden(entry.pin_type))
+                        {
+                            continue;
+                        }
+
+                        add_gate(entry.index);
+                        push_exits(entry.index);
+                    }
+                }
+            }
+
+            std::set<Gate*> get_result() const
+            {
+                std::set<Gate*> res;
+                for (const u32 gate_index : m_result)
+                {
+                    res.insert(m_snapshot.get_gate(gate_index));
+                }
+                return res;
+            }
+
+        private:
+            bool is_forbidden(PinType pin_type) const
+            {
+                return (m_forbidden_pins >> static_cast<u32>(pin_type)) & 1;
+            }
+
+            void add_gate(u32 gate_index)
+            {
+                if (m_gate_marks[gate_index] != m_epoch)
+                {
+                    m_gate_marks[gate_index] = m_epoch;
+                    m_result.push_back(gate_index);
+                }
+            }
+
+            const NetlistSnapshot& m_snapshot;
+            bool m_successors;
+            u64 m_forbidden_pins = 0;
+
+            // objects are marked with the epoch of the traversal that visited them, so the marks never have to be cleared
+            u32 m_epoch = 0;
+            std::vector<u32> m_net_marks;
+            std::vector<u32> m_gate_marks;
+            std::vector<u32> m_stack;
+            std::vector<u32> m_result;
+        };
+
+        Result<std::monostate> check_snapshot(const Netlist& netlist, const NetlistSnapshot& snapshot)
+        {
+            if (&snapshot.get_netlist() != &netlist)
+            {
+                return ERR("snapshot does not belong to netlist");
+            }
+            return OK({});
+        }
+    }    // namespace
+
     NetlistTraversalDecorator::NetlistTraversalDecorator(const Netlist& netlist) : m_netlist(netlist)
     {
     }
@@ -49,7 +191,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, previous.size() + 1))
                 {
@@ -175,7 +317,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, previous.size() + 1))
                 {
@@ -293,7 +435,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 if (max_depth != 0 && current_depth > max_depth)
                 {
@@ -394,7 +536,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 auto entry_pin = entry_ep->get_pin();
                 auto* gate     = entry_ep->get_gate();
@@ -530,7 +672,7 @@ namespace hal
         std::map<Gate*, std::set<Gate*>> seq_gate_map;
         std::unordered_map<const Net*, std::set<Gate*>> cache = {};
 
-        for (auto* sg : m_netlist.get_gates([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::sequential); }))
+        for (auto* sg : m_netlist.get_gates_view([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::sequential); }))
         {
             if (const auto res = this->get_next_sequential_gates(sg, successors, forbidden_pins, &cache); res.is_ok())
             {
@@ -576,7 +718,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 auto* gate            = entry_ep->get_gate();
                 const auto* entry_pin = entry_ep->get_pin();
@@ -701,6 +843,146 @@ namespace hal
         return OK(res);
     }
 
+    Result<std::set<Gate*>> NetlistTraversalDecorator::get_next_sequential_gates(const NetlistSnapshot& snapshot, const Net* net, bool successors, const std::set<PinType>& forbidden_pins) const
+    {
+        if (net == nullptr)
+        {
+            return ERR("nullptr given as net");
+        }
+
+        if (auto res = check_snapshot(m_netlist, snapshot); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+
+        const u32 net_index = snapshot.get_net_index(net);
+        if (net_index == NetlistSnapshot::INVALID_INDEX)
+        {
+            return ERR("net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " is not part of the snapshot");
+        }
+
+        SnapshotTraversal traversal(snapshot, successors, forbidden_pins);
+        traversal.reset();
+        traversal.push_net(net_index);
+        traversal.run_sequential();
+        return OK(traversal.get_result());
+    }
+
+    Result<std::set<Gate*>> NetlistTraversalDecorator::get_next_sequential_gates(const NetlistSnapshot& snapshot, const Gate* gate, bool successors, const std::set<PinType>& forbidden_pins) const
+    {
+        if (gate == nullptr)
+        {
+            return ERR("nullptr given as gate");
+        }
+
+        if (auto res = check_snapshot(m_netlist, snapshot); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+
+        const u32 gate_index = snapshot.get_gate_index(gate);
+        if (gate_index == NetlistSnapshot::INVALID_INDEX)
+        {
+            return ERR("gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + " is not part of the snapshot");
+        }
+
+        SnapshotTraversal traversal(snapshot, successors, forbidden_pins);
+        traversal.reset();
+        traversal.push_exits(gate_index);
+        traversal.run_sequential();
+        return OK(traversal.get_result());
+    }
+
+    Result<std::map<Gate*, std::set<Gate*>>>
+        NetlistTraversalDecorator::get_next_sequential_gates_map(const NetlistSnapshot& snapshot, bool successors, const std::set<PinType>& forbidden_pins, u32 num_workers) const
+    {
+        if (auto res = check_snapshot(m_netlist, snapshot); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+
+        std::vector<u32> seq_gates;
+        for (u32 i = 0; i < snapshot.get_num_gates(); i++)
+        {
+            if (snapshot.has_gate_property(i, GateTypeProperty::sequential))
+            {
+                seq_gates.push_back(i);
+            }
+        }
+
+        // every worker reuses a single traversal, since its marks cover the entire snapshot
+        std::vector<std::set<Gate*>> results(seq_gates.size());
+        utils::run_in_chunks(
+            num_workers,
+            seq_gates.size(),
+            TRAVERSAL_CHUNK_SIZE,
+            [&]() { return SnapshotTraversal(snapshot, successors, forbidden_pins); },
+            [&](SnapshotTraversal& traversal, u32 i) {
+                traversal.reset();
+                traversal.push_exits(seq_gates[i]);
+                traversal.run_sequential();
+                results[i] = traversal.get_result();
+            });
+
+        std::map<Gate*, std::set<Gate*>> seq_gate_map;
+        for (u32 i = 0; i < seq_gates.size(); i++)
+        {
+            seq_gate_map[snapshot.get_gate(seq_gates[i])] = std::move(results[i]);
+        }
+
+        return OK(std::move(seq_gate_map));
+    }
+
+    Result<std::set<Gate*>> NetlistTraversalDecorator::get_next_combinational_gates(const NetlistSnapshot& snapshot, const Net* net, bool successors, const std::set<PinType>& forbidden_pins) const
+    {
+        if (net == nullptr)
+        {
+            return ERR("nullptr given as net");
+        }
+
+        if (auto res = check_snapshot(m_netlist, snapshot); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+
+        const u32 net_index = snapshot.get_net_index(net);
+        if (net_index == NetlistSnapshot::INVALID_INDEX)
+        {
+            return ERR("net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " is not part of the snapshot");
+        }
+
+        SnapshotTraversal traversal(snapshot, successors, forbidden_pins);
+        traversal.reset();
+        traversal.push_net(net_index);
+        traversal.run_combinational();
+        return OK(traversal.get_result());
+    }
+
+    Result<std::set<Gate*>> NetlistTraversalDecorator::get_next_combinational_gates(const NetlistSnapshot& snapshot, const Gate* gate, bool successors, const std::set<PinType>& forbidden_pins) const
+    {
+        if (gate == nullptr)
+        {
+            return ERR("nullptr given as gate");
+        }
+
+        if (auto res = check_snapshot(m_netlist, snapshot); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+
+        const u32 gate_index = snapshot.get_gate_index(gate);
+        if (gate_index == NetlistSnapshot::INVALID_INDEX)
+        {
+            return ERR("gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + " is not part of the snapshot");
+        }
+
+        SnapshotTraversal traversal(snapshot, successors, forbidden_pins);
+        traversal.reset();
+        traversal.push_exits(gate_index);
+        traversal.run_combinational();
+        return OK(traversal.get_result());
+    }
+
     Result<std::optional<u32>> NetlistTraversalDecorator::get_shortest_path_distance(const Gate* start_gate,
                                                                                      const Gate* end_gate,
                                                                                      const PinDirection& direction,
@@ -729,7 +1011,7 @@ namespace hal
                             continue;
                         }
 
-                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations() : exit_ep->get_net()->get_sources())
+                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations_view() : exit_ep->get_net()->get_sources_view())
                         {
                             if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, distance))
                             {
@@ -864,7 +1146,7 @@ namespace hal
                             continue;
                         }
 
-                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations() : exit_ep->get_net()->get_sources())
+                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations_view() : exit_ep->get_net()->get_sources_view())
                         {
                             if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, distance))
                             {
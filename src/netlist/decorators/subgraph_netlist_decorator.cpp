@@ -366,14 +366,116 @@ namespace hal
             return OK(inputs);
         }
 
+        Result<BooleanFunctionDAG::NodeId> subgraph_function_dag_recursive(const Net* n,
+                                                                           const std::vector<const Gate*>& subgraph_gates,
+                                                                           BooleanFunctionDAG& dag,
+                                                                           std::map<std::pair<u32, const GatePin*>, BooleanFunctionDAG::NodeId>& gate_cache,
+                                                                           std::unordered_set<const Net*>& on_stack)
+        {
+            if (on_stack.find(n) != on_stack.end())
+            {
+                return ERR("could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": subgraph contains a cycle!");
+            }
+
+            const std::vector<Endpoint*> sources = n->get_sources();
+
+            // net is multi driven
+            if (sources.size() > 1)
+            {
+                return ERR("could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": cannot handle multi driven nets! Encountered at net "
+                           + std::to_string(n->get_id()) + ".");
+            }
+
+            // net has no source
+            if (sources.empty())
+            {
+                const auto net_dec = BooleanFunctionNetDecorator(*n);
+                return dag.add(net_dec.get_boolean_variable());
+            }
+
+            const Endpoint* src_ep = sources.front();
+
+            if (src_ep->get_gate() == nullptr)
+            {
+                return ERR("could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": gate at source for net " + std::to_string(n->get_id())
+                           + " is null.");
+            }
+
+            const Gate* src_gate = src_ep->get_gate();
+
+            // source is not in subgraph gates
+            if (std::find(subgraph_gates.begin(), subgraph_gates.end(), src_gate) == subgraph_gates.end())
+            {
+                const auto net_dec = BooleanFunctionNetDecorator(*n);
+                return dag.add(net_dec.get_boolean_variable());
+            }
+
+            if (const auto it = gate_cache.find({src_gate->get_id(), src_ep->get_pin()}); it != gate_cache.end())
+            {
+                return OK(it->second);
+            }
+
+            const auto bf_res = src_gate->get_resolved_boolean_function(src_ep->get_pin());
+            if (bf_res.is_error())
+            {
+                return ERR_APPEND(bf_res.get_error(), "could not get subgraph function of net " + n->get_name() + " with ID " + std::to_string(n->get_id()) + ": failed to get function of gate.");
+            }
+            BooleanFunction gate_func = bf_res.get().simplify_local();
+
+            on_stack.insert(n);
+
+            std::unordered_map<std::string, BooleanFunctionDAG::NodeId> input_to_node;
+
+            for (const std::string& in_net_str : gate_func.get_variable_names())
+            {
+                u32 in_net_id = std::stoi(in_net_str.substr(4));
+                Net* in_net   = src_gate->get_netlist()->get_net_by_id(in_net_id);
+
+                if (in_net == nullptr)
+                {
+                    return ERR("could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": cannot find in_net " + in_net_str + " at gate "
+                               + std::to_string(src_gate->get_id()) + "!");
+                }
+
+                auto input_res = subgraph_function_dag_recursive(in_net, subgraph_gates, dag, gate_cache, on_stack);
+
+                if (input_res.is_error())
+                {
+                    // NOTE since this can lead to a deep recursion we dont append the error and instead just forward this.
+                    return input_res;
+                }
+
+                input_to_node.insert({in_net_str, input_res.get()});
+            }
+
+            // the inputs are bound to their DAG nodes instead of being substituted, so shared logic is never duplicated
+            auto res = dag.add(gate_func, input_to_node);
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(),
+                                  "could not get subgraph function of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": failed to add gate function " + gate_func.to_string()
+                                      + " to DAG.");
+            }
+
+            on_stack.erase(n);
+
+            gate_cache.insert({{src_gate->get_id(), src_ep->get_pin()}, res.get()});
+
+            return res;
+        }
+
     }    // namespace
 
     Result<BooleanFunction> SubgraphNetlistDecorator::get_subgraph_function(const std::vector<const Gate*>& subgraph_gates,
                                                                             const Net* subgraph_output,
                                                                             std::map<std::pair<u32, const GatePin*>, BooleanFunction>& gate_cache) const
     {
-        // check validity of subgraph_gates
-        if (subgraph_gates.empty())
+        // check validity of subgraph_output and subgraph_gates, the net is checked first since the other error messages refer to it
+        if (subgraph_output == nullptr)
+        {
+            return ERR("could not get subgraph function: net is a 'nullptr'");
+        }
+        else if (subgraph_gates.empty())
         {
             return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": subgraph contains no gates");
         }
@@ -382,10 +484,6 @@ namespace hal
             return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id())
                        + ": subgraph contains a gate that is a 'nullptr'");
         }
-        else if (subgraph_output == nullptr)
-        {
-            return ERR("could not get subgraph function: net is a 'nullptr'");
-        }
         else if (subgraph_output->get_num_of_sources() > 1)
         {
             return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has more than one source");
@@ -478,10 +576,17 @@ namespace hal
         }
     }
 
-    Result<std::set<const Net*>> SubgraphNetlistDecorator::get_subgraph_function_inputs(const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output) const
+    Result<BooleanFunctionDAG::NodeId> SubgraphNetlistDecorator::get_subgraph_function_dag(const std::vector<const Gate*>& subgraph_gates,
+                                                                                           const Net* subgraph_output,
+                                                                                           BooleanFunctionDAG& dag,
+                                                                                           std::map<std::pair<u32, const GatePin*>, BooleanFunctionDAG::NodeId>& cache) const
     {
-        // check validity of subgraph_gates
-        if (subgraph_gates.empty())
+        // check validity of subgraph_output and subgraph_gates, the net is checked first since the other error messages refer to it
+        if (subgraph_output == nullptr)
+        {
+            return ERR("could not get subgraph function: net is a 'nullptr'");
+        }
+        else if (subgraph_gates.empty())
         {
             return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": subgraph contains no gates");
         }
@@ -490,10 +595,86 @@ namespace hal
             return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id())
                        + ": subgraph contains a gate that is a 'nullptr'");
         }
-        else if (subgraph_output == nullptr)
+        else if (subgraph_output->get_num_of_sources() > 1)
+        {
+            return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has more than one source");
+        }
+        else if (subgraph_output->is_global_input_net())
+        {
+            const auto net_dec = BooleanFunctionNetDecorator(*subgraph_output);
+            return dag.add(net_dec.get_boolean_variable());
+        }
+        else if (subgraph_output->get_num_of_sources() == 0)
+        {
+            return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has no sources");
+        }
+
+        const Gate* start_gate = subgraph_output->get_sources()[0]->get_gate();
+        if (std::find(subgraph_gates.begin(), subgraph_gates.end(), start_gate) == subgraph_gates.end())
+        {
+            const auto net_dec = BooleanFunctionNetDecorator(*subgraph_output);
+            return dag.add(net_dec.get_boolean_variable());
+        }
+
+        std::unordered_set<const Net*> on_stack;
+
+        return subgraph_function_dag_recursive(subgraph_output, subgraph_gates, dag, cache, on_stack);
+    }
+
+    Result<BooleanFunctionDAG::NodeId> SubgraphNetlistDecorator::get_subgraph_function_dag(const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output, BooleanFunctionDAG& dag) const
+    {
+        std::map<std::pair<u32, const GatePin*>, BooleanFunctionDAG::NodeId> gate_cache;
+        if (auto res = get_subgraph_function_dag(subgraph_gates, subgraph_output, dag, gate_cache); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return res;
+        }
+    }
+
+    Result<BooleanFunctionDAG::NodeId> SubgraphNetlistDecorator::get_subgraph_function_dag(const std::vector<Gate*>& subgraph_gates, const Net* subgraph_output, BooleanFunctionDAG& dag) const
+    {
+        const auto subgraph_gates_const = std::vector<const Gate*>(subgraph_gates.begin(), subgraph_gates.end());
+        if (auto res = get_subgraph_function_dag(subgraph_gates_const, subgraph_output, dag); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return res;
+        }
+    }
+
+    Result<BooleanFunctionDAG::NodeId> SubgraphNetlistDecorator::get_subgraph_function_dag(const Module* subgraph_module, const Net* subgraph_output, BooleanFunctionDAG& dag) const
+    {
+        if (auto res = get_subgraph_function_dag(subgraph_module->get_gates(), subgraph_output, dag); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return res;
+        }
+    }
+
+    Result<std::set<const Net*>> SubgraphNetlistDecorator::get_subgraph_function_inputs(const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output) const
+    {
+        // check validity of subgraph_output and subgraph_gates, the net is checked first since the other error messages refer to it
+        if (subgraph_output == nullptr)
         {
             return ERR("could not get subgraph function: net is a 'nullptr'");
         }
+        else if (subgraph_gates.empty())
+        {
+            return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": subgraph contains no gates");
+        }
+        else if (std::any_of(subgraph_gates.begin(), subgraph_gates.end(), [](const Gate* g) { return g == nullptr; }))
+        {
+            return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id())
+                       + ": subgraph contains a gate that is a 'nullptr'");
+        }
         else if (subgraph_output->get_num_of_sources() > 1)
         {
             return ERR("could not get subgraph function of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has more than one source");
@@ -65,6 +65,90 @@ namespace hal
                                                                                            {GroupingEvent::event::module_assigned, "module_assigned"},
                                                                                            {GroupingEvent::event::module_removed, "module_removed"}};
 
+    namespace
+    {
+        template<typename Hook, typename Queue, typename EventType, typename ObjectType>
+        void batch_event(Hook& hook, Queue& queue, u32 batch_depth, EventType ev, ObjectType* object, u32 associated_data, bool created, bool removed)
+        {
+            if (hook.size() == 0)
+            {
+                return;
+            }
+
+            if (batch_depth > 0)
+            {
+                queue.push(ev, object, object->get_id(), associated_data, created, removed);
+            }
+            else
+            {
+                hook({{ev, object, object->get_id(), {associated_data}}});
+            }
+        }
+    }    // namespace
+
+    template<typename EventType, typename ObjectType>
+    void EventHandler::EventQueue<EventType, ObjectType>::push(EventType ev, ObjectType* object, u32 object_id, u32 associated_data, bool created, bool removed)
+    {
+        if (removed)
+        {
+            // the removal supersedes all queued events of the object, which vanishes entirely if it has been created within the batch
+            bool was_created = false;
+            if (auto it = m_objects.find(object); it != m_objects.end())
+            {
+                for (u32 index : it->second.indices)
+                {
+                    m_cancelled[index] = true;
+                }
+                was_created = it->second.created;
+                m_objects.erase(it);
+            }
+
+            if (!was_created)
+            {
+                m_events.push_back({ev, object, object_id, {associated_data}});
+                m_cancelled.push_back(false);
+            }
+            return;
+        }
+
+        PendingObject& pending = m_objects[object];
+        pending.created |= created;
+        for (u32 index : pending.indices)
+        {
+            if (auto& event = m_events[index]; event.event == ev)
+            {
+                if (event.associated_data.back() != associated_data)
+                {
+                    event.associated_data.push_back(associated_data);
+                }
+                return;
+            }
+        }
+
+        pending.indices.push_back(m_events.size());
+        m_events.push_back({ev, object, object_id, {associated_data}});
+        m_cancelled.push_back(false);
+    }
+
+    template<typename EventType, typename ObjectType>
+    std::vector<BatchedEvent<EventType, ObjectType>> EventHandler::EventQueue<EventType, ObjectType>::take()
+    {
+        std::vector<BatchedEvent<EventType, ObjectType>> res;
+        res.reserve(m_events.size());
+        for (u32 i = 0; i < m_events.size(); i++)
+        {
+            if (!m_cancelled[i])
+            {
+                res.push_back(std::move(m_events[i]));
+            }
+        }
+
+        m_events.clear();
+        m_cancelled.clear();
+        m_objects.clear();
+        return res;
+    }
+
     EventHandler::EventHandler() : netlist_event_enabled(true), module_event_enabled(true), gate_event_enabled(true), net_event_enabled(true), grouping_event_enabled(true)
     {
     }
@@ -84,6 +168,7 @@ namespace hal
         {
             m_netlist_callback(c, netlist, associated_data);
             event_log::handle_netlist_event(c, netlist, associated_data);
+            batch_event(m_netlist_batch_callback, m_netlist_queue, m_batch_depth, c, netlist, associated_data, false, false);
         }
     }
 
@@ -93,6 +178,7 @@ namespace hal
         {
             m_gate_callback(c, gate, associated_data);
             event_log::handle_gate_event(c, gate, associated_data);
+            batch_event(m_gate_batch_callback, m_gate_queue, m_batch_depth, c, gate, associated_data, c == GateEvent::event::created, c == GateEvent::event::removed);
         }
     }
 
@@ -102,6 +188,7 @@ namespace hal
         {
             m_net_callback(c, net, associated_data);
             event_log::handle_net_event(c, net, associated_data);
+            batch_event(m_net_batch_callback, m_net_queue, m_batch_depth, c, net, associated_data, c == NetEvent::event::created, c == NetEvent::event::removed);
         }
     }
 
@@ -112,6 +199,7 @@ namespace hal
         {
             m_module_callback(c, module, associated_data);
             event_log::handle_module_event(c, module, associated_data);
+            batch_event(m_module_batch_callback, m_module_queue, m_batch_depth, c, module, associated_data, c == ModuleEvent::event::created, c == ModuleEvent::event::removed);
         }
     }
 
@@ -121,6 +209,7 @@ namespace hal
         {
             m_grouping_callback(c, grouping, associated_data);
             event_log::handle_grouping_event(c, grouping, associated_data);
+            batch_event(m_grouping_batch_callback, m_grouping_queue, m_batch_depth, c, grouping, associated_data, c == GroupingEvent::event::created, c == GroupingEvent::event::removed);
         }
     }
 
@@ -149,6 +238,31 @@ namespace hal
         m_netlist_callback.add_callback(name, function);
     }
 
+    void EventHandler::register_batch_callback(const std::string& name, std::function<void(const std::vector<NetlistBatchedEvent>&)> function)
+    {
+        m_netlist_batch_callback.add_callback(name, function);
+    }
+
+    void EventHandler::register_batch_callback(const std::string& name, std::function<void(const std::vector<ModuleBatchedEvent>&)> function)
+    {
+        m_module_batch_callback.add_callback(name, function);
+    }
+
+    void EventHandler::register_batch_callback(const std::string& name, std::function<void(const std::vector<GateBatchedEvent>&)> function)
+    {
+        m_gate_batch_callback.add_callback(name, function);
+    }
+
+    void EventHandler::register_batch_callback(const std::string& name, std::function<void(const std::vector<NetBatchedEvent>&)> function)
+    {
+        m_net_batch_callback.add_callback(name, function);
+    }
+
+    void EventHandler::register_batch_callback(const std::string& name, std::function<void(const std::vector<GroupingBatchedEvent>&)> function)
+    {
+        m_grouping_batch_callback.add_callback(name, function);
+    }
+
     void EventHandler::unregister_callback(const std::string& name)
     {
         m_netlist_callback.remove_callback(name);
@@ -156,5 +270,56 @@ namespace hal
         m_gate_callback.remove_callback(name);
         m_net_callback.remove_callback(name);
         m_grouping_callback.remove_callback(name);
+        m_netlist_batch_callback.remove_callback(name);
+        m_module_batch_callback.remove_callback(name);
+        m_gate_batch_callback.remove_callback(name);
+        m_net_batch_callback.remove_callback(name);
+        m_grouping_batch_callback.remove_callback(name);
+    }
+
+    void EventHandler::begin_batch()
+    {
+        m_batch_depth++;
+    }
+
+    void EventHandler::end_batch()
+    {
+        if (m_batch_depth == 0 || --m_batch_depth > 0)
+        {
+            return;
+        }
+
+        // take all queues before delivering anything, events caused by the callbacks themselves are delivered immediately
+        const auto netlist_events  = m_netlist_queue.take();
+        const auto gate_events     = m_gate_queue.take();
+        const auto net_events      = m_net_queue.take();
+        const auto module_events   = m_module_queue.take();
+        const auto grouping_events = m_grouping_queue.take();
+
+        if (!netlist_events.empty())
+        {
+            m_netlist_batch_callback(netlist_events);
+        }
+        if (!gate_events.empty())
+        {
+            m_gate_batch_callback(gate_events);
+        }
+        if (!net_events.empty())
+        {
+            m_net_batch_callback(net_events);
+        }
+        if (!module_events.empty())
+        {
+            m_module_batch_callback(module_events);
+        }
+        if (!grouping_events.empty())
+        {
+            m_grouping_batch_callback(grouping_events);
+        }
+    }
+
+    bool EventHandler::is_batch_active() const
+    {
+        return m_batch_depth > 0;
     }
 }    // namespace hal
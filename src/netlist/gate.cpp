@@ -47,6 +47,16 @@ namespace hal
         ;
     }
 
+    void Gate::load_deferred_data() const
+    {
+        m_internal_manager->load_deferred_data(this);
+    }
+
+    void Gate::notify_data_changed()
+    {
+        m_internal_manager->notify_data_changed(this);
+    }
+
     bool Gate::operator==(const Gate& other) const
     {
         if (m_id != other.get_id() || m_name != other.get_name() || m_type != other.get_type())
@@ -67,7 +77,7 @@ namespace hal
             return false;
         }
 
-        if (m_functions != other.get_boolean_functions(true))
+        if (m_functions != other.m_functions)
         {
             log_debug("gate", "the gates with IDs {} and {} are not equal due to an unequal Boolean functions.", m_id, other.get_id());
             return false;
@@ -173,28 +183,30 @@ namespace hal
 
     Module* Gate::get_module() const
     {
+        m_internal_manager->load_deferred_modules();
         return m_module;
     }
 
     std::vector<Module*> Gate::get_modules(const std::function<bool(Module*)>& filter, bool recursive) const
     {
         std::vector<Module*> res;
+        Module* module = get_module();
 
         if (!filter)
         {
-            res.push_back(m_module);
+            res.push_back(module);
         }
         else
         {
-            if (filter(m_module))
+            if (filter(module))
             {
-                res.push_back(m_module);
+                res.push_back(module);
             }
         }
 
         if (recursive)
         {
-            std::vector<Module*> more = m_module->get_parent_modules(filter, true);
+            std::vector<Module*> more = module->get_parent_modules(filter, true);
             res.reserve(res.size() + more.size());
             res.insert(res.end(), more.begin(), more.end());
         }
@@ -203,6 +215,7 @@ namespace hal
 
     Grouping* Gate::get_grouping() const
     {
+        m_internal_manager->load_deferred_groupings();
         return m_grouping;
     }
 
@@ -382,15 +395,19 @@ namespace hal
             return BooleanFunction();
         }
 
-        const std::string& category  = init_component->get_init_category();
-        const std::string& key       = init_component->get_init_identifiers().front();
-        std::string config_str       = std::get<1>(get_data(category, key));
+        const DataValue* config_value = nullptr;
+        const auto category           = DataSymbol::find(init_component->get_init_category());
+        const auto key                = DataSymbol::find(init_component->get_init_identifiers().front());
+        if (category.has_value() && key.has_value())
+        {
+            config_value = get_data_value(category.value(), key.value());
+        }
         auto is_ascending            = lut_component->is_init_ascending();
         std::vector<GatePin*> inputs = m_type->get_input_pins();
 
         auto result = BooleanFunction::Const(BooleanFunction::Value::ZERO);
 
-        if (config_str.empty())
+        if (config_value == nullptr || (config_value->get_kind() == DataValue::Kind::string && config_value->to_string().empty()))
         {
             return result;
         }
@@ -402,29 +419,41 @@ namespace hal
         }
 
         u64 config = 0;
-        try
+        // hexadecimal INIT strings are already stored as bit-vectors and do not need to be parsed again
+        if (config_value->get_kind() == DataValue::Kind::bit_vector && config_value->get_num_digits() <= 16)
         {
-            config = std::stoull(config_str, nullptr, 16);
-        }
-        catch (std::invalid_argument& ex)
-        {
-            log_error("gate",
-                      "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which is not a hex value.",
-                      m_name,
-                      m_id,
-                      m_internal_manager->m_netlist->get_id(),
-                      config_str);
-            return BooleanFunction();
+            for (u32 i = 0; i < config_value->get_num_digits(); i++)
+            {
+                config |= u64(config_value->get_digit(i)) << (4 * i);
+            }
         }
-        catch (std::out_of_range& ex)
+        else
         {
-            log_error("gate",
-                      "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which has to many hex digits.",
-                      m_name,
-                      m_id,
-                      m_internal_manager->m_netlist->get_id(),
-                      config_str);
-            return BooleanFunction();
+            const std::string config_str = config_value->to_string();
+            try
+            {
+                config = std::stoull(config_str, nullptr, 16);
+            }
+            catch (std::invalid_argument& ex)
+            {
+                log_error("gate",
+                          "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which is not a hex value.",
+                          m_name,
+                          m_id,
+                          m_internal_manager->m_netlist->get_id(),
+                          config_str);
+                return BooleanFunction();
+            }
+            catch (std::out_of_range& ex)
+            {
+                log_error("gate",
+                          "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which has to many hex digits.",
+                          m_name,
+                          m_id,
+                          m_internal_manager->m_netlist->get_id(),
+                          config_str);
+                return BooleanFunction();
+            }
         }
 
         u32 max_config_size = 1 << inputs.size();
@@ -437,9 +466,12 @@ namespace hal
         auto cache_key = std::make_pair(inputs, config);
         auto& cache    = m_internal_manager->m_lut_function_cache;
 
-        if (auto it = cache.find(cache_key); it != cache.end())
         {
-            return it->second;
+            std::shared_lock lock(m_internal_manager->m_lut_function_cache_mutex);
+            if (auto it = cache.find(cache_key); it != cache.end())
+            {
+                return it->second;
+            }
         }
 
         u32 config_size = 0;
@@ -460,8 +492,8 @@ namespace hal
                       m_id,
                       m_internal_manager->m_netlist->get_id(),
                       max_config_size,
-                      config_str,
-                      config_str.size() * 4);
+                      config_value->to_string(),
+                      config_value->to_string().size() * 4);
             return BooleanFunction();
         }
 
@@ -489,9 +521,10 @@ namespace hal
             }
         }
 
-        auto f           = result.simplify();
-        cache[cache_key] = f;
-        return f;
+        // another thread may have computed the same function in the meantime, in which case its result is kept
+        auto f = result.simplify();
+        std::unique_lock lock(m_internal_manager->m_lut_function_cache_mutex);
+        return cache.emplace(std::move(cache_key), std::move(f)).first->second;
     }
 
     bool Gate::add_boolean_function(const std::string& name, const BooleanFunction& func)
@@ -874,39 +907,40 @@ namespace hal
     std::vector<Gate*> Gate::get_unique_predecessors(const std::function<bool(const GatePin* pin, Endpoint*)>& filter) const
     {
         std::unordered_set<Gate*> res;
-        auto endpoints = get_predecessors(filter);
-        res.reserve(endpoints.size());
-        for (auto ep : endpoints)
+        if (!filter)
+        {
+            for (auto ep : get_predecessors_view())
+            {
+                res.insert(ep->get_gate());
+            }
+        }
+        else
         {
-            res.insert(ep->get_gate());
+            for (auto ep : get_predecessors_view(std::cref(filter)))
+            {
+                res.insert(ep->get_gate());
+            }
         }
         return std::vector<Gate*>(res.begin(), res.end());
     }
 
     std::vector<Endpoint*> Gate::get_predecessors(const std::function<bool(const GatePin* pin, Endpoint*)>& filter) const
     {
-        std::vector<Endpoint*> result;
-        for (auto ep : m_in_endpoints)
+        if (!filter)
         {
-            auto pred_pin     = ep->get_pin();
-            auto predecessors = ep->get_net()->get_sources();
-            if (!filter)
-            {
-                result.insert(result.end(), predecessors.begin(), predecessors.end());
-            }
-            else
-            {
-                for (auto pre : predecessors)
-                {
-                    if (!filter(pred_pin, pre))
-                    {
-                        continue;
-                    }
-                    result.push_back(pre);
-                }
-            }
+            return get_predecessors_view().to_vector();
         }
-        return result;
+        return get_predecessors_view(std::cref(filter)).to_vector();
+    }
+
+    Range<std::vector<Endpoint*>::const_iterator> Gate::NetSources::operator()(const Endpoint* ep) const
+    {
+        return ep->get_net()->get_sources_view();
+    }
+
+    FlattenedRange<std::vector<Endpoint*>::const_iterator, Gate::NetSources, AcceptAll> Gate::get_predecessors_view() const
+    {
+        return FlattenedRange<std::vector<Endpoint*>::const_iterator, NetSources, AcceptAll>(m_in_endpoints.begin(), m_in_endpoints.end(), NetSources(), AcceptAll());
     }
 
     Endpoint* Gate::get_predecessor(const GatePin* pin) const
@@ -921,18 +955,20 @@ namespace hal
             log_warning("gate", "could not get predecessor endpoint of pin '{}' at gate '{}' with ID {}: pin is not an input pin", pin->get_name(), m_name, std::to_string(m_id));
             return nullptr;
         }
-        auto predecessors = get_predecessors([pin](const auto p, auto) -> bool { return *p == *pin; });
-        if (predecessors.size() == 0)
+        const auto predecessors = get_predecessors_view([pin](const GatePin* p, Endpoint*) -> bool { return *p == *pin; });
+        auto it                 = predecessors.begin();
+        if (it == predecessors.end())
         {
             return nullptr;
         }
-        if (predecessors.size() > 1)
+        Endpoint* predecessor = *it;
+        if (++it != predecessors.end())
         {
             log_warning("gate", "gate '{}' with ID {} has multiple predecessors at input pin '{}' in netlist with ID {}.", m_name, m_id, pin->get_name(), m_internal_manager->m_netlist->get_id());
             return nullptr;
         }
 
-        return predecessors[0];
+        return predecessor;
     }
 
     Endpoint* Gate::get_predecessor(const std::string& pin_name) const
@@ -954,39 +990,40 @@ namespace hal
     std::vector<Gate*> Gate::get_unique_successors(const std::function<bool(const GatePin* pin, Endpoint*)>& filter) const
     {
         std::unordered_set<Gate*> res;
-        auto endpoints = get_successors(filter);
-        res.reserve(endpoints.size());
-        for (auto ep : endpoints)
+        if (!filter)
+        {
+            for (auto ep : get_successors_view())
+            {
+                res.insert(ep->get_gate());
+            }
+        }
+        else
         {
-            res.insert(ep->get_gate());
+            for (auto ep : get_successors_view(std::cref(filter)))
+            {
+                res.insert(ep->get_gate());
+            }
         }
         return std::vector<Gate*>(res.begin(), res.end());
     }
 
     std::vector<Endpoint*> Gate::get_successors(const std::function<bool(const GatePin* pin, Endpoint*)>& filter) const
     {
-        std::vector<Endpoint*> result;
-        for (auto ep : m_out_endpoints)
+        if (!filter)
         {
-            auto suc_pin    = ep->get_pin();
-            auto successors = ep->get_net()->get_destinations();
-            if (!filter)
-            {
-                result.insert(result.end(), successors.begin(), successors.end());
-            }
-            else
-            {
-                for (auto suc : successors)
-                {
-                    if (!filter(suc_pin, suc))
-                    {
-                        continue;
-                    }
-                    result.push_back(suc);
-                }
-            }
+            return get_successors_view().to_vector();
         }
-        return result;
+        return get_successors_view(std::cref(filter)).to_vector();
+    }
+
+    Range<std::vector<Endpoint*>::const_iterator> Gate::NetDestinations::operator()(const Endpoint* ep) const
+    {
+        return ep->get_net()->get_destinations_view();
+    }
+
+    FlattenedRange<std::vector<Endpoint*>::const_iterator, Gate::NetDestinations, AcceptAll> Gate::get_successors_view() const
+    {
+        return FlattenedRange<std::vector<Endpoint*>::const_iterator, NetDestinations, AcceptAll>(m_out_endpoints.begin(), m_out_endpoints.end(), NetDestinations(), AcceptAll());
     }
 
     Endpoint* Gate::get_successor(const GatePin* pin) const
@@ -1001,18 +1038,20 @@ namespace hal
             log_warning("gate", "could not get successor endpoint of pin '{}' at gate '{}' with ID {}: pin is not an output pin", pin->get_name(), m_name, std::to_string(m_id));
             return nullptr;
         }
-        auto successors = get_successors([pin](const auto p, auto) -> bool { return *p == *pin; });
-        if (successors.size() == 0)
+        const auto successors = get_successors_view([pin](const GatePin* p, Endpoint*) -> bool { return *p == *pin; });
+        auto it               = successors.begin();
+        if (it == successors.end())
         {
             return nullptr;
         }
-        if (successors.size() > 1)
+        Endpoint* successor = *it;
+        if (++it != successors.end())
         {
             log_warning("gate", "gate '{}' with ID {} has multiple successor at output pin '{}' in netlist with ID {}.", m_name, m_id, pin->get_name(), m_internal_manager->m_netlist->get_id());
             return nullptr;
         }
 
-        return successors[0];
+        return successor;
     }
 
     Endpoint* Gate::get_successor(const std::string& pin_name) const
@@ -1043,10 +1082,17 @@ namespace hal
         const std::string& category                 = init_component->get_init_category();
         const std::vector<std::string>& identifiers = init_component->get_init_identifiers();
 
+        const auto category_symbol = DataSymbol::find(category);
+
         std::vector<std::string> init_data;
         for (const std::string& id : identifiers)
         {
-            init_data.push_back(std::get<1>(get_data(category, id)));
+            const DataValue* value = nullptr;
+            if (const auto id_symbol = DataSymbol::find(id); category_symbol.has_value() && id_symbol.has_value())
+            {
+                value = get_data_value(category_symbol.value(), id_symbol.value());
+            }
+            init_data.push_back((value != nullptr) ? value->to_string() : "");
         }
 
         return OK(init_data);
@@ -0,0 +1,188 @@
+#include "hal_core/netlist/id_allocator.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace hal
+{
+    bool IdAllocator::PagedBitmap::test(u32 index) const
+    {
+        const u32 page = index / PAGE_BITS;
+        if (page >= m_pages.size() || m_pages[page].empty())
+        {
+            return false;
+        }
+        const u32 offset = index % PAGE_BITS;
+        return (m_pages[page][offset / 64] >> (offset % 64)) & 1;
+    }
+
+    bool IdAllocator::PagedBitmap::set(u32 index)
+    {
+        const u32 page = index / PAGE_BITS;
+        if (page >= m_pages.size())
+        {
+            m_pages.resize(page + 1);
+        }
+        if (m_pages[page].empty())
+        {
+            m_pages[page].resize(PAGE_BITS / 64, 0);
+        }
+        const u32 offset   = index % PAGE_BITS;
+        u64& word          = m_pages[page][offset / 64];
+        const u64 mask     = u64(1) << (offset % 64);
+        const bool was_set = (word & mask) != 0;
+        word |= mask;
+        return !was_set;
+    }
+
+    bool IdAllocator::PagedBitmap::reset(u32 index)
+    {
+        const u32 page = index / PAGE_BITS;
+        if (page >= m_pages.size() || m_pages[page].empty())
+        {
+            return false;
+        }
+        const u32 offset   = index % PAGE_BITS;
+        u64& word          = m_pages[page][offset / 64];
+        const u64 mask     = u64(1) << (offset % 64);
+        const bool was_set = (word & mask) != 0;
+        word &= ~mask;
+        return was_set;
+    }
+
+    void IdAllocator::PagedBitmap::clear()
+    {
+        m_pages.clear();
+    }
+
+    std::set<u32> IdAllocator::PagedBitmap::to_set() const
+    {
+        std::set<u32> res;
+        for (u32 page = 0; page < m_pages.size(); page++)
+        {
+            for (u32 w = 0; w < m_pages[page].size(); w++)
+            {
+                u64 word = m_pages[page][w];
+                while (word != 0)
+                {
+                    const u32 bit = __builtin_ctzll(word);
+                    res.insert(res.end(), page * PAGE_BITS + w * 64 + bit);
+                    word &= word - 1;
+                }
+            }
+        }
+        return res;
+    }
+
+    u32 IdAllocator::get_unique_id()
+    {
+        // discard heap entries of IDs that have been reused in the meantime
+        while (!m_free_heap.empty() && !m_free.test(m_free_heap.front()))
+        {
+            std::pop_heap(m_free_heap.begin(), m_free_heap.end(), std::greater<u32>());
+            m_free_heap.pop_back();
+        }
+        if (!m_free_heap.empty())
+        {
+            return m_free_heap.front();
+        }
+        while (m_used.test(m_next_id))
+        {
+            m_next_id++;
+        }
+        return m_next_id;
+    }
+
+    bool IdAllocator::is_used(u32 id) const
+    {
+        return m_used.test(id);
+    }
+
+    bool IdAllocator::reserve(u32 id)
+    {
+        if (!m_used.set(id))
+        {
+            return false;
+        }
+        m_num_used++;
+        if (m_free.reset(id))
+        {
+            m_num_free--;
+        }
+        return true;
+    }
+
+    bool IdAllocator::release(u32 id)
+    {
+        if (!m_used.reset(id))
+        {
+            return false;
+        }
+        m_num_used--;
+        if (m_free.set(id))
+        {
+            m_num_free++;
+            m_free_heap.push_back(id);
+            std::push_heap(m_free_heap.begin(), m_free_heap.end(), std::greater<u32>());
+        }
+
+        // rebuild the heap if stale entries dominate it
+        if (m_free_heap.size() > 2 * m_num_free + 64)
+        {
+            m_free_heap.clear();
+            for (const u32 free_id : m_free.to_set())
+            {
+                m_free_heap.push_back(free_id);
+            }
+        }
+        return true;
+    }
+
+    u32 IdAllocator::get_next_id() const
+    {
+        return m_next_id;
+    }
+
+    void IdAllocator::set_next_id(u32 id)
+    {
+        m_next_id = id;
+    }
+
+    u32 IdAllocator::get_num_used_ids() const
+    {
+        return m_num_used;
+    }
+
+    std::set<u32> IdAllocator::get_used_ids() const
+    {
+        return m_used.to_set();
+    }
+
+    void IdAllocator::set_used_ids(const std::set<u32>& ids)
+    {
+        m_used.clear();
+        for (const u32 id : ids)
+        {
+            m_used.set(id);
+        }
+        m_num_used = ids.size();
+    }
+
+    std::set<u32> IdAllocator::get_free_ids() const
+    {
+        return m_free.to_set();
+    }
+
+    void IdAllocator::set_free_ids(const std::set<u32>& ids)
+    {
+        m_free.clear();
+        m_free_heap.clear();
+        for (const u32 id : ids)
+        {
+            m_free.set(id);
+            // ascending order already satisfies the heap property
+            m_free_heap.push_back(id);
+        }
+        m_num_free = ids.size();
+    }
+}    // namespace hal
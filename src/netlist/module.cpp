@@ -17,12 +17,14 @@ namespace hal
         m_parent           = parent;
         m_name             = name;
 
-        m_next_pin_id       = 1;
-        m_next_pin_group_id = 1;
-
         m_event_handler = event_handler;
     }
 
+    void Module::notify_data_changed()
+    {
+        m_internal_manager->notify_data_changed(this);
+    }
+
     bool Module::operator==(const Module& other) const
     {
         if (m_id != other.get_id() || m_name != other.get_name() || m_type != other.get_type())
@@ -119,6 +121,7 @@ namespace hal
 
     Grouping* Module::get_grouping() const
     {
+        m_internal_manager->load_deferred_groupings();
         return m_grouping;
     }
 
@@ -198,11 +201,29 @@ namespace hal
         }
 
         m_parent->m_submodules_map.erase(m_id);
-        m_parent->m_submodules.erase(std::find(m_parent->m_submodules.begin(), m_parent->m_submodules.end(), this));
+        m_parent->m_submodules.erase(m_parent->m_submodules.begin() + m_submodule_index);
+        for (u32 i = m_submodule_index; i < m_parent->m_submodules.size(); i++)
+        {
+            m_parent->m_submodules[i]->m_submodule_index = i;
+        }
 
-        if (m_internal_manager->m_net_checks_enabled)
+        // endpoints within this module no longer count towards the previous ancestors
+        for (const auto& [net, counts] : m_net_endpoint_counts)
+        {
+            m_parent->count_net_endpoints(net, -static_cast<i32>(counts.num_sources), -static_cast<i32>(counts.num_destinations));
+        }
+
+        // the endpoint counts cover all nets of the module, even if their classification has been deferred by a bulk edit
+        if (m_internal_manager->m_bulk_edit_depth > 0)
         {
-            for (Net* net : get_nets(nullptr, true))
+            for (const auto& [net, counts] : m_net_endpoint_counts)
+            {
+                m_internal_manager->bulk_edit_mark_net(net, m_parent);
+            }
+        }
+        else if (m_internal_manager->m_net_checks_enabled)
+        {
+            for (const auto& [net, counts] : m_net_endpoint_counts)
             {
                 if (auto res = m_parent->check_net(net, true); res.is_error())
                 {
@@ -216,11 +237,24 @@ namespace hal
         m_parent = new_parent;
 
         m_parent->m_submodules_map[m_id] = this;
+        m_submodule_index                = m_parent->m_submodules.size();
         m_parent->m_submodules.push_back(this);
 
-        if (m_internal_manager->m_net_checks_enabled)
+        for (const auto& [net, counts] : m_net_endpoint_counts)
+        {
+            m_parent->count_net_endpoints(net, counts.num_sources, counts.num_destinations);
+        }
+
+        if (m_internal_manager->m_bulk_edit_depth > 0)
         {
-            for (Net* net : get_nets(nullptr, true))
+            for (const auto& [net, counts] : m_net_endpoint_counts)
+            {
+                m_internal_manager->bulk_edit_mark_net(net, m_parent);
+            }
+        }
+        else if (m_internal_manager->m_net_checks_enabled)
+        {
+            for (const auto& [net, counts] : m_net_endpoint_counts)
             {
                 if (auto res = m_parent->check_net(net, true); res.is_error())
                 {
@@ -395,34 +429,50 @@ namespace hal
 
     std::vector<Gate*> Module::get_gates(const std::function<bool(Gate*)>& filter, bool recursive) const
     {
-        std::vector<Gate*> res;
         if (!filter)
         {
-            res = m_gates;
+            return recursive ? get_gates_view(true).to_vector() : m_gates;
         }
-        else
+        return get_gates_view(std::cref(filter), recursive).to_vector();
+    }
+
+    Module::GateIterator::GateIterator(const Module* root, const Module* current, bool recursive) : m_root(root), m_current(current), m_recursive(recursive)
+    {
+        skip_exhausted();
+    }
+
+    void Module::GateIterator::skip_exhausted()
+    {
+        while (m_current != nullptr && m_index >= m_current->m_gates.size())
         {
-            for (auto g : m_gates)
-            {
-                if (!filter(g))
-                {
-                    continue;
-                }
-                res.push_back(g);
-            }
+            m_current = m_recursive ? next_module(m_current) : nullptr;
+            m_index   = 0;
         }
+    }
 
-        if (recursive)
+    const Module* Module::GateIterator::next_module(const Module* module) const
+    {
+        // depth-first pre-order: descend into the first submodule, otherwise continue with the next sibling of the closest ancestor that has one
+        if (!module->m_submodules.empty())
         {
-            for (auto sm : m_submodules)
+            return module->m_submodules.front();
+        }
+
+        while (module != m_root)
+        {
+            const auto& siblings = module->m_parent->m_submodules;
+            if (module->m_submodule_index + 1 < siblings.size())
             {
-                auto more = sm->get_gates(filter, true);
-                res.reserve(res.size() + more.size());
-                res.insert(res.end(), more.begin(), more.end());
+                return siblings[module->m_submodule_index + 1];
             }
+            module = module->m_parent;
         }
+        return nullptr;
+    }
 
-        return res;
+    Range<Module::GateIterator> Module::get_gates_view(bool recursive) const
+    {
+        return Range<GateIterator>(GateIterator(this, this, recursive), GateIterator(this, nullptr, recursive));
     }
 
     /*
@@ -437,21 +487,44 @@ namespace hal
         m_input_nets.clear();
         m_output_nets.clear();
         m_internal_nets.clear();
+        m_net_endpoint_counts.clear();
 
-        std::unordered_set<Net*> net_cache;
-        for (const Gate* gate : get_gates(nullptr, true))
+        std::vector<Net*> connected_nets;
+        if (m_parent != nullptr)
         {
-            for (Net* net : gate->get_fan_in_nets())
+            for (const Gate* gate : get_gates_view(true))
             {
-                net_cache.insert(net);
+                for (const Endpoint* ep : gate->get_fan_in_endpoints())
+                {
+                    m_net_endpoint_counts[ep->get_net()].num_destinations++;
+                }
+                for (const Endpoint* ep : gate->get_fan_out_endpoints())
+                {
+                    m_net_endpoint_counts[ep->get_net()].num_sources++;
+                }
             }
-            for (Net* net : gate->get_fan_out_nets())
+
+            // the endpoint counts already identify all connected nets
+            connected_nets.reserve(m_net_endpoint_counts.size());
+            for (const auto& entry : m_net_endpoint_counts)
             {
-                net_cache.insert(net);
+                connected_nets.push_back(entry.first);
+            }
+        }
+        else
+        {
+            // all gates belong to the top module, hence it is connected to every net that has at least one endpoint
+            for (Net* net : get_netlist()->get_nets())
+            {
+                if (!net->get_sources_view().empty() || !net->get_destinations_view().empty())
+                {
+                    connected_nets.push_back(net);
+                }
             }
         }
 
-        for (Net* net : net_cache)
+        m_nets.reserve(connected_nets.size());
+        for (Net* net : connected_nets)
         {
             NetConnectivity con = check_net_endpoints(net);
             if (con.has_internal_source || con.has_internal_destination)
@@ -582,51 +655,47 @@ namespace hal
         return m_internal_nets.find(net) != m_internal_nets.end();
     }
 
-    Module::NetConnectivity Module::check_net_endpoints(const Net* net) const
+    void Module::count_net_endpoints(Net* net, i32 num_sources, i32 num_destinations)
     {
-        std::vector<Endpoint*> sources      = net->get_sources();
-        std::vector<Endpoint*> destinations = net->get_destinations();
-
-        NetConnectivity res;
-        res.has_external_source      = net->is_global_input_net();
-        res.has_internal_source      = false;
-        res.has_external_destination = net->is_global_output_net();
-        res.has_internal_destination = false;
-
-        for (Endpoint* ep : sources)
+        // every gate is contained in the top module, hence its counts would always equal the number of endpoints of the net
+        for (Module* mod = this; mod->m_parent != nullptr; mod = mod->m_parent)
         {
-            if (Module* mod = ep->get_gate()->get_module(); this != mod && !is_parent_module_of(mod, true))
+            auto it = mod->m_net_endpoint_counts.try_emplace(net).first;
+            it->second.num_sources += num_sources;
+            it->second.num_destinations += num_destinations;
+            if (it->second.num_sources == 0 && it->second.num_destinations == 0)
             {
-                res.has_external_source = true;
-            }
-            else
-            {
-                res.has_internal_source = true;
-            }
-
-            if (res.has_external_source && res.has_internal_source)
-            {
-                break;
+                mod->m_net_endpoint_counts.erase(it);
             }
         }
+    }
+
+    Module::NetConnectivity Module::check_net_endpoints(Net* net) const
+    {
+        const u32 num_sources      = net->get_sources_view().size();
+        const u32 num_destinations = net->get_destinations_view().size();
 
-        for (Endpoint* ep : destinations)
+        u32 num_internal_sources      = num_sources;
+        u32 num_internal_destinations = num_destinations;
+        if (m_parent != nullptr)
         {
-            if (Module* mod = ep->get_gate()->get_module(); this != mod && !is_parent_module_of(mod, true))
+            if (const auto it = m_net_endpoint_counts.find(net); it != m_net_endpoint_counts.end())
             {
-                res.has_external_destination = true;
+                num_internal_sources      = it->second.num_sources;
+                num_internal_destinations = it->second.num_destinations;
             }
             else
             {
-                res.has_internal_destination = true;
-            }
-
-            if (res.has_external_destination && res.has_internal_destination)
-            {
-                break;
+                num_internal_sources      = 0;
+                num_internal_destinations = 0;
             }
         }
 
+        NetConnectivity res;
+        res.has_internal_source      = num_internal_sources > 0;
+        res.has_internal_destination = num_internal_destinations > 0;
+        res.has_external_source      = num_internal_sources < num_sources || net->is_global_input_net();
+        res.has_external_destination = num_internal_destinations < num_destinations || net->is_global_output_net();
         return res;
     }
 
@@ -671,6 +740,8 @@ namespace hal
             }
             else
             {
+                m_input_nets.insert(net);
+                m_output_nets.insert(net);
                 if (!assign_pin_net(get_unique_pin_id(), net, PinDirection::inout))
                 {
                     return ERR("could not assign inout pin to net ID " + std::to_string(net->get_id()) + ": failed to create pin");
@@ -760,28 +831,12 @@ namespace hal
 
     u32 Module::get_unique_pin_id()
     {
-        if (!m_free_pin_ids.empty())
-        {
-            return *(m_free_pin_ids.begin());
-        }
-        while (m_used_pin_ids.find(m_next_pin_id) != m_used_pin_ids.end())
-        {
-            m_next_pin_id++;
-        }
-        return m_next_pin_id;
+        return m_pin_ids.get_unique_id();
     }
 
     u32 Module::get_unique_pin_group_id()
     {
-        if (!m_free_pin_group_ids.empty())
-        {
-            return *(m_free_pin_group_ids.begin());
-        }
-        while (m_used_pin_group_ids.find(m_next_pin_group_id) != m_used_pin_group_ids.end())
-        {
-            m_next_pin_group_id++;
-        }
-        return m_next_pin_group_id;
+        return m_pin_group_ids.get_unique_id();
     }
 
     Result<ModulePin*> Module::create_pin(const u32 id, const std::string& name, Net* net, PinType type, bool create_group, bool force_name)
@@ -1748,7 +1803,7 @@ namespace hal
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_ids.find(id) != m_used_pin_ids.end())
+        if (m_pin_ids.is_used(id))
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1784,11 +1839,7 @@ namespace hal
         m_pin_names_map[name] = pin;
 
         // mark pin ID as used
-        if (auto free_id_it = m_free_pin_ids.find(id); free_id_it != m_free_pin_ids.end())
-        {
-            m_free_pin_ids.erase(free_id_it);
-        }
-        m_used_pin_ids.insert(id);
+        m_pin_ids.reserve(id);
 
         return OK(pin);
     }
@@ -1815,8 +1866,7 @@ namespace hal
         m_pins.erase(std::find_if(m_pins.begin(), m_pins.end(), [pin](const auto& p) { return p.get() == pin; }));
 
         // free pin ID
-        m_free_pin_ids.insert(del_id);
-        m_used_pin_ids.erase(del_id);
+        m_pin_ids.release(del_id);
 
         return true;
     }
@@ -1828,7 +1878,7 @@ namespace hal
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_group_ids.find(id) != m_used_pin_group_ids.end())
+        if (m_pin_group_ids.is_used(id))
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1857,11 +1907,7 @@ namespace hal
         m_pin_group_names_map[name] = pin_group;
 
         // mark pin group ID as used
-        if (auto free_id_it = m_free_pin_group_ids.find(id); free_id_it != m_free_pin_group_ids.end())
-        {
-            m_free_pin_group_ids.erase(free_id_it);
-        }
-        m_used_pin_group_ids.insert(id);
+        m_pin_group_ids.reserve(id);
 
         return OK(pin_group);
     }
@@ -1890,8 +1936,7 @@ namespace hal
         m_pin_groups.erase(std::find_if(m_pin_groups.begin(), m_pin_groups.end(), [pin_group](const auto& pg) { return pg.get() == pin_group; }));
 
         // free pin group ID
-        m_free_pin_group_ids.insert(del_id);
-        m_used_pin_group_ids.erase(del_id);
+        m_pin_group_ids.release(del_id);
 
         return true;
     }
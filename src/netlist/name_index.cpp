@@ -0,0 +1,237 @@
+#include "hal_core/netlist/name_index.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    namespace
+    {
+        // names without objects are kept in the trigram index until they outnumber both this threshold and the names with objects
+        constexpr u32 MIN_EMPTY_NAMES_FOR_COMPACTION = 1024;
+
+        u32 to_trigram(const char* c)
+        {
+            return (u32(u8(c[0])) << 16) | (u32(u8(c[1])) << 8) | u32(u8(c[2]));
+        }
+
+        std::vector<u32> get_trigrams(const std::string& str)
+        {
+            std::vector<u32> trigrams;
+            for (u32 i = 0; i + 3 <= str.size(); i++)
+            {
+                trigrams.push_back(to_trigram(str.data() + i));
+            }
+            std::sort(trigrams.begin(), trigrams.end());
+            trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+            return trigrams;
+        }
+    }    // namespace
+
+    void NameIndex::insert(u32 id, const std::string& name)
+    {
+        if (id < m_name_of.size() && m_name_of[id] != INVALID_NAME)
+        {
+            rename(id, name);
+            return;
+        }
+
+        const u32 name_index = add_name(name);
+        if (m_objects[name_index].empty())
+        {
+            m_num_empty_names--;
+        }
+        m_objects[name_index].push_back(id);
+
+        if (id >= m_name_of.size())
+        {
+            m_name_of.resize(id + 1, INVALID_NAME);
+        }
+        m_name_of[id] = name_index;
+        m_num_objects++;
+    }
+
+    bool NameIndex::erase(u32 id)
+    {
+        if (id >= m_name_of.size() || m_name_of[id] == INVALID_NAME)
+        {
+            return false;
+        }
+
+        std::vector<u32>& objects = m_objects[m_name_of[id]];
+        *std::find(objects.begin(), objects.end(), id) = objects.back();
+        objects.pop_back();
+        m_name_of[id] = INVALID_NAME;
+        m_num_objects--;
+
+        if (objects.empty())
+        {
+            m_num_empty_names++;
+            if (m_num_empty_names > std::max<u64>(MIN_EMPTY_NAMES_FOR_COMPACTION, m_names.size() - m_num_empty_names))
+            {
+                compact();
+            }
+        }
+        return true;
+    }
+
+    void NameIndex::rename(u32 id, const std::string& name)
+    {
+        erase(id);
+        insert(id, name);
+    }
+
+    void NameIndex::clear()
+    {
+        m_name_indices.clear();
+        m_names.clear();
+        m_objects.clear();
+        m_name_of.clear();
+        m_trigrams.clear();
+        m_num_objects     = 0;
+        m_num_empty_names = 0;
+    }
+
+    std::vector<u32> NameIndex::find(const std::string& name) const
+    {
+        if (const auto it = m_name_indices.find(name); it != m_name_indices.end())
+        {
+            return m_objects[it->second];
+        }
+        return {};
+    }
+
+    std::vector<u32> NameIndex::find_pattern(const std::string& pattern) const
+    {
+        // every literal run of the pattern has to occur in a matching name, hence only names containing the trigrams of the rarest literal are candidates
+        const std::vector<u32>* candidates = nullptr;
+        bool has_literal                   = false;
+        std::string literal;
+        for (u32 i = 0; i <= pattern.size(); i++)
+        {
+            if (i < pattern.size() && pattern[i] != '*' && pattern[i] != '?')
+            {
+                literal.push_back(pattern[i]);
+                continue;
+            }
+
+            for (const u32 trigram : get_trigrams(literal))
+            {
+                has_literal   = true;
+                const auto it = m_trigrams.find(trigram);
+                if (it == m_trigrams.end())
+                {
+                    // no name contains the literal
+                    return {};
+                }
+                if (candidates == nullptr || it->second.size() < candidates->size())
+                {
+                    candidates = &it->second;
+                }
+            }
+            literal.clear();
+        }
+
+        std::vector<u32> res;
+        const auto check = [this, &pattern, &res](u32 name_index) {
+            if (!m_objects[name_index].empty() && matches_pattern(pattern, *m_names[name_index]))
+            {
+                res.insert(res.end(), m_objects[name_index].begin(), m_objects[name_index].end());
+            }
+        };
+
+        if (has_literal)
+        {
+            for (const u32 name_index : *candidates)
+            {
+                check(name_index);
+            }
+        }
+        else
+        {
+            for (u32 name_index = 0; name_index < m_names.size(); name_index++)
+            {
+                check(name_index);
+            }
+        }
+        return res;
+    }
+
+    u64 NameIndex::size() const
+    {
+        return m_num_objects;
+    }
+
+    bool NameIndex::matches_pattern(const std::string& pattern, const std::string& name)
+    {
+        // greedy matching that backtracks to the most recent `*` on a mismatch
+        size_t p      = 0;
+        size_t n      = 0;
+        size_t star_p = std::string::npos;
+        size_t star_n = 0;
+        while (n < name.size())
+        {
+            if (p < pattern.size() && (pattern[p] == '?' || (pattern[p] != '*' && pattern[p] == name[n])))
+            {
+                p++;
+                n++;
+            }
+            else if (p < pattern.size() && pattern[p] == '*')
+            {
+                star_p = p++;
+                star_n = n;
+            }
+            else if (star_p != std::string::npos)
+            {
+                p = star_p + 1;
+                n = ++star_n;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        while (p < pattern.size() && pattern[p] == '*')
+        {
+            p++;
+        }
+        return p == pattern.size();
+    }
+
+    u32 NameIndex::add_name(const std::string& name)
+    {
+        const auto [it, added] = m_name_indices.try_emplace(name, m_names.size());
+        if (!added)
+        {
+            return it->second;
+        }
+
+        // map nodes are stable, hence the name vector can refer to the keys
+        m_names.push_back(&it->first);
+        m_objects.emplace_back();
+        m_num_empty_names++;
+        for (const u32 trigram : get_trigrams(name))
+        {
+            m_trigrams[trigram].push_back(it->second);
+        }
+        return it->second;
+    }
+
+    void NameIndex::compact()
+    {
+        std::vector<std::pair<u32, std::string>> objects;
+        objects.reserve(m_num_objects);
+        for (u32 name_index = 0; name_index < m_names.size(); name_index++)
+        {
+            for (const u32 id : m_objects[name_index])
+            {
+                objects.emplace_back(id, *m_names[name_index]);
+            }
+        }
+
+        clear();
+        for (const auto& [id, name] : objects)
+        {
+            insert(id, name);
+        }
+    }
+}    // namespace hal
@@ -8,11 +8,34 @@
 #include "hal_core/netlist/netlist_internal_manager.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <memory>
 
 namespace hal
 {
+    namespace
+    {
+        // a gate pin is connected to at most one net, hence endpoints of equal nets can be matched by sorting them by gate ID and pin ID
+        bool equal_endpoints(const std::vector<Endpoint*>& endpoints_n1, const std::vector<Endpoint*>& endpoints_n2)
+        {
+            const auto by_gate_and_pin = [](const Endpoint* a, const Endpoint* b) {
+                const u32 gate_a = a->get_gate()->get_id();
+                const u32 gate_b = b->get_gate()->get_id();
+                return (gate_a != gate_b) ? (gate_a < gate_b) : (a->get_pin()->get_id() < b->get_pin()->get_id());
+            };
+
+            std::vector<const Endpoint*> sorted_n1(endpoints_n1.begin(), endpoints_n1.end());
+            std::vector<const Endpoint*> sorted_n2(endpoints_n2.begin(), endpoints_n2.end());
+            std::sort(sorted_n1.begin(), sorted_n1.end(), by_gate_and_pin);
+            std::sort(sorted_n2.begin(), sorted_n2.end(), by_gate_and_pin);
+
+            return std::equal(sorted_n1.begin(), sorted_n1.end(), sorted_n2.begin(), sorted_n2.end(), [](const Endpoint* ep_n1, const Endpoint* ep_n2) {
+                return *ep_n1->get_pin() == *ep_n2->get_pin() && *ep_n1->get_gate() == *ep_n2->get_gate();
+            });
+        }
+    }    // namespace
+
     Net::Net(NetlistInternalManager* internal_manager, EventHandler* event_handler, const u32 id, const std::string& name)
     {
         assert(internal_manager != nullptr);
@@ -23,6 +46,16 @@ namespace hal
         m_event_handler = event_handler;
     }
 
+    void Net::load_deferred_data() const
+    {
+        m_internal_manager->load_deferred_data(this);
+    }
+
+    void Net::notify_data_changed()
+    {
+        m_internal_manager->notify_data_changed(this);
+    }
+
     bool Net::operator==(const Net& other) const
     {
         if (m_id != other.get_id() || m_name != other.get_name())
@@ -37,33 +70,22 @@ namespace hal
             return false;
         }
 
-        if (m_sources.size() != other.get_num_of_sources() || m_destinations.size() != other.get_num_of_destinations())
+        if (m_sources_raw.size() != other.get_num_of_sources() || m_destinations_raw.size() != other.get_num_of_destinations())
         {
             log_debug("net", "the nets with IDs {} and {} are not equal due to an unequal number of sources or destinations.", m_id, other.get_id());
             return false;
         }
 
-        const std::vector<Endpoint*>& sources_n2 = other.get_sources();
-        for (const Endpoint* ep_n1 : m_sources_raw)
+        if (!equal_endpoints(m_sources_raw, other.get_sources()))
         {
-            if (std::find_if(sources_n2.begin(), sources_n2.end(), [ep_n1](const Endpoint* ep_n2) { return *ep_n1->get_pin() == *ep_n2->get_pin() && *ep_n1->get_gate() == *ep_n2->get_gate(); })
-                == sources_n2.end())
-            {
-                log_debug("net", "the nets with IDs {} and {} are not equal due to an unequal source endpoint.", m_id, other.get_id());
-                return false;
-            }
+            log_debug("net", "the nets with IDs {} and {} are not equal due to an unequal source endpoint.", m_id, other.get_id());
+            return false;
         }
 
-        const std::vector<Endpoint*>& destinations_n2 = other.get_destinations();
-        for (const Endpoint* ep_n1 : m_destinations_raw)
+        if (!equal_endpoints(m_destinations_raw, other.get_destinations()))
         {
-            if (std::find_if(
-                    destinations_n2.begin(), destinations_n2.end(), [ep_n1](const Endpoint* ep_n2) { return *ep_n1->get_pin() == *ep_n2->get_pin() && *ep_n1->get_gate() == *ep_n2->get_gate(); })
-                == destinations_n2.end())
-            {
-                log_debug("net", "the nets with IDs {} and {} are not equal due to an unequal destination endpoint.", m_id, other.get_id());
-                return false;
-            }
+            log_debug("net", "the nets with IDs {} and {} are not equal due to an unequal destination endpoint.", m_id, other.get_id());
+            return false;
         }
 
         if (!DataContainer::operator==(other))
@@ -116,6 +138,7 @@ namespace hal
 
     Grouping* Net::get_grouping() const
     {
+        m_internal_manager->load_deferred_groupings();
         return m_grouping;
     }
 
@@ -280,6 +303,11 @@ namespace hal
         return srcs;
     }
 
+    Range<std::vector<Endpoint*>::const_iterator> Net::get_sources_view() const
+    {
+        return Range<std::vector<Endpoint*>::const_iterator>(m_sources_raw.begin(), m_sources_raw.end());
+    }
+
     Endpoint* Net::add_destination(Gate* gate, GatePin* pin)
     {
         return m_internal_manager->net_add_destination(this, gate, pin);
@@ -442,19 +470,24 @@ namespace hal
         return dsts;
     }
 
+    Range<std::vector<Endpoint*>::const_iterator> Net::get_destinations_view() const
+    {
+        return Range<std::vector<Endpoint*>::const_iterator>(m_destinations_raw.begin(), m_destinations_raw.end());
+    }
+
     bool Net::is_unrouted() const
     {
-        return ((m_sources.size() == 0) || (m_destinations.size() == 0));
+        return ((m_sources_raw.size() == 0) || (m_destinations_raw.size() == 0));
     }
 
     bool Net::is_gnd_net() const
     {
-        return m_sources.size() == 1 && m_sources.front()->get_gate()->is_gnd_gate();
+        return m_sources_raw.size() == 1 && m_sources_raw.front()->get_gate()->is_gnd_gate();
     }
 
     bool Net::is_vcc_net() const
     {
-        return m_sources.size() == 1 && m_sources.front()->get_gate()->is_vcc_gate();
+        return m_sources_raw.size() == 1 && m_sources_raw.front()->get_gate()->is_vcc_gate();
     }
 
     bool Net::mark_global_input_net()
@@ -1,26 +1,117 @@
 #include "hal_core/netlist/netlist.h"
 
+#include "hal_core/netlist/data_container.h"
+#include "hal_core/netlist/endpoint.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/grouping.h"
 #include "hal_core/netlist/module.h"
+#include "hal_core/netlist/name_index.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_internal_manager.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace hal
 {
+    namespace
+    {
+        template<typename T>
+        bool equal_ids(const std::vector<T*>& objects_1, const std::vector<T*>& objects_2)
+        {
+            if (objects_1.size() != objects_2.size())
+            {
+                return false;
+            }
+
+            std::vector<u32> ids_1;
+            std::vector<u32> ids_2;
+            ids_1.reserve(objects_1.size());
+            ids_2.reserve(objects_2.size());
+            std::transform(objects_1.begin(), objects_1.end(), std::back_inserter(ids_1), [](const T* object) { return object->get_id(); });
+            std::transform(objects_2.begin(), objects_2.end(), std::back_inserter(ids_2), [](const T* object) { return object->get_id(); });
+            std::sort(ids_1.begin(), ids_1.end());
+            std::sort(ids_2.begin(), ids_2.end());
+            return ids_1 == ids_2;
+        }
+
+        // gate types are compared by identity as part of the gates, hence pins can be compared by ID
+        bool equal_endpoints(const Range<std::vector<Endpoint*>::const_iterator>& endpoints_n1,
+                             const Range<std::vector<Endpoint*>::const_iterator>& endpoints_n2,
+                             std::vector<std::pair<u32, u32>>& buffer_n1,
+                             std::vector<std::pair<u32, u32>>& buffer_n2)
+        {
+            if (endpoints_n1.size() != endpoints_n2.size())
+            {
+                return false;
+            }
+
+            buffer_n1.clear();
+            buffer_n2.clear();
+            for (const Endpoint* ep : endpoints_n1)
+            {
+                buffer_n1.emplace_back(ep->get_gate()->get_id(), ep->get_pin()->get_id());
+            }
+            for (const Endpoint* ep : endpoints_n2)
+            {
+                buffer_n2.emplace_back(ep->get_gate()->get_id(), ep->get_pin()->get_id());
+            }
+            std::sort(buffer_n1.begin(), buffer_n1.end());
+            std::sort(buffer_n2.begin(), buffer_n2.end());
+            return buffer_n1 == buffer_n2;
+        }
+
+        const std::string NAME_INDEX_CALLBACK = "netlist_name_index";
+
+        template<typename T>
+        void update_name_index(NameIndex& index, bool created, bool removed, bool name_changed, const T* object)
+        {
+            if (created || name_changed)
+            {
+                index.insert(object->get_id(), object->get_name());
+            }
+            else if (removed)
+            {
+                index.erase(object->get_id());
+            }
+        }
+
+        // results are sorted by ID, such that they do not depend on whether the name index is enabled
+        template<typename T>
+        std::vector<T*> sort_by_id(std::vector<T*> objects)
+        {
+            std::sort(objects.begin(), objects.end(), [](const T* a, const T* b) { return a->get_id() < b->get_id(); });
+            return objects;
+        }
+
+        // the name index may be stale if objects have been created, deleted, or renamed while events were disabled,
+        // hence IDs that no longer resolve and objects whose name no longer matches are skipped
+        template<typename Lookup, typename Match>
+        auto resolve_ids(std::vector<u32> ids, const Lookup& lookup, const Match& matches)
+        {
+            std::sort(ids.begin(), ids.end());
+            std::vector<decltype(lookup(0))> res;
+            res.reserve(ids.size());
+            for (const u32 id : ids)
+            {
+                if (auto* object = lookup(id); object != nullptr && matches(object->get_name()))
+                {
+                    res.push_back(object);
+                }
+            }
+            return res;
+        }
+    }    // namespace
+
     Netlist::Netlist(const GateLibrary* library) : m_gate_library(library)
     {
-        m_event_handler    = std::make_unique<EventHandler>();
-        m_manager          = new NetlistInternalManager(this, m_event_handler.get());
-        m_netlist_id       = 1;
-        m_next_gate_id     = 1;
-        m_next_net_id      = 1;
-        m_next_module_id   = 1;
-        m_next_grouping_id = 1;
-        m_top_module       = nullptr;    // this triggers the internal manager to allow creation of a module without parent
-        m_top_module       = create_module("top_module", nullptr);
+        m_event_handler = std::make_unique<EventHandler>();
+        m_manager       = new NetlistInternalManager(this, m_event_handler.get());
+        m_netlist_id    = 1;
+        m_top_module    = nullptr;    // this triggers the internal manager to allow creation of a module without parent
+        m_top_module    = create_module("top_module", nullptr);
     }
 
     Netlist::~Netlist()
@@ -30,6 +121,12 @@ namespace hal
 
     bool Netlist::operator==(const Netlist& other) const
     {
+        if (!load_deferred_content() || !other.load_deferred_content())
+        {
+            log_info("netlist", "the netlists with IDs {} and {} cannot be compared as not all of their content could be loaded.", m_netlist_id, other.get_id());
+            return false;
+        }
+
         if (m_file_name != other.get_input_filename() || m_design_name != other.get_design_name() || m_device_name != other.get_device_name())
         {
             log_info("netlist", "the netlists with IDs {} and {} are not equal due to an unequal file name, design name, or device name.", m_netlist_id, other.get_id());
@@ -48,9 +145,21 @@ namespace hal
             return false;
         }
 
+        if (!equal_ids(m_global_input_nets, other.get_global_input_nets()) || !equal_ids(m_global_output_nets, other.get_global_output_nets())
+            || !equal_ids(m_gnd_gates, other.get_gnd_gates()) || !equal_ids(m_vcc_gates, other.get_vcc_gates()))
+        {
+            log_info("netlist", "the netlists with IDs {} and {} are not equal due to unequal global nets or GND/VCC gates.", m_netlist_id, other.get_id());
+            return false;
+        }
+
+        // gates are compared once as part of their modules, hence nets only need to be compared by the gate IDs and pins of their endpoints
+        std::vector<std::pair<u32, u32>> endpoints_n1;
+        std::vector<std::pair<u32, u32>> endpoints_n2;
         for (const Net* net : other.get_nets())
         {
-            if (const auto it = m_nets_map.find(net->get_id()); it == m_nets_map.end() || *it->second != *net)
+            const Net* own_net = m_nets.get(net->get_id());
+            if (own_net == nullptr || own_net->get_name() != net->get_name() || !equal_endpoints(own_net->get_sources_view(), net->get_sources_view(), endpoints_n1, endpoints_n2)
+                || !equal_endpoints(own_net->get_destinations_view(), net->get_destinations_view(), endpoints_n1, endpoints_n2) || !own_net->DataContainer::operator==(*net))
             {
                 log_info("netlist", "the netlists with IDs {} and {} are not equal due to unequal nets.", m_netlist_id, other.get_id());
                 return false;
@@ -139,15 +248,30 @@ namespace hal
         return m_event_handler.get();
     }
 
-    Result<std::unique_ptr<Netlist>> Netlist::copy() const
+    u64 Netlist::get_num_data_changes() const
+    {
+        return m_num_data_changes;
+    }
+
+    Result<std::unique_ptr<Netlist>> Netlist::copy(u32 num_workers) const
     {
-        if (auto res = m_manager->copy_netlist(this); res.is_error())
+        if (!load_deferred_content())
+        {
+            return ERR("could not copy netlist with ID " + std::to_string(m_netlist_id) + ": failed to load deferred content");
+        }
+
+        if (auto res = m_manager->copy_netlist(this, num_workers); res.is_error())
         {
             return ERR(res.get_error());
         }
         else
         {
-            return res;
+            std::unique_ptr<Netlist> c_netlist = res.get();
+            if (is_name_index_enabled())
+            {
+                c_netlist->enable_name_index();
+            }
+            return OK(std::move(c_netlist));
         }
     }
 
@@ -159,15 +283,7 @@ namespace hal
 
     u32 Netlist::get_unique_gate_id()
     {
-        if (!m_free_gate_ids.empty())
-        {
-            return *(m_free_gate_ids.begin());
-        }
-        while (m_used_gate_ids.find(m_next_gate_id) != m_used_gate_ids.end())
-        {
-            m_next_gate_id++;
-        }
-        return m_next_gate_id;
+        return m_gate_ids.get_unique_id();
     }
 
     Gate* Netlist::create_gate(const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
@@ -187,14 +303,15 @@ namespace hal
 
     bool Netlist::is_gate_in_netlist(const Gate* gate) const
     {
-        return gate != nullptr && m_gates_set.find(gate) != m_gates_set.end();
+        // check pool membership first so that pointers to deleted gates are never dereferenced
+        return gate != nullptr && m_manager->m_gate_pool.contains(gate) && m_gates.get(gate->get_id()) == gate;
     }
 
     Gate* Netlist::get_gate_by_id(const u32 gate_id) const
     {
-        if (auto it = m_gates_map.find(gate_id); it != m_gates_map.end())
+        if (Gate* gate = m_gates.get(gate_id); gate != nullptr)
         {
-            return it->second.get();
+            return gate;
         }
 
         log_debug("netlist", "there is no gate with ID {} in the netlist with ID {}.", gate_id, m_netlist_id);
@@ -203,14 +320,14 @@ namespace hal
 
     const std::vector<Gate*>& Netlist::get_gates() const
     {
-        return m_gates;
+        return m_gates.get_objects();
     }
 
     std::vector<Gate*> Netlist::get_gates(const std::function<bool(const Gate*)>& filter) const
     {
         if (!filter)
         {
-            return m_gates;
+            return m_gates.get_objects();
         }
         std::vector<Gate*> res;
         for (Gate* g : m_gates)
@@ -225,6 +342,30 @@ namespace hal
         return res;
     }
 
+    std::vector<Gate*> Netlist::get_gates_by_name(const std::string& name) const
+    {
+        if (m_gate_name_index != nullptr)
+        {
+            return resolve_ids(
+                m_gate_name_index->find(name),
+                [this](u32 id) { return m_gates.get(id); },
+                [&name](const std::string& object_name) { return object_name == name; });
+        }
+        return sort_by_id(get_gates([&name](const Gate* gate) { return gate->get_name() == name; }));
+    }
+
+    std::vector<Gate*> Netlist::get_gates_by_name_pattern(const std::string& pattern) const
+    {
+        if (m_gate_name_index != nullptr)
+        {
+            return resolve_ids(
+                m_gate_name_index->find_pattern(pattern),
+                [this](u32 id) { return m_gates.get(id); },
+                [&pattern](const std::string& object_name) { return NameIndex::matches_pattern(pattern, object_name); });
+        }
+        return sort_by_id(get_gates([&pattern](const Gate* gate) { return NameIndex::matches_pattern(pattern, gate->get_name()); }));
+    }
+
     bool Netlist::mark_vcc_gate(Gate* gate)
     {
         if (!is_gate_in_netlist(gate))
@@ -319,15 +460,7 @@ namespace hal
 
     u32 Netlist::get_unique_net_id()
     {
-        if (!m_free_net_ids.empty())
-        {
-            return *(m_free_net_ids.begin());
-        }
-        while (m_used_net_ids.find(m_next_net_id) != m_used_net_ids.end())
-        {
-            m_next_net_id++;
-        }
-        return m_next_net_id;
+        return m_net_ids.get_unique_id();
     }
 
     Net* Netlist::create_net(const u32 id, const std::string& name)
@@ -347,14 +480,15 @@ namespace hal
 
     bool Netlist::is_net_in_netlist(const Net* n) const
     {
-        return n != nullptr && m_nets_set.find(n) != m_nets_set.end();
+        // check pool membership first so that pointers to deleted nets are never dereferenced
+        return n != nullptr && m_manager->m_net_pool.contains(n) && m_nets.get(n->get_id()) == n;
     }
 
     Net* Netlist::get_net_by_id(u32 net_id) const
     {
-        if (auto it = m_nets_map.find(net_id); it != m_nets_map.end())
+        if (Net* net = m_nets.get(net_id); net != nullptr)
         {
-            return it->second.get();
+            return net;
         }
 
         log_debug("netlist", "there is no net with ID {} in the netlist with ID {}.", net_id, m_netlist_id);
@@ -363,14 +497,14 @@ namespace hal
 
     const std::vector<Net*>& Netlist::get_nets() const
     {
-        return m_nets;
+        return m_nets.get_objects();
     }
 
     std::vector<Net*> Netlist::get_nets(const std::function<bool(const Net*)>& filter) const
     {
         if (!filter)
         {
-            return m_nets;
+            return m_nets.get_objects();
         }
         std::vector<Net*> res;
         for (auto net : m_nets)
@@ -384,6 +518,30 @@ namespace hal
         return res;
     }
 
+    std::vector<Net*> Netlist::get_nets_by_name(const std::string& name) const
+    {
+        if (m_net_name_index != nullptr)
+        {
+            return resolve_ids(
+                m_net_name_index->find(name),
+                [this](u32 id) { return m_nets.get(id); },
+                [&name](const std::string& object_name) { return object_name == name; });
+        }
+        return sort_by_id(get_nets([&name](const Net* net) { return net->get_name() == name; }));
+    }
+
+    std::vector<Net*> Netlist::get_nets_by_name_pattern(const std::string& pattern) const
+    {
+        if (m_net_name_index != nullptr)
+        {
+            return resolve_ids(
+                m_net_name_index->find_pattern(pattern),
+                [this](u32 id) { return m_nets.get(id); },
+                [&pattern](const std::string& object_name) { return NameIndex::matches_pattern(pattern, object_name); });
+        }
+        return sort_by_id(get_nets([&pattern](const Net* net) { return NameIndex::matches_pattern(pattern, net->get_name()); }));
+    }
+
     bool Netlist::mark_global_input_net(Net* n)
     {
         if (!is_net_in_netlist(n))
@@ -398,13 +556,17 @@ namespace hal
         m_global_input_nets.push_back(n);
 
         // update internal nets and port nets
-        if (m_manager->m_net_checks_enabled)
+        if (m_manager->m_bulk_edit_depth > 0)
+        {
+            m_manager->bulk_edit_mark_net(n, nullptr);
+        }
+        else if (m_manager->m_net_checks_enabled)
         {
-            for (Endpoint* ep : n->get_sources())
+            for (Endpoint* ep : n->get_sources_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
-            for (Endpoint* ep : n->get_destinations())
+            for (Endpoint* ep : n->get_destinations_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
@@ -428,13 +590,17 @@ namespace hal
         m_global_output_nets.push_back(n);
 
         // update internal nets and port nets
-        if (m_manager->m_net_checks_enabled)
+        if (m_manager->m_bulk_edit_depth > 0)
+        {
+            m_manager->bulk_edit_mark_net(n, nullptr);
+        }
+        else if (m_manager->m_net_checks_enabled)
         {
-            for (Endpoint* ep : n->get_sources())
+            for (Endpoint* ep : n->get_sources_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
-            for (Endpoint* ep : n->get_destinations())
+            for (Endpoint* ep : n->get_destinations_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
@@ -459,13 +625,17 @@ namespace hal
         m_global_input_nets.erase(it);
 
         // update internal nets and port nets
-        if (m_manager->m_net_checks_enabled)
+        if (m_manager->m_bulk_edit_depth > 0)
+        {
+            m_manager->bulk_edit_mark_net(n, nullptr);
+        }
+        else if (m_manager->m_net_checks_enabled)
         {
-            for (Endpoint* ep : n->get_sources())
+            for (Endpoint* ep : n->get_sources_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
-            for (Endpoint* ep : n->get_destinations())
+            for (Endpoint* ep : n->get_destinations_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
@@ -490,13 +660,17 @@ namespace hal
         m_global_output_nets.erase(it);
 
         // update internal nets and port nets
-        if (m_manager->m_net_checks_enabled)
+        if (m_manager->m_bulk_edit_depth > 0)
+        {
+            m_manager->bulk_edit_mark_net(n, nullptr);
+        }
+        else if (m_manager->m_net_checks_enabled)
         {
-            for (Endpoint* ep : n->get_sources())
+            for (Endpoint* ep : n->get_sources_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
-            for (Endpoint* ep : n->get_destinations())
+            for (Endpoint* ep : n->get_destinations_view())
             {
                 m_manager->module_check_net(ep->get_gate()->get_module(), n, true);
             }
@@ -565,6 +739,31 @@ namespace hal
         m_manager->m_net_checks_enabled = enable_checks;
     }
 
+    void Netlist::begin_bulk_edit()
+    {
+        m_manager->begin_bulk_edit();
+    }
+
+    Result<std::monostate> Netlist::end_bulk_edit()
+    {
+        return m_manager->end_bulk_edit();
+    }
+
+    bool Netlist::is_bulk_edit_active() const
+    {
+        return m_manager->m_bulk_edit_depth > 0;
+    }
+
+    std::shared_lock<std::shared_mutex> Netlist::acquire_read_lock() const
+    {
+        return std::shared_lock(m_access_mutex);
+    }
+
+    std::unique_lock<std::shared_mutex> Netlist::acquire_write_lock() const
+    {
+        return std::unique_lock(m_access_mutex);
+    }
+
     /*
      * ################################################################
      *      module functions
@@ -573,19 +772,15 @@ namespace hal
 
     u32 Netlist::get_unique_module_id()
     {
-        if (!m_free_module_ids.empty())
-        {
-            return *(m_free_module_ids.begin());
-        }
-        while (m_used_module_ids.find(m_next_module_id) != m_used_module_ids.end())
-        {
-            m_next_module_id++;
-        }
-        return m_next_module_id;
+        load_deferred_modules();
+
+        return m_module_ids.get_unique_id();
     }
 
     Module* Netlist::create_module(const u32 id, const std::string& name, Module* parent, const std::vector<Gate*>& gates)
     {
+        load_deferred_modules();
+
         auto m = m_manager->create_module(id, parent, name);
         if (m == nullptr)
         {
@@ -602,16 +797,22 @@ namespace hal
 
     bool Netlist::delete_module(Module* module)
     {
+        load_deferred_modules();
+
         return m_manager->delete_module(module);
     }
 
     Module* Netlist::get_top_module() const
     {
+        load_deferred_modules();
+
         return m_top_module;
     }
 
     Module* Netlist::get_module_by_id(u32 id) const
     {
+        load_deferred_modules();
+
         if (auto it = m_modules_map.find(id); it != m_modules_map.end())
         {
             return it->second.get();
@@ -623,11 +824,15 @@ namespace hal
 
     const std::vector<Module*>& Netlist::get_modules() const
     {
+        load_deferred_modules();
+
         return m_modules;
     }
 
     std::vector<Module*> Netlist::get_modules(const std::function<bool(const Module*)>& filter) const
     {
+        load_deferred_modules();
+
         if (!filter)
         {
             return m_modules;
@@ -644,8 +849,44 @@ namespace hal
         return res;
     }
 
+    std::vector<Module*> Netlist::get_modules_by_name(const std::string& name) const
+    {
+        load_deferred_modules();
+
+        if (m_module_name_index != nullptr)
+        {
+            return resolve_ids(
+                m_module_name_index->find(name),
+                [this](u32 id) -> Module* {
+                    const auto it = m_modules_map.find(id);
+                    return (it != m_modules_map.end()) ? it->second.get() : nullptr;
+                },
+                [&name](const std::string& object_name) { return object_name == name; });
+        }
+        return sort_by_id(get_modules([&name](const Module* module) { return module->get_name() == name; }));
+    }
+
+    std::vector<Module*> Netlist::get_modules_by_name_pattern(const std::string& pattern) const
+    {
+        load_deferred_modules();
+
+        if (m_module_name_index != nullptr)
+        {
+            return resolve_ids(
+                m_module_name_index->find_pattern(pattern),
+                [this](u32 id) -> Module* {
+                    const auto it = m_modules_map.find(id);
+                    return (it != m_modules_map.end()) ? it->second.get() : nullptr;
+                },
+                [&pattern](const std::string& object_name) { return NameIndex::matches_pattern(pattern, object_name); });
+        }
+        return sort_by_id(get_modules([&pattern](const Module* module) { return NameIndex::matches_pattern(pattern, module->get_name()); }));
+    }
+
     bool Netlist::is_module_in_netlist(const Module* module) const
     {
+        load_deferred_modules();
+
         return (module != nullptr) && (m_modules_set.find(module) != m_modules_set.end());
     }
 
@@ -657,19 +898,15 @@ namespace hal
 
     u32 Netlist::get_unique_grouping_id()
     {
-        if (!m_free_grouping_ids.empty())
-        {
-            return *(m_free_grouping_ids.begin());
-        }
-        while (m_used_grouping_ids.find(m_next_grouping_id) != m_used_grouping_ids.end())
-        {
-            m_next_grouping_id++;
-        }
-        return m_next_grouping_id;
+        load_deferred_groupings();
+
+        return m_grouping_ids.get_unique_id();
     }
 
     Grouping* Netlist::create_grouping(const u32 id, const std::string& name)
     {
+        load_deferred_groupings();
+
         return m_manager->create_grouping(id, name);
     }
 
@@ -680,16 +917,22 @@ namespace hal
 
     bool Netlist::delete_grouping(Grouping* g)
     {
+        load_deferred_groupings();
+
         return m_manager->delete_grouping(g);
     }
 
     bool Netlist::is_grouping_in_netlist(const Grouping* n) const
     {
+        load_deferred_groupings();
+
         return n != nullptr && m_groupings_set.find(n) != m_groupings_set.end();
     }
 
     Grouping* Netlist::get_grouping_by_id(u32 grouping_id) const
     {
+        load_deferred_groupings();
+
         if (auto it = m_groupings_map.find(grouping_id); it != m_groupings_map.end())
         {
             return it->second.get();
@@ -701,11 +944,15 @@ namespace hal
 
     const std::vector<Grouping*>& Netlist::get_groupings() const
     {
+        load_deferred_groupings();
+
         return m_groupings;
     }
 
     std::vector<Grouping*> Netlist::get_groupings(const std::function<bool(const Grouping*)>& filter) const
     {
+        load_deferred_groupings();
+
         if (!filter)
         {
             return m_groupings;
@@ -730,122 +977,146 @@ namespace hal
 
     u32 Netlist::get_next_gate_id() const
     {
-        return m_next_gate_id;
+        return m_gate_ids.get_next_id();
     }
 
     void Netlist::set_next_gate_id(const u32 id)
     {
-        m_next_gate_id = id;
+        m_gate_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_gate_ids() const
     {
-        return m_used_gate_ids;
+        return m_gate_ids.get_used_ids();
     }
 
     void Netlist::set_used_gate_ids(const std::set<u32> ids)
     {
-        m_used_gate_ids = ids;
+        m_gate_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_gate_ids() const
     {
-        return m_free_gate_ids;
+        return m_gate_ids.get_free_ids();
     }
 
     void Netlist::set_free_gate_ids(const std::set<u32> ids)
     {
-        m_free_gate_ids = ids;
+        m_gate_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_net_id() const
     {
-        return m_next_net_id;
+        return m_net_ids.get_next_id();
     }
 
     void Netlist::set_next_net_id(const u32 id)
     {
-        m_next_net_id = id;
+        m_net_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_net_ids() const
     {
-        return m_used_net_ids;
+        return m_net_ids.get_used_ids();
     }
 
     void Netlist::set_used_net_ids(const std::set<u32> ids)
     {
-        m_used_net_ids = ids;
+        m_net_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_net_ids() const
     {
-        return m_free_net_ids;
+        return m_net_ids.get_free_ids();
     }
 
     void Netlist::set_free_net_ids(const std::set<u32> ids)
     {
-        m_free_net_ids = ids;
+        m_net_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_module_id() const
     {
-        return m_next_module_id;
+        load_deferred_modules();
+
+        return m_module_ids.get_next_id();
     }
 
     void Netlist::set_next_module_id(const u32 id)
     {
-        m_next_module_id = id;
+        load_deferred_modules();
+
+        m_module_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_module_ids() const
     {
-        return m_used_module_ids;
+        load_deferred_modules();
+
+        return m_module_ids.get_used_ids();
     }
 
     void Netlist::set_used_module_ids(const std::set<u32> ids)
     {
-        m_used_module_ids = ids;
+        load_deferred_modules();
+
+        m_module_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_module_ids() const
     {
-        return m_free_module_ids;
+        load_deferred_modules();
+
+        return m_module_ids.get_free_ids();
     }
 
     void Netlist::set_free_module_ids(const std::set<u32> ids)
     {
-        m_free_module_ids = ids;
+        load_deferred_modules();
+
+        m_module_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_grouping_id() const
     {
-        return m_next_grouping_id;
+        load_deferred_groupings();
+
+        return m_grouping_ids.get_next_id();
     }
 
     void Netlist::set_next_grouping_id(const u32 id)
     {
-        m_next_grouping_id = id;
+        load_deferred_groupings();
+
+        m_grouping_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_grouping_ids() const
     {
-        return m_used_grouping_ids;
+        load_deferred_groupings();
+
+        return m_grouping_ids.get_used_ids();
     }
 
     void Netlist::set_used_grouping_ids(const std::set<u32> ids)
     {
-        m_used_grouping_ids = ids;
+        load_deferred_groupings();
+
+        m_grouping_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_grouping_ids() const
     {
-        return m_free_grouping_ids;
+        load_deferred_groupings();
+
+        return m_grouping_ids.get_free_ids();
     }
 
     void Netlist::set_free_grouping_ids(const std::set<u32> ids)
     {
-        m_free_grouping_ids = ids;
+        load_deferred_groupings();
+
+        m_grouping_ids.set_free_ids(ids);
     }
 
     /*
@@ -854,11 +1125,230 @@ namespace hal
      * ################################################################
      */
 
+    void Netlist::enable_name_index(bool enable)
+    {
+        if (enable == is_name_index_enabled())
+        {
+            return;
+        }
+
+        if (!enable)
+        {
+            m_event_handler->unregister_callback(NAME_INDEX_CALLBACK);
+            m_gate_name_index.reset();
+            m_net_name_index.reset();
+            m_module_name_index.reset();
+            return;
+        }
+
+        m_gate_name_index   = std::make_unique<NameIndex>();
+        m_net_name_index    = std::make_unique<NameIndex>();
+        m_module_name_index = std::make_unique<NameIndex>();
+        for (const Gate* gate : m_gates)
+        {
+            m_gate_name_index->insert(gate->get_id(), gate->get_name());
+        }
+        for (const Net* net : m_nets)
+        {
+            m_net_name_index->insert(net->get_id(), net->get_name());
+        }
+        for (const Module* module : m_modules)
+        {
+            m_module_name_index->insert(module->get_id(), module->get_name());
+        }
+
+        m_event_handler->register_callback(NAME_INDEX_CALLBACK, std::function<void(GateEvent::event, Gate*, u32)>([this](GateEvent::event e, Gate* gate, u32) {
+                                               update_name_index(*m_gate_name_index, e == GateEvent::event::created, e == GateEvent::event::removed, e == GateEvent::event::name_changed, gate);
+                                           }));
+        m_event_handler->register_callback(NAME_INDEX_CALLBACK, std::function<void(NetEvent::event, Net*, u32)>([this](NetEvent::event e, Net* net, u32) {
+                                               update_name_index(*m_net_name_index, e == NetEvent::event::created, e == NetEvent::event::removed, e == NetEvent::event::name_changed, net);
+                                           }));
+        m_event_handler->register_callback(NAME_INDEX_CALLBACK, std::function<void(ModuleEvent::event, Module*, u32)>([this](ModuleEvent::event e, Module* module, u32) {
+                                               update_name_index(*m_module_name_index, e == ModuleEvent::event::created, e == ModuleEvent::event::removed, e == ModuleEvent::event::name_changed, module);
+                                           }));
+    }
+
+    bool Netlist::is_name_index_enabled() const
+    {
+        return m_gate_name_index != nullptr;
+    }
+
     void Netlist::clear_caches()
     {
         m_manager->clear_caches();
     }
 
+    void Netlist::defer_modules(const std::function<bool(Netlist*)>& loader)
+    {
+        std::lock_guard lock(m_deferred_mutex);
+        m_modules_loader       = loader;
+        m_has_deferred_modules = (bool)loader;
+    }
+
+    void Netlist::defer_groupings(const std::function<bool(Netlist*)>& loader)
+    {
+        std::lock_guard lock(m_deferred_mutex);
+        m_groupings_loader       = loader;
+        m_has_deferred_groupings = (bool)loader;
+    }
+
+    void Netlist::defer_data(const std::vector<DataContainer*>& containers, const std::function<bool(DataContainer*)>& loader)
+    {
+        std::lock_guard lock(m_deferred_mutex);
+        if (!loader || containers.empty())
+        {
+            return;
+        }
+
+        m_data_loader = loader;
+        for (DataContainer* container : containers)
+        {
+            if (!container->m_data_deferred)
+            {
+                container->m_data_deferred = true;
+                m_num_deferred_data++;
+            }
+        }
+    }
+
+    bool Netlist::has_deferred_content() const
+    {
+        return m_has_deferred_modules || m_has_deferred_groupings || m_num_deferred_data > 0;
+    }
+
+    bool Netlist::load_deferred_content() const
+    {
+        if (!has_deferred_content())
+        {
+            return true;
+        }
+
+        std::lock_guard lock(m_deferred_mutex);
+        bool success = load_deferred_modules();
+        success &= load_deferred_groupings();
+
+        if (m_num_deferred_data > 0)
+        {
+            for (const Gate* gate : m_gates)
+            {
+                success &= load_deferred_data(gate);
+            }
+            for (const Net* net : m_nets)
+            {
+                success &= load_deferred_data(net);
+            }
+
+            // containers that have been deleted before being loaded are not counted anymore
+            m_num_deferred_data = 0;
+            m_data_loader       = nullptr;
+        }
+        return success;
+    }
+
+    bool Netlist::load_deferred_modules() const
+    {
+        if (!m_has_deferred_modules)
+        {
+            return true;
+        }
+
+        std::lock_guard lock(m_deferred_mutex);
+        if (!m_modules_loader)
+        {
+            // either loaded by another thread in the meantime or currently being loaded by this thread
+            return true;
+        }
+
+        // the loader is taken beforehand since creating modules while loading accesses the module hierarchy again
+        auto loader      = std::move(m_modules_loader);
+        m_modules_loader = nullptr;
+
+        // module nets are updated by the loader once all modules have been created, the data entries of the modules are part of the loaded content
+        const bool net_checks_enabled   = m_manager->m_net_checks_enabled;
+        const u64 num_data_changes      = m_num_data_changes;
+        m_manager->m_net_checks_enabled = false;
+        const bool success              = loader(const_cast<Netlist*>(this));
+        m_manager->m_net_checks_enabled = net_checks_enabled;
+        m_num_data_changes              = num_data_changes;
+        if (!success)
+        {
+            log_error("netlist", "failed to load the deferred modules of the netlist with ID {}.", m_netlist_id);
+        }
+        m_has_deferred_modules = false;
+        return success;
+    }
+
+    bool Netlist::load_deferred_groupings() const
+    {
+        if (!m_has_deferred_groupings)
+        {
+            return true;
+        }
+
+        std::lock_guard lock(m_deferred_mutex);
+        if (!m_groupings_loader)
+        {
+            // either loaded by another thread in the meantime or currently being loaded by this thread
+            return true;
+        }
+
+        // groupings may contain modules, hence the modules are loaded first
+        bool success       = load_deferred_modules();
+        auto loader        = std::move(m_groupings_loader);
+        m_groupings_loader = nullptr;
+        if (!loader(const_cast<Netlist*>(this)))
+        {
+            log_error("netlist", "failed to load the deferred groupings of the netlist with ID {}.", m_netlist_id);
+            success = false;
+        }
+        m_has_deferred_groupings = false;
+        return success;
+    }
+
+    void Netlist::notify_data_changed(const DataContainer* container)
+    {
+        // deferred data entries are added through the regular setters while they are loaded
+        if (m_loading_data != container)
+        {
+            m_num_data_changes++;
+        }
+    }
+
+    bool Netlist::load_deferred_data(const DataContainer* container) const
+    {
+        if (!container->m_data_deferred)
+        {
+            return true;
+        }
+
+        std::lock_guard lock(m_deferred_mutex);
+        if (!container->m_data_deferred || m_loading_data == container)
+        {
+            return true;
+        }
+
+        bool success = false;
+        if (m_data_loader)
+        {
+            m_loading_data = container;
+            success        = m_data_loader(const_cast<DataContainer*>(container));
+            m_loading_data = nullptr;
+            if (!success)
+            {
+                // the source is unusable, so the remaining data entries are dropped instead of failing once per gate or net
+                log_error("netlist", "failed to load the deferred data entries of the netlist with ID {}, remaining deferred data entries are discarded.", m_netlist_id);
+                m_data_loader = nullptr;
+            }
+        }
+        container->m_data_deferred = false;
+        if (--m_num_deferred_data == 0)
+        {
+            // the loader and the resources it holds are no longer needed
+            m_data_loader = nullptr;
+        }
+        return success;
+    }
+
     bool Netlist::load_gate_locations_from_data(const std::string& data_category, const std::pair<std::string, std::string>& data_identifiers)
     {
         std::string category;
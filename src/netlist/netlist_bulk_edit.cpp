@@ -0,0 +1,34 @@
+#include "hal_core/netlist/netlist_bulk_edit.h"
+
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/log.h"
+
+#include <cassert>
+
+namespace hal
+{
+    NetlistBulkEdit::NetlistBulkEdit(Netlist* netlist) : m_netlist(netlist)
+    {
+        assert(netlist != nullptr);
+        m_netlist->begin_bulk_edit();
+    }
+
+    NetlistBulkEdit::~NetlistBulkEdit()
+    {
+        if (const auto res = commit(); res.is_error())
+        {
+            log_error("netlist", "{}", res.get_error().get());
+        }
+    }
+
+    Result<std::monostate> NetlistBulkEdit::commit()
+    {
+        if (m_committed)
+        {
+            return OK({});
+        }
+        m_committed = true;
+
+        return m_netlist->end_bulk_edit();
+    }
+}    // namespace hal
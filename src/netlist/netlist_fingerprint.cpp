@@ -0,0 +1,611 @@
+#include "hal_core/netlist/netlist_fingerprint.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/pins/gate_pin.h"
+#include "hal_core/netlist/pins/module_pin.h"
+#include "hal_core/netlist/pins/pin_group.h"
+#include "hal_core/utilities/parallel.h"
+
+#include <algorithm>
+#include <string_view>
+
+namespace hal
+{
+    namespace
+    {
+        // number of neighborhood refinement rounds of the structure hash
+        constexpr u32 STRUCTURE_ROUNDS = 3;
+
+        // hashes must not depend on std::hash, which differs between platforms and standard libraries
+        u64 hash_string(std::string_view str)
+        {
+            u64 h = 0xcbf29ce484222325ULL;
+            for (const char c : str)
+            {
+                h ^= static_cast<u8>(c);
+                h *= 0x100000001b3ULL;
+            }
+            return h;
+        }
+
+        // final mixing step, such that sums of hashes do not cancel out
+        u64 finalize(u64 h)
+        {
+            h ^= h >> 30;
+            h *= 0xbf58476d1ce4e5b9ULL;
+            h ^= h >> 27;
+            h *= 0x94d049bb133111ebULL;
+            h ^= h >> 31;
+            // `0` is reserved for objects that do not exist
+            return (h == 0) ? 1 : h;
+        }
+
+        void hash_combine(u64& seed, u64 v)
+        {
+            seed ^= v + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        void store(std::vector<u64>& hashes, u32 id, u64 h)
+        {
+            if (id >= hashes.size())
+            {
+                hashes.resize(id + 1, 0);
+            }
+            hashes[id] = h;
+        }
+
+        u64 load(const std::vector<u64>& hashes, u32 id)
+        {
+            return (id < hashes.size()) ? hashes[id] : 0;
+        }
+    }    // namespace
+
+    NetlistFingerprint::NetlistFingerprint(Netlist* netlist, u32 num_workers) : m_netlist(netlist)
+    {
+        for (const Net* net : m_netlist->get_global_input_nets())
+        {
+            m_global_input_nets.insert(net->get_id());
+        }
+        for (const Net* net : m_netlist->get_global_output_nets())
+        {
+            m_global_output_nets.insert(net->get_id());
+        }
+        for (const Gate* gate : m_netlist->get_gnd_gates())
+        {
+            m_gnd_gates.insert(gate->get_id());
+        }
+        for (const Gate* gate : m_netlist->get_vcc_gates())
+        {
+            m_vcc_gates.insert(gate->get_id());
+        }
+
+        // every object writes to its own slot of the hash vectors, hence objects can be processed concurrently
+        const std::vector<Gate*>& gates = m_netlist->get_gates();
+        u32 max_gate_id                 = 0;
+        for (const Gate* gate : gates)
+        {
+            max_gate_id = std::max(max_gate_id, gate->get_id());
+        }
+        m_gate_hashes.assign(max_gate_id + 1, 0);
+        utils::run_in_chunks(num_workers, gates.size(), 1024, [this, &gates](u32 i) { m_gate_hashes[gates[i]->get_id()] = compute_gate_hash(gates[i]); });
+
+        const std::vector<Net*>& nets = m_netlist->get_nets();
+        u32 max_net_id                = 0;
+        for (const Net* net : nets)
+        {
+            max_net_id = std::max(max_net_id, net->get_id());
+        }
+        m_net_hashes.assign(max_net_id + 1, 0);
+        utils::run_in_chunks(num_workers, nets.size(), 1024, [this, &nets](u32 i) { m_net_hashes[nets[i]->get_id()] = compute_net_hash(nets[i]); });
+
+        for (const u64 h : m_gate_hashes)
+        {
+            m_gate_sum += h;
+        }
+        for (const u64 h : m_net_hashes)
+        {
+            m_net_sum += h;
+        }
+        for (const Module* module : m_netlist->get_modules())
+        {
+            const u64 h                          = compute_module_hash(module);
+            m_module_hashes[module->get_id()] = h;
+            m_module_sum += h;
+        }
+
+        m_callback_name = "netlist_fingerprint_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+
+        EventHandler* event_handler = m_netlist->get_event_handler();
+
+        event_handler->register_callback(m_callback_name, std::function<void(NetlistEvent::event, Netlist*, u32)>([this](NetlistEvent::event e, Netlist*, u32 associated_data) {
+                                             std::lock_guard lock(m_mutex);
+                                             switch (e)
+                                             {
+                                                 case NetlistEvent::event::id_changed:
+                                                     return;
+                                                 case NetlistEvent::event::marked_global_vcc:
+                                                     m_vcc_gates.insert(associated_data);
+                                                     mark_gate(associated_data);
+                                                     break;
+                                                 case NetlistEvent::event::unmarked_global_vcc:
+                                                     m_vcc_gates.erase(associated_data);
+                                                     mark_gate(associated_data);
+                                                     break;
+                                                 case NetlistEvent::event::marked_global_gnd:
+                                                     m_gnd_gates.insert(associated_data);
+                                                     mark_gate(associated_data);
+                                                     break;
+                                                 case NetlistEvent::event::unmarked_global_gnd:
+                                                     m_gnd_gates.erase(associated_data);
+                                                     mark_gate(associated_data);
+                                                     break;
+                                                 case NetlistEvent::event::marked_global_input:
+                                                     m_global_input_nets.insert(associated_data);
+                                                     m_dirty_nets.insert(associated_data);
+                                                     break;
+                                                 case NetlistEvent::event::unmarked_global_input:
+                                                     m_global_input_nets.erase(associated_data);
+                                                     m_dirty_nets.insert(associated_data);
+                                                     break;
+                                                 case NetlistEvent::event::marked_global_output:
+                                                     m_global_output_nets.insert(associated_data);
+                                                     m_dirty_nets.insert(associated_data);
+                                                     break;
+                                                 case NetlistEvent::event::unmarked_global_output:
+                                                     m_global_output_nets.erase(associated_data);
+                                                     m_dirty_nets.insert(associated_data);
+                                                     break;
+                                                 default:
+                                                     // the names of the netlist are hashed on every query
+                                                     break;
+                                             }
+                                             m_modification_count++;
+                                         }));
+
+        event_handler->register_callback(m_callback_name, std::function<void(GateEvent::event, Gate*, u32)>([this](GateEvent::event, Gate* gate, u32) {
+                                             std::lock_guard lock(m_mutex);
+                                             mark_gate(gate->get_id());
+                                             m_modification_count++;
+                                         }));
+
+        event_handler->register_callback(m_callback_name, std::function<void(NetEvent::event, Net*, u32)>([this](NetEvent::event e, Net* net, u32 associated_data) {
+                                             std::lock_guard lock(m_mutex);
+                                             switch (e)
+                                             {
+                                                 case NetEvent::event::src_added:
+                                                 case NetEvent::event::src_removed:
+                                                 case NetEvent::event::dst_added:
+                                                 case NetEvent::event::dst_removed:
+                                                     // connections are part of the gate hash
+                                                     mark_gate(associated_data);
+                                                     break;
+                                                 default:
+                                                     m_dirty_nets.insert(net->get_id());
+                                                     break;
+                                             }
+                                             m_modification_count++;
+                                         }));
+
+        event_handler->register_callback(m_callback_name, std::function<void(ModuleEvent::event, Module*, u32)>([this](ModuleEvent::event e, Module* module, u32) {
+                                             if (e == ModuleEvent::event::gates_assign_begin || e == ModuleEvent::event::gates_assign_end || e == ModuleEvent::event::gates_remove_begin
+                                                 || e == ModuleEvent::event::gates_remove_end)
+                                             {
+                                                 return;
+                                             }
+                                             std::lock_guard lock(m_mutex);
+                                             m_dirty_modules.insert(module->get_id());
+                                             invalidate_module(module);
+                                             m_modification_count++;
+                                         }));
+    }
+
+    NetlistFingerprint::~NetlistFingerprint()
+    {
+        m_netlist->get_event_handler()->unregister_callback(m_callback_name);
+    }
+
+    Netlist* NetlistFingerprint::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    u64 NetlistFingerprint::get_hash() const
+    {
+        std::lock_guard lock(m_mutex);
+        update();
+
+        u64 h = hash_string(m_netlist->get_design_name());
+        hash_combine(h, hash_string(m_netlist->get_device_name()));
+        hash_combine(h, hash_string(m_netlist->get_input_filename().string()));
+        hash_combine(h, (m_netlist->get_gate_library() != nullptr) ? hash_string(m_netlist->get_gate_library()->get_name()) : 0);
+        hash_combine(h, m_gate_sum);
+        hash_combine(h, m_net_sum);
+        hash_combine(h, m_module_sum);
+        return finalize(h);
+    }
+
+    u64 NetlistFingerprint::get_gate_hash(const Gate* gate) const
+    {
+        if (gate == nullptr || m_netlist->get_gate_by_id(gate->get_id()) != gate)
+        {
+            return 0;
+        }
+
+        std::lock_guard lock(m_mutex);
+        update();
+        return load(m_gate_hashes, gate->get_id());
+    }
+
+    u64 NetlistFingerprint::get_net_hash(const Net* net) const
+    {
+        if (net == nullptr || m_netlist->get_net_by_id(net->get_id()) != net)
+        {
+            return 0;
+        }
+
+        std::lock_guard lock(m_mutex);
+        update();
+        return load(m_net_hashes, net->get_id());
+    }
+
+    u64 NetlistFingerprint::get_module_hash(const Module* module) const
+    {
+        if (module == nullptr || m_netlist->get_module_by_id(module->get_id()) != module)
+        {
+            return 0;
+        }
+
+        std::lock_guard lock(m_mutex);
+        update();
+        return compute_recursive_module_hash(module);
+    }
+
+    u64 NetlistFingerprint::get_modification_count() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_modification_count;
+    }
+
+    u64 NetlistFingerprint::get_module_structure_hash(const Module* module) const
+    {
+        const std::vector<Gate*> gates = module->get_gates(nullptr, true);
+        const u32 num_gates            = gates.size();
+
+        std::unordered_map<const Gate*, u32> gate_indices;
+        gate_indices.reserve(num_gates);
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            gate_indices[gates[i]] = i;
+        }
+
+        // initial labels are derived from the gate types, the endpoints of every gate are stored as (local net index, pin hash) in CSR layout
+        std::unordered_map<const GateType*, u64> type_hashes;
+        std::unordered_map<const GatePin*, u64> pin_hashes;
+        std::unordered_map<const Net*, u32> net_indices;
+        std::vector<const Net*> nets;
+        std::vector<u64> labels(num_gates);
+        std::vector<u32> offsets(num_gates + 1, 0);
+        std::vector<std::pair<u32, u64>> endpoints;
+
+        const auto add_endpoint = [&](const Endpoint* ep) {
+            const Net* net       = ep->get_net();
+            auto [net_it, added] = net_indices.try_emplace(net, nets.size());
+            if (added)
+            {
+                nets.push_back(net);
+            }
+
+            auto pin_it = pin_hashes.find(ep->get_pin());
+            if (pin_it == pin_hashes.end())
+            {
+                u64 h = hash_string(ep->get_pin()->get_name());
+                hash_combine(h, ep->is_destination_pin() ? 1 : 2);
+                pin_it = pin_hashes.emplace(ep->get_pin(), h).first;
+            }
+            endpoints.emplace_back(net_it->second, pin_it->second);
+        };
+
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            const Gate* gate = gates[i];
+
+            auto type_it = type_hashes.find(gate->get_type());
+            if (type_it == type_hashes.end())
+            {
+                type_it = type_hashes.emplace(gate->get_type(), finalize(hash_string(gate->get_type()->get_name()))).first;
+            }
+            labels[i] = type_it->second;
+
+            offsets[i] = endpoints.size();
+            for (const Endpoint* ep : gate->get_fan_in_endpoints())
+            {
+                add_endpoint(ep);
+            }
+            for (const Endpoint* ep : gate->get_fan_out_endpoints())
+            {
+                add_endpoint(ep);
+            }
+        }
+        offsets[num_gates] = endpoints.size();
+
+        // nets leaving the module or the netlist are distinguished from internal nets
+        const u32 num_nets = nets.size();
+        std::vector<u32> num_inner_endpoints(num_nets, 0);
+        for (const auto& [n, pin_hash] : endpoints)
+        {
+            num_inner_endpoints[n]++;
+        }
+        std::vector<u64> boundary(num_nets, 0);
+        u64 num_boundary_nets = 0;
+        for (u32 n = 0; n < num_nets; n++)
+        {
+            const Net* net = nets[n];
+            if (num_inner_endpoints[n] < net->get_num_of_sources() + net->get_num_of_destinations() || m_global_input_nets.find(net->get_id()) != m_global_input_nets.end()
+                || m_global_output_nets.find(net->get_id()) != m_global_output_nets.end())
+            {
+                boundary[n] = 1;
+                num_boundary_nets++;
+            }
+        }
+
+        // in every round, the label of a gate absorbs the labels of all gates it is connected to together with the connecting pins
+        std::vector<u64> net_sums(num_nets);
+        std::vector<u64> next_labels(num_gates);
+        for (u32 r = 0; r < STRUCTURE_ROUNDS; r++)
+        {
+            std::fill(net_sums.begin(), net_sums.end(), 0);
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                for (u32 e = offsets[i]; e < offsets[i + 1]; e++)
+                {
+                    u64 h = endpoints[e].second;
+                    hash_combine(h, labels[i]);
+                    net_sums[endpoints[e].first] += finalize(h);
+                }
+            }
+
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                u64 neighborhood = 0;
+                for (u32 e = offsets[i]; e < offsets[i + 1]; e++)
+                {
+                    const auto& [n, pin_hash] = endpoints[e];
+
+                    u64 own = pin_hash;
+                    hash_combine(own, labels[i]);
+
+                    u64 h = pin_hash;
+                    hash_combine(h, net_sums[n] - finalize(own));
+                    hash_combine(h, boundary[n]);
+                    neighborhood += finalize(h);
+                }
+
+                u64 h = labels[i];
+                hash_combine(h, neighborhood);
+                next_labels[i] = finalize(h);
+            }
+            std::swap(labels, next_labels);
+        }
+
+        u64 label_sum = 0;
+        for (const u64 label : labels)
+        {
+            label_sum += label;
+        }
+
+        u64 h = num_gates;
+        hash_combine(h, label_sum);
+        hash_combine(h, num_nets);
+        hash_combine(h, num_boundary_nets);
+        return finalize(h);
+    }
+
+    std::vector<std::vector<Module*>> NetlistFingerprint::get_duplicate_modules(u32 num_workers) const
+    {
+        std::vector<Module*> modules;
+        for (Module* module : m_netlist->get_modules())
+        {
+            if (!module->is_top_module())
+            {
+                modules.push_back(module);
+            }
+        }
+
+        // modules vary strongly in size, hence they are handed out one at a time
+        std::vector<u64> hashes(modules.size());
+        utils::run_in_chunks(num_workers, modules.size(), 1, [this, &modules, &hashes](u32 i) { hashes[i] = get_module_structure_hash(modules[i]); });
+
+        std::unordered_map<u64, std::vector<Module*>> modules_by_hash;
+        for (u32 i = 0; i < modules.size(); i++)
+        {
+            modules_by_hash[hashes[i]].push_back(modules[i]);
+        }
+
+        const auto by_id = [](const Module* a, const Module* b) { return a->get_id() < b->get_id(); };
+
+        std::vector<std::vector<Module*>> groups;
+        for (auto& [h, group] : modules_by_hash)
+        {
+            if (group.size() > 1)
+            {
+                std::sort(group.begin(), group.end(), by_id);
+                groups.push_back(std::move(group));
+            }
+        }
+        std::sort(groups.begin(), groups.end(), [&by_id](const auto& a, const auto& b) { return by_id(a.front(), b.front()); });
+
+        return groups;
+    }
+
+    void NetlistFingerprint::update() const
+    {
+        for (const u32 id : m_dirty_gates)
+        {
+            const Gate* gate = m_netlist->get_gate_by_id(id);
+            const u64 h      = (gate != nullptr) ? compute_gate_hash(gate) : 0;
+            m_gate_sum += h - load(m_gate_hashes, id);
+            store(m_gate_hashes, id, h);
+        }
+        m_dirty_gates.clear();
+
+        for (const u32 id : m_dirty_nets)
+        {
+            const Net* net = m_netlist->get_net_by_id(id);
+            const u64 h    = (net != nullptr) ? compute_net_hash(net) : 0;
+            m_net_sum += h - load(m_net_hashes, id);
+            store(m_net_hashes, id, h);
+        }
+        m_dirty_nets.clear();
+
+        for (const u32 id : m_dirty_modules)
+        {
+            const Module* module = m_netlist->get_module_by_id(id);
+            const u64 h          = (module != nullptr) ? compute_module_hash(module) : 0;
+            if (const auto it = m_module_hashes.find(id); it != m_module_hashes.end())
+            {
+                m_module_sum -= it->second;
+                m_module_hashes.erase(it);
+            }
+            if (h != 0)
+            {
+                m_module_hashes[id] = h;
+                m_module_sum += h;
+            }
+        }
+        m_dirty_modules.clear();
+    }
+
+    void NetlistFingerprint::invalidate_module(const Module* module)
+    {
+        // a cached module hash implies cached hashes of all submodules, hence the walk can stop at the first module without cached hash
+        while (module != nullptr && m_recursive_module_hashes.erase(module->get_id()) != 0)
+        {
+            module = module->get_parent_module();
+        }
+    }
+
+    void NetlistFingerprint::mark_gate(u32 gate_id)
+    {
+        m_dirty_gates.insert(gate_id);
+
+        // removed gates are no longer found, their modules are invalidated by the module event
+        if (const Gate* gate = m_netlist->get_gate_by_id(gate_id); gate != nullptr)
+        {
+            invalidate_module(gate->get_module());
+        }
+    }
+
+    u64 NetlistFingerprint::compute_gate_hash(const Gate* gate) const
+    {
+        u64 h = gate->get_id();
+        hash_combine(h, hash_string(gate->get_name()));
+        hash_combine(h, hash_string(gate->get_type()->get_name()));
+        hash_combine(h, static_cast<u32>(gate->get_location_x()));
+        hash_combine(h, static_cast<u32>(gate->get_location_y()));
+        hash_combine(h, m_gnd_gates.find(gate->get_id()) != m_gnd_gates.end());
+        hash_combine(h, m_vcc_gates.find(gate->get_id()) != m_vcc_gates.end());
+
+        // functions and endpoints are unordered, hence their hashes are summed up
+        u64 functions = 0;
+        for (const auto& [name, function] : gate->get_boolean_functions(true))
+        {
+            u64 fh = hash_string(name);
+            hash_combine(fh, hash_string(function.to_string()));
+            functions += finalize(fh);
+        }
+        hash_combine(h, functions);
+
+        u64 endpoints = 0;
+        for (const Endpoint* ep : gate->get_fan_in_endpoints())
+        {
+            u64 eh = ep->get_pin()->get_id();
+            hash_combine(eh, hash_string(ep->get_pin()->get_name()));
+            hash_combine(eh, ep->get_net()->get_id());
+            endpoints += finalize(eh);
+        }
+        for (const Endpoint* ep : gate->get_fan_out_endpoints())
+        {
+            u64 eh = ep->get_pin()->get_id();
+            hash_combine(eh, hash_string(ep->get_pin()->get_name()));
+            hash_combine(eh, ep->get_net()->get_id());
+            // distinguishes input and output endpoints
+            endpoints += finalize(~eh);
+        }
+        hash_combine(h, endpoints);
+
+        return finalize(h);
+    }
+
+    u64 NetlistFingerprint::compute_net_hash(const Net* net) const
+    {
+        u64 h = net->get_id();
+        hash_combine(h, hash_string(net->get_name()));
+        hash_combine(h, m_global_input_nets.find(net->get_id()) != m_global_input_nets.end());
+        hash_combine(h, m_global_output_nets.find(net->get_id()) != m_global_output_nets.end());
+        return finalize(h);
+    }
+
+    u64 NetlistFingerprint::compute_module_hash(const Module* module) const
+    {
+        u64 h = module->get_id();
+        hash_combine(h, hash_string(module->get_name()));
+        hash_combine(h, hash_string(module->get_type()));
+        hash_combine(h, (module->get_parent_module() != nullptr) ? module->get_parent_module()->get_id() : 0);
+
+        // pin groups and their pins are ordered
+        for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+        {
+            hash_combine(h, pin_group->get_id());
+            hash_combine(h, hash_string(pin_group->get_name()));
+            hash_combine(h, static_cast<u32>(pin_group->get_direction()));
+            hash_combine(h, static_cast<u32>(pin_group->get_type()));
+            hash_combine(h, pin_group->is_ascending());
+            hash_combine(h, static_cast<u32>(pin_group->get_start_index()));
+            for (const ModulePin* pin : pin_group->get_pins())
+            {
+                hash_combine(h, pin->get_id());
+                hash_combine(h, hash_string(pin->get_name()));
+                hash_combine(h, static_cast<u32>(pin->get_direction()));
+                hash_combine(h, static_cast<u32>(pin->get_type()));
+                hash_combine(h, (pin->get_net() != nullptr) ? pin->get_net()->get_id() : 0);
+            }
+        }
+
+        return finalize(h);
+    }
+
+    u64 NetlistFingerprint::compute_recursive_module_hash(const Module* module) const
+    {
+        if (const auto it = m_recursive_module_hashes.find(module->get_id()); it != m_recursive_module_hashes.end())
+        {
+            return it->second;
+        }
+
+        u64 gates = 0;
+        for (const Gate* gate : module->get_gates())
+        {
+            gates += load(m_gate_hashes, gate->get_id());
+        }
+
+        u64 submodules = 0;
+        for (const Module* submodule : module->get_submodules())
+        {
+            submodules += compute_recursive_module_hash(submodule);
+        }
+
+        u64 h = m_module_hashes.at(module->get_id());
+        hash_combine(h, gates);
+        hash_combine(h, submodules);
+        h = finalize(h);
+
+        m_recursive_module_hashes[module->get_id()] = h;
+        return h;
+    }
+}    // namespace hal
@@ -10,9 +10,18 @@
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel.h"
+
+#include <algorithm>
 
 namespace hal
 {
+    namespace
+    {
+        // number of objects handed out to a worker at once
+        constexpr u32 COPY_CHUNK_SIZE = 1024;
+    }    // namespace
+
     NetlistInternalManager::NetlistInternalManager(Netlist* nl, EventHandler* eh)
     {
         m_netlist       = nl;
@@ -25,7 +34,7 @@ namespace hal
     //###                      netlist                                   ###
     //######################################################################
 
-    Result<std::unique_ptr<Netlist>> NetlistInternalManager::copy_netlist(const Netlist* nl) const
+    Result<std::unique_ptr<Netlist>> NetlistInternalManager::copy_netlist(const Netlist* nl, u32 num_workers) const
     {
         std::unique_ptr<Netlist> c_netlist = netlist_factory::create_netlist(nl->m_gate_library);
         if (c_netlist == nullptr)
@@ -33,131 +42,185 @@ namespace hal
             return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create netlist");
         }
 
+        // the original netlist is consistent, hence its gates, nets, endpoints, and modules are cloned directly into the internal structures of the copy
+        // without going through the checks of the public API, without firing events, and without classifying module nets for every single endpoint
+        NetlistInternalManager* c_manager = c_netlist->m_manager;
+        EventHandler* c_event_handler     = c_netlist->m_event_handler.get();
+
         c_netlist->enable_automatic_net_checks(false);
 
         // manager, netlist_id, and top_module are set in the constructor
 
         // copy design name, device name, input filename
-        c_netlist->set_design_name(nl->get_design_name());
-        c_netlist->set_device_name(nl->get_device_name());
-        c_netlist->set_input_filename(nl->get_input_filename());
+        c_netlist->m_design_name = nl->m_design_name;
+        c_netlist->m_device_name = nl->m_device_name;
+        c_netlist->m_file_name   = nl->m_file_name;
 
-        // copy nets
-        for (const Net* net : nl->m_nets)
+        const std::vector<Net*>& nets   = nl->m_nets.get_objects();
+        const std::vector<Gate*>& gates = nl->m_gates.get_objects();
+
+        // allocate nets, gates, and endpoints up front, since the object pools must not be accessed concurrently
+        std::vector<Net*> c_nets(nets.size());
+        c_netlist->m_nets.reserve(nets.size());
+        for (u32 i = 0; i < nets.size(); i++)
         {
-            Net* c_net = c_netlist->create_net(net->m_id, net->m_name);
-            if (c_net == nullptr)
-            {
-                return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied net '" + net->m_name + "' with ID " + std::to_string(net->m_id));
-            }
-            c_net->m_data = net->m_data;
+            c_nets[i] = new (c_manager->m_net_pool.allocate()) Net(c_manager, c_event_handler, nets[i]->m_id, nets[i]->m_name);
+            c_netlist->m_nets.insert(nets[i]->m_id, c_nets[i]);
+        }
+
+        std::vector<Gate*> c_gates(gates.size());
+        std::vector<u32> endpoint_offsets(gates.size() + 1, 0);
+        c_netlist->m_gates.reserve(gates.size());
+        for (u32 i = 0; i < gates.size(); i++)
+        {
+            const Gate* gate = gates[i];
+            c_gates[i]       = new (c_manager->m_gate_pool.allocate()) Gate(c_manager, c_event_handler, gate->m_id, gate->m_type, gate->m_name, gate->m_x, gate->m_y);
+            c_netlist->m_gates.insert(gate->m_id, c_gates[i]);
+            endpoint_offsets[i + 1] = endpoint_offsets[i] + gate->m_in_endpoints.size() + gate->m_out_endpoints.size();
         }
 
-        // copy gates
-        for (const Gate* gate : nl->m_gates)
+        std::vector<void*> endpoint_slots(endpoint_offsets.back());
+        for (void*& slot : endpoint_slots)
         {
-            Gate* c_gate = c_netlist->create_gate(gate->m_id, gate->m_type, gate->m_name, gate->m_x, gate->m_y);
-            if (c_gate == nullptr)
+            slot = c_manager->m_endpoint_pool.allocate();
+        }
+
+        // copy gates, every gate only writes to its own endpoints
+        utils::run_in_chunks(num_workers, gates.size(), COPY_CHUNK_SIZE, [&](u32 i) {
+            const Gate* gate = gates[i];
+            Gate* c_gate     = c_gates[i];
+
+            c_gate->m_functions = gate->m_functions;
+            c_gate->m_data      = gate->m_data;
+
+            void** slot = endpoint_slots.data() + endpoint_offsets[i];
+            c_gate->m_in_endpoints.reserve(gate->m_in_endpoints.size());
+            for (const Endpoint* ep : gate->m_in_endpoints)
             {
-                return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied gate '" + gate->m_name + "' with ID " + std::to_string(gate->m_id));
+                c_gate->m_in_endpoints.push_back(new (*slot++) Endpoint(c_gate, ep->get_pin(), c_netlist->m_nets.get(ep->get_net()->m_id), true));
             }
-
-            for (const auto& [name, func] : gate->get_boolean_functions(true))
+            c_gate->m_out_endpoints.reserve(gate->m_out_endpoints.size());
+            for (const Endpoint* ep : gate->m_out_endpoints)
             {
-                c_gate->add_boolean_function(name, func);
+                c_gate->m_out_endpoints.push_back(new (*slot++) Endpoint(c_gate, ep->get_pin(), c_netlist->m_nets.get(ep->get_net()->m_id), false));
             }
 
-            for (const Endpoint* in_point : gate->get_fan_in_endpoints())
+            c_gate->m_in_nets.reserve(gate->m_in_nets.size());
+            for (const Net* net : gate->m_in_nets)
             {
-                const auto net_id = in_point->get_net()->m_id;
-                auto c_net        = c_netlist->get_net_by_id(net_id);
-                if (c_net == nullptr)
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to get copied net by ID " + std::to_string(net_id));
-                }
-
-                if (!c_net->add_destination(c_gate, in_point->get_pin()))
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to add destination to copied net '" + c_net->m_name + "' with ID "
-                               + std::to_string(c_net->m_id));
-                }
+                c_gate->m_in_nets.push_back(c_netlist->m_nets.get(net->m_id));
             }
-
-            for (const Endpoint* out_point : gate->get_fan_out_endpoints())
+            c_gate->m_out_nets.reserve(gate->m_out_nets.size());
+            for (const Net* net : gate->m_out_nets)
             {
-                const auto net_id = out_point->get_net()->m_id;
-                auto c_net        = c_netlist->get_net_by_id(net_id);
-                if (c_net == nullptr)
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to get copied net by ID " + std::to_string(net_id));
-                }
-
-                if (!c_net->add_source(c_gate, out_point->get_pin()))
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to add source to copied net '" + c_net->m_name + "' with ID "
-                               + std::to_string(c_net->m_id));
-                }
+                c_gate->m_out_nets.push_back(c_netlist->m_nets.get(net->m_id));
             }
+        });
 
-            c_gate->m_data = gate->m_data;
-        }
+        // copy nets, the copied endpoints of a gate are identified by their pin
+        const auto get_copied_endpoint = [&c_netlist](const Endpoint* ep) {
+            const Gate* c_gate                     = c_netlist->m_gates.get(ep->get_gate()->m_id);
+            const std::vector<Endpoint*>& c_points = ep->is_destination_pin() ? c_gate->m_in_endpoints : c_gate->m_out_endpoints;
+            return *std::find_if(c_points.begin(), c_points.end(), [ep](const Endpoint* c_ep) { return c_ep->get_pin() == ep->get_pin(); });
+        };
 
-        // copy modules
+        utils::run_in_chunks(num_workers, nets.size(), COPY_CHUNK_SIZE, [&](u32 i) {
+            const Net* net = nets[i];
+            Net* c_net     = c_nets[i];
+
+            c_net->m_data = net->m_data;
+
+            c_net->m_sources_raw.reserve(net->m_sources_raw.size());
+            for (const Endpoint* ep : net->m_sources_raw)
+            {
+                c_net->m_sources_raw.push_back(get_copied_endpoint(ep));
+            }
+            c_net->m_destinations_raw.reserve(net->m_destinations_raw.size());
+            for (const Endpoint* ep : net->m_destinations_raw)
+            {
+                c_net->m_destinations_raw.push_back(get_copied_endpoint(ep));
+            }
+        });
+
+        // copy modules together with their gates, the module hierarchy is restored once all modules exist
         for (const Module* module : nl->m_modules)
         {
-            // ignore top module, since this is already created by the constructor
-            if (module->m_id == 1)
+            Module* c_module = c_netlist->m_top_module;
+            if (module->m_parent != nullptr)
             {
-                c_netlist->m_top_module->m_data = module->get_data_map();
-                c_netlist->m_top_module->m_type = module->m_type;
-                continue;
+                auto m   = std::unique_ptr<Module>(new Module(c_manager, c_event_handler, module->m_id, nullptr, module->m_name));
+                c_module = m.get();
+                c_netlist->m_modules_map[module->m_id] = std::move(m);
+                c_netlist->m_modules_set.insert(c_module);
+                c_netlist->m_modules.push_back(c_module);
+            }
+            else
+            {
+                c_module->m_name = module->m_name;
             }
 
-            std::vector<Gate*> c_gates;
+            c_module->m_type = module->m_type;
+            c_module->m_data = module->m_data;
+
+            c_module->m_gates.reserve(module->m_gates.size());
+            c_module->m_gates_map.reserve(module->m_gates.size());
             for (const Gate* gate : module->m_gates)
             {
-                // find gates of module in the copied netlist by id
-                Gate* c_gate = c_netlist->get_gate_by_id(gate->m_id);
+                Gate* c_gate = c_netlist->m_gates.get(gate->m_id);
                 if (c_gate == nullptr)
                 {
                     return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to get copied gate by ID " + std::to_string(gate->m_id));
                 }
-                c_gates.push_back(c_gate);
-            }
-
-            // create all modules with the top module as parent module and update later
-            Module* c_module = c_netlist->create_module(module->m_id, module->m_name, c_netlist->m_top_module, c_gates);
-            if (c_module == nullptr)
-            {
-                return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied module '" + module->m_name + "' with ID " + std::to_string(module->m_id));
+                c_gate->m_module = c_module;
+                c_module->m_gates.push_back(c_gate);
+                c_module->m_gates_map[gate->m_id] = c_gate;
             }
-
-            c_module->m_data = module->m_data;
-            c_module->m_type = module->m_type;
         }
 
-        // update parent_module in modules
         for (const Module* module : nl->m_modules)
         {
-            // ignore top_module
-            if (module->m_parent == nullptr)
+            Module* c_module = c_netlist->get_module_by_id(module->m_id);
+            if (c_module == nullptr)
             {
-                continue;
+                return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to get copied module by ID " + std::to_string(module->m_id));
             }
 
-            // find parent and child module in the copied netlist by id
-            const u32 module_id = module->m_id;
-            const u32 parent_id = module->m_parent->m_id;
-            Module* c_module    = c_netlist->get_module_by_id(module_id);
-            Module* c_parent    = c_netlist->get_module_by_id(parent_id);
+            if (module->m_parent != nullptr)
+            {
+                c_module->m_parent = c_netlist->get_module_by_id(module->m_parent->m_id);
+            }
 
-            if (!c_module->set_parent_module(c_parent))
+            c_module->m_submodules.reserve(module->m_submodules.size());
+            for (const Module* submodule : module->m_submodules)
             {
-                return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to set copied module '" + c_parent->m_name + "' with ID " + std::to_string(module->m_id)
-                           + " as parent module of '" + c_module->m_name + "' with ID " + std::to_string(c_module->m_id));
+                Module* c_submodule            = c_netlist->get_module_by_id(submodule->m_id);
+                c_submodule->m_submodule_index = submodule->m_submodule_index;
+                c_module->m_submodules.push_back(c_submodule);
+                c_module->m_submodules_map[submodule->m_id] = c_submodule;
             }
         }
 
+        // mark globals, which is required before classifying module nets
+        for (const Net* global_input_net : nl->m_global_input_nets)
+        {
+            c_netlist->m_global_input_nets.push_back(c_netlist->m_nets.get(global_input_net->m_id));
+        }
+        for (const Net* global_output_net : nl->m_global_output_nets)
+        {
+            c_netlist->m_global_output_nets.push_back(c_netlist->m_nets.get(global_output_net->m_id));
+        }
+        for (const Gate* gnd_gate : nl->m_gnd_gates)
+        {
+            c_netlist->m_gnd_gates.push_back(c_netlist->m_gates.get(gnd_gate->m_id));
+        }
+        for (const Gate* vcc_gate : nl->m_vcc_gates)
+        {
+            c_netlist->m_vcc_gates.push_back(c_netlist->m_gates.get(vcc_gate->m_id));
+        }
+
+        // classify module nets once per module, every module only writes to its own net sets
+        utils::run_in_chunks(num_workers, c_netlist->m_modules.size(), 1, [&c_netlist](u32 i) { c_netlist->m_modules[i]->update_nets(); });
+
         // copy groupings
         for (const Grouping* grouping : nl->m_groupings)
         {
@@ -187,54 +250,16 @@ namespace hal
             }
         }
 
-        // mark globals
-        for (const Net* global_input_net : nl->m_global_input_nets)
-        {
-            Net* c_global_input_net = c_netlist->get_net_by_id(global_input_net->m_id);
-            c_netlist->mark_global_input_net(c_global_input_net);
-        }
-        for (const Net* global_output_net : nl->m_global_output_nets)
-        {
-            Net* c_global_output_net = c_netlist->get_net_by_id(global_output_net->m_id);
-            c_netlist->mark_global_output_net(c_global_output_net);
-        }
-        for (const Gate* gnd_gate : nl->m_gnd_gates)
-        {
-            Gate* c_gnd_gate = c_netlist->get_gate_by_id(gnd_gate->m_id);
-            c_netlist->mark_gnd_gate(c_gnd_gate);
-        }
-        for (const Gate* vcc_gate : nl->m_vcc_gates)
-        {
-            Gate* c_vcc_gate = c_netlist->get_gate_by_id(vcc_gate->m_id);
-            c_netlist->mark_vcc_gate(c_vcc_gate);
-        }
-
-        c_netlist->m_design_name = nl->m_design_name;
-        c_netlist->m_device_name = nl->m_device_name;
-        c_netlist->m_file_name   = nl->m_file_name;
-
         // update ids last, after all the creation
-        c_netlist->m_next_gate_id  = nl->m_next_gate_id;
-        c_netlist->m_used_gate_ids = nl->m_used_gate_ids;
-        c_netlist->m_free_gate_ids = nl->m_free_gate_ids;
-
-        c_netlist->m_next_net_id  = nl->m_next_net_id;
-        c_netlist->m_used_net_ids = nl->m_used_net_ids;
-        c_netlist->m_free_net_ids = nl->m_free_net_ids;
-
-        c_netlist->m_next_module_id  = nl->m_next_module_id;
-        c_netlist->m_used_module_ids = nl->m_used_module_ids;
-        c_netlist->m_free_module_ids = nl->m_free_module_ids;
-
-        c_netlist->m_next_grouping_id  = nl->m_next_grouping_id;
-        c_netlist->m_used_grouping_ids = nl->m_used_grouping_ids;
-        c_netlist->m_free_grouping_ids = nl->m_free_grouping_ids;
+        c_netlist->m_gate_ids     = nl->m_gate_ids;
+        c_netlist->m_net_ids      = nl->m_net_ids;
+        c_netlist->m_module_ids   = nl->m_module_ids;
+        c_netlist->m_grouping_ids = nl->m_grouping_ids;
 
         // copy module port names
         for (Module* module : nl->m_modules)
         {
             Module* c_module = c_netlist->get_module_by_id(module->m_id);
-            c_module->update_nets();
 
             for (const std::unique_ptr<PinGroup<ModulePin>>& pin_group : module->m_pin_groups)
             {
@@ -283,7 +308,7 @@ namespace hal
             log_error("gate", "ID 0 represents an invalid gate ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_gate_ids.find(id) != m_netlist->m_used_gate_ids.end())
+        if (m_netlist->m_gate_ids.is_used(id))
         {
             log_error("gate", "gate ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -304,24 +329,14 @@ namespace hal
             return nullptr;
         }
 
-        auto new_gate = std::unique_ptr<Gate>(new Gate(this, m_event_handler, id, gt, name, x, y));
-
-        auto free_id_it = m_netlist->m_free_gate_ids.find(id);
-        if (free_id_it != m_netlist->m_free_gate_ids.end())
-        {
-            m_netlist->m_free_gate_ids.erase(free_id_it);
-        }
+        auto raw = new (m_gate_pool.allocate()) Gate(this, m_event_handler, id, gt, name, x, y);
 
-        m_netlist->m_used_gate_ids.insert(id);
+        m_netlist->m_gate_ids.reserve(id);
 
         // add gate to top module
-        new_gate->m_module = m_netlist->m_top_module;
+        raw->m_module = m_netlist->m_top_module;
 
-        auto raw = new_gate.get();
-
-        m_netlist->m_gates_map[id] = std::move(new_gate);
-        m_netlist->m_gates_set.insert(raw);
-        m_netlist->m_gates.push_back(raw);
+        m_netlist->m_gates.insert(id, raw);
 
         m_netlist->m_top_module->m_gates_map[id] = raw;
         m_netlist->m_top_module->m_gates.push_back(raw);
@@ -340,6 +355,13 @@ namespace hal
             return false;
         }
 
+        std::vector<Net*> connected_nets;
+        if (m_bulk_edit_depth > 0)
+        {
+            connected_nets = gate->m_out_nets;
+            connected_nets.insert(connected_nets.end(), gate->m_in_nets.begin(), gate->m_in_nets.end());
+        }
+
         for (auto ep : gate->get_fan_out_endpoints())
         {
             if (!net_remove_source(ep->get_net(), ep))
@@ -356,6 +378,15 @@ namespace hal
             }
         }
 
+        // deliver pending endpoint events that refer to the gate before announcing its removal
+        for (Net* net : connected_nets)
+        {
+            if (auto it = m_bulk_edit_nets.find(net->get_id()); it != m_bulk_edit_nets.end())
+            {
+                bulk_edit_send_events(net, it->second);
+            }
+        }
+
         // remove from grouping
         if (Grouping* g = gate->get_grouping(); g != nullptr)
         {
@@ -370,19 +401,16 @@ namespace hal
         gate->m_module->m_gates_map.erase(gate->m_module->m_gates_map.find(gate->get_id()));
         utils::unordered_vector_erase(gate->m_module->m_gates, gate);
 
-        auto it  = m_netlist->m_gates_map.find(gate->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_gates_map.erase(it);
-        m_netlist->m_gates_set.erase(gate);
-        utils::unordered_vector_erase(m_netlist->m_gates, gate);
+        m_netlist->m_gates.erase(gate->get_id());
 
         // free ids
-        m_netlist->m_free_gate_ids.insert(gate->get_id());
-        m_netlist->m_used_gate_ids.erase(gate->get_id());
+        m_netlist->m_gate_ids.release(gate->get_id());
 
         m_event_handler->notify(ModuleEvent::event::gate_removed, gate->m_module, gate->get_id());
         m_event_handler->notify(GateEvent::event::removed, gate);
 
+        m_gate_pool.destroy(gate);
+
         return true;
     }
 
@@ -402,7 +430,7 @@ namespace hal
             log_error("net", "ID 0 represents an invalid net ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_net_ids.find(id) != m_netlist->m_used_net_ids.end())
+        if (m_netlist->m_net_ids.is_used(id))
         {
             log_error("net", "net ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -413,21 +441,12 @@ namespace hal
             return nullptr;
         }
 
-        auto new_net = std::unique_ptr<Net>(new Net(this, m_event_handler, id, name));
+        auto raw = new (m_net_pool.allocate()) Net(this, m_event_handler, id, name);
 
-        auto free_id_it = m_netlist->m_free_net_ids.find(id);
-        if (free_id_it != m_netlist->m_free_net_ids.end())
-        {
-            m_netlist->m_free_net_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_net_ids.insert(id);
+        m_netlist->m_net_ids.reserve(id);
 
         // add net to netlist
-        auto raw                  = new_net.get();
-        m_netlist->m_nets_map[id] = std::move(new_net);
-        m_netlist->m_nets_set.insert(raw);
-        m_netlist->m_nets.push_back(raw);
+        m_netlist->m_nets.insert(id, raw);
 
         // notify
         m_event_handler->notify(NetEvent::event::created, raw);
@@ -470,18 +489,21 @@ namespace hal
         m_netlist->unmark_global_input_net(net);
         m_netlist->unmark_global_output_net(net);
 
+        // finish pending bulk edit updates while the net is still alive
+        if (m_bulk_edit_depth > 0)
+        {
+            bulk_edit_flush_net(net);
+        }
+
         // remove net from netlist
-        auto it  = m_netlist->m_nets_map.find(net->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_nets_map.erase(it);
-        m_netlist->m_nets_set.erase(net);
-        utils::unordered_vector_erase(m_netlist->m_nets, net);
+        m_netlist->m_nets.erase(net->get_id());
 
-        m_netlist->m_free_net_ids.insert(net->get_id());
-        m_netlist->m_used_net_ids.erase(net->get_id());
+        m_netlist->m_net_ids.release(net->get_id());
 
         m_event_handler->notify(NetEvent::event::removed, net);
 
+        m_net_pool.destroy(net);
+
         return true;
     }
 
@@ -492,7 +514,8 @@ namespace hal
             return nullptr;
         }
 
-        if (net->is_a_source(gate, pin))
+        // search the endpoints of the gate rather than those of the net, which may be many
+        if (std::any_of(gate->m_out_endpoints.begin(), gate->m_out_endpoints.end(), [net, pin](const Endpoint* ep) { return ep->get_net() == net && *ep->get_pin() == *pin; }))
         {
             log_error("net",
                       "pin '{}' of gate '{}' with ID {} is already a source of net '{}' with ID {} in netlist with ID {}.",
@@ -530,12 +553,19 @@ namespace hal
             return nullptr;
         }
 
-        auto new_endpoint     = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, false));
-        auto new_endpoint_raw = new_endpoint.get();
-        net->m_sources.push_back(std::move(new_endpoint));
+        auto new_endpoint_raw = new (m_endpoint_pool.allocate()) Endpoint(gate, pin, net, false);
         net->m_sources_raw.push_back(new_endpoint_raw);
         gate->m_out_endpoints.push_back(new_endpoint_raw);
         gate->m_out_nets.push_back(net);
+        gate->m_module->count_net_endpoints(net, 1, 0);
+
+        // defer updating internal nets and port nets to the end of the bulk edit
+        if (m_bulk_edit_depth > 0)
+        {
+            bulk_edit_mark_net(net, gate->get_module());
+            bulk_edit_add_event(net, NetEvent::event::src_added, gate->get_id(), pin);
+            return new_endpoint_raw;
+        }
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
@@ -546,7 +576,7 @@ namespace hal
                 return nullptr;
             }
 
-            for (Endpoint* ep : net->get_destinations())
+            for (Endpoint* ep : net->get_destinations_view())
             {
                 if (const auto res = ep->get_gate()->get_module()->check_net(net, true); res.is_error())
                 {
@@ -564,6 +594,7 @@ namespace hal
     bool NetlistInternalManager::net_remove_source(Net* net, Endpoint* ep)
     {
         auto gate = ep->get_gate();
+        auto pin  = ep->get_pin();
 
         if (!m_netlist->is_net_in_netlist(net) || !m_netlist->is_gate_in_netlist(gate) || !net->is_a_source(ep))
         {
@@ -571,17 +602,24 @@ namespace hal
         }
 
         bool removed = false;
-        for (u32 i = 0; i < net->m_sources.size(); ++i)
+        for (u32 i = 0; i < net->m_sources_raw.size(); ++i)
         {
             if (net->m_sources_raw[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_out_endpoints, ep);
                 utils::unordered_vector_erase(gate->m_out_nets, net);
-                net->m_sources[i] = std::move(net->m_sources.back());
-                net->m_sources.pop_back();
                 net->m_sources_raw[i] = net->m_sources_raw.back();
                 net->m_sources_raw.pop_back();
-                m_event_handler->notify(NetEvent::event::src_removed, net, gate->get_id());
+                gate->m_module->count_net_endpoints(net, -1, 0);
+                m_endpoint_pool.destroy(ep);
+                if (m_bulk_edit_depth > 0)
+                {
+                    bulk_edit_add_event(net, NetEvent::event::src_removed, gate->get_id(), pin);
+                }
+                else
+                {
+                    m_event_handler->notify(NetEvent::event::src_removed, net, gate->get_id());
+                }
                 removed = true;
                 break;
             }
@@ -598,6 +636,10 @@ namespace hal
                         net->get_id(),
                         m_netlist->m_netlist_id);
         }
+        else if (m_bulk_edit_depth > 0)
+        {
+            bulk_edit_mark_net(net, gate->get_module());
+        }
         else
         {
             // update internal nets and port nets
@@ -609,7 +651,7 @@ namespace hal
                     return false;
                 }
 
-                for (Endpoint* dst : net->get_destinations())
+                for (Endpoint* dst : net->get_destinations_view())
                 {
                     if (const auto res = dst->get_gate()->get_module()->check_net(net, true); res.is_error())
                     {
@@ -630,7 +672,8 @@ namespace hal
             return nullptr;
         }
 
-        if (net->is_a_destination(gate, pin))
+        // search the endpoints of the gate rather than those of the net, which may be many
+        if (std::any_of(gate->m_in_endpoints.begin(), gate->m_in_endpoints.end(), [net, pin](const Endpoint* ep) { return ep->get_net() == net && *ep->get_pin() == *pin; }))
         {
             log_error("net",
                       "pin '{}' of gate '{}' with ID {} is already a destination of net '{}' with ID {} in netlist with ID {}.",
@@ -668,12 +711,19 @@ namespace hal
             return nullptr;
         }
 
-        std::unique_ptr<Endpoint> new_endpoint = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, true));
-        Endpoint* new_endpoint_raw             = new_endpoint.get();
-        net->m_destinations.push_back(std::move(new_endpoint));
+        Endpoint* new_endpoint_raw = new (m_endpoint_pool.allocate()) Endpoint(gate, pin, net, true);
         net->m_destinations_raw.push_back(new_endpoint_raw);
         gate->m_in_endpoints.push_back(new_endpoint_raw);
         gate->m_in_nets.push_back(net);
+        gate->m_module->count_net_endpoints(net, 0, 1);
+
+        // defer updating internal nets and port nets to the end of the bulk edit
+        if (m_bulk_edit_depth > 0)
+        {
+            bulk_edit_mark_net(net, gate->get_module());
+            bulk_edit_add_event(net, NetEvent::event::dst_added, gate->get_id(), pin);
+            return new_endpoint_raw;
+        }
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
@@ -684,7 +734,7 @@ namespace hal
                 return nullptr;
             }
 
-            for (Endpoint* ep : net->get_sources())
+            for (Endpoint* ep : net->get_sources_view())
             {
                 if (const auto res = ep->get_gate()->get_module()->check_net(net, true); res.is_error())
                 {
@@ -702,23 +752,31 @@ namespace hal
     bool NetlistInternalManager::net_remove_destination(Net* net, Endpoint* ep)
     {
         auto gate = ep->get_gate();
+        auto pin  = ep->get_pin();
         if (!m_netlist->is_net_in_netlist(net) || !m_netlist->is_gate_in_netlist(gate) || !net->is_a_destination(ep))
         {
             return false;
         }
 
         bool removed = false;
-        for (u32 i = 0; i < net->m_destinations.size(); ++i)
+        for (u32 i = 0; i < net->m_destinations_raw.size(); ++i)
         {
             if (net->m_destinations_raw[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_in_endpoints, ep);
                 utils::unordered_vector_erase(gate->m_in_nets, net);
-                net->m_destinations[i] = std::move(net->m_destinations.back());
-                net->m_destinations.pop_back();
                 net->m_destinations_raw[i] = net->m_destinations_raw.back();
                 net->m_destinations_raw.pop_back();
-                m_event_handler->notify(NetEvent::event::dst_removed, net, gate->get_id());
+                gate->m_module->count_net_endpoints(net, 0, -1);
+                m_endpoint_pool.destroy(ep);
+                if (m_bulk_edit_depth > 0)
+                {
+                    bulk_edit_add_event(net, NetEvent::event::dst_removed, gate->get_id(), pin);
+                }
+                else
+                {
+                    m_event_handler->notify(NetEvent::event::dst_removed, net, gate->get_id());
+                }
                 removed = true;
                 break;
             }
@@ -735,6 +793,10 @@ namespace hal
                         net->get_id(),
                         m_netlist->m_netlist_id);
         }
+        else if (m_bulk_edit_depth > 0)
+        {
+            bulk_edit_mark_net(net, gate->get_module());
+        }
         else
         {    // update internal nets and port nets
             if (m_net_checks_enabled)
@@ -745,7 +807,7 @@ namespace hal
                     return false;
                 }
 
-                for (Endpoint* src : net->get_sources())
+                for (Endpoint* src : net->get_sources_view())
                 {
                     if (const auto res = src->get_gate()->get_module()->check_net(net, true); res.is_error())
                     {
@@ -770,7 +832,7 @@ namespace hal
             log_error("module", "ID 0 represents an invalid module ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_module_ids.find(id) != m_netlist->m_used_module_ids.end())
+        if (m_netlist->m_module_ids.is_used(id))
         {
             log_error("module", "module ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -793,13 +855,7 @@ namespace hal
 
         auto m = std::unique_ptr<Module>(new Module(this, m_event_handler, id, parent, name));
 
-        auto free_id_it = m_netlist->m_free_module_ids.find(id);
-        if (free_id_it != m_netlist->m_free_module_ids.end())
-        {
-            m_netlist->m_free_module_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_module_ids.insert(id);
+        m_netlist->m_module_ids.reserve(id);
 
         auto raw                     = m.get();
         m_netlist->m_modules_map[id] = std::move(m);
@@ -809,6 +865,7 @@ namespace hal
         if (parent != nullptr)
         {
             parent->m_submodules_map[id] = raw;
+            raw->m_submodule_index       = parent->m_submodules.size();
             parent->m_submodules.push_back(raw);
         }
 
@@ -850,6 +907,7 @@ namespace hal
         for (auto sm : to_remove->m_submodules)
         {
             to_remove->m_parent->m_submodules_map[sm->get_id()] = sm;
+            sm->m_submodule_index                               = to_remove->m_parent->m_submodules.size();
             to_remove->m_parent->m_submodules.push_back(sm);
 
             m_event_handler->notify(ModuleEvent::event::submodule_removed, sm->get_parent_module(), sm->get_id());
@@ -862,7 +920,11 @@ namespace hal
 
         // remove module from parent
         to_remove->m_parent->m_submodules_map.erase(to_remove->get_id());
-        utils::unordered_vector_erase(to_remove->m_parent->m_submodules, to_remove);
+        // replace the module by the last submodule of its parent to remove it in constant time
+        auto& siblings                         = to_remove->m_parent->m_submodules;
+        siblings[to_remove->m_submodule_index] = siblings.back();
+        siblings.back()->m_submodule_index     = to_remove->m_submodule_index;
+        siblings.pop_back();
         m_event_handler->notify(ModuleEvent::event::submodule_removed, to_remove->m_parent, to_remove->get_id());
 
         auto it  = m_netlist->m_modules_map.find(to_remove->get_id());
@@ -871,8 +933,7 @@ namespace hal
         m_netlist->m_modules_set.erase(to_remove);
         utils::unordered_vector_erase(m_netlist->m_modules, to_remove);
 
-        m_netlist->m_free_module_ids.insert(to_remove->get_id());
-        m_netlist->m_used_module_ids.erase(to_remove->get_id());
+        m_netlist->m_module_ids.release(to_remove->get_id());
 
         m_event_handler->notify(ModuleEvent::event::removed, to_remove);
         return true;
@@ -935,31 +996,39 @@ namespace hal
 
         // re-assign gates
         std::unordered_map<Module*, std::unordered_set<Net*>> nets_to_check;
+        std::vector<Module*> gate_prev_modules;
+        gate_prev_modules.reserve(gates.size());
         for (Gate* g : gates)
         {
-            // remove gate from old module
+            // remove gate from old module, its gate vector is compacted once all gates have been moved
             Module* prev_mod = g->m_module;
             const auto it    = prev_mod->m_gates_map.find(g->get_id());
             assert(it != prev_mod->m_gates_map.end());
             prev_mod->m_gates_map.erase(it);
-
-            utils::unordered_vector_erase(prev_mod->m_gates, g);
+            gate_prev_modules.push_back(prev_mod);
 
             // move gate to new module
             module->m_gates_map[g->get_id()] = g;
             module->m_gates.push_back(g);
             g->m_module = module;
 
-            // collect affected nets
-            std::vector<Net*> fan_in = g->get_fan_in_nets();
-            nets_to_check[prev_mod].insert(fan_in.begin(), fan_in.end());
-            nets_to_check[module].insert(fan_in.begin(), fan_in.end());
-
-            std::vector<Net*> fan_out = g->get_fan_out_nets();
-            nets_to_check[prev_mod].insert(fan_out.begin(), fan_out.end());
-            nets_to_check[module].insert(fan_out.begin(), fan_out.end());
-            m_event_handler->notify(ModuleEvent::event::gate_removed, prev_mod, g->get_id());
-            m_event_handler->notify(ModuleEvent::event::gate_assigned, module, g->get_id());
+            // move endpoint counts and collect affected nets, counts are incremented first to keep entries of shared ancestors alive
+            std::unordered_set<Net*>& prev_nets = nets_to_check[prev_mod];
+            std::unordered_set<Net*>& nets      = nets_to_check[module];
+            for (const Endpoint* ep : g->m_in_endpoints)
+            {
+                module->count_net_endpoints(ep->get_net(), 0, 1);
+                prev_mod->count_net_endpoints(ep->get_net(), 0, -1);
+                prev_nets.insert(ep->get_net());
+                nets.insert(ep->get_net());
+            }
+            for (const Endpoint* ep : g->m_out_endpoints)
+            {
+                module->count_net_endpoints(ep->get_net(), 1, 0);
+                prev_mod->count_net_endpoints(ep->get_net(), -1, 0);
+                prev_nets.insert(ep->get_net());
+                nets.insert(ep->get_net());
+            }
 
             if (auto prev_mod_it = prev_modules.find(prev_mod); prev_mod_it == prev_modules.end())
             {
@@ -971,7 +1040,30 @@ namespace hal
             }
         }
 
-        if (m_net_checks_enabled)
+        // a single pass per previous module instead of one search per gate keeps assigning many gates out of a large module linear
+        for (const auto& [prev_mod, num_gates] : prev_modules)
+        {
+            prev_mod->m_gates.erase(std::remove_if(prev_mod->m_gates.begin(), prev_mod->m_gates.end(), [prev_mod = prev_mod](const Gate* g) { return g->m_module != prev_mod; }),
+                                    prev_mod->m_gates.end());
+        }
+
+        for (u32 i = 0; i < gates.size(); i++)
+        {
+            m_event_handler->notify(ModuleEvent::event::gate_removed, gate_prev_modules[i], gates[i]->get_id());
+            m_event_handler->notify(ModuleEvent::event::gate_assigned, module, gates[i]->get_id());
+        }
+
+        if (m_bulk_edit_depth > 0)
+        {
+            for (const auto& [affected_module, nets] : nets_to_check)
+            {
+                for (Net* net : nets)
+                {
+                    bulk_edit_mark_net(net, affected_module);
+                }
+            }
+        }
+        else if (m_net_checks_enabled)
         {
             for (const auto& [affected_module, nets] : nets_to_check)
             {
@@ -1015,7 +1107,7 @@ namespace hal
             log_error("grouping", "ID 0 represents an invalid grouping ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_grouping_ids.find(id) != m_netlist->m_used_grouping_ids.end())
+        if (m_netlist->m_grouping_ids.is_used(id))
         {
             log_error("grouping", "grouping ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -1028,13 +1120,7 @@ namespace hal
 
         auto new_grouping = std::unique_ptr<Grouping>(new Grouping(this, m_event_handler, id, name));
 
-        auto free_id_it = m_netlist->m_free_grouping_ids.find(id);
-        if (free_id_it != m_netlist->m_free_grouping_ids.end())
-        {
-            m_netlist->m_free_grouping_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_grouping_ids.insert(id);
+        m_netlist->m_grouping_ids.reserve(id);
 
         auto raw = new_grouping.get();
 
@@ -1077,8 +1163,7 @@ namespace hal
         utils::unordered_vector_erase(m_netlist->m_groupings, grouping);
 
         // free ids
-        m_netlist->m_free_grouping_ids.insert(grouping->get_id());
-        m_netlist->m_used_grouping_ids.erase(grouping->get_id());
+        m_netlist->m_grouping_ids.release(grouping->get_id());
 
         // notify
         m_event_handler->notify(GroupingEvent::event::removed, grouping);
@@ -1296,12 +1381,233 @@ namespace hal
         return true;
     }
 
+    //######################################################################
+    //###                         bulk edits                             ###
+    //######################################################################
+
+    void NetlistInternalManager::begin_bulk_edit()
+    {
+        m_bulk_edit_depth++;
+        m_event_handler->begin_batch();
+    }
+
+    Result<std::monostate> NetlistInternalManager::end_bulk_edit()
+    {
+        if (m_bulk_edit_depth == 0)
+        {
+            return ERR("could not end bulk edit of netlist with ID " + std::to_string(m_netlist->m_netlist_id) + ": no bulk edit is in progress");
+        }
+
+        if (--m_bulk_edit_depth > 0)
+        {
+            m_event_handler->end_batch();
+            return OK({});
+        }
+
+        std::unordered_map<u32, PendingNetUpdate> pending_nets = std::move(m_bulk_edit_nets);
+        std::vector<u32> order                                 = std::move(m_bulk_edit_order);
+        m_bulk_edit_nets.clear();
+        m_bulk_edit_order.clear();
+
+        // reclassify all affected nets first, so that event handlers observe a consistent netlist
+        bool failed = false;
+        std::vector<std::pair<Net*, PendingNetUpdate*>> updates;
+        updates.reserve(pending_nets.size());
+        for (u32 net_id : order)
+        {
+            auto it = pending_nets.find(net_id);
+            if (it == pending_nets.end())
+            {
+                continue;
+            }
+
+            // deleted nets have already been flushed, so every remaining entry refers to a live net
+            Net* net = m_netlist->m_nets.get(net_id);
+            if (net == nullptr)
+            {
+                continue;
+            }
+
+            if (const auto res = bulk_edit_check_net(net, it->second); res.is_error())
+            {
+                log_error("net", "{}", res.get_error().get());
+                failed = true;
+            }
+            updates.push_back({net, &it->second});
+        }
+
+        for (auto& [net, update] : updates)
+        {
+            bulk_edit_send_events(net, *update);
+        }
+        m_event_handler->end_batch();
+
+        if (failed)
+        {
+            return ERR("could not end bulk edit of netlist with ID " + std::to_string(m_netlist->m_netlist_id) + ": failed to update module nets");
+        }
+
+        return OK({});
+    }
+
+    void NetlistInternalManager::bulk_edit_mark_net(Net* net, const Module* module)
+    {
+        if (!m_net_checks_enabled)
+        {
+            return;
+        }
+
+        auto [it, inserted] = m_bulk_edit_nets.try_emplace(net->get_id());
+        if (inserted)
+        {
+            m_bulk_edit_order.push_back(net->get_id());
+        }
+
+        // record the current parent modules as well, since the module may be moved or deleted before the bulk edit ends
+        it->second.needs_check = true;
+        for (; module != nullptr; module = module->get_parent_module())
+        {
+            it->second.module_ids.insert(module->get_id());
+        }
+    }
+
+    void NetlistInternalManager::bulk_edit_add_event(Net* net, NetEvent::event ev, u32 gate_id, const GatePin* pin)
+    {
+        auto [it, inserted] = m_bulk_edit_nets.try_emplace(net->get_id());
+        if (inserted)
+        {
+            m_bulk_edit_order.push_back(net->get_id());
+        }
+        PendingNetUpdate& update = it->second;
+
+        // an endpoint that is removed again before the bulk edit ends cancels out the event of its addition
+        const bool is_source = (ev == NetEvent::event::src_added || ev == NetEvent::event::src_removed);
+        const auto key       = std::make_tuple(gate_id, is_source, pin);
+        if (ev == NetEvent::event::src_removed || ev == NetEvent::event::dst_removed)
+        {
+            if (auto add_it = update.pending_additions.find(key); add_it != update.pending_additions.end() && !add_it->second.empty())
+            {
+                update.events[add_it->second.back()].cancelled = true;
+                add_it->second.pop_back();
+                return;
+            }
+        }
+        else
+        {
+            update.pending_additions[key].push_back(update.events.size());
+        }
+
+        update.events.push_back({ev, gate_id, false});
+    }
+
+    Result<std::monostate> NetlistInternalManager::bulk_edit_check_net(Net* net, PendingNetUpdate& update)
+    {
+        if (!update.needs_check || !m_net_checks_enabled)
+        {
+            return OK({});
+        }
+        update.needs_check = false;
+
+        // collect all modules that contained an endpoint of the net or contain one now, including their parent modules
+        std::vector<Module*> modules;
+        std::unordered_set<Module*> visited;
+        auto add_module = [&modules, &visited](Module* module) {
+            while (module != nullptr && visited.insert(module).second)
+            {
+                modules.push_back(module);
+                module = module->get_parent_module();
+            }
+        };
+
+        for (u32 module_id : update.module_ids)
+        {
+            if (auto it = m_netlist->m_modules_map.find(module_id); it != m_netlist->m_modules_map.end())
+            {
+                add_module(it->second.get());
+            }
+        }
+        for (const Endpoint* ep : net->m_sources_raw)
+        {
+            add_module(ep->get_gate()->get_module());
+        }
+        for (const Endpoint* ep : net->m_destinations_raw)
+        {
+            add_module(ep->get_gate()->get_module());
+        }
+
+        for (Module* module : modules)
+        {
+            if (const auto res = module->check_net(net, false); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(),
+                                  "could not update net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " in module '" + module->get_name() + "' with ID "
+                                      + std::to_string(module->get_id()));
+            }
+        }
+
+        return OK({});
+    }
+
+    void NetlistInternalManager::bulk_edit_send_events(Net* net, PendingNetUpdate& update)
+    {
+        for (const auto& event : update.events)
+        {
+            if (!event.cancelled)
+            {
+                m_event_handler->notify(event.event, net, event.gate_id);
+            }
+        }
+        update.events.clear();
+        update.pending_additions.clear();
+    }
+
+    void NetlistInternalManager::bulk_edit_flush_net(Net* net)
+    {
+        auto it = m_bulk_edit_nets.find(net->get_id());
+        if (it == m_bulk_edit_nets.end())
+        {
+            return;
+        }
+
+        if (const auto res = bulk_edit_check_net(net, it->second); res.is_error())
+        {
+            log_error("net", "{}", res.get_error().get());
+        }
+        bulk_edit_send_events(net, it->second);
+        m_bulk_edit_nets.erase(it);
+    }
+
+    //######################################################################
+    //###                      deferred loading                          ###
+    //######################################################################
+
+    void NetlistInternalManager::load_deferred_modules() const
+    {
+        m_netlist->load_deferred_modules();
+    }
+
+    void NetlistInternalManager::load_deferred_groupings() const
+    {
+        m_netlist->load_deferred_groupings();
+    }
+
+    void NetlistInternalManager::load_deferred_data(const DataContainer* container) const
+    {
+        m_netlist->load_deferred_data(container);
+    }
+
+    void NetlistInternalManager::notify_data_changed(const DataContainer* container)
+    {
+        m_netlist->notify_data_changed(container);
+    }
+
     //######################################################################
     //###                           caches                               ###
     //######################################################################
 
     void NetlistInternalManager::clear_caches()
     {
+        std::unique_lock lock(m_lut_function_cache_mutex);
         m_lut_function_cache.clear();
     }
 }    // namespace hal
@@ -0,0 +1,205 @@
+#include "hal_core/netlist/netlist_snapshot.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/parallel.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace hal
+{
+    namespace
+    {
+        // number of objects handed out to a worker at once
+        constexpr u32 CHUNK_SIZE = 1024;
+
+        // turns per-object connection counts into CSR offsets, returns the total number of connections
+        u32 to_offsets(std::vector<u32>& offsets)
+        {
+            u32 sum = 0;
+            for (auto& o : offsets)
+            {
+                const u32 count = o;
+                o               = sum;
+                sum += count;
+            }
+            offsets.push_back(sum);
+            return sum;
+        }
+    }    // namespace
+
+    NetlistSnapshot::NetlistSnapshot(const Netlist& netlist, u32 num_workers) : m_netlist(&netlist)
+    {
+        const auto by_id = [](const auto* a, const auto* b) { return a->get_id() < b->get_id(); };
+
+        m_gates = netlist.get_gates();
+        m_nets  = netlist.get_nets();
+        std::sort(m_gates.begin(), m_gates.end(), by_id);
+        std::sort(m_nets.begin(), m_nets.end(), by_id);
+
+        const u32 num_gates = m_gates.size();
+        const u32 num_nets  = m_nets.size();
+
+        m_gate_indices.assign(m_gates.empty() ? 0 : m_gates.back()->get_id() + 1, INVALID_INDEX);
+        m_net_indices.assign(m_nets.empty() ? 0 : m_nets.back()->get_id() + 1, INVALID_INDEX);
+
+        // count connections and collect gate type properties, which are computed only once per gate type
+        std::unordered_map<const GateType*, u64> type_properties;
+        m_gate_properties.resize(num_gates);
+        m_fan_in_offsets.resize(num_gates);
+        m_fan_out_offsets.resize(num_gates);
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            const Gate* gate               = m_gates[i];
+            m_gate_indices[gate->get_id()] = i;
+            m_fan_in_offsets[i]            = gate->get_fan_in_endpoints().size();
+            m_fan_out_offsets[i]           = gate->get_fan_out_endpoints().size();
+
+            const GateType* type = gate->get_type();
+            auto it              = type_properties.find(type);
+            if (it == type_properties.end())
+            {
+                u64 mask = 0;
+                for (const auto property : type->get_property_list())
+                {
+                    mask |= u64(1) << static_cast<u32>(property);
+                }
+                it = type_properties.emplace(type, mask).first;
+            }
+            m_gate_properties[i] = it->second;
+        }
+
+        m_source_offsets.resize(num_nets);
+        m_destination_offsets.resize(num_nets);
+        for (u32 i = 0; i < num_nets; i++)
+        {
+            const Net* net               = m_nets[i];
+            m_net_indices[net->get_id()] = i;
+            m_source_offsets[i]          = net->m_sources_raw.size();
+            m_destination_offsets[i]     = net->m_destinations_raw.size();
+        }
+
+        m_fan_in.resize(to_offsets(m_fan_in_offsets));
+        m_fan_out.resize(to_offsets(m_fan_out_offsets));
+        m_sources.resize(to_offsets(m_source_offsets));
+        m_destinations.resize(to_offsets(m_destination_offsets));
+
+        // every object writes to its own slice of the connection arrays, hence objects can be processed concurrently
+        utils::run_in_chunks(num_workers, num_gates, CHUNK_SIZE, [this](u32 i) {
+            const Gate* gate = m_gates[i];
+
+            Connection* out = &m_fan_in[m_fan_in_offsets[i]];
+            for (const Endpoint* ep : gate->get_fan_in_endpoints())
+            {
+                const GatePin* pin = ep->get_pin();
+                *out++             = {m_net_indices[ep->get_net()->get_id()], pin->get_type(), pin};
+            }
+
+            out = &m_fan_out[m_fan_out_offsets[i]];
+            for (const Endpoint* ep : gate->get_fan_out_endpoints())
+            {
+                const GatePin* pin = ep->get_pin();
+                *out++             = {m_net_indices[ep->get_net()->get_id()], pin->get_type(), pin};
+            }
+        });
+
+        utils::run_in_chunks(num_workers, num_nets, CHUNK_SIZE, [this](u32 i) {
+            const Net* net = m_nets[i];
+
+            Connection* out = &m_sources[m_source_offsets[i]];
+            for (const Endpoint* ep : net->m_sources_raw)
+            {
+                const GatePin* pin = ep->get_pin();
+                *out++             = {m_gate_indices[ep->get_gate()->get_id()], pin->get_type(), pin};
+            }
+
+            out = &m_destinations[m_destination_offsets[i]];
+            for (const Endpoint* ep : net->m_destinations_raw)
+            {
+                const GatePin* pin = ep->get_pin();
+                *out++             = {m_gate_indices[ep->get_gate()->get_id()], pin->get_type(), pin};
+            }
+        });
+    }
+
+    const Netlist& NetlistSnapshot::get_netlist() const
+    {
+        return *m_netlist;
+    }
+
+    u32 NetlistSnapshot::get_num_gates() const
+    {
+        return m_gates.size();
+    }
+
+    u32 NetlistSnapshot::get_num_nets() const
+    {
+        return m_nets.size();
+    }
+
+    Gate* NetlistSnapshot::get_gate(u32 gate_index) const
+    {
+        return m_gates[gate_index];
+    }
+
+    Net* NetlistSnapshot::get_net(u32 net_index) const
+    {
+        return m_nets[net_index];
+    }
+
+    u32 NetlistSnapshot::get_gate_index(const Gate* gate) const
+    {
+        if (gate == nullptr || gate->get_id() >= m_gate_indices.size())
+        {
+            return INVALID_INDEX;
+        }
+
+        const u32 index = m_gate_indices[gate->get_id()];
+        return (index != INVALID_INDEX && m_gates[index] == gate) ? index : INVALID_INDEX;
+    }
+
+    u32 NetlistSnapshot::get_net_index(const Net* net) const
+    {
+        if (net == nullptr || net->get_id() >= m_net_indices.size())
+        {
+            return INVALID_INDEX;
+        }
+
+        const u32 index = m_net_indices[net->get_id()];
+        return (index != INVALID_INDEX && m_nets[index] == net) ? index : INVALID_INDEX;
+    }
+
+    u64 NetlistSnapshot::get_gate_properties(u32 gate_index) const
+    {
+        return m_gate_properties[gate_index];
+    }
+
+    bool NetlistSnapshot::has_gate_property(u32 gate_index, GateTypeProperty property) const
+    {
+        return (m_gate_properties[gate_index] >> static_cast<u32>(property)) & 1;
+    }
+
+    NetlistSnapshot::ConnectionRange NetlistSnapshot::get_fan_in(u32 gate_index) const
+    {
+        return ConnectionRange(m_fan_in.data() + m_fan_in_offsets[gate_index], m_fan_in.data() + m_fan_in_offsets[gate_index + 1]);
+    }
+
+    NetlistSnapshot::ConnectionRange NetlistSnapshot::get_fan_out(u32 gate_index) const
+    {
+        return ConnectionRange(m_fan_out.data() + m_fan_out_offsets[gate_index], m_fan_out.data() + m_fan_out_offsets[gate_index + 1]);
+    }
+
+    NetlistSnapshot::ConnectionRange NetlistSnapshot::get_sources(u32 net_index) const
+    {
+        return ConnectionRange(m_sources.data() + m_source_offsets[net_index], m_sources.data() + m_source_offsets[net_index + 1]);
+    }
+
+    NetlistSnapshot::ConnectionRange NetlistSnapshot::get_destinations(u32 net_index) const
+    {
+        return ConnectionRange(m_destinations.data() + m_destination_offsets[net_index], m_destinations.data() + m_destination_offsets[net_index + 1]);
+    }
+}    // namespace hal
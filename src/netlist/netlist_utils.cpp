@@ -186,7 +186,7 @@ namespace hal
                         }
                         nets_handled.insert(n);
 
-                        for (const Endpoint* ep : get_successors ? n->get_destinations() : n->get_sources())
+                        for (const Endpoint* ep : get_successors ? n->get_destinations_view() : n->get_sources_view())
                         {
                             Gate* g1 = ep->get_gate();
                             if (gats_handled.find(g1) != gats_handled.end())
@@ -218,7 +218,7 @@ namespace hal
             std::vector<const Gate*> v0;
             std::unordered_set<const Gate*> gates_handled;
             std::unordered_set<const Net*> nets_handled;
-            for (const Endpoint* ep : (get_successors ? net->get_destinations() : net->get_sources()))
+            for (const Endpoint* ep : (get_successors ? net->get_destinations_view() : net->get_sources_view()))
             {
                 Gate* g = ep->get_gate();
                 if (!filter || filter(g))
@@ -243,7 +243,7 @@ namespace hal
                         }
                         nets_handled.insert(n);
 
-                        for (const Endpoint* ep : get_successors ? n->get_destinations() : n->get_sources())
+                        for (const Endpoint* ep : get_successors ? n->get_destinations_view() : n->get_sources_view())
                         {
                             Gate* g1 = ep->get_gate();
                             if (gates_handled.find(g1) != gates_handled.end())
@@ -295,7 +295,7 @@ namespace hal
 
                 std::vector<Gate*> found_ffs;
 
-                for (auto endpoint : forward ? start_net->get_destinations() : start_net->get_sources())
+                for (auto endpoint : forward ? start_net->get_destinations_view() : start_net->get_sources_view())
                 {
                     auto next_gate = endpoint->get_gate();
 
@@ -373,7 +373,7 @@ namespace hal
 
                 std::vector<Gate*> found_combinational;
 
-                for (auto endpoint : forward ? start_net->get_destinations() : start_net->get_sources())
+                for (auto endpoint : forward ? start_net->get_destinations_view() : start_net->get_sources_view())
                 {
                     auto next_gate = endpoint->get_gate();
 
@@ -733,7 +733,7 @@ namespace hal
             std::map<Net*, u32> net_count;
             for (Gate* g : gates)
             {
-                for (Endpoint* pred : g->get_predecessors())
+                for (Endpoint* pred : g->get_predecessors_view())
                 {
                     if (pred->get_gate()->is_gnd_gate() || pred->get_gate()->is_vcc_gate())
                     {
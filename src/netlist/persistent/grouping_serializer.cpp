@@ -73,17 +73,30 @@ namespace hal {
         std::filesystem::path groupingFilePath(loaddir);
         groupingFilePath.append(relname);
 
+        // in lazy mode the groupings are read once they are accessed for the first time
+        if (ProjectManager::instance()->get_netlist_read_options().lazy)
+        {
+            netlist->defer_groupings([groupingFilePath](Netlist* nl) { return deserialize_groupings(nl, groupingFilePath); });
+            return;
+        }
+
+        deserialize_groupings(netlist, groupingFilePath);
+    }
+
+    bool GroupingSerializer::deserialize_groupings(Netlist* netlist, const std::filesystem::path& groupingFilePath)
+    {
         FILE* grpFile = fopen(groupingFilePath.string().c_str(), "rb");
         if (grpFile == NULL)
         {
             log_error("GroupingSerializer::deserialize", "unable to open '{}'.", groupingFilePath.string());
-            return;
+            return false;
         }
 
         char buffer[65536];
         rapidjson::FileReadStream frs(grpFile, buffer, sizeof(buffer));
         rapidjson::Document document;
         document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(frs);
+        fclose(grpFile);
 
         if (document.HasMember("groupings"))
         {
@@ -92,7 +105,7 @@ namespace hal {
                 Grouping* grouping = netlist->create_grouping(grpVal["id"].GetUint(), grpVal["name"].GetString());
                 if (grouping == nullptr)
                 {
-                    return;
+                    return false;
                 }
 
                 if (grpVal.HasMember("modules"))
@@ -120,5 +133,6 @@ namespace hal {
                 }
             }
         }
+        return true;
     }
 }
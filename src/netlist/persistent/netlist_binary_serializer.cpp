@@ -0,0 +1,1259 @@
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/project_manager.h"
+#include "hal_core/utilities/enums.h"
+#include "hal_core/utilities/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <optional>
+#include <queue>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+
+#ifndef DURATION
+#define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
+#endif
+
+namespace hal
+{
+    namespace netlist_binary_serializer
+    {
+        namespace
+        {
+            // PNG-style signature that breaks on text-mode line ending conversion and never starts a JSON document
+            constexpr char MAGIC[8]           = {'\x89', 'H', 'A', 'L', '\r', '\n', '\x1a', '\n'};
+            constexpr u32 BYTE_ORDER_MARK     = 0x01020304;
+            constexpr u32 SECTION_ALIGNMENT   = 8;
+            constexpr u32 GATE_IS_GND         = 1 << 0;
+            constexpr u32 GATE_IS_VCC         = 1 << 1;
+            constexpr u32 NET_IS_GLOBAL_IN    = 1 << 0;
+            constexpr u32 NET_IS_GLOBAL_OUT   = 1 << 1;
+            constexpr u32 PIN_GROUP_ASCENDING = 1 << 0;
+            constexpr u32 PIN_GROUP_ORDERED   = 1 << 1;
+
+            /*
+             * All records are fixed-width, contain no pointers, and refer to strings by their index within the string table.
+             * Records referring to a run of records within another section store the index of the first record and the number of records.
+             */
+
+            enum Section : u32
+            {
+                STRINGS,
+                CHARACTERS,
+                GATES,
+                NETS,
+                ENDPOINTS,
+                DATA,
+                FUNCTIONS,
+                NODES,
+                MODULES,
+                MODULE_GATES,
+                PIN_GROUPS,
+                PINS,
+                NUM_SECTIONS
+            };
+
+            struct SectionRecord
+            {
+                u64 offset;
+                u64 count;
+            };
+
+            struct FileHeader
+            {
+                char magic[8];
+                u32 version;
+                u32 byte_order;
+                u32 netlist_id;
+                u32 gate_library;
+                u32 input_file;
+                u32 design_name;
+                u32 device_name;
+                u32 reserved;
+                SectionRecord sections[NUM_SECTIONS];
+            };
+
+            struct StringRecord
+            {
+                u64 offset;
+                u64 length;
+            };
+
+            struct GateRecord
+            {
+                u32 id;
+                u32 name;
+                u32 type;
+                u32 flags;
+                i32 location_x;
+                i32 location_y;
+                u32 data_count;
+                u32 function_count;
+                u64 data_begin;
+                u64 function_begin;
+            };
+
+            struct NetRecord
+            {
+                u32 id;
+                u32 name;
+                u32 flags;
+                u32 source_count;
+                u32 destination_count;
+                u32 data_count;
+                u64 endpoint_begin;
+                u64 data_begin;
+            };
+
+            struct EndpointRecord
+            {
+                u32 gate_id;
+                u32 pin_id;
+            };
+
+            struct DataRecord
+            {
+                u32 category;
+                u32 key;
+                u32 type;
+                u32 value;
+            };
+
+            struct FunctionRecord
+            {
+                u32 name;
+                u32 node_count;
+                u64 node_begin;
+            };
+
+            // identical to BooleanFunction::Node, except for variables and wide constants that refer to the string table
+            struct NodeRecord
+            {
+                u16 type;
+                u16 size;
+                u32 data;
+            };
+
+            struct ModuleRecord
+            {
+                u32 id;
+                u32 parent_id;
+                u32 name;
+                u32 type;
+                u32 gate_count;
+                u32 pin_group_count;
+                u32 data_count;
+                u32 reserved;
+                u64 gate_begin;
+                u64 pin_group_begin;
+                u64 data_begin;
+            };
+
+            struct PinGroupRecord
+            {
+                u32 id;
+                u32 name;
+                u32 direction;
+                u32 type;
+                u32 start_index;
+                u32 flags;
+                u32 pin_count;
+                u32 reserved;
+                u64 pin_begin;
+            };
+
+            struct PinRecord
+            {
+                u32 id;
+                u32 name;
+                u32 type;
+                u32 net_id;
+            };
+
+            static_assert(sizeof(FileHeader) % SECTION_ALIGNMENT == 0);
+            static_assert(sizeof(NodeRecord) == sizeof(BooleanFunction::Node));
+
+            constexpr u64 RECORD_SIZES[NUM_SECTIONS] = {sizeof(StringRecord),
+                                                        sizeof(char),
+                                                        sizeof(GateRecord),
+                                                        sizeof(NetRecord),
+                                                        sizeof(EndpointRecord),
+                                                        sizeof(DataRecord),
+                                                        sizeof(FunctionRecord),
+                                                        sizeof(NodeRecord),
+                                                        sizeof(ModuleRecord),
+                                                        sizeof(u32),
+                                                        sizeof(PinGroupRecord),
+                                                        sizeof(PinRecord)};
+
+            char encode_value(BooleanFunction::Value value)
+            {
+                switch (value)
+                {
+                    case BooleanFunction::Value::ZERO:
+                        return '0';
+                    case BooleanFunction::Value::ONE:
+                        return '1';
+                    case BooleanFunction::Value::Z:
+                        return 'Z';
+                    default:
+                        return 'X';
+                }
+            }
+
+            BooleanFunction::Value decode_value(char c)
+            {
+                switch (c)
+                {
+                    case '0':
+                        return BooleanFunction::Value::ZERO;
+                    case '1':
+                        return BooleanFunction::Value::ONE;
+                    case 'Z':
+                        return BooleanFunction::Value::Z;
+                    default:
+                        return BooleanFunction::Value::X;
+                }
+            }
+
+            /**
+             * Collects the records of all sections in memory before they are written to the file.
+             */
+            class Writer
+            {
+            public:
+                Writer()
+                {
+                    // index 0 always refers to the empty string
+                    add_string("");
+                }
+
+                u32 add_string(const std::string& str)
+                {
+                    const auto [it, added] = m_string_indices.try_emplace(str, (u32)m_strings.size());
+                    if (added)
+                    {
+                        m_strings.push_back({m_characters.size(), str.size()});
+                        m_characters.append(str);
+                    }
+                    return it->second;
+                }
+
+                u32 add_data(const DataContainer* container, u64& data_begin)
+                {
+                    data_begin = m_data.size();
+                    for (const auto& [category_key, type_value] : container->get_data_map())
+                    {
+                        m_data.push_back(
+                            {add_string(std::get<0>(category_key)), add_string(std::get<1>(category_key)), add_string(std::get<0>(type_value)), add_string(std::get<1>(type_value))});
+                    }
+                    return m_data.size() - data_begin;
+                }
+
+                void add_gate(const Netlist* nl, const Gate* gate)
+                {
+                    GateRecord record{};
+                    record.id         = gate->get_id();
+                    record.name       = add_string(gate->get_name());
+                    record.type       = add_string(gate->get_type()->get_name());
+                    record.flags      = (nl->is_gnd_gate(gate) ? GATE_IS_GND : 0) | (nl->is_vcc_gate(gate) ? GATE_IS_VCC : 0);
+                    record.location_x = gate->get_location_x();
+                    record.location_y = gate->get_location_y();
+                    record.data_count = add_data(gate, record.data_begin);
+
+                    // sort the functions by name to obtain a deterministic file
+                    const auto functions = gate->get_boolean_functions(true);
+                    std::vector<const std::pair<const std::string, BooleanFunction>*> sorted;
+                    sorted.reserve(functions.size());
+                    for (const auto& entry : functions)
+                    {
+                        sorted.push_back(&entry);
+                    }
+                    std::sort(sorted.begin(), sorted.end(), [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+                    record.function_begin = m_functions.size();
+                    for (const auto* entry : sorted)
+                    {
+                        const auto& nodes = entry->second.get_nodes();
+                        m_functions.push_back({add_string(entry->first), (u32)nodes.size(), m_nodes.size()});
+                        for (const BooleanFunction::Node& node : nodes)
+                        {
+                            NodeRecord node_record{node.type, node.size, node.data};
+                            if (node.is_variable())
+                            {
+                                node_record.data = add_string(node.variable());
+                            }
+                            else if (node.is_constant() && node.size > BooleanFunction::Node::MAX_PACKED_CONSTANT_SIZE)
+                            {
+                                std::string value;
+                                for (const BooleanFunction::Value v : node.constant())
+                                {
+                                    value.push_back(encode_value(v));
+                                }
+                                node_record.data = add_string(value);
+                            }
+                            m_nodes.push_back(node_record);
+                        }
+                    }
+                    record.function_count = m_functions.size() - record.function_begin;
+
+                    m_gates.push_back(record);
+                }
+
+                void add_net(const Netlist* nl, const Net* net)
+                {
+                    NetRecord record{};
+                    record.id    = net->get_id();
+                    record.name  = add_string(net->get_name());
+                    record.flags = (nl->is_global_input_net(net) ? NET_IS_GLOBAL_IN : 0) | (nl->is_global_output_net(net) ? NET_IS_GLOBAL_OUT : 0);
+
+                    const auto add_endpoints = [this](std::vector<Endpoint*> endpoints) {
+                        std::sort(endpoints.begin(), endpoints.end(), [](const Endpoint* lhs, const Endpoint* rhs) {
+                            return std::make_pair(lhs->get_gate()->get_id(), lhs->get_pin()->get_id()) < std::make_pair(rhs->get_gate()->get_id(), rhs->get_pin()->get_id());
+                        });
+                        for (const Endpoint* ep : endpoints)
+                        {
+                            m_endpoints.push_back({ep->get_gate()->get_id(), ep->get_pin()->get_id()});
+                        }
+                        return (u32)endpoints.size();
+                    };
+                    record.endpoint_begin    = m_endpoints.size();
+                    record.source_count      = add_endpoints(net->get_sources());
+                    record.destination_count = add_endpoints(net->get_destinations());
+                    record.data_count        = add_data(net, record.data_begin);
+
+                    m_nets.push_back(record);
+                }
+
+                void add_module(const Module* module)
+                {
+                    ModuleRecord record{};
+                    record.id        = module->get_id();
+                    record.parent_id = (module->get_parent_module() != nullptr) ? module->get_parent_module()->get_id() : 0;
+                    record.name      = add_string(module->get_name());
+                    record.type      = add_string(module->get_type());
+
+                    std::vector<Gate*> gates = module->get_gates(nullptr, false);
+                    std::sort(gates.begin(), gates.end(), [](const Gate* lhs, const Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    record.gate_begin = m_module_gates.size();
+                    record.gate_count = gates.size();
+                    for (const Gate* gate : gates)
+                    {
+                        m_module_gates.push_back(gate->get_id());
+                    }
+
+                    record.pin_group_begin = m_pin_groups.size();
+                    for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+                    {
+                        PinGroupRecord pin_group_record{};
+                        pin_group_record.id          = pin_group->get_id();
+                        pin_group_record.name        = add_string(pin_group->get_name());
+                        pin_group_record.direction   = add_string(enum_to_string(pin_group->get_direction()));
+                        pin_group_record.type        = add_string(enum_to_string(pin_group->get_type()));
+                        pin_group_record.start_index = pin_group->get_start_index();
+                        pin_group_record.flags       = (pin_group->is_ascending() ? PIN_GROUP_ASCENDING : 0) | (pin_group->is_ordered() ? PIN_GROUP_ORDERED : 0);
+                        pin_group_record.pin_begin   = m_pins.size();
+                        for (const ModulePin* pin : pin_group->get_pins())
+                        {
+                            m_pins.push_back({pin->get_id(), add_string(pin->get_name()), add_string(enum_to_string(pin->get_type())), pin->get_net()->get_id()});
+                        }
+                        pin_group_record.pin_count = m_pins.size() - pin_group_record.pin_begin;
+                        m_pin_groups.push_back(pin_group_record);
+                    }
+                    record.pin_group_count = m_pin_groups.size() - record.pin_group_begin;
+                    record.data_count      = add_data(module, record.data_begin);
+
+                    m_modules.push_back(record);
+                }
+
+                bool write(std::ofstream& stream, FileHeader& header) const
+                {
+                    const std::pair<const char*, u64> sections[NUM_SECTIONS] = {{(const char*)m_strings.data(), m_strings.size()},
+                                                                                {m_characters.data(), m_characters.size()},
+                                                                                {(const char*)m_gates.data(), m_gates.size()},
+                                                                                {(const char*)m_nets.data(), m_nets.size()},
+                                                                                {(const char*)m_endpoints.data(), m_endpoints.size()},
+                                                                                {(const char*)m_data.data(), m_data.size()},
+                                                                                {(const char*)m_functions.data(), m_functions.size()},
+                                                                                {(const char*)m_nodes.data(), m_nodes.size()},
+                                                                                {(const char*)m_modules.data(), m_modules.size()},
+                                                                                {(const char*)m_module_gates.data(), m_module_gates.size()},
+                                                                                {(const char*)m_pin_groups.data(), m_pin_groups.size()},
+                                                                                {(const char*)m_pins.data(), m_pins.size()}};
+
+                    // every section starts at an aligned offset so that its records can be accessed in place once the file is mapped
+                    u64 offset = sizeof(FileHeader);
+                    for (u32 s = 0; s < NUM_SECTIONS; s++)
+                    {
+                        offset             = (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+                        header.sections[s] = {offset, sections[s].second};
+                        offset += sections[s].second * RECORD_SIZES[s];
+                    }
+
+                    stream.write((const char*)&header, sizeof(FileHeader));
+                    u64 written = sizeof(FileHeader);
+                    for (u32 s = 0; s < NUM_SECTIONS; s++)
+                    {
+                        static const char padding[SECTION_ALIGNMENT] = {};
+                        stream.write(padding, header.sections[s].offset - written);
+                        stream.write(sections[s].first, sections[s].second * RECORD_SIZES[s]);
+                        written = header.sections[s].offset + sections[s].second * RECORD_SIZES[s];
+                    }
+                    return !stream.fail();
+                }
+
+            private:
+                std::unordered_map<std::string, u32> m_string_indices;
+                std::vector<StringRecord> m_strings;
+                std::string m_characters;
+                std::vector<GateRecord> m_gates;
+                std::vector<NetRecord> m_nets;
+                std::vector<EndpointRecord> m_endpoints;
+                std::vector<DataRecord> m_data;
+                std::vector<FunctionRecord> m_functions;
+                std::vector<NodeRecord> m_nodes;
+                std::vector<ModuleRecord> m_modules;
+                std::vector<u32> m_module_gates;
+                std::vector<PinGroupRecord> m_pin_groups;
+                std::vector<PinRecord> m_pins;
+            };
+
+            /**
+             * Read-only memory mapping of a file that is unmapped on destruction.
+             */
+            class MappedFile
+            {
+            public:
+                MappedFile() = default;
+
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+
+                ~MappedFile()
+                {
+                    if (m_data != nullptr)
+                    {
+                        munmap(m_data, m_size);
+                    }
+                }
+
+                bool open(const std::filesystem::path& file)
+                {
+                    const int fd = ::open(file.c_str(), O_RDONLY);
+                    if (fd < 0)
+                    {
+                        return false;
+                    }
+
+                    struct stat file_stat;
+                    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+                    {
+                        close(fd);
+                        return false;
+                    }
+                    m_size = file_stat.st_size;
+
+                    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    close(fd);
+                    if (data == MAP_FAILED)
+                    {
+                        return false;
+                    }
+                    m_data = data;
+
+                    // the records are instantiated front to back
+                    madvise(m_data, m_size, MADV_SEQUENTIAL);
+                    return true;
+                }
+
+                const u8* data() const
+                {
+                    return (const u8*)m_data;
+                }
+
+                u64 size() const
+                {
+                    return m_size;
+                }
+
+            private:
+                void* m_data = nullptr;
+                u64 m_size   = 0;
+            };
+
+            /**
+             * Provides bounds-checked access to the records of a mapped file.
+             */
+            class Reader
+            {
+            public:
+                Reader(const u8* data, u64 size) : m_data(data), m_size(size)
+                {
+                }
+
+                bool validate()
+                {
+                    if (m_size < sizeof(FileHeader))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: file is too small to be a binary netlist");
+                        return false;
+                    }
+                    std::memcpy(&m_header, m_data, sizeof(FileHeader));
+
+                    if (std::memcmp(m_header.magic, MAGIC, sizeof(MAGIC)) != 0)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: file is not a binary netlist");
+                        return false;
+                    }
+                    if (m_header.byte_order != BYTE_ORDER_MARK)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: file has been written on a machine with different byte order");
+                        return false;
+                    }
+                    if (m_header.version != FORMAT_VERSION)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: unsupported binary format version {} (expected version {})", m_header.version, FORMAT_VERSION);
+                        return false;
+                    }
+
+                    for (u32 s = 0; s < NUM_SECTIONS; s++)
+                    {
+                        const SectionRecord& section = m_header.sections[s];
+                        if (section.offset % SECTION_ALIGNMENT != 0 || section.offset > m_size || section.count > (m_size - section.offset) / RECORD_SIZES[s])
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: file is truncated or corrupted");
+                            return false;
+                        }
+                    }
+
+                    // validate all strings once so that string accesses need no further checks
+                    for (const StringRecord& str : records<StringRecord>(STRINGS))
+                    {
+                        if (str.offset > m_header.sections[CHARACTERS].count || str.length > m_header.sections[CHARACTERS].count - str.offset)
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: string table is corrupted");
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                const FileHeader& header() const
+                {
+                    return m_header;
+                }
+
+                template<typename T>
+                struct Range
+                {
+                    const T* first;
+                    const T* last;
+
+                    const T* begin() const
+                    {
+                        return first;
+                    }
+
+                    const T* end() const
+                    {
+                        return last;
+                    }
+                };
+
+                template<typename T>
+                Range<T> records(Section section) const
+                {
+                    const T* first = (const T*)(m_data + m_header.sections[section].offset);
+                    return {first, first + m_header.sections[section].count};
+                }
+
+                template<typename T>
+                bool records(Section section, u64 begin, u64 count, Range<T>& range) const
+                {
+                    if (begin > m_header.sections[section].count || count > m_header.sections[section].count - begin)
+                    {
+                        return false;
+                    }
+                    range = records<T>(section);
+                    range = {range.first + begin, range.first + begin + count};
+                    return true;
+                }
+
+                bool has_string(u32 index) const
+                {
+                    return index < m_header.sections[STRINGS].count;
+                }
+
+                std::string string(u32 index) const
+                {
+                    if (!has_string(index))
+                    {
+                        return "";
+                    }
+                    const StringRecord& str = records<StringRecord>(STRINGS).first[index];
+                    return std::string((const char*)m_data + m_header.sections[CHARACTERS].offset + str.offset, str.length);
+                }
+
+            private:
+                const u8* m_data;
+                u64 m_size;
+                FileHeader m_header;
+            };
+
+            bool check_strings(const Reader& reader, std::initializer_list<u32> indices)
+            {
+                return std::all_of(indices.begin(), indices.end(), [&reader](u32 index) { return reader.has_string(index); });
+            }
+
+            bool deserialize_data(const Reader& reader, DataContainer* container, u64 begin, u32 count)
+            {
+                Reader::Range<DataRecord> data;
+                if (!reader.records(DATA, begin, count, data))
+                {
+                    return false;
+                }
+                for (const DataRecord& entry : data)
+                {
+                    if (!check_strings(reader, {entry.category, entry.key, entry.type, entry.value}))
+                    {
+                        return false;
+                    }
+                    container->set_data(reader.string(entry.category), reader.string(entry.key), reader.string(entry.type), reader.string(entry.value));
+                }
+                return true;
+            }
+
+            Result<BooleanFunction> deserialize_function(const Reader& reader, const FunctionRecord& function)
+            {
+                Reader::Range<NodeRecord> node_records;
+                if (!reader.records(NODES, function.node_begin, function.node_count, node_records))
+                {
+                    return ERR("node range is out of bounds");
+                }
+
+                std::vector<BooleanFunction::Node> nodes;
+                nodes.reserve(function.node_count);
+                for (const NodeRecord& record : node_records)
+                {
+                    const bool is_variable      = record.type == BooleanFunction::NodeType::Variable;
+                    const bool is_wide_constant = record.type == BooleanFunction::NodeType::Constant && record.size > BooleanFunction::Node::MAX_PACKED_CONSTANT_SIZE;
+                    if ((is_variable || is_wide_constant) && !reader.has_string(record.data))
+                    {
+                        return ERR("string index " + std::to_string(record.data) + " is out of bounds");
+                    }
+
+                    if (is_variable)
+                    {
+                        nodes.push_back(BooleanFunction::Node::Variable(reader.string(record.data), record.size));
+                    }
+                    else if (is_wide_constant)
+                    {
+                        const std::string encoded = reader.string(record.data);
+                        if (encoded.size() != record.size)
+                        {
+                            return ERR("constant of size " + std::to_string(encoded.size()) + " does not match node size " + std::to_string(record.size));
+                        }
+                        std::vector<BooleanFunction::Value> value;
+                        value.reserve(encoded.size());
+                        for (const char c : encoded)
+                        {
+                            value.push_back(decode_value(c));
+                        }
+                        nodes.push_back(BooleanFunction::Node::Constant(value));
+                    }
+                    else
+                    {
+                        // operations, indices, and packed constants are position independent and copied as they are
+                        BooleanFunction::Node node = BooleanFunction::Node::Operation(record.type, record.size);
+                        node.data                  = record.data;
+                        nodes.push_back(node);
+                    }
+                }
+
+                // validation is linear in the number of nodes and rejects corrupted node arrays
+                return BooleanFunction::build(std::move(nodes));
+            }
+
+            bool deserialize_gate(const Reader& reader, Netlist* nl, const GateRecord& record, std::vector<GateType*>& gate_types, std::vector<DataContainer*>* deferred_data)
+            {
+                if (!check_strings(reader, {record.name, record.type}))
+                {
+                    log_error("netlist_persistent", "could not deserialize gate with ID {}: string index is out of bounds", record.id);
+                    return false;
+                }
+                const std::string gate_name = reader.string(record.name);
+
+                // resolve every gate type name only once
+                if (gate_types.empty())
+                {
+                    gate_types.resize(reader.header().sections[STRINGS].count, nullptr);
+                }
+                GateType*& gate_type = gate_types[record.type];
+                if (gate_type == nullptr)
+                {
+                    gate_type = nl->get_gate_library()->get_gate_type_by_name(reader.string(record.type));
+                    if (gate_type == nullptr)
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(record.id) + ": failed to find gate '" + reader.string(record.type)
+                                      + "' in gate library '" + nl->get_gate_library()->get_name() + "'");
+                        return false;
+                    }
+                }
+
+                Gate* gate = nl->create_gate(record.id, gate_type, gate_name, record.location_x, record.location_y);
+                if (gate == nullptr)
+                {
+                    log_error("netlist_persistent", "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(record.id) + ": failed to create gate");
+                    return false;
+                }
+
+                if (deferred_data != nullptr && record.data_count > 0)
+                {
+                    deferred_data->push_back(gate);
+                }
+                else if (!deserialize_data(reader, gate, record.data_begin, record.data_count))
+                {
+                    log_error("netlist_persistent", "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(record.id) + ": data entries are corrupted");
+                    return false;
+                }
+
+                Reader::Range<FunctionRecord> functions;
+                if (!reader.records(FUNCTIONS, record.function_begin, record.function_count, functions))
+                {
+                    log_error("netlist_persistent", "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(record.id) + ": function range is out of bounds");
+                    return false;
+                }
+                for (const FunctionRecord& function : functions)
+                {
+                    auto res = deserialize_function(reader, function);
+                    if (res.is_error() || !reader.has_string(function.name))
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(record.id) + ": failed to deserialize Boolean function\n{}",
+                                  res.is_error() ? res.get_error().get() : "string index is out of bounds");
+                        return false;
+                    }
+                    gate->add_boolean_function(reader.string(function.name), res.get());
+                }
+
+                if (((record.flags & GATE_IS_GND) && !nl->mark_gnd_gate(gate)) || ((record.flags & GATE_IS_VCC) && !nl->mark_vcc_gate(gate)))
+                {
+                    log_error("netlist_persistent", "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(record.id) + ": failed to mark global gate");
+                    return false;
+                }
+
+                return true;
+            }
+
+            bool deserialize_net(const Reader& reader, Netlist* nl, const NetRecord& record, std::vector<DataContainer*>* deferred_data)
+            {
+                if (!reader.has_string(record.name))
+                {
+                    log_error("netlist_persistent", "could not deserialize net with ID {}: string index is out of bounds", record.id);
+                    return false;
+                }
+                const std::string net_name = reader.string(record.name);
+
+                Net* net = nl->create_net(record.id, net_name);
+                if (net == nullptr)
+                {
+                    log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(record.id) + ": failed to create net");
+                    return false;
+                }
+
+                Reader::Range<EndpointRecord> endpoints;
+                if (!reader.records(ENDPOINTS, record.endpoint_begin, (u64)record.source_count + record.destination_count, endpoints))
+                {
+                    log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(record.id) + ": endpoint range is out of bounds");
+                    return false;
+                }
+                for (const EndpointRecord* ep = endpoints.begin(); ep != endpoints.end(); ep++)
+                {
+                    const bool is_source = ep < endpoints.begin() + record.source_count;
+                    Gate* gate           = nl->get_gate_by_id(ep->gate_id);
+                    GatePin* pin         = (gate != nullptr) ? gate->get_type()->get_pin_by_id(ep->pin_id) : nullptr;
+                    if (pin == nullptr)
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize net '" + net_name + "' with ID " + std::to_string(record.id) + ": failed to get pin with ID " + std::to_string(ep->pin_id)
+                                      + " of gate with ID " + std::to_string(ep->gate_id));
+                        return false;
+                    }
+
+                    if ((is_source && net->add_source(gate, pin) == nullptr) || (!is_source && net->add_destination(gate, pin) == nullptr))
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize net '" + net_name + "' with ID " + std::to_string(record.id) + ": failed to add pin '" + pin->get_name() + "' of gate with ID "
+                                      + std::to_string(ep->gate_id) + " as " + (is_source ? "source" : "destination"));
+                        return false;
+                    }
+                }
+
+                if (deferred_data != nullptr && record.data_count > 0)
+                {
+                    deferred_data->push_back(net);
+                }
+                else if (!deserialize_data(reader, net, record.data_begin, record.data_count))
+                {
+                    log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(record.id) + ": data entries are corrupted");
+                    return false;
+                }
+
+                if (((record.flags & NET_IS_GLOBAL_IN) && !nl->mark_global_input_net(net)) || ((record.flags & NET_IS_GLOBAL_OUT) && !nl->mark_global_output_net(net)))
+                {
+                    log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(record.id) + ": failed to mark global net");
+                    return false;
+                }
+
+                return true;
+            }
+
+            Module* deserialize_module(const Reader& reader, Netlist* nl, const ModuleRecord& record, bool ignore_missing_gates)
+            {
+                if (!check_strings(reader, {record.name, record.type}))
+                {
+                    log_error("netlist_persistent", "could not deserialize module with ID {}: string index is out of bounds", record.id);
+                    return nullptr;
+                }
+                const std::string module_name = reader.string(record.name);
+
+                Module* sm = nl->get_top_module();
+                if (record.parent_id == 0)
+                {
+                    // top_module must not be created but might be renamed
+                    if (module_name != sm->get_name())
+                    {
+                        sm->set_name(module_name);
+                    }
+                }
+                else
+                {
+                    // modules are stored in breadth-first order, hence the parent has already been created
+                    sm = nl->create_module(record.id, module_name, nl->get_module_by_id(record.parent_id));
+                    if (sm == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize module '" + module_name + "' with ID " + std::to_string(record.id) + ": failed to create module");
+                        return nullptr;
+                    }
+                }
+                sm->set_type(reader.string(record.type));
+
+                Reader::Range<u32> gate_ids;
+                if (!reader.records(MODULE_GATES, record.gate_begin, record.gate_count, gate_ids))
+                {
+                    log_error("netlist_persistent", "could not deserialize module '" + module_name + "' with ID " + std::to_string(record.id) + ": gate range is out of bounds");
+                    return nullptr;
+                }
+                if (!sm->is_top_module())
+                {
+                    std::vector<Gate*> gates;
+                    gates.reserve(record.gate_count);
+                    for (const u32 gate_id : gate_ids)
+                    {
+                        // gates may have been deleted before deferred modules are loaded
+                        if (Gate* gate = nl->get_gate_by_id(gate_id); gate != nullptr || !ignore_missing_gates)
+                        {
+                            gates.push_back(gate);
+                        }
+                    }
+                    if (std::find(gates.begin(), gates.end(), nullptr) != gates.end() || !sm->assign_gates(gates))
+                    {
+                        log_error("netlist_persistent", "could not deserialize module '" + module_name + "' with ID " + std::to_string(record.id) + ": failed to assign gates");
+                        return nullptr;
+                    }
+                }
+
+                if (!deserialize_data(reader, sm, record.data_begin, record.data_count))
+                {
+                    log_error("netlist_persistent", "could not deserialize module '" + module_name + "' with ID " + std::to_string(record.id) + ": data entries are corrupted");
+                    return nullptr;
+                }
+
+                return sm;
+            }
+
+            bool deserialize_module_pins(const Reader& reader, Netlist* nl, Module* sm, const ModuleRecord& record)
+            {
+                Reader::Range<PinGroupRecord> pin_groups;
+                if (!reader.records(PIN_GROUPS, record.pin_group_begin, record.pin_group_count, pin_groups))
+                {
+                    log_error("netlist_persistent", "could not deserialize pins of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id()) + ": pin group range is out of bounds");
+                    return false;
+                }
+
+                for (const PinGroupRecord& pg : pin_groups)
+                {
+                    Reader::Range<PinRecord> pin_records;
+                    if (!check_strings(reader, {pg.name, pg.direction, pg.type}) || !reader.records(PINS, pg.pin_begin, pg.pin_count, pin_records))
+                    {
+                        log_error("netlist_persistent", "could not deserialize pin group with ID {} of module '{}' with ID {}: record is corrupted", pg.id, sm->get_name(), sm->get_id());
+                        return false;
+                    }
+
+                    std::vector<ModulePin*> pins;
+                    pins.reserve(pg.pin_count);
+                    for (const PinRecord& p : pin_records)
+                    {
+                        if (!check_strings(reader, {p.name, p.type}))
+                        {
+                            log_error("netlist_persistent", "could not deserialize pin with ID {} of module '{}' with ID {}: record is corrupted", p.id, sm->get_name(), sm->get_id());
+                            return false;
+                        }
+                        const std::string pin_name = reader.string(p.name);
+                        if (auto res = sm->create_pin(p.id, pin_name, nl->get_net_by_id(p.net_id), enum_from_string<PinType>(reader.string(p.type), PinType::none), false); res.is_error())
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize pin '" + pin_name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id()) + ": failed to create pin\n{}",
+                                      res.get_error().get());
+                            return false;
+                        }
+                        else
+                        {
+                            pins.push_back(res.get());
+                        }
+                    }
+
+                    const std::string pin_group_name = reader.string(pg.name);
+                    if (auto res = sm->create_pin_group(pg.id,
+                                                        pin_group_name,
+                                                        pins,
+                                                        enum_from_string<PinDirection>(reader.string(pg.direction), PinDirection::none),
+                                                        enum_from_string<PinType>(reader.string(pg.type), PinType::none),
+                                                        pg.flags & PIN_GROUP_ASCENDING,
+                                                        pg.start_index);
+                        res.is_error())
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize pin group '" + pin_group_name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id())
+                                      + ": failed to create pin group\n{}",
+                                  res.get_error().get());
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            GateLibrary* load_gate_library(const std::string& path)
+            {
+                std::filesystem::path glib_path(path);
+                if (glib_path.is_relative())
+                {
+                    if (ProjectManager* pm = ProjectManager::instance(); pm)
+                    {
+                        glib_path = pm->get_project_directory() / glib_path;
+                    }
+                }
+
+                if (GateLibrary* gatelib = gate_library_manager::get_gate_library(glib_path.string()); gatelib != nullptr)
+                {
+                    return gatelib;
+                }
+
+                // not found : try the other possible gate library extension
+                glib_path.replace_extension((glib_path.extension() == ".hgl") ? ".lib" : ".hgl");
+                GateLibrary* gatelib = gate_library_manager::get_gate_library(glib_path.string());
+                if (gatelib == nullptr)
+                {
+                    log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + path + "'");
+                    return nullptr;
+                }
+                log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", path, glib_path.string());
+                return gatelib;
+            }
+
+            bool deserialize_modules(const Reader& reader, Netlist* nl, bool ignore_missing_gates)
+            {
+                std::vector<std::pair<Module*, const ModuleRecord*>> modules;
+                for (const ModuleRecord& record : reader.records<ModuleRecord>(MODULES))
+                {
+                    Module* sm = deserialize_module(reader, nl, record, ignore_missing_gates);
+                    if (sm == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module");
+                        return false;
+                    }
+                    modules.emplace_back(sm, &record);
+                }
+
+                // update module nets, internal nets, input nets, and output nets
+                for (Module* mod : nl->get_modules())
+                {
+                    mod->update_nets();
+                }
+
+                // load module pins (nets must have been updated beforehand)
+                for (const auto& [sm, record] : modules)
+                {
+                    if (!deserialize_module_pins(reader, nl, sm, *record))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module pins");
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template<typename T, typename Record>
+            bool deserialize_deferred_data(const Reader& reader, const T* object, Section section, DataContainer* container)
+            {
+                // records are stored in ascending order of their IDs
+                const auto records = reader.records<Record>(section);
+                const auto it      = std::lower_bound(records.begin(), records.end(), object->get_id(), [](const Record& record, u32 id) { return record.id < id; });
+                if (it == records.end() || it->id != object->get_id())
+                {
+                    return false;
+                }
+                return deserialize_data(reader, container, it->data_begin, it->data_count);
+            }
+
+            /**
+             * Keeps a file mapped while modules or data entries of a netlist read from the file are deferred.
+             */
+            struct DeferredContent
+            {
+                std::filesystem::path hal_file;
+                std::filesystem::file_time_type write_time;
+                MappedFile file;
+                std::optional<Reader> reader;
+
+                bool is_unchanged() const
+                {
+                    std::error_code ec;
+                    if (std::filesystem::last_write_time(hal_file, ec) != write_time || ec || std::filesystem::file_size(hal_file, ec) != file.size() || ec)
+                    {
+                        log_error("netlist_persistent", "could not load deferred content: file '{}' has been modified since it was read", hal_file.string());
+                        return false;
+                    }
+                    return true;
+                }
+            };
+
+            std::unique_ptr<Netlist> deserialize(const Reader& reader, GateLibrary* gatelib, std::vector<DataContainer*>* deferred_data)
+            {
+                const FileHeader& header = reader.header();
+                if (!check_strings(reader, {header.gate_library, header.input_file, header.design_name, header.device_name}))
+                {
+                    log_error("netlist_persistent", "could not deserialize netlist: header is corrupted");
+                    return nullptr;
+                }
+
+                if (gatelib == nullptr)
+                {
+                    // no preferred gate library explicitly given
+                    gatelib = load_gate_library(reader.string(header.gate_library));
+                    if (gatelib == nullptr)
+                    {
+                        return nullptr;
+                    }
+                }
+
+                auto nl = std::make_unique<Netlist>(gatelib);
+
+                // disable automatically checking module nets
+                nl->enable_automatic_net_checks(false);
+
+                nl->set_id(header.netlist_id);
+                nl->set_input_filename(reader.string(header.input_file));
+                nl->set_design_name(reader.string(header.design_name));
+                nl->set_device_name(reader.string(header.device_name));
+
+                std::vector<GateType*> gate_types;
+                for (const GateRecord& record : reader.records<GateRecord>(GATES))
+                {
+                    if (!deserialize_gate(reader, nl.get(), record, gate_types, deferred_data))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
+                        return nullptr;
+                    }
+                }
+
+                for (const NetRecord& record : reader.records<NetRecord>(NETS))
+                {
+                    if (!deserialize_net(reader, nl.get(), record, deferred_data))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize net");
+                        return nullptr;
+                    }
+                }
+
+                // deferred modules are loaded once they are accessed for the first time
+                if (deferred_data == nullptr && !deserialize_modules(reader, nl.get(), false))
+                {
+                    return nullptr;
+                }
+
+                // re-enable automatically checking module nets
+                nl->enable_automatic_net_checks(true);
+
+                return nl;
+            }
+        }    // namespace
+
+        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            // deferred content may be read from the file that is about to be overwritten
+            if (!nl->load_deferred_content())
+            {
+                log_error("netlist_persistent", "could not serialize netlist: failed to load deferred content");
+                return false;
+            }
+
+            // create directory if it got erased in the meantime
+            if (const std::filesystem::path dir = hal_file.parent_path(); !dir.empty() && !std::filesystem::exists(dir))
+            {
+                std::error_code err;
+                if (!std::filesystem::create_directories(dir, err))
+                {
+                    log_error("netlist_persistent", "Could not create directory '{}', error was '{}'.", dir.string(), err.message());
+                    return false;
+                }
+            }
+
+            std::ofstream hal_file_stream(hal_file, std::ios::binary);
+            if (hal_file_stream.fail())
+            {
+                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", hal_file.string());
+                return false;
+            }
+
+            Writer writer;
+
+            FileHeader header{};
+            std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+            header.version      = FORMAT_VERSION;
+            header.byte_order   = BYTE_ORDER_MARK;
+            header.netlist_id   = nl->get_id();
+            header.gate_library = writer.add_string(nl->get_gate_library()->get_path().string());
+            header.input_file   = writer.add_string(nl->get_input_filename().string());
+            header.design_name  = writer.add_string(nl->get_design_name());
+            header.device_name  = writer.add_string(nl->get_device_name());
+
+            std::vector<Gate*> gates = nl->get_gates();
+            std::sort(gates.begin(), gates.end(), [](const Gate* lhs, const Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+            for (const Gate* gate : gates)
+            {
+                writer.add_gate(nl, gate);
+            }
+
+            std::vector<Net*> nets = nl->get_nets();
+            std::sort(nets.begin(), nets.end(), [](const Net* lhs, const Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+            for (const Net* net : nets)
+            {
+                writer.add_net(nl, net);
+            }
+
+            // module ids are not sorted to preserve hierarchy
+            std::queue<const Module*> q;
+            q.push(nl->get_top_module());
+            while (!q.empty())
+            {
+                const Module* module = q.front();
+                q.pop();
+
+                writer.add_module(module);
+
+                for (const Module* sm : module->get_submodules())
+                {
+                    q.push(sm);
+                }
+            }
+
+            if (!writer.write(hal_file_stream, header))
+            {
+                log_error("netlist_persistent", "could not write to file {}", hal_file.string());
+                return false;
+            }
+            hal_file_stream.close();
+
+            log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+
+            return true;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gatelib)
+        {
+            return netlist_binary_serializer::deserialize_from_file(hal_file, gatelib, netlist_serializer::ReadOptions());
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gatelib, const netlist_serializer::ReadOptions& options)
+        {
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            // the file stays mapped for as long as content is deferred
+            auto content      = std::make_shared<DeferredContent>();
+            content->hal_file = hal_file;
+            std::error_code ec;
+            content->write_time = std::filesystem::last_write_time(hal_file, ec);
+            if (ec || !content->file.open(hal_file))
+            {
+                log_error("netlist_persistent", "unable to open '{}'.", hal_file.string());
+                return nullptr;
+            }
+
+            const Reader& reader = content->reader.emplace(content->file.data(), content->file.size());
+            if (!content->reader->validate())
+            {
+                return nullptr;
+            }
+
+            std::vector<DataContainer*> deferred_data;
+            auto netlist = deserialize(reader, gatelib, options.lazy ? &deferred_data : nullptr);
+
+            if (netlist && options.lazy)
+            {
+                netlist->defer_modules([content](Netlist* nl) { return content->is_unchanged() && deserialize_modules(*content->reader, nl, true); });
+                netlist->defer_data(deferred_data, [content](DataContainer* container) {
+                    if (!content->is_unchanged())
+                    {
+                        return false;
+                    }
+                    if (const Gate* gate = dynamic_cast<const Gate*>(container); gate != nullptr)
+                    {
+                        return deserialize_deferred_data<Gate, GateRecord>(*content->reader, gate, GATES, container);
+                    }
+                    if (const Net* net = dynamic_cast<const Net*>(container); net != nullptr)
+                    {
+                        return deserialize_deferred_data<Net, NetRecord>(*content->reader, net, NETS, container);
+                    }
+                    return false;
+                });
+            }
+
+            if (netlist)
+            {
+                log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+            }
+
+            return netlist;
+        }
+
+        bool is_binary_file(const std::filesystem::path& hal_file)
+        {
+            std::ifstream stream(hal_file, std::ios::binary);
+            char magic[sizeof(MAGIC)];
+            return stream.read(magic, sizeof(MAGIC)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+        }
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
+
+#undef DURATION
@@ -0,0 +1,107 @@
+#include "hal_core/netlist/persistent/netlist_journal.h"
+
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+namespace hal
+{
+    NetlistJournal::NetlistJournal(Netlist* netlist) : m_netlist(netlist), m_num_data_changes(netlist->get_num_data_changes())
+    {
+        auto changes    = std::make_shared<netlist_serializer::NetlistChanges>();
+        m_changes       = changes;
+        m_callback_name = "netlist_journal_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+
+        EventHandler* event_handler = m_netlist->get_event_handler();
+
+        event_handler->register_callback(m_callback_name,
+                                         std::function<void(NetlistEvent::event, Netlist*, u32)>([changes](NetlistEvent::event, Netlist*, u32) { changes->netlist = true; }));
+
+        event_handler->register_callback(m_callback_name,
+                                         std::function<void(GateEvent::event, Gate*, u32)>([changes](GateEvent::event, Gate* gate, u32) { changes->gates.insert(gate->get_id()); }));
+
+        event_handler->register_callback(m_callback_name,
+                                         std::function<void(NetEvent::event, Net*, u32)>([changes](NetEvent::event, Net* net, u32) { changes->nets.insert(net->get_id()); }));
+
+        event_handler->register_callback(m_callback_name, std::function<void(ModuleEvent::event, Module*, u32)>([changes](ModuleEvent::event e, Module* module, u32) {
+                                             if (e == ModuleEvent::event::gates_assign_begin || e == ModuleEvent::event::gates_assign_end || e == ModuleEvent::event::gates_remove_begin
+                                                 || e == ModuleEvent::event::gates_remove_end)
+                                             {
+                                                 return;
+                                             }
+                                             changes->modules.insert(module->get_id());
+                                         }));
+    }
+
+    NetlistJournal::~NetlistJournal()
+    {
+        if (is_attached())
+        {
+            m_netlist->get_event_handler()->unregister_callback(m_callback_name);
+        }
+    }
+
+    Netlist* NetlistJournal::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    bool NetlistJournal::is_attached() const
+    {
+        return !m_changes.expired();
+    }
+
+    bool NetlistJournal::has_changes() const
+    {
+        if (auto changes = m_changes.lock(); changes != nullptr)
+        {
+            return changes->netlist || !changes->gates.empty() || !changes->nets.empty() || !changes->modules.empty();
+        }
+        return false;
+    }
+
+    bool NetlistJournal::has_data_changes() const
+    {
+        return is_attached() && m_netlist->get_num_data_changes() != m_num_data_changes;
+    }
+
+    netlist_serializer::NetlistChanges NetlistJournal::get_changes() const
+    {
+        if (auto changes = m_changes.lock(); changes != nullptr)
+        {
+            return *changes;
+        }
+        return netlist_serializer::NetlistChanges();
+    }
+
+    bool NetlistJournal::append_to_file(const std::filesystem::path& journal_file)
+    {
+        auto changes = m_changes.lock();
+        if (changes == nullptr)
+        {
+            return false;
+        }
+        if (!has_changes())
+        {
+            return true;
+        }
+
+        if (!netlist_serializer::append_to_journal(m_netlist, *changes, journal_file))
+        {
+            return false;
+        }
+        *changes = netlist_serializer::NetlistChanges();
+        return true;
+    }
+
+    void NetlistJournal::clear()
+    {
+        if (auto changes = m_changes.lock(); changes != nullptr)
+        {
+            *changes           = netlist_serializer::NetlistChanges();
+            m_num_data_changes = m_netlist->get_num_data_changes();
+        }
+    }
+}    // namespace hal
@@ -6,22 +6,25 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/utilities/log.h"
-#include "rapidjson/filereadstream.h"
-#include "rapidjson/stringbuffer.h"
-
-#define PRETTY_JSON_OUTPUT false
-#if PRETTY_JSON_OUTPUT
+#include "hal_core/utilities/parallel.h"
 #include "rapidjson/prettywriter.h"
-#else
+#include "rapidjson/reader.h"
+#include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
-#endif
 
+#include <array>
+#include <cassert>
 #include <chrono>
 #include <fstream>
+#include <map>
+#include <optional>
 #include <queue>
 #include <sstream>
+#include <unordered_set>
+#include <zlib.h>
 
 #ifndef DURATION
 #define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
@@ -38,7 +41,6 @@ namespace hal
             int encoded_format_version;
 
             // Ver 12 : location of gates
-#define JSON_STR_HELPER(x) rapidjson::Value{}.SetString(x.c_str(), x.length(), allocator)
 
 #define assert_availablility(MEMBER)                                                               \
     if (!root.HasMember(MEMBER))                                                                   \
@@ -72,19 +74,27 @@ namespace hal
             }    // namespace
 
             // serialize container data
-            rapidjson::Value serialize(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data, rapidjson::Document::AllocatorType& allocator)
+            template<typename Writer>
+            void serialize_data(const DataContainer* c, Writer& writer)
             {
-                rapidjson::Value val(rapidjson::kArrayType);
+                const auto data = c->get_data_map();
+                if (data.empty())
+                {
+                    return;
+                }
+
+                writer.Key("data");
+                writer.StartArray();
                 for (const auto& it : data)
                 {
-                    rapidjson::Value entry(rapidjson::kArrayType);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.second)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.second)), allocator);
-                    val.PushBack(entry, allocator);
+                    writer.StartArray();
+                    writer.String(std::get<0>(it.first));
+                    writer.String(std::get<1>(it.first));
+                    writer.String(std::get<0>(it.second));
+                    writer.String(std::get<1>(it.second));
+                    writer.EndArray();
                 }
-                return val;
+                writer.EndArray();
             }
 
             void deserialize_data(DataContainer* c, const rapidjson::Value& val)
@@ -96,12 +106,15 @@ namespace hal
             }
 
             // serialize endpoint
-            rapidjson::Value serialize(const Endpoint* ep, rapidjson::Document::AllocatorType& allocator)
+            template<typename Writer>
+            void serialize(const Endpoint* ep, Writer& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("gate_id", ep->get_gate()->get_id(), allocator);
-                val.AddMember("pin_id", ep->get_pin()->get_id(), allocator);
-                return val;
+                writer.StartObject();
+                writer.Key("gate_id");
+                writer.Uint(ep->get_gate()->get_id());
+                writer.Key("pin_id");
+                writer.Uint(ep->get_pin()->get_id());
+                writer.EndObject();
             }
 
             bool deserialize_destination(Netlist* nl, Net* net, const rapidjson::Value& val)
@@ -236,35 +249,39 @@ namespace hal
             }
 
             // serialize gate
-            rapidjson::Value serialize(const Gate* gate, rapidjson::Document::AllocatorType& allocator)
+            template<typename Writer>
+            void serialize(const Gate* gate, Writer& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", gate->get_id(), allocator);
-                val.AddMember("name", gate->get_name(), allocator);
-                val.AddMember("type", gate->get_type()->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(gate->get_id());
+                writer.Key("name");
+                writer.String(gate->get_name());
+                writer.Key("type");
+                writer.String(gate->get_type()->get_name());
                 if (gate->has_location())
                 {
-                    val.AddMember("location_x", gate->get_location_x(), allocator);
-                    val.AddMember("location_y", gate->get_location_y(), allocator);
-                }
-                auto data = serialize(gate->get_data_map(), allocator);
-                if (!data.Empty())
-                {
-                    val.AddMember("data", data, allocator);
+                    writer.Key("location_x");
+                    writer.Int(gate->get_location_x());
+                    writer.Key("location_y");
+                    writer.Int(gate->get_location_y());
                 }
+                serialize_data(gate, writer);
                 {
-                    rapidjson::Value functions(rapidjson::kObjectType);
-                    for (const auto& [name, function] : gate->get_boolean_functions(true))
-                    {
-                        const std::string function_str = function.to_string();
-                        functions.AddMember(JSON_STR_HELPER(name), JSON_STR_HELPER(function_str), allocator);
-                    }
-                    if (functions.MemberCount() > 0)
+                    const auto functions = gate->get_boolean_functions(true);
+                    if (!functions.empty())
                     {
-                        val.AddMember("custom_functions", functions, allocator);
+                        writer.Key("custom_functions");
+                        writer.StartObject();
+                        for (const auto& [name, function] : functions)
+                        {
+                            writer.Key(name);
+                            writer.String(function.to_string());
+                        }
+                        writer.EndObject();
                     }
                 }
-                return val;
+                writer.EndObject();
             }
 
             bool deserialize_gate(Netlist* nl, const rapidjson::Value& val, const std::unordered_map<std::string, hal::GateType*>& gate_types)
@@ -320,46 +337,47 @@ namespace hal
             }
 
             // serialize net
-            rapidjson::Value serialize(const Net* net, rapidjson::Document::AllocatorType& allocator)
+            template<typename Writer>
+            void serialize(const Net* net, Writer& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", net->get_id(), allocator);
-                val.AddMember("name", net->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(net->get_id());
+                writer.Key("name");
+                writer.String(net->get_name());
 
                 {
-                    rapidjson::Value srcs(rapidjson::kArrayType);
                     std::vector<Endpoint*> sorted = net->get_sources();
-                    std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
-                    for (const Endpoint* src : sorted)
-                    {
-                        srcs.PushBack(serialize(src, allocator), allocator);
-                    }
-                    if (!srcs.Empty())
+                    if (!sorted.empty())
                     {
-                        val.AddMember("srcs", srcs, allocator);
+                        std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                        writer.Key("srcs");
+                        writer.StartArray();
+                        for (const Endpoint* src : sorted)
+                        {
+                            serialize(src, writer);
+                        }
+                        writer.EndArray();
                     }
                 }
 
                 {
-                    rapidjson::Value dsts(rapidjson::kArrayType);
                     std::vector<Endpoint*> sorted = net->get_destinations();
-                    std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
-                    for (const Endpoint* dst : sorted)
-                    {
-                        dsts.PushBack(serialize(dst, allocator), allocator);
-                    }
-                    if (!dsts.Empty())
+                    if (!sorted.empty())
                     {
-                        val.AddMember("dsts", dsts, allocator);
+                        std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                        writer.Key("dsts");
+                        writer.StartArray();
+                        for (const Endpoint* dst : sorted)
+                        {
+                            serialize(dst, writer);
+                        }
+                        writer.EndArray();
                     }
                 }
 
-                auto data = serialize(net->get_data_map(), allocator);
-                if (!data.Empty())
-                {
-                    val.AddMember("data", data, allocator);
-                }
-                return val;
+                serialize_data(net, writer);
+                writer.EndObject();
             }
 
             bool deserialize_net(Netlist* nl, const rapidjson::Value& val)
@@ -406,71 +424,80 @@ namespace hal
             }
 
             // serialize module
-            rapidjson::Value serialize(const Module* module, rapidjson::Document::AllocatorType& allocator)
+            template<typename Writer>
+            void serialize(const Module* module, Writer& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", module->get_id(), allocator);
-                val.AddMember("type", module->get_type(), allocator);
-                val.AddMember("name", module->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(module->get_id());
+                writer.Key("type");
+                writer.String(module->get_type());
+                writer.Key("name");
+                writer.String(module->get_name());
                 Module* parent = module->get_parent_module();
-                if (parent == nullptr)
-                {
-                    val.AddMember("parent", 0, allocator);
-                }
-                else
-                {
-                    val.AddMember("parent", parent->get_id(), allocator);
-                }
+                writer.Key("parent");
+                writer.Uint((parent == nullptr) ? 0 : parent->get_id());
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
                     std::vector<Gate*> sorted = module->get_gates(nullptr, false);
-                    std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
-                    for (const Gate* g : sorted)
-                    {
-                        gates.PushBack(g->get_id(), allocator);
-                    }
-                    if (!gates.Empty())
+                    if (!sorted.empty())
                     {
-                        val.AddMember("gates", gates, allocator);
+                        std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                        writer.Key("gates");
+                        writer.StartArray();
+                        for (const Gate* g : sorted)
+                        {
+                            writer.Uint(g->get_id());
+                        }
+                        writer.EndArray();
                     }
                 }
                 {
-                    rapidjson::Value json_pin_groups(rapidjson::kArrayType);
-                    for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+                    const std::vector<PinGroup<ModulePin>*> pin_groups = module->get_pin_groups();
+                    if (!pin_groups.empty())
                     {
-                        rapidjson::Value json_pin_group(rapidjson::kObjectType);
-                        json_pin_group.AddMember("id", pin_group->get_id(), allocator);
-                        json_pin_group.AddMember("name", pin_group->get_name(), allocator);
-                        json_pin_group.AddMember("direction", enum_to_string(pin_group->get_direction()), allocator);
-                        json_pin_group.AddMember("type", enum_to_string(pin_group->get_type()), allocator);
-                        json_pin_group.AddMember("ascending", pin_group->is_ascending(), allocator);
-                        json_pin_group.AddMember("ordered", pin_group->is_ordered(), allocator);
-                        json_pin_group.AddMember("start_index", pin_group->get_start_index(), allocator);
-                        rapidjson::Value json_pins(rapidjson::kArrayType);
-                        for (const ModulePin* pin : pin_group->get_pins())
+                        writer.Key("pin_groups");
+                        writer.StartArray();
+                        for (const PinGroup<ModulePin>* pin_group : pin_groups)
                         {
-                            rapidjson::Value json_pin(rapidjson::kObjectType);
-                            json_pin.AddMember("id", pin->get_id(), allocator);
-                            json_pin.AddMember("name", pin->get_name(), allocator);
-                            json_pin.AddMember("type", enum_to_string(pin->get_type()), allocator);
-                            json_pin.AddMember("net_id", pin->get_net()->get_id(), allocator);
-                            json_pins.PushBack(json_pin, allocator);
+                            writer.StartObject();
+                            writer.Key("id");
+                            writer.Uint(pin_group->get_id());
+                            writer.Key("name");
+                            writer.String(pin_group->get_name());
+                            writer.Key("direction");
+                            writer.String(enum_to_string(pin_group->get_direction()));
+                            writer.Key("type");
+                            writer.String(enum_to_string(pin_group->get_type()));
+                            writer.Key("ascending");
+                            writer.Bool(pin_group->is_ascending());
+                            writer.Key("ordered");
+                            writer.Bool(pin_group->is_ordered());
+                            writer.Key("start_index");
+                            writer.Int(pin_group->get_start_index());
+                            writer.Key("pins");
+                            writer.StartArray();
+                            for (const ModulePin* pin : pin_group->get_pins())
+                            {
+                                writer.StartObject();
+                                writer.Key("id");
+                                writer.Uint(pin->get_id());
+                                writer.Key("name");
+                                writer.String(pin->get_name());
+                                writer.Key("type");
+                                writer.String(enum_to_string(pin->get_type()));
+                                writer.Key("net_id");
+                                writer.Uint(pin->get_net()->get_id());
+                                writer.EndObject();
+                            }
+                            writer.EndArray();
+                            writer.EndObject();
                         }
-                        json_pin_group.AddMember("pins", json_pins, allocator);
-                        json_pin_groups.PushBack(json_pin_group, allocator);
-                    }
-                    if (!json_pin_groups.Empty())
-                    {
-                        val.AddMember("pin_groups", json_pin_groups, allocator);
+                        writer.EndArray();
                     }
                 }
 
-                auto data = serialize(module->get_data_map(), allocator);
-                if (!data.Empty())
-                {
-                    val.AddMember("data", data, allocator);
-                }
-                return val;
+                serialize_data(module, writer);
+                writer.EndObject();
             }
 
             bool deserialize_module(Netlist* nl, const rapidjson::Value& val, std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
@@ -639,68 +666,116 @@ namespace hal
                 return true;
             }
 
-            // serialize netlist
-            void serialize(const Netlist* nl, rapidjson::Document& document)
+            /**
+             * Reports the number of gates, nets, and modules written so far to the progress callback of the write options.
+             */
+            class WriteProgress
             {
-                rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-                rapidjson::Value root(rapidjson::kObjectType);
+            public:
+                WriteProgress(const std::function<void(u64, u64)>& callback, u64 total) : m_callback(callback), m_total(total)
+                {
+                }
+
+                void advance()
+                {
+                    m_written++;
+                    if (m_callback && (m_written % PROGRESS_INTERVAL == 0 || m_written == m_total))
+                    {
+                        m_callback(m_written, m_total);
+                    }
+                }
+
+            private:
+                static constexpr u64 PROGRESS_INTERVAL = 4096;
 
-                root.AddMember("gate_library", nl->get_gate_library()->get_path().string(), allocator);
-                root.AddMember("id", nl->get_id(), allocator);
-                root.AddMember("input_file", nl->get_input_filename().string(), allocator);
-                root.AddMember("design_name", nl->get_design_name(), allocator);
-                root.AddMember("device_name", nl->get_device_name(), allocator);
+                const std::function<void(u64, u64)>& m_callback;
+                u64 m_total;
+                u64 m_written = 0;
+            };
 
+            template<typename Writer>
+            void serialize_ids(const char* key, const std::vector<u32>& ids, Writer& writer)
+            {
+                writer.Key(key);
+                writer.StartArray();
+                for (const u32 id : ids)
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
-                    rapidjson::Value global_vccs(rapidjson::kArrayType);
-                    rapidjson::Value global_gnds(rapidjson::kArrayType);
+                    writer.Uint(id);
+                }
+                writer.EndArray();
+            }
+
+            // serialize netlist
+            template<typename Writer>
+            void serialize(const Netlist* nl, Writer& writer, WriteProgress& progress)
+            {
+                writer.StartObject();
+                writer.Key("gate_library");
+                writer.String(nl->get_gate_library()->get_path().string());
+                writer.Key("id");
+                writer.Uint(nl->get_id());
+                writer.Key("input_file");
+                writer.String(nl->get_input_filename().string());
+                writer.Key("design_name");
+                writer.String(nl->get_design_name());
+                writer.Key("device_name");
+                writer.String(nl->get_device_name());
+
+                {
+                    std::vector<u32> global_vccs;
+                    std::vector<u32> global_gnds;
                     std::vector<Gate*> sorted = nl->get_gates();
                     std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    writer.Key("gates");
+                    writer.StartArray();
                     for (const Gate* gate : sorted)
                     {
-                        gates.PushBack(serialize(gate, allocator), allocator);
+                        serialize(gate, writer);
+                        progress.advance();
 
                         if (nl->is_gnd_gate(gate))
                         {
-                            global_gnds.PushBack(gate->get_id(), allocator);
+                            global_gnds.push_back(gate->get_id());
                         }
 
                         if (nl->is_vcc_gate(gate))
                         {
-                            global_vccs.PushBack(gate->get_id(), allocator);
+                            global_vccs.push_back(gate->get_id());
                         }
                     }
-                    root.AddMember("gates", gates, allocator);
-                    root.AddMember("global_vcc", global_vccs, allocator);
-                    root.AddMember("global_gnd", global_gnds, allocator);
+                    writer.EndArray();
+                    serialize_ids("global_vcc", global_vccs, writer);
+                    serialize_ids("global_gnd", global_gnds, writer);
                 }
                 {
-                    rapidjson::Value nets(rapidjson::kArrayType);
-                    rapidjson::Value global_in(rapidjson::kArrayType);
-                    rapidjson::Value global_out(rapidjson::kArrayType);
+                    std::vector<u32> global_in;
+                    std::vector<u32> global_out;
                     std::vector<Net*> sorted = nl->get_nets();
                     std::sort(sorted.begin(), sorted.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    writer.Key("nets");
+                    writer.StartArray();
                     for (const Net* net : sorted)
                     {
-                        nets.PushBack(serialize(net, allocator), allocator);
+                        serialize(net, writer);
+                        progress.advance();
 
                         if (nl->is_global_input_net(net))
                         {
-                            global_in.PushBack(net->get_id(), allocator);
+                            global_in.push_back(net->get_id());
                         }
 
                         if (nl->is_global_output_net(net))
                         {
-                            global_out.PushBack(net->get_id(), allocator);
+                            global_out.push_back(net->get_id());
                         }
                     }
-                    root.AddMember("nets", nets, allocator);
-                    root.AddMember("global_in", global_in, allocator);
-                    root.AddMember("global_out", global_out, allocator);
+                    writer.EndArray();
+                    serialize_ids("global_in", global_in, writer);
+                    serialize_ids("global_out", global_out, writer);
                 }
                 {
-                    rapidjson::Value modules(rapidjson::kArrayType);
+                    writer.Key("modules");
+                    writer.StartArray();
 
                     // module ids are not sorted to preserve hierarchy
                     std::queue<const Module*> q;
@@ -710,17 +785,285 @@ namespace hal
                         const Module* module = q.front();
                         q.pop();
 
-                        modules.PushBack(serialize(module, allocator), allocator);
+                        serialize(module, writer);
+                        progress.advance();
 
                         for (const Module* sm : module->get_submodules())
                         {
                             q.push(sm);
                         }
                     }
-                    root.AddMember("modules", modules, allocator);
+                    writer.EndArray();
+                }
+
+                writer.EndObject();
+            }
+
+            template<typename Writer>
+            void serialize_document(const Netlist* nl, Writer& writer, WriteProgress& progress)
+            {
+                writer.StartObject();
+                writer.Key("serialization_format_version");
+                writer.Int(SERIALIZATION_FORMAT_VERSION);
+                writer.Key("netlist");
+                serialize(nl, writer, progress);
+                writer.EndObject();
+            }
+
+            /**
+             * Buffered output stream for rapidjson writers that writes to a gzip-compressed or, using the transparent mode of zlib, to a plain file.
+             */
+            class GzFileWriteStream
+            {
+            public:
+                typedef char Ch;
+
+                GzFileWriteStream(gzFile file) : m_file(file)
+                {
+                }
+
+                void Put(Ch c)
+                {
+                    if (m_size == BUFFER_SIZE)
+                    {
+                        Flush();
+                    }
+                    m_buffer[m_size++] = c;
+                }
+
+                void Flush()
+                {
+                    if (m_size > 0 && gzwrite(m_file, m_buffer, m_size) != (int)m_size)
+                    {
+                        m_failed = true;
+                    }
+                    m_size = 0;
+                }
+
+                bool has_failed() const
+                {
+                    return m_failed;
+                }
+
+            private:
+                static constexpr u32 BUFFER_SIZE = 65536;
+
+                gzFile m_file;
+                char m_buffer[BUFFER_SIZE];
+                u32 m_size    = 0;
+                bool m_failed = false;
+            };
+
+            /**
+             * Input stream for rapidjson readers that reads from a gzip-compressed or a plain file, following `rapidjson::FileReadStream`.
+             */
+            class GzFileReadStream
+            {
+            public:
+                typedef char Ch;
+
+                GzFileReadStream(gzFile file) : m_file(file)
+                {
+                    read();
+                }
+
+                Ch Peek() const
+                {
+                    return *m_current;
+                }
+
+                Ch Take()
+                {
+                    Ch c = *m_current;
+                    read();
+                    return c;
+                }
+
+                size_t Tell() const
+                {
+                    return m_count + static_cast<size_t>(m_current - m_buffer);
+                }
+
+                // not implemented
+                void Put(Ch)
+                {
+                    assert(false);
+                }
+
+                void Flush()
+                {
+                    assert(false);
+                }
+
+                Ch* PutBegin()
+                {
+                    assert(false);
+                    return nullptr;
+                }
+
+                size_t PutEnd(Ch*)
+                {
+                    assert(false);
+                    return 0;
+                }
+
+            private:
+                static constexpr u32 BUFFER_SIZE = 65536;
+
+                gzFile m_file;
+                char m_buffer[BUFFER_SIZE + 1];
+                char* m_buffer_last = nullptr;
+                char* m_current     = m_buffer;
+                size_t m_read_count = 0;
+                size_t m_count      = 0;
+                bool m_eof          = false;
+
+                void read()
+                {
+                    if (m_current < m_buffer_last)
+                    {
+                        ++m_current;
+                    }
+                    else if (!m_eof)
+                    {
+                        m_count += m_read_count;
+                        const int read_count = gzread(m_file, m_buffer, BUFFER_SIZE);
+                        m_read_count         = (read_count > 0) ? (size_t)read_count : 0;
+                        m_buffer_last        = m_buffer + m_read_count - 1;
+                        m_current            = m_buffer;
+
+                        if (m_read_count < BUFFER_SIZE)
+                        {
+                            // terminate the input after the last character read
+                            m_buffer[m_read_count] = '\0';
+                            ++m_buffer_last;
+                            m_eof = true;
+                        }
+                    }
+                }
+            };
+
+            /**
+             * Positions of the deferred sections of a netlist that has been read from an uncompressed JSON file in lazy mode.
+             * The file is kept open until all sections have been read, consecutive sections are read without seeking.
+             */
+            class DeferredContent
+            {
+            public:
+                DeferredContent(const std::filesystem::path& hal_file) : m_hal_file(hal_file)
+                {
+                }
+
+                ~DeferredContent()
+                {
+                    if (m_file != NULL)
+                    {
+                        gzclose(m_file);
+                    }
+                }
+
+                DeferredContent(const DeferredContent&) = delete;
+                DeferredContent& operator=(const DeferredContent&) = delete;
+
+                bool open()
+                {
+                    std::error_code ec;
+                    m_write_time = std::filesystem::last_write_time(m_hal_file, ec);
+                    if (!ec)
+                    {
+                        m_size = std::filesystem::file_size(m_hal_file, ec);
+                    }
+                    m_file = ec ? NULL : gzopen(m_hal_file.string().c_str(), "rb");
+                    return m_file != NULL;
+                }
+
+                template<typename Handler>
+                bool read(size_t offset, Handler& handler)
+                {
+                    std::error_code ec;
+                    if (std::filesystem::last_write_time(m_hal_file, ec) != m_write_time || ec || std::filesystem::file_size(m_hal_file, ec) != m_size || ec)
+                    {
+                        log_error("netlist_persistent", "could not load deferred content: file '{}' has been modified since it was read", m_hal_file.string());
+                        return false;
+                    }
+
+                    // skip ahead within the current buffer if possible, seek otherwise
+                    if (m_stream == nullptr || offset < m_stream_begin + m_stream->Tell() || offset - (m_stream_begin + m_stream->Tell()) > MAX_SKIP)
+                    {
+                        if (gzseek(m_file, offset, SEEK_SET) != (z_off_t)offset)
+                        {
+                            log_error("netlist_persistent", "could not load deferred content: failed to seek in file '{}'", m_hal_file.string());
+                            return false;
+                        }
+                        m_stream       = std::make_unique<GzFileReadStream>(m_file);
+                        m_stream_begin = offset;
+                    }
+                    while (m_stream_begin + m_stream->Tell() < offset)
+                    {
+                        m_stream->Take();
+                    }
+
+                    rapidjson::Reader reader;
+                    if (reader.Parse<rapidjson::kParseStopWhenDoneFlag>(*m_stream, handler).IsError() || handler.has_failed())
+                    {
+                        log_error("netlist_persistent", "could not load deferred content: invalid json string at offset {} in file '{}'", offset, m_hal_file.string());
+                        m_stream = nullptr;
+                        return false;
+                    }
+                    return true;
+                }
+
+                /// The position of the "modules" array.
+                size_t modules_offset = 0;
+                /// The positions of the non-empty "data" arrays of gates and nets.
+                std::unordered_map<DataContainer*, size_t> data_offsets;
+
+            private:
+                static constexpr size_t MAX_SKIP = 65536;
+
+                std::filesystem::path m_hal_file;
+                std::filesystem::file_time_type m_write_time;
+                uintmax_t m_size = 0;
+                gzFile m_file    = NULL;
+                std::unique_ptr<GzFileReadStream> m_stream;
+                size_t m_stream_begin = 0;
+            };
+
+            GateLibrary* load_gate_library(const std::string& path)
+            {
+                std::filesystem::path glib_path(path);
+
+                if (glib_path.is_relative())
+                {
+                    ProjectManager* pm = ProjectManager::instance();
+                    if (pm)
+                        glib_path = pm->get_project_directory() / glib_path;
                 }
+                GateLibrary* gatelib = gate_library_manager::get_gate_library(glib_path.string());
 
-                document.AddMember("netlist", root, document.GetAllocator());
+                if (gatelib == nullptr)
+                {
+                    // not found : try the other possible gate library extension
+                    if (glib_path.extension() == ".hgl")
+                    {
+                        glib_path.replace_extension(".lib");
+                    }
+                    else
+                    {
+                        glib_path.replace_extension(".hgl");
+                    }
+
+                    gatelib = gate_library_manager::get_gate_library(glib_path.string());
+                    if (gatelib == nullptr)
+                    {
+                        log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + path + "'");
+                    }
+                    else
+                    {
+                        log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", path, glib_path.string());
+                    }
+                }
+                return gatelib;
             }
 
             std::unique_ptr<Netlist> deserialize(const rapidjson::Document& document, GateLibrary* gatelib)
@@ -741,38 +1084,10 @@ namespace hal
                         return nullptr;
                     }
 
-                    std::filesystem::path glib_path(root["gate_library"].GetString());
-
-                    if (glib_path.is_relative())
-                    {
-                        ProjectManager* pm = ProjectManager::instance();
-                        if (pm)
-                            glib_path = pm->get_project_directory() / glib_path;
-                    }
-                    gatelib = gate_library_manager::get_gate_library(glib_path.string());
-
+                    gatelib = load_gate_library(root["gate_library"].GetString());
                     if (gatelib == nullptr)
                     {
-                        // not found : try the other possible gate library extension
-                        if (glib_path.extension() == ".hgl")
-                        {
-                            glib_path.replace_extension(".lib");
-                        }
-                        else
-                        {
-                            glib_path.replace_extension(".hgl");
-                        }
-
-                        gatelib = gate_library_manager::get_gate_library(glib_path.string());
-                        if (gatelib == nullptr)
-                        {
-                            log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + std::string(root["gate_library"].GetString()) + "'");
-                            return nullptr;
-                        }
-                        else
-                        {
-                            log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", root["gate_library"].GetString(), glib_path.string());
-                        }
+                        return nullptr;
                     }
                 }
 
@@ -965,85 +1280,1460 @@ namespace hal
                 return netlist;
             }
 
-        }    // namespace
-
-        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file)
-        {
-            if (nl == nullptr)
+            /**
+             * SAX handler that creates the gates, nets, and modules of a netlist as soon as their JSON objects have been read, so that the document is never held in memory as a whole.
+             * Boolean functions are collected while reading and parsed in parallel once the netlist is complete, endpoints are wired in bulk once all nets have been read.
+             * Files that contain legacy members or in which a section precedes the sections it depends on are left to the DOM-based loader.
+             */
+            class NetlistStreamHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, NetlistStreamHandler>
             {
-                return false;
-            }
+            public:
+                explicit NetlistStreamHandler(GateLibrary* gatelib) : m_gatelib(gatelib)
+                {
+                }
 
-            auto begin_time = std::chrono::high_resolution_clock::now();
+                /**
+                 * Creates a handler that reads a single deferred section of a netlist, i.e., either its "modules" array or the "data" array of one of its gates or nets.
+                 */
+                NetlistStreamHandler(Netlist* nl, const std::string& section) : m_gatelib(nullptr), m_netlist(nl), m_key(section)
+                {
+                    // gates and nets might have been deleted in the meantime
+                    m_scopes.push_back((section == "modules") ? Scope::netlist : Scope::gate);
+                    m_gates_done           = true;
+                    m_nets_done            = true;
+                    m_ignore_missing_gates = true;
+                }
 
-            std::filesystem::path serialize_to_dir = hal_file.parent_path();
-            if (serialize_to_dir.empty())
-                return false;
+                /**
+                 * Skips the modules and the data entries of gates and nets and records their positions instead.
+                 */
+                void defer(DeferredContent* content, const std::function<size_t()>& tell)
+                {
+                    m_deferred = content;
+                    m_tell     = tell;
+                }
 
-            if (serialize_to_dir.is_relative())
-                serialize_to_dir = ProjectManager::instance()->get_project_directory() / serialize_to_dir;
+                bool end_deferred_modules()
+                {
+                    return finish_modules();
+                }
 
-            // create directory if it got erased in the meantime
-            if (!std::filesystem::exists(serialize_to_dir))
-            {
-                std::error_code err;
-                if (!std::filesystem::create_directories(serialize_to_dir, err))
+                void end_deferred_data(DataContainer* c)
                 {
-                    log_error("netlist_persistent", "Could not create directory '{}', error was '{}'.", serialize_to_dir.string(), err.message());
-                    return false;
+                    apply_data(c);
                 }
-            }
 
-            std::ofstream hal_file_stream;
-            hal_file_stream.open(hal_file.string());
-            if (hal_file_stream.fail())
-            {
-                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", hal_file.string());
-                return false;
-            }
+                bool requires_fallback() const
+                {
+                    return m_fallback;
+                }
 
-            rapidjson::Document document;
-            document.SetObject();
+                bool has_failed() const
+                {
+                    return m_failed;
+                }
 
-            document.AddMember("serialization_format_version", SERIALIZATION_FORMAT_VERSION, document.GetAllocator());
+                std::unique_ptr<Netlist> get_netlist()
+                {
+                    return std::move(m_result);
+                }
 
-            serialize(nl, document);
+                bool Default()
+                {
+                    // values of any other type are not part of the format and therefore ignored
+                    return true;
+                }
 
-            rapidjson::StringBuffer strbuf;
-#if PRETTY_JSON_OUTPUT == 1
-            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
-#else
-            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
-#endif
-            document.Accept(writer);
+                bool Bool(bool value)
+                {
+                    if (top() == Scope::pin_group)
+                    {
+                        if (m_key == "ascending")
+                        {
+                            m_pin_group.ascending = value;
+                        }
+                        else if (m_key == "ordered")
+                        {
+                            m_pin_group.ordered = value;
+                            m_has_ordered       = true;
+                        }
+                    }
+                    return true;
+                }
 
-            hal_file_stream << strbuf.GetString();
+                bool Int(int value)
+                {
+                    return number(value);
+                }
 
-            hal_file_stream.close();
+                bool Uint(unsigned value)
+                {
+                    return number(value);
+                }
 
-            log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+                bool Int64(int64_t value)
+                {
+                    return number(value);
+                }
 
-            return true;
-        }
+                bool Uint64(uint64_t value)
+                {
+                    return number((i64)value);
+                }
 
-        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gatelib)
-        {
-            auto begin_time = std::chrono::high_resolution_clock::now();
+                bool String(const char* str, rapidjson::SizeType length, bool)
+                {
+                    std::string value(str, length);
+                    switch (top())
+                    {
+                        case Scope::netlist:
+                            if (m_key == "gate_library")
+                            {
+                                m_gate_library_path = std::move(value);
+                            }
+                            else if (m_key == "input_file")
+                            {
+                                m_input_file = std::move(value);
+                            }
+                            else if (m_key == "design_name")
+                            {
+                                m_design_name = std::move(value);
+                            }
+                            else if (m_key == "device_name")
+                            {
+                                m_device_name = std::move(value);
+                            }
+                            break;
+                        case Scope::gate:
+                            if (m_key == "name")
+                            {
+                                m_gate.name = std::move(value);
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_gate.type = std::move(value);
+                            }
+                            break;
+                        case Scope::functions:
+                            m_gate.functions.emplace_back(m_key, std::move(value));
+                            break;
+                        case Scope::data_entry:
+                            m_data_entry.push_back(std::move(value));
+                            break;
+                        case Scope::net:
+                            if (m_key == "name")
+                            {
+                                m_net.name = std::move(value);
+                            }
+                            break;
+                        case Scope::module:
+                            if (m_key == "name")
+                            {
+                                m_module.name = std::move(value);
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_module.type     = std::move(value);
+                                m_module.has_type = true;
+                            }
+                            break;
+                        case Scope::pin_group:
+                            if (m_key == "name")
+                            {
+                                m_pin_group.name = std::move(value);
+                            }
+                            else if (m_key == "direction")
+                            {
+                                m_pin_group.direction = enum_from_string<PinDirection>(value);
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_pin_group.type = enum_from_string<PinType>(value);
+                            }
+                            break;
+                        case Scope::pin:
+                            if (m_key == "name")
+                            {
+                                m_pin.name = std::move(value);
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_pin.type = enum_from_string<PinType>(value);
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    return true;
+                }
+
+                bool Key(const char* str, rapidjson::SizeType length, bool)
+                {
+                    m_key.assign(str, length);
+                    switch (top())
+                    {
+                        case Scope::netlist:
+                            m_netlist_keys.insert(m_key);
+                            break;
+                        case Scope::endpoint:
+                            if (m_key == "pin_type")
+                            {
+                                return fallback();
+                            }
+                            break;
+                        case Scope::module:
+                            if (m_key == "input_ports" || m_key == "output_ports")
+                            {
+                                return fallback();
+                            }
+                            if (m_key == "gates")
+                            {
+                                m_module.has_gates = true;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    return true;
+                }
+
+                bool StartObject()
+                {
+                    Scope scope = Scope::skip;
+                    if (m_scopes.empty())
+                    {
+                        scope = Scope::root;
+                    }
+                    else
+                    {
+                        switch (top())
+                        {
+                            case Scope::root:
+                                if (m_key == "netlist")
+                                {
+                                    if (!begin_netlist())
+                                    {
+                                        return false;
+                                    }
+                                    scope = Scope::netlist;
+                                }
+                                break;
+                            case Scope::gates:
+                                m_gate = GateInformation();
+                                m_data.clear();
+                                m_data_offset.reset();
+                                scope = Scope::gate;
+                                break;
+                            case Scope::gate:
+                                if (m_key == "custom_functions")
+                                {
+                                    scope = Scope::functions;
+                                }
+                                break;
+                            case Scope::nets:
+                                m_net = NetInformation();
+                                m_data.clear();
+                                m_data_offset.reset();
+                                m_net_endpoints_begin = m_endpoints.size();
+                                scope                 = Scope::net;
+                                break;
+                            case Scope::endpoints:
+                                m_endpoint           = EndpointInformation();
+                                m_endpoint.is_source = m_is_source;
+                                scope                = Scope::endpoint;
+                                break;
+                            case Scope::modules:
+                                m_module = ModuleInformation();
+                                m_data.clear();
+                                scope = Scope::module;
+                                break;
+                            case Scope::pin_groups:
+                                m_pin_group   = PinGroupInformation();
+                                m_has_ordered = false;
+                                scope         = Scope::pin_group;
+                                break;
+                            case Scope::pins:
+                                m_pin = PinGroupInformation::PinInformation();
+                                scope = Scope::pin;
+                                break;
+                            default:
+                                break;
+                        }
+                    }
+                    m_scopes.push_back(scope);
+                    return true;
+                }
+
+                bool EndObject(rapidjson::SizeType)
+                {
+                    const Scope scope = top();
+                    m_scopes.pop_back();
+                    switch (scope)
+                    {
+                        case Scope::netlist:
+                            return end_netlist();
+                        case Scope::gate:
+                            return end_gate();
+                        case Scope::net:
+                            return end_net();
+                        case Scope::endpoint:
+                            m_endpoints.push_back(m_endpoint);
+                            return true;
+                        case Scope::module:
+                            return end_module();
+                        case Scope::pin_group:
+                            if (!m_has_ordered)
+                            {
+                                // same as the DOM-based loader
+                                m_pin_group.type = PinType::none;
+                            }
+                            m_module.pin_groups.push_back(std::move(m_pin_group));
+                            return true;
+                        case Scope::pin:
+                            m_pin_group.pins.push_back(std::move(m_pin));
+                            return true;
+                        default:
+                            return true;
+                    }
+                }
+
+                bool StartArray()
+                {
+                    Scope scope = Scope::skip;
+                    switch (top())
+                    {
+                        case Scope::netlist:
+                            if (m_key == "gates")
+                            {
+                                if (!create_netlist())
+                                {
+                                    return false;
+                                }
+                                scope = Scope::gates;
+                            }
+                            else if (m_key == "nets" || m_key == "global_vcc" || m_key == "global_gnd")
+                            {
+                                // gates have to be known beforehand
+                                if (!m_gates_done)
+                                {
+                                    return fallback();
+                                }
+                                scope = (m_key == "nets") ? Scope::nets : Scope::ids;
+                            }
+                            else if (m_key == "modules" || m_key == "global_in" || m_key == "global_out")
+                            {
+                                // nets have to be known beforehand
+                                if (!m_nets_done)
+                                {
+                                    return fallback();
+                                }
+                                scope = (m_key == "modules") ? Scope::modules : Scope::ids;
+                                if (scope == Scope::modules && m_deferred != nullptr)
+                                {
+                                    // '[' has already been consumed
+                                    m_deferred->modules_offset = m_tell() - 1;
+                                    scope                      = Scope::skip;
+                                }
+                            }
+                            m_ids_key = m_key;
+                            break;
+                        case Scope::gate:
+                        case Scope::net:
+                            if (m_key == "data")
+                            {
+                                scope = Scope::data;
+                                if (m_deferred != nullptr)
+                                {
+                                    m_data_offset = m_tell() - 1;
+                                    scope         = Scope::deferred_data;
+                                }
+                            }
+                            else if (top() == Scope::net && (m_key == "srcs" || m_key == "dsts"))
+                            {
+                                m_is_source = (m_key == "srcs");
+                                scope       = Scope::endpoints;
+                            }
+                            break;
+                        case Scope::module:
+                            if (m_key == "data")
+                            {
+                                scope = Scope::data;
+                            }
+                            else if (m_key == "gates")
+                            {
+                                scope = Scope::module_gates;
+                            }
+                            else if (m_key == "pin_groups")
+                            {
+                                scope = Scope::pin_groups;
+                            }
+                            break;
+                        case Scope::data:
+                            m_data_entry.clear();
+                            scope = Scope::data_entry;
+                            break;
+                        case Scope::pin_group:
+                            if (m_key == "pins")
+                            {
+                                scope = Scope::pins;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    m_scopes.push_back(scope);
+                    return true;
+                }
+
+                bool EndArray(rapidjson::SizeType element_count)
+                {
+                    const Scope scope = top();
+                    m_scopes.pop_back();
+                    switch (scope)
+                    {
+                        case Scope::deferred_data:
+                            if (element_count == 0)
+                            {
+                                // nothing to load later on
+                                m_data_offset.reset();
+                            }
+                            return true;
+                        case Scope::gates:
+                            m_gates_done = true;
+                            return true;
+                        case Scope::nets:
+                            m_nets_done = true;
+                            return wire_endpoints();
+                        case Scope::data_entry:
+                            if (m_data_entry.size() == 4)
+                            {
+                                m_data.push_back({std::move(m_data_entry[0]), std::move(m_data_entry[1]), std::move(m_data_entry[2]), std::move(m_data_entry[3])});
+                            }
+                            return true;
+                        default:
+                            return true;
+                    }
+                }
+
+            private:
+                enum class Scope
+                {
+                    root,
+                    netlist,
+                    gates,
+                    gate,
+                    functions,
+                    nets,
+                    net,
+                    endpoints,
+                    endpoint,
+                    modules,
+                    module,
+                    module_gates,
+                    pin_groups,
+                    pin_group,
+                    pins,
+                    pin,
+                    data,
+                    data_entry,
+                    deferred_data,
+                    ids,
+                    skip
+                };
+
+                struct GateInformation
+                {
+                    u32 id = 0;
+                    std::string name;
+                    std::string type;
+                    std::optional<i32> location_x;
+                    std::optional<i32> location_y;
+                    std::vector<std::pair<std::string, std::string>> functions;
+                };
+
+                struct NetInformation
+                {
+                    u32 id = 0;
+                    std::string name;
+                };
+
+                struct EndpointInformation
+                {
+                    Net* net       = nullptr;
+                    u32 gate_id    = 0;
+                    u32 pin_id     = 0;
+                    bool is_source = false;
+                };
+
+                struct ModuleInformation
+                {
+                    u32 id = 0;
+                    std::string name;
+                    std::string type;
+                    bool has_type  = false;
+                    u32 parent     = 0;
+                    bool has_gates = false;
+                    std::vector<u32> gate_ids;
+                    std::vector<PinGroupInformation> pin_groups;
+                };
+
+                struct FunctionInformation
+                {
+                    Gate* gate;
+                    std::string name;
+                    std::string expression;
+                    BooleanFunction function;
+                    std::string error;
+                };
+
+                GateLibrary* m_gatelib;
+                std::unique_ptr<Netlist> m_owned_netlist;
+                Netlist* m_netlist = nullptr;
+                std::unique_ptr<Netlist> m_result;
+                std::unordered_map<std::string, GateType*> m_gate_types;
+                bool m_fallback = false;
+                bool m_failed   = false;
+
+                DeferredContent* m_deferred = nullptr;
+                std::function<size_t()> m_tell;
+                std::optional<size_t> m_data_offset;
+                bool m_ignore_missing_gates = false;
+
+                std::vector<Scope> m_scopes;
+                std::string m_key;
+                std::string m_ids_key;
+
+                std::optional<u32> m_version;
+                std::unordered_set<std::string> m_netlist_keys;
+                std::string m_gate_library_path;
+                u32 m_netlist_id = 0;
+                std::string m_input_file;
+                std::string m_design_name;
+                std::string m_device_name;
+                bool m_gates_done = false;
+                bool m_nets_done  = false;
+
+                GateInformation m_gate;
+                NetInformation m_net;
+                EndpointInformation m_endpoint;
+                ModuleInformation m_module;
+                PinGroupInformation m_pin_group;
+                PinGroupInformation::PinInformation m_pin;
+                bool m_has_ordered = false;
+                bool m_is_source   = false;
+                std::vector<std::array<std::string, 4>> m_data;
+                std::vector<std::string> m_data_entry;
+
+                std::vector<FunctionInformation> m_functions;
+                std::vector<EndpointInformation> m_endpoints;
+                size_t m_net_endpoints_begin = 0;
+                std::unordered_map<Module*, std::vector<PinGroupInformation>> m_pin_group_cache;
+
+                Scope top() const
+                {
+                    return m_scopes.empty() ? Scope::skip : m_scopes.back();
+                }
+
+                bool fallback()
+                {
+                    m_fallback = true;
+                    return false;
+                }
+
+                bool fail()
+                {
+                    m_failed = true;
+                    return false;
+                }
+
+                bool number(i64 value)
+                {
+                    switch (top())
+                    {
+                        case Scope::root:
+                            if (m_key == "serialization_format_version")
+                            {
+                                m_version = (u32)value;
+                            }
+                            break;
+                        case Scope::netlist:
+                            if (m_key == "id")
+                            {
+                                m_netlist_id = (u32)value;
+                            }
+                            break;
+                        case Scope::gate:
+                            if (m_key == "id")
+                            {
+                                m_gate.id = (u32)value;
+                            }
+                            else if (m_key == "location_x")
+                            {
+                                m_gate.location_x = (i32)value;
+                            }
+                            else if (m_key == "location_y")
+                            {
+                                m_gate.location_y = (i32)value;
+                            }
+                            break;
+                        case Scope::net:
+                            if (m_key == "id")
+                            {
+                                m_net.id = (u32)value;
+                            }
+                            break;
+                        case Scope::endpoint:
+                            if (m_key == "gate_id")
+                            {
+                                m_endpoint.gate_id = (u32)value;
+                            }
+                            else if (m_key == "pin_id")
+                            {
+                                m_endpoint.pin_id = (u32)value;
+                            }
+                            break;
+                        case Scope::module:
+                            if (m_key == "id")
+                            {
+                                m_module.id = (u32)value;
+                            }
+                            else if (m_key == "parent")
+                            {
+                                m_module.parent = (u32)value;
+                            }
+                            break;
+                        case Scope::module_gates:
+                            m_module.gate_ids.push_back((u32)value);
+                            break;
+                        case Scope::pin_group:
+                            if (m_key == "id")
+                            {
+                                m_pin_group.id = (i32)value;
+                            }
+                            else if (m_key == "start_index")
+                            {
+                                m_pin_group.start_index = (u32)value;
+                            }
+                            break;
+                        case Scope::pin:
+                            if (m_key == "id")
+                            {
+                                m_pin.id = (i32)value;
+                            }
+                            else if (m_key == "net_id")
+                            {
+                                m_pin.net = m_netlist->get_net_by_id((u32)value);
+                            }
+                            break;
+                        case Scope::ids:
+                            return mark_global((u32)value);
+                        default:
+                            break;
+                    }
+                    return true;
+                }
+
+                bool begin_netlist()
+                {
+                    // legacy files need the DOM-based loader
+                    if (!m_version.has_value() || *m_version < 13)
+                    {
+                        return fallback();
+                    }
+
+                    encoded_format_version = *m_version;
+                    if (encoded_format_version < SERIALIZATION_FORMAT_VERSION)
+                    {
+                        log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
+                    }
+                    else if (encoded_format_version > SERIALIZATION_FORMAT_VERSION)
+                    {
+                        log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
+                    }
+                    return true;
+                }
+
+                bool create_netlist()
+                {
+                    if (m_netlist != nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (!m_gatelib)
+                    {
+                        // the gate library has to be known before the first gate is read
+                        if (m_netlist_keys.find("gate_library") == m_netlist_keys.end())
+                        {
+                            return fallback();
+                        }
+
+                        m_gatelib = load_gate_library(m_gate_library_path);
+                        if (m_gatelib == nullptr)
+                        {
+                            return fail();
+                        }
+                    }
+
+                    m_owned_netlist = std::make_unique<Netlist>(m_gatelib);
+                    m_netlist       = m_owned_netlist.get();
+
+                    // disable automatically checking module nets
+                    m_netlist->enable_automatic_net_checks(false);
+
+                    m_gate_types = m_gatelib->get_gate_types();
+                    return true;
+                }
+
+                void apply_data(DataContainer* c)
+                {
+                    for (const auto& entry : m_data)
+                    {
+                        c->set_data(entry[0], entry[1], entry[2], entry[3]);
+                    }
+                }
+
+                bool end_gate()
+                {
+                    const auto it = m_gate_types.find(m_gate.type);
+                    if (it == m_gate_types.end())
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize gate '" + m_gate.name + "' with ID " + std::to_string(m_gate.id) + ": failed to find gate '" + m_gate.type + "' in gate library '"
+                                      + m_gatelib->get_name() + "'");
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
+                        return fail();
+                    }
+
+                    const bool has_location = m_gate.location_x.has_value() && m_gate.location_y.has_value();
+                    Gate* gate              = m_netlist->create_gate(m_gate.id, it->second, m_gate.name, has_location ? *m_gate.location_x : -1, has_location ? *m_gate.location_y : -1);
+                    if (gate == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize gate '" + m_gate.name + "' with ID " + std::to_string(m_gate.id) + ": failed to create gate");
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
+                        return fail();
+                    }
+
+                    apply_data(gate);
+                    if (m_data_offset.has_value())
+                    {
+                        m_deferred->data_offsets.emplace(gate, *m_data_offset);
+                    }
+
+                    for (auto& [name, expression] : m_gate.functions)
+                    {
+                        m_functions.push_back({gate, std::move(name), std::move(expression), BooleanFunction(), ""});
+                    }
+                    return true;
+                }
+
+                bool end_net()
+                {
+                    Net* net = m_netlist->create_net(m_net.id, m_net.name);
+                    if (net == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize net '" + m_net.name + "' with ID " + std::to_string(m_net.id) + ": failed to create net");
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize net");
+                        return fail();
+                    }
+
+                    for (size_t i = m_net_endpoints_begin; i < m_endpoints.size(); i++)
+                    {
+                        m_endpoints[i].net = net;
+                    }
+
+                    apply_data(net);
+                    if (m_data_offset.has_value())
+                    {
+                        m_deferred->data_offsets.emplace(net, *m_data_offset);
+                    }
+                    return true;
+                }
+
+                bool wire_endpoint(const EndpointInformation& ep)
+                {
+                    Net* net                = ep.net;
+                    const std::string label = ep.is_source ? "source" : "destination";
+
+                    Gate* gate = m_netlist->get_gate_by_id(ep.gate_id);
+                    if (gate == nullptr)
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize " + label + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get gate with ID "
+                                      + std::to_string(ep.gate_id));
+                        return false;
+                    }
+
+                    GatePin* pin = gate->get_type()->get_pin_by_id(ep.pin_id);
+                    if (pin == nullptr)
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize " + label + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with ID "
+                                      + std::to_string(ep.pin_id));
+                        return false;
+                    }
+
+                    if (ep.is_source ? (net->add_source(gate, pin) == nullptr) : !net->add_destination(gate, pin))
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize " + label + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name()
+                                      + "' as " + label + " to net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()));
+                        return false;
+                    }
+                    return true;
+                }
+
+                bool wire_endpoints()
+                {
+                    // all gates and nets exist at this point, hence the endpoints are wired in a single pass in file order
+                    for (const EndpointInformation& ep : m_endpoints)
+                    {
+                        if (!wire_endpoint(ep))
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize net '" + ep.net->get_name() + "' with ID " + std::to_string(ep.net->get_id()) + ": failed to deserialize "
+                                          + (ep.is_source ? "source" : "destination"));
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize net");
+                            return fail();
+                        }
+                    }
+
+                    m_endpoints.clear();
+                    m_endpoints.shrink_to_fit();
+                    return true;
+                }
+
+                bool mark_global(u32 id)
+                {
+                    if (m_ids_key == "global_vcc" && !m_netlist->mark_vcc_gate(m_netlist->get_gate_by_id(id)))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark VCC gate");
+                        return fail();
+                    }
+                    if (m_ids_key == "global_gnd" && !m_netlist->mark_gnd_gate(m_netlist->get_gate_by_id(id)))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark GND gate");
+                        return fail();
+                    }
+                    if (m_ids_key == "global_in" && !m_netlist->mark_global_input_net(m_netlist->get_net_by_id(id)))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark global input net");
+                        return fail();
+                    }
+                    if (m_ids_key == "global_out" && !m_netlist->mark_global_output_net(m_netlist->get_net_by_id(id)))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark global output net");
+                        return fail();
+                    }
+                    return true;
+                }
+
+                bool end_module()
+                {
+                    Module* sm = m_netlist->get_top_module();
+                    if (m_module.parent == 0)
+                    {
+                        // top_module must not be created but might be renamed
+                        if (m_module.name != sm->get_name())
+                        {
+                            sm->set_name(m_module.name);
+                        }
+                    }
+                    else
+                    {
+                        sm = m_netlist->create_module(m_module.id, m_module.name, m_netlist->get_module_by_id(m_module.parent));
+                        if (sm == nullptr)
+                        {
+                            log_error("netlist_persistent", "could not deserialize module '" + m_module.name + "' with ID " + std::to_string(m_module.id) + ": failed to create module");
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module");
+                            return fail();
+                        }
+                    }
+
+                    if (m_module.has_type)
+                    {
+                        sm->set_type(m_module.type);
+                    }
+
+                    if (m_module.has_gates && !sm->is_top_module())
+                    {
+                        std::vector<Gate*> gates;
+                        gates.reserve(m_module.gate_ids.size());
+                        for (const u32 gate_id : m_module.gate_ids)
+                        {
+                            if (Gate* gate = m_netlist->get_gate_by_id(gate_id); gate != nullptr || !m_ignore_missing_gates)
+                            {
+                                gates.push_back(gate);
+                            }
+                        }
+                        sm->assign_gates(gates);
+                    }
+
+                    apply_data(sm);
+
+                    // pins need to be cached until all modules have been instantiated
+                    if (!m_module.pin_groups.empty())
+                    {
+                        auto& pin_groups = m_pin_group_cache[sm];
+                        std::move(m_module.pin_groups.begin(), m_module.pin_groups.end(), std::back_inserter(pin_groups));
+                    }
+                    return true;
+                }
+
+                bool finish_modules()
+                {
+                    // update module nets, internal nets, input nets, and output nets, every module only writes to its own net sets
+                    const std::vector<Module*> modules = m_netlist->get_modules();
+                    utils::run_in_chunks(0, modules.size(), 1, [&modules](u32 i) { modules[i]->update_nets(); });
+
+                    // load module pins (nets must have been updated beforehand)
+                    if (!deserialize_module_pins(m_pin_group_cache))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module pins");
+                        return fail();
+                    }
+                    return true;
+                }
+
+                bool end_netlist()
+                {
+                    if (!create_netlist())
+                    {
+                        return false;
+                    }
+
+                    for (const char* key : {"id", "input_file", "design_name", "device_name", "gates", "global_vcc", "global_gnd", "nets", "global_in", "global_out", "modules"})
+                    {
+                        if (m_netlist_keys.find(key) == m_netlist_keys.end())
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node '{}'", key);
+                            return fail();
+                        }
+                    }
+
+                    m_netlist->set_id(m_netlist_id);
+                    m_netlist->set_input_filename(m_input_file);
+                    m_netlist->set_design_name(m_design_name);
+                    m_netlist->set_device_name(m_device_name);
+
+                    // parse Boolean functions in parallel, but add them in file order
+                    utils::run_in_chunks(0, m_functions.size(), 64, [this](u32 i) {
+                        FunctionInformation& f = m_functions[i];
+                        if (auto res = BooleanFunction::from_string(f.expression); res.is_error())
+                        {
+                            f.error = res.get_error().get();
+                        }
+                        else
+                        {
+                            f.function = res.get();
+                        }
+                    });
+                    for (FunctionInformation& f : m_functions)
+                    {
+                        if (!f.error.empty())
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize gate '" + f.gate->get_name() + "' with ID " + std::to_string(f.gate->get_id()) + ": failed to parse Boolean function from string\n{}",
+                                      f.error);
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
+                            return fail();
+                        }
+                        f.gate->add_boolean_function(f.name, std::move(f.function));
+                    }
+                    m_functions.clear();
+
+                    // deferred modules are loaded once they are accessed for the first time
+                    if (m_deferred == nullptr && !finish_modules())
+                    {
+                        return false;
+                    }
+
+                    // re-enable automatically checking module nets
+                    m_netlist->enable_automatic_net_checks(true);
+
+                    m_result = std::move(m_owned_netlist);
+                    return true;
+                }
+            };
+
+            template<typename InputStream>
+            std::unique_ptr<Netlist> deserialize_stream(InputStream& is, GateLibrary* gatelib, bool& requires_fallback, DeferredContent* deferred = nullptr)
+            {
+                NetlistStreamHandler handler(gatelib);
+                if (deferred != nullptr)
+                {
+                    handler.defer(deferred, [&is]() { return is.Tell(); });
+                }
+                rapidjson::Reader reader;
+                const bool parse_error = reader.Parse(is, handler).IsError();
+
+                requires_fallback = handler.requires_fallback();
+                if (requires_fallback || handler.has_failed())
+                {
+                    return nullptr;
+                }
+
+                if (parse_error)
+                {
+                    log_error("netlist_persistent", "invalid json string for deserialization");
+                    return nullptr;
+                }
+
+                auto netlist = handler.get_netlist();
+                if (netlist == nullptr)
+                {
+                    log_error("netlist_persistent", "could not deserialize netlist: file has no 'netlist' node");
+                }
+                return netlist;
+            }
+
+            template<typename Writer, typename T>
+            void serialize_sorted_ids(const char* key, const std::vector<T*>& objects, Writer& writer)
+            {
+                std::vector<u32> ids;
+                ids.reserve(objects.size());
+                for (const T* object : objects)
+                {
+                    ids.push_back(object->get_id());
+                }
+                std::sort(ids.begin(), ids.end());
+                serialize_ids(key, ids, writer);
+            }
+
+            template<typename Writer, typename F>
+            void serialize_changed_objects(const char* key, const char* removed_key, const std::set<u32>& ids, const F& get_object, Writer& writer)
+            {
+                std::vector<u32> removed;
+                writer.Key(key);
+                writer.StartArray();
+                for (const u32 id : ids)
+                {
+                    if (const auto* object = get_object(id); object != nullptr)
+                    {
+                        serialize(object, writer);
+                    }
+                    else
+                    {
+                        removed.push_back(id);
+                    }
+                }
+                writer.EndArray();
+                serialize_ids(removed_key, removed, writer);
+            }
+
+            template<typename Writer>
+            void serialize_journal_entry(const Netlist* nl, const NetlistChanges& changes, Writer& writer)
+            {
+                writer.StartObject();
+                writer.Key("serialization_format_version");
+                writer.Int(SERIALIZATION_FORMAT_VERSION);
+
+                if (changes.netlist)
+                {
+                    writer.Key("netlist");
+                    writer.StartObject();
+                    writer.Key("id");
+                    writer.Uint(nl->get_id());
+                    writer.Key("input_file");
+                    writer.String(nl->get_input_filename().string());
+                    writer.Key("design_name");
+                    writer.String(nl->get_design_name());
+                    writer.Key("device_name");
+                    writer.String(nl->get_device_name());
+                    serialize_sorted_ids("global_vcc", nl->get_vcc_gates(), writer);
+                    serialize_sorted_ids("global_gnd", nl->get_gnd_gates(), writer);
+                    serialize_sorted_ids("global_in", nl->get_global_input_nets(), writer);
+                    serialize_sorted_ids("global_out", nl->get_global_output_nets(), writer);
+                    writer.EndObject();
+                }
+
+                serialize_changed_objects("gates", "removed_gates", changes.gates, [nl](u32 id) { return nl->get_gate_by_id(id); }, writer);
+                serialize_changed_objects("nets", "removed_nets", changes.nets, [nl](u32 id) { return nl->get_net_by_id(id); }, writer);
+                serialize_changed_objects("modules", "removed_modules", changes.modules, [nl](u32 id) { return nl->get_module_by_id(id); }, writer);
+                writer.EndObject();
+            }
+
+            /**
+             * Merges the entries of a journal into the document of a `.hal` file by replacing the records of changed objects and dropping the records of removed objects.
+             * Afterwards, gates and nets are sorted by ID and every module follows its parent, as if the document had been written from the resulting netlist.
+             */
+            bool merge_journal(rapidjson::Document& document, const std::filesystem::path& journal_file)
+            {
+                std::ifstream journal(journal_file, std::ios::binary);
+                if (!journal.is_open())
+                {
+                    log_error("netlist_persistent", "unable to open '{}'.", journal_file.string());
+                    return false;
+                }
+
+                auto& allocator                               = document.GetAllocator();
+                rapidjson::Value& root                        = document["netlist"];
+                const std::array<const char*, 3> sections     = {"gates", "nets", "modules"};
+                const std::array<const char*, 3> removed_keys = {"removed_gates", "removed_nets", "removed_modules"};
+                std::array<std::map<u32, rapidjson::Value>, 3> records;
+                for (u32 i = 0; i < sections.size(); i++)
+                {
+                    for (auto& record : root[sections[i]].GetArray())
+                    {
+                        records[i][record["id"].GetUint()] = record;
+                    }
+                }
+
+                std::string line;
+                u32 line_number = 0;
+                while (std::getline(journal, line))
+                {
+                    line_number++;
+                    if (line.empty())
+                    {
+                        continue;
+                    }
+
+                    // the entry shares the allocator of the document, hence its records can be moved into the document
+                    rapidjson::Document entry(&allocator);
+                    entry.Parse<0, rapidjson::UTF8<>>(line.c_str());
+                    if (entry.HasParseError() || !entry.IsObject())
+                    {
+                        if (journal.peek() == std::char_traits<char>::eof())
+                        {
+                            log_warning("netlist_persistent", "skipping truncated entry {} of journal '{}'.", line_number, journal_file.string());
+                            break;
+                        }
+                        log_error("netlist_persistent", "could not replay journal '{}': entry {} is invalid", journal_file.string(), line_number);
+                        return false;
+                    }
+
+                    if (!entry.HasMember("serialization_format_version") || entry["serialization_format_version"].GetInt() != SERIALIZATION_FORMAT_VERSION)
+                    {
+                        log_warning("netlist_persistent", "entry {} of journal '{}' was written with a different version of the serializer, deserialization may contain errors.", line_number, journal_file.string());
+                    }
+
+                    if (entry.HasMember("netlist"))
+                    {
+                        for (auto& member : entry["netlist"].GetObject())
+                        {
+                            if (auto it = root.FindMember(member.name); it != root.MemberEnd())
+                            {
+                                it->value = member.value;
+                            }
+                            else
+                            {
+                                root.AddMember(member.name, member.value, allocator);
+                            }
+                        }
+                    }
+
+                    for (u32 i = 0; i < sections.size(); i++)
+                    {
+                        if (entry.HasMember(removed_keys[i]))
+                        {
+                            for (const auto& id : entry[removed_keys[i]].GetArray())
+                            {
+                                records[i].erase(id.GetUint());
+                            }
+                        }
+                        if (entry.HasMember(sections[i]))
+                        {
+                            for (auto& record : entry[sections[i]].GetArray())
+                            {
+                                records[i][record["id"].GetUint()] = record;
+                            }
+                        }
+                    }
+                }
+
+                for (u32 i = 0; i < 2; i++)
+                {
+                    rapidjson::Value array(rapidjson::kArrayType);
+                    array.Reserve(records[i].size(), allocator);
+                    for (auto& [id, record] : records[i])
+                    {
+                        array.PushBack(record, allocator);
+                    }
+                    root[sections[i]] = array;
+                }
+
+                // the top module has parent 0
+                std::map<u32, std::vector<u32>> submodules;
+                for (const auto& [id, record] : records[2])
+                {
+                    submodules[record["parent"].GetUint()].push_back(id);
+                }
+                rapidjson::Value modules(rapidjson::kArrayType);
+                modules.Reserve(records[2].size(), allocator);
+                std::queue<u32> q;
+                q.push(0);
+                while (!q.empty())
+                {
+                    const u32 parent_id = q.front();
+                    q.pop();
+                    if (const auto it = submodules.find(parent_id); it != submodules.end())
+                    {
+                        for (const u32 module_id : it->second)
+                        {
+                            modules.PushBack(records[2][module_id], allocator);
+                            q.push(module_id);
+                        }
+                    }
+                }
+                if (modules.Size() != records[2].size())
+                {
+                    log_error("netlist_persistent", "could not replay journal '{}': the parent of a module does not exist", journal_file.string());
+                    return false;
+                }
+                root["modules"] = modules;
+
+                return true;
+            }
+        }    // namespace
+
+        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file, Format format)
+        {
+            WriteOptions options;
+            options.format = format;
+            return serialize_to_file(nl, hal_file, options);
+        }
+
+        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file, const WriteOptions& options)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            if (options.format == Format::binary)
+            {
+                return netlist_binary_serializer::serialize_to_file(nl, hal_file);
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            // deferred content may be read from the file that is about to be overwritten
+            if (!nl->load_deferred_content())
+            {
+                log_error("netlist_persistent", "could not serialize netlist: failed to load deferred content");
+                return false;
+            }
+
+            std::filesystem::path serialize_to_dir = hal_file.parent_path();
+            if (serialize_to_dir.empty())
+                return false;
+
+            if (serialize_to_dir.is_relative())
+                serialize_to_dir = ProjectManager::instance()->get_project_directory() / serialize_to_dir;
+
+            // create directory if it got erased in the meantime
+            if (!std::filesystem::exists(serialize_to_dir))
+            {
+                std::error_code err;
+                if (!std::filesystem::create_directories(serialize_to_dir, err))
+                {
+                    log_error("netlist_persistent", "Could not create directory '{}', error was '{}'.", serialize_to_dir.string(), err.message());
+                    return false;
+                }
+            }
+
+            // the transparent mode writes the file without compression
+            gzFile file = gzopen(hal_file.string().c_str(), options.compress ? "wb6" : "wbT");
+            if (file == NULL)
+            {
+                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", hal_file.string());
+                return false;
+            }
+
+            WriteProgress progress(options.progress_callback, nl->get_gates().size() + nl->get_nets().size() + nl->get_modules().size());
+            GzFileWriteStream os(file);
+            if (options.pretty)
+            {
+                rapidjson::PrettyWriter<GzFileWriteStream> writer(os);
+                serialize_document(nl, writer, progress);
+            }
+            else
+            {
+                rapidjson::Writer<GzFileWriteStream> writer(os);
+                serialize_document(nl, writer, progress);
+            }
+            os.Flush();
+
+            if (gzclose(file) != Z_OK || os.has_failed())
+            {
+                log_error("netlist_persistent", "could not write file {}: please verify that there is enough space left on the device", hal_file.string());
+                return false;
+            }
+
+            log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+
+            return true;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gatelib)
+        {
+            return deserialize_from_file(hal_file, gatelib, ReadOptions());
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gatelib, const ReadOptions& options)
+        {
+            if (netlist_binary_serializer::is_binary_file(hal_file))
+            {
+                return netlist_binary_serializer::deserialize_from_file(hal_file, gatelib, options);
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
 
             // event_controls::enable_all(false);
 
-            FILE* pFile = fopen(hal_file.string().c_str(), "rb");
-            if (pFile == NULL)
+            // compressed files are decompressed while reading, other files are read as they are
+            gzFile file = gzopen(hal_file.string().c_str(), "rb");
+            if (file == NULL)
             {
                 log_error("netlist_persistent", "unable to open '{}'.", hal_file.string());
                 return nullptr;
             }
 
-            char buffer[65536];
-            rapidjson::FileReadStream is(pFile, buffer, sizeof(buffer));
+            // sections are only deferred within uncompressed files, since compressed files do not support seeking efficiently
+            std::shared_ptr<DeferredContent> deferred;
+            if (options.lazy)
+            {
+                if (gzdirect(file) == 1)
+                {
+                    deferred = std::make_shared<DeferredContent>(hal_file);
+                }
+                else
+                {
+                    log_info("netlist_persistent", "lazy loading is not supported for compressed file '{}', reading the file completely instead.", hal_file.string());
+                }
+            }
+
+            auto is                = std::make_unique<GzFileReadStream>(file);
+            bool requires_fallback = false;
+            auto netlist           = deserialize_stream(*is, gatelib, requires_fallback, deferred.get());
+            if (!requires_fallback)
+            {
+                gzclose(file);
+                if (netlist && deferred != nullptr)
+                {
+                    if (!deferred->open())
+                    {
+                        log_error("netlist_persistent", "unable to open '{}'.", hal_file.string());
+                        return nullptr;
+                    }
+
+                    std::vector<DataContainer*> containers;
+                    containers.reserve(deferred->data_offsets.size());
+                    for (const auto& [container, offset] : deferred->data_offsets)
+                    {
+                        containers.push_back(container);
+                    }
+
+                    netlist->defer_modules([deferred](Netlist* nl) {
+                        NetlistStreamHandler handler(nl, "modules");
+                        return deferred->read(deferred->modules_offset, handler) && handler.end_deferred_modules();
+                    });
+                    netlist->defer_data(containers, [deferred](DataContainer* container) {
+                        const auto it = deferred->data_offsets.find(container);
+                        if (it == deferred->data_offsets.end())
+                        {
+                            return false;
+                        }
+                        NetlistStreamHandler handler(nullptr, "data");
+                        if (!deferred->read(it->second, handler))
+                        {
+                            return false;
+                        }
+                        handler.end_deferred_data(container);
+                        return true;
+                    });
+                }
+                if (netlist)
+                {
+                    log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+                }
+                return netlist;
+            }
+
+            // legacy files are read into a document instead
+            gzrewind(file);
+            is = std::make_unique<GzFileReadStream>(file);
+            rapidjson::Document document;
+            document.ParseStream<0, rapidjson::UTF8<>, GzFileReadStream>(*is);
+            gzclose(file);
+
+            return deserialize_document(document, gatelib, hal_file.string(), begin_time);
+        }
+
+        bool append_to_journal(const Netlist* nl, const NetlistChanges& changes, const std::filesystem::path& journal_file)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            // every entry is written as a single line, so that an interrupted write can only truncate the last entry
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            serialize_journal_entry(nl, changes, writer);
+
+            std::ofstream journal(journal_file, std::ios::binary | std::ios::app);
+            if (!journal.is_open())
+            {
+                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", journal_file.string());
+                return false;
+            }
+            journal.write(buffer.GetString(), buffer.GetSize());
+            journal.put('\n');
+            journal.flush();
+            if (!journal.good())
+            {
+                log_error("netlist_persistent", "could not write file {}: please verify that there is enough space left on the device", journal_file.string());
+                return false;
+            }
+
+            return true;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_journal(const std::filesystem::path& hal_file, const std::filesystem::path& journal_file, GateLibrary* gatelib)
+        {
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
             rapidjson::Document document;
-            document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(is);
-            fclose(pFile);
+            bool is_current_version = false;
+            if (!netlist_binary_serializer::is_binary_file(hal_file))
+            {
+                gzFile file = gzopen(hal_file.string().c_str(), "rb");
+                if (file == NULL)
+                {
+                    log_error("netlist_persistent", "unable to open '{}'.", hal_file.string());
+                    return nullptr;
+                }
+                auto is = std::make_unique<GzFileReadStream>(file);
+                document.ParseStream<0, rapidjson::UTF8<>, GzFileReadStream>(*is);
+                gzclose(file);
+
+                is_current_version = !document.HasParseError() && document.IsObject() && document.HasMember("netlist") && document.HasMember("serialization_format_version")
+                                     && document["serialization_format_version"].GetInt() == SERIALIZATION_FORMAT_VERSION;
+            }
+
+            if (!is_current_version)
+            {
+                // binary and legacy files are converted to a document of the current version, so that the records of the journal fit in
+                auto netlist = deserialize_from_file(hal_file, gatelib);
+                if (netlist == nullptr)
+                {
+                    return nullptr;
+                }
+
+                rapidjson::StringBuffer buffer;
+                rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+                const std::function<void(u64, u64)> no_progress_callback;
+                WriteProgress progress(no_progress_callback, 0);
+                serialize_document(netlist.get(), writer, progress);
+                document.Parse<0, rapidjson::UTF8<>>(buffer.GetString());
+            }
+
+            if (!merge_journal(document, journal_file))
+            {
+                return nullptr;
+            }
 
             return deserialize_document(document, gatelib, hal_file.string(), begin_time);
         }
@@ -1054,6 +2744,19 @@ namespace hal
 
             // event_controls::enable_all(false);
 
+            rapidjson::StringStream is(hal_string.c_str());
+            bool requires_fallback = false;
+            auto netlist           = deserialize_stream(is, gatelib, requires_fallback);
+            if (!requires_fallback)
+            {
+                if (netlist)
+                {
+                    log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", "source string", DURATION(begin_time));
+                }
+                return netlist;
+            }
+
+            // legacy strings are read into a document instead
             rapidjson::Document document;
             document.Parse<0, rapidjson::UTF8<> >(hal_string.c_str());
 
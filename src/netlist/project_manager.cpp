@@ -8,9 +8,11 @@
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <rapidjson/filereadstream.h>
 #include <rapidjson/stringbuffer.h>
 
@@ -21,7 +23,7 @@
 #include "rapidjson/writer.h"
 #endif
 
-const int SERIALIZATION_FORMAT_VERSION = 10;
+const int SERIALIZATION_FORMAT_VERSION = 11;
 
 namespace hal
 {
@@ -29,7 +31,7 @@ namespace hal
 
     const std::string ProjectManager::s_project_file = ".project.json";
 
-    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE)
+    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE), m_journal_enabled(false), m_journal_compaction_threshold(64), m_num_journal_entries(0)
     {
         ;
     }
@@ -136,6 +138,58 @@ namespace hal
         m_gatelib_path = glpath;
     }
 
+    void ProjectManager::set_netlist_format(netlist_serializer::Format format)
+    {
+        m_netlist_write_options.format = format;
+    }
+
+    netlist_serializer::Format ProjectManager::get_netlist_format() const
+    {
+        return m_netlist_write_options.format;
+    }
+
+    void ProjectManager::set_netlist_write_options(const netlist_serializer::WriteOptions& options)
+    {
+        m_netlist_write_options = options;
+    }
+
+    const netlist_serializer::WriteOptions& ProjectManager::get_netlist_write_options() const
+    {
+        return m_netlist_write_options;
+    }
+
+    void ProjectManager::set_netlist_read_options(const netlist_serializer::ReadOptions& options)
+    {
+        m_netlist_read_options = options;
+    }
+
+    const netlist_serializer::ReadOptions& ProjectManager::get_netlist_read_options() const
+    {
+        return m_netlist_read_options;
+    }
+
+    void ProjectManager::set_journal_enabled(bool enable)
+    {
+        m_journal_enabled = enable;
+        if (!enable)
+            m_netlist_journal.reset();
+    }
+
+    bool ProjectManager::is_journal_enabled() const
+    {
+        return m_journal_enabled;
+    }
+
+    void ProjectManager::set_journal_compaction_threshold(u32 threshold)
+    {
+        m_journal_compaction_threshold = threshold;
+    }
+
+    u32 ProjectManager::get_journal_compaction_threshold() const
+    {
+        return m_journal_compaction_threshold;
+    }
+
     bool ProjectManager::serialize_project(Netlist* netlist, bool shadow)
     {
         if (!netlist)
@@ -150,8 +204,46 @@ namespace hal
         else
             m_netlist_file = m_proj_dir.get_default_filename(".hal");
 
-        if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file))
-            return false;
+        // the journal can only be continued if it tracks the netlist since the netlist file was last written, autosaves are always written entirely
+        // data changes are not recorded by the journal, hence they also require writing the netlist entirely
+        std::filesystem::path journalPath = m_proj_dir.get_default_filename(".journal");
+        if (!shadow && m_journal_enabled && m_netlist_journal && m_netlist_journal->get_netlist() == m_netlist_save && m_netlist_journal->is_attached()
+            && !m_netlist_journal->has_data_changes() && m_num_journal_entries < m_journal_compaction_threshold && std::filesystem::exists(m_netlist_file))
+        {
+            if (m_netlist_journal->has_changes())
+            {
+                if (m_journal_file.empty())
+                {
+                    // do not continue a journal that is not referenced by the project file
+                    std::error_code errCode;
+                    std::filesystem::remove(journalPath, errCode);
+                }
+                if (!m_netlist_journal->append_to_file(journalPath))
+                    return false;
+                m_num_journal_entries++;
+                m_journal_file = journalPath.string();
+            }
+        }
+        else
+        {
+            if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file, m_netlist_write_options))
+                return false;
+
+            if (!shadow)
+            {
+                std::error_code errCode;
+                std::filesystem::remove(journalPath, errCode);
+                m_journal_file.clear();
+                m_num_journal_entries = 0;
+
+                if (!m_journal_enabled)
+                    m_netlist_journal.reset();
+                else if (m_netlist_journal && m_netlist_journal->get_netlist() == m_netlist_save && m_netlist_journal->is_attached())
+                    m_netlist_journal->clear();
+                else
+                    m_netlist_journal = std::make_unique<NetlistJournal>(m_netlist_save);
+            }
+        }
 
         if (!serialize_external(shadow))
             return false;
@@ -243,12 +335,58 @@ namespace hal
                 m_netlist_file = doc["netlist"].GetString();
                 std::filesystem::path netlistPath(m_proj_dir);
                 netlistPath.append(m_netlist_file);
-                m_netlist_load = netlist_factory::load_netlist(netlistPath,gatelibPath);
+
+                m_journal_file.clear();
+                m_num_journal_entries = 0;
+                if (doc.HasMember("netlist_journal"))
+                {
+                    std::filesystem::path journalPath(m_proj_dir);
+                    journalPath.append(doc["netlist_journal"].GetString());
+                    if (std::filesystem::exists(journalPath))
+                    {
+                        m_journal_file = journalPath.string();
+                        std::ifstream journal(journalPath, std::ios::binary);
+                        m_num_journal_entries = std::count(std::istreambuf_iterator<char>(journal), std::istreambuf_iterator<char>(), '\n');
+                    }
+                    else
+                    {
+                        log_warning("project_manager", "cannot find netlist journal '{}', loading netlist without it.", journalPath.string());
+                    }
+                }
+
+                if (m_journal_file.empty() && !m_netlist_read_options.lazy)
+                {
+                    m_netlist_load = netlist_factory::load_netlist(netlistPath, gatelibPath);
+                }
+                else
+                {
+                    GateLibrary* gatelib = gate_library_manager::load(gatelibPath);
+                    if (gatelib == nullptr)
+                    {
+                        log_error("project_manager", "cannot load gate library '{}'.", gatelibPath.string());
+                        return false;
+                    }
+                    // journals are always replayed onto the complete netlist
+                    if (m_journal_file.empty())
+                    {
+                        m_netlist_load = netlist_serializer::deserialize_from_file(netlistPath, gatelib, m_netlist_read_options);
+                    }
+                    else
+                    {
+                        m_netlist_load = netlist_serializer::deserialize_from_journal(netlistPath, m_journal_file, gatelib);
+                    }
+                }
                 if (!m_netlist_load)
                 {
                     log_error("project_manager", "cannot load netlist {}.", netlistPath.string());
                     return false;
                 }
+
+                std::error_code errCode;
+                if (m_journal_enabled && std::filesystem::equivalent(netlistPath, m_proj_dir.get_default_filename(".hal"), errCode))
+                    m_netlist_journal = std::make_unique<NetlistJournal>(m_netlist_load.get());
+                else
+                    m_netlist_journal.reset();
             }
             else
             {
@@ -310,6 +448,8 @@ namespace hal
         doc["serialization_format_version"] = SERIALIZATION_FORMAT_VERSION;
         doc["netlist"]                      = m_proj_dir.get_relative_file_path(m_netlist_file).string();
         doc["gate_library"]                 = m_proj_dir.get_relative_file_path(m_gatelib_path).string();
+        if (!shadow && !m_journal_file.empty())
+            doc["netlist_journal"] = m_proj_dir.get_relative_file_path(m_journal_file).string();
 
         if (!m_filename.empty())
         {
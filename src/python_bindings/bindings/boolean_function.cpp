@@ -1448,6 +1448,34 @@ namespace hal
             :rtype: list[list[hal_py.BooleanFunction.Value]] or None
         )");
 
+        py_boolean_function.def(
+            "compute_packed_truth_table",
+            [](const BooleanFunction& self, const std::vector<std::string>& ordered_variables, bool remove_unknown_variables) -> std::optional<std::vector<std::vector<u64>>> {
+                auto res = self.compute_packed_truth_table(ordered_variables, remove_unknown_variables);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("ordered_variables")        = std::vector<std::string>(),
+            py::arg("remove_unknown_variables") = false,
+            R"(
+            Computes the truth table outputs for a Boolean function that comprises <= 20 single-bit variables as packed bit vectors.
+            Row ``r`` assigns bit ``i`` of ``r`` to the ``i``-th variable and is stored in bit ``r % 64`` of word ``r / 64``.
+
+            **Warning:** The generation of the truth table is exponential in the number of parameters.
+
+            :param list[str] ordered_variables: A list describing the order of input variables used to generate the truth table. Defaults to an empty list.
+            :param bool remove_unknown_variables: Set True to remove variables from the truth table that are not present within the Boolean function, False otherwise. Defaults to False.
+            :returns: One list of 64-bit words per output bit on success, None otherwise.
+            :rtype: list[list[int]] or None
+        )");
+
         py_boolean_function.def(
             "get_truth_table_as_string",
             [](const BooleanFunction& self, const std::vector<std::string>& ordered_variables, std::string function_name, bool remove_unknown_variables) -> std::optional<std::string> {
@@ -1493,19 +1521,19 @@ namespace hal
             :type: int
         )");
 
-        py_boolean_function_node.def_readwrite("constant", &BooleanFunction::Node::constant, R"(
+        py_boolean_function_node.def_property_readonly("constant", &BooleanFunction::Node::constant, R"(
             The (optional) constant value of the node.
 
             :type: list[hal_py.BooleanFunction.Value]
         )");
 
-        py_boolean_function_node.def_readwrite("index", &BooleanFunction::Node::index, R"(
+        py_boolean_function_node.def_property_readonly("index", &BooleanFunction::Node::index, R"(
             The (optional) index value of the node.
 
             :type: int
         )");
 
-        py_boolean_function_node.def_readwrite("variable", &BooleanFunction::Node::variable, R"(
+        py_boolean_function_node.def_property_readonly("variable", &BooleanFunction::Node::variable, R"(
             The (optional) variable name of the node.
 
             :type: str
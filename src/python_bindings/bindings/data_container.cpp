@@ -12,7 +12,7 @@ namespace hal
             Construct a new data container.
         )");
 
-        py_data_container.def("set_data", &DataContainer::set_data, py::arg("category"), py::arg("key"), py::arg("data_type"), py::arg("value"), py::arg("log_with_info_level") = false, R"(
+        py_data_container.def("set_data", py::overload_cast<const std::string&, const std::string&, const std::string&, const std::string&, const bool>(&DataContainer::set_data), py::arg("category"), py::arg("key"), py::arg("data_type"), py::arg("value"), py::arg("log_with_info_level") = false, R"(
             Add a data entry.<br>
             May overwrite an existing entry.
 
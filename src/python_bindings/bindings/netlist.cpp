@@ -125,8 +125,8 @@ namespace hal
 
         py_netlist.def(
             "copy",
-            [](Netlist* nl) -> std::shared_ptr<Netlist> {
-                auto res = nl->copy();
+            [](Netlist* nl, u32 num_workers) -> std::shared_ptr<Netlist> {
+                auto res = nl->copy(num_workers);
                 if (res.is_ok())
                 {
                     return std::shared_ptr<Netlist>(res.get());
@@ -137,18 +137,51 @@ namespace hal
                     return nullptr;
                 }
             },
+            py::arg("num_workers") = 1,
             R"(
             Create a deep copy of the netlist.
+            The gates and nets of the netlist can be copied by multiple threads.
 
+            :param int num_workers: The maximum number of threads used to copy the netlist, ``0`` to use one thread per hardware thread. Defaults to ``1``.
             :returns: The copy of the netlist.
             :rtype: hal_py.Netlist
         )");
 
+        py_netlist.def("has_deferred_content", &Netlist::has_deferred_content, R"(
+            Check whether parts of the netlist have been deferred by a lazy deserializer and not been loaded yet.
+
+            :returns: ``True`` if parts of the netlist have not been loaded yet, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist.def("load_deferred_content", &Netlist::load_deferred_content, R"(
+            Load all deferred parts of the netlist at once, e.g., before the file they are loaded from is overwritten.
+
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
         py_netlist.def("clear_caches", &Netlist::clear_caches, R"(
             Clear all internal caches of the netlist.
             In a typical application, calling this function is not required.
         )");
 
+        py_netlist.def("enable_name_index", &Netlist::enable_name_index, py::arg("enable") = true, R"(
+            Enable or disable the name index of the netlist.
+            The name index maps the names of all gates, nets, and modules to the respective objects and speeds up :func:`get_gates_by_name`, :func:`get_gates_by_name_pattern`, and their counterparts for nets and modules.
+            It is built when enabled and kept up to date through the events of gates, nets, and modules.
+            Hence, names must not be changed while events are disabled.
+
+            :param bool enable: Set True to enable the name index, False to disable and free it.
+        )");
+
+        py_netlist.def("is_name_index_enabled", &Netlist::is_name_index_enabled, R"(
+            Check whether the name index of the netlist is enabled.
+
+            :returns: True if the name index is enabled, False otherwise.
+            :rtype: bool
+        )");
+
         py_netlist.def("get_unique_gate_id", &Netlist::get_unique_gate_id, R"(
             Get a spare gate ID.
             The value of 0 is reserved and represents an invalid ID.
@@ -242,6 +275,24 @@ namespace hal
             :rtype: list[hal_py.Gate]
         )");
 
+        py_netlist.def("get_gates_by_name", &Netlist::get_gates_by_name, py::arg("name"), R"(
+            Get all gates with the given name.
+            If the name index is enabled, see :func:`enable_name_index`, the gates are looked up in the index, otherwise all gates are checked.
+
+            :param str name: The name.
+            :returns: A list of gates sorted by ID.
+            :rtype: list[hal_py.Gate]
+        )");
+
+        py_netlist.def("get_gates_by_name_pattern", &Netlist::get_gates_by_name_pattern, py::arg("pattern"), R"(
+            Get all gates with a name matching the given wildcard pattern, where ``*`` matches any sequence of characters and ``?`` matches any single character.
+            If the name index is enabled, see :func:`enable_name_index`, only gates sharing a substring of at least three characters with the pattern are checked, otherwise all gates are checked.
+
+            :param str pattern: The pattern, e.g., ``*reg*`` for all gates with a name containing ``reg``.
+            :returns: A list of gates sorted by ID.
+            :rtype: list[hal_py.Gate]
+        )");
+
         py_netlist.def("mark_vcc_gate", &Netlist::mark_vcc_gate, py::arg("gate"), R"(
             Mark a gate as global VCC gate.
 
@@ -416,6 +467,24 @@ namespace hal
             :rtype: list[hal_py.Net]
         )");
 
+        py_netlist.def("get_nets_by_name", &Netlist::get_nets_by_name, py::arg("name"), R"(
+            Get all nets with the given name.
+            If the name index is enabled, see :func:`enable_name_index`, the nets are looked up in the index, otherwise all nets are checked.
+
+            :param str name: The name.
+            :returns: A list of nets sorted by ID.
+            :rtype: list[hal_py.Net]
+        )");
+
+        py_netlist.def("get_nets_by_name_pattern", &Netlist::get_nets_by_name_pattern, py::arg("pattern"), R"(
+            Get all nets with a name matching the given wildcard pattern, where ``*`` matches any sequence of characters and ``?`` matches any single character.
+            If the name index is enabled, see :func:`enable_name_index`, only nets sharing a substring of at least three characters with the pattern are checked, otherwise all nets are checked.
+
+            :param str pattern: The pattern, e.g., ``*reg*`` for all nets with a name containing ``reg``.
+            :returns: A list of nets sorted by ID.
+            :rtype: list[hal_py.Net]
+        )");
+
         py_netlist.def("mark_global_input_net", &Netlist::mark_global_input_net, py::arg("net"), R"(
             Mark a net as a global input net.
 
@@ -498,6 +567,44 @@ namespace hal
             :param bool enable_checks: Set True to enable automatic checks, False otherwise.
         )");
 
+        py_netlist.def("begin_bulk_edit", &Netlist::begin_bulk_edit, R"(
+            Begin a bulk edit of the netlist.
+            While a bulk edit is in progress, adding or removing sources and destinations of nets, marking global nets, and moving gates or modules between modules does not update the input, output, and internal nets of the affected modules.
+            Also, the events for added or removed net sources and destinations are held back.
+            When the outermost bulk edit ends, every affected net is classified once for all affected modules and the held back events are sent, with events of endpoints that have been added and removed again being dropped.
+            Bulk edits may be nested.
+
+            WARNING: the input, output, and internal nets and the pins of modules may be outdated while a bulk edit is in progress.
+        )");
+
+        py_netlist.def(
+            "end_bulk_edit",
+            [](Netlist* nl) -> bool {
+                if (auto res = nl->end_bulk_edit(); res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+            },
+            R"(
+            End a bulk edit of the netlist that has been started using hal_py.Netlist.begin_bulk_edit.
+            If this ends the outermost bulk edit, all deferred module net updates are performed and all held back events are sent.
+
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist.def("is_bulk_edit_active", &Netlist::is_bulk_edit_active, R"(
+            Check whether a bulk edit is in progress.
+
+            :returns: True if a bulk edit is in progress, False otherwise.
+            :rtype: bool
+        )");
+
         py_netlist.def("get_unique_module_id", &Netlist::get_unique_module_id, R"(
             Get a spare module ID.
             The value of 0 is reserved and represents an invalid ID.
@@ -587,6 +694,24 @@ namespace hal
             :rtype: list[hal_py.Module]
         )");
 
+        py_netlist.def("get_modules_by_name", &Netlist::get_modules_by_name, py::arg("name"), R"(
+            Get all modules with the given name.
+            If the name index is enabled, see :func:`enable_name_index`, the modules are looked up in the index, otherwise all modules are checked.
+
+            :param str name: The name.
+            :returns: A list of modules sorted by ID.
+            :rtype: list[hal_py.Module]
+        )");
+
+        py_netlist.def("get_modules_by_name_pattern", &Netlist::get_modules_by_name_pattern, py::arg("pattern"), R"(
+            Get all modules with a name matching the given wildcard pattern, where ``*`` matches any sequence of characters and ``?`` matches any single character.
+            If the name index is enabled, see :func:`enable_name_index`, only modules sharing a substring of at least three characters with the pattern are checked, otherwise all modules are checked.
+
+            :param str pattern: The pattern, e.g., ``*reg*`` for all modules with a name containing ``reg``.
+            :returns: A list of modules sorted by ID.
+            :rtype: list[hal_py.Module]
+        )");
+
         py_netlist.def_property_readonly("top_module", &Netlist::get_top_module, R"(
             The top module of the netlist.
 
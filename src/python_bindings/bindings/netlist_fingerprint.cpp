@@ -0,0 +1,91 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void netlist_fingerprint_init(py::module& m)
+    {
+        py::class_<NetlistFingerprint> py_netlist_fingerprint(m, "NetlistFingerprint", R"(
+            An incrementally maintained structural hash of a netlist.
+            The fingerprint assigns a hash to every gate, net, and module of the netlist and combines them into a hash of the entire netlist.
+            It subscribes to the events of the netlist and only recomputes the hashes of objects that have been changed since the last query.
+            Data entries and groupings are not covered by the fingerprint.
+        )");
+
+        py_netlist_fingerprint.def(py::init<Netlist*, u32>(), py::arg("netlist"), py::arg("num_workers") = 0, py::keep_alive<1, 2>(), R"(
+            Compute the fingerprint of the given netlist and start tracking its changes.
+
+            :param hal_py.Netlist netlist: The netlist.
+            :param int num_workers: The maximum number of threads used to compute the initial hashes, ``0`` to use one thread per hardware thread.
+        )");
+
+        py_netlist_fingerprint.def_property_readonly("hash", &NetlistFingerprint::get_hash, R"(
+            The hash of the entire netlist.
+
+            :type: int
+        )");
+
+        py_netlist_fingerprint.def("get_hash", &NetlistFingerprint::get_hash, R"(
+            Get the hash of the entire netlist.
+            Unequal hashes imply that the netlists differ in their structure, while equal hashes indicate structural equality with high probability.
+
+            :returns: The hash of the netlist.
+            :rtype: int
+        )");
+
+        py_netlist_fingerprint.def("get_gate_hash", &NetlistFingerprint::get_gate_hash, py::arg("gate"), R"(
+            Get the hash of the given gate.
+
+            :param hal_py.Gate gate: The gate.
+            :returns: The hash of the gate, or ``0`` if the gate is not part of the netlist.
+            :rtype: int
+        )");
+
+        py_netlist_fingerprint.def("get_net_hash", &NetlistFingerprint::get_net_hash, py::arg("net"), R"(
+            Get the hash of the given net.
+
+            :param hal_py.Net net: The net.
+            :returns: The hash of the net, or ``0`` if the net is not part of the netlist.
+            :rtype: int
+        )");
+
+        py_netlist_fingerprint.def("get_module_hash", &NetlistFingerprint::get_module_hash, py::arg("module"), R"(
+            Get the hash of the given module including all of its gates and submodules.
+
+            :param hal_py.Module module: The module.
+            :returns: The hash of the module, or ``0`` if the module is not part of the netlist.
+            :rtype: int
+        )");
+
+        py_netlist_fingerprint.def_property_readonly("modification_count", &NetlistFingerprint::get_modification_count, R"(
+            The number of tracked changes to the netlist.
+
+            :type: int
+        )");
+
+        py_netlist_fingerprint.def("get_modification_count", &NetlistFingerprint::get_modification_count, R"(
+            Get the number of tracked changes to the netlist.
+            The counter can be used to check in constant time whether the netlist has been changed since a previous analysis.
+
+            :returns: The number of changes.
+            :rtype: int
+        )");
+
+        py_netlist_fingerprint.def("get_module_structure_hash", &NetlistFingerprint::get_module_structure_hash, py::arg("module"), R"(
+            Get a hash of the structure of the given module that does not depend on IDs or names.
+            Two modules implementing the same circuit yield the same hash, e.g., multiple instances of the same hardware block.
+
+            :param hal_py.Module module: The module.
+            :returns: The structure hash of the module.
+            :rtype: int
+        )");
+
+        py_netlist_fingerprint.def("get_duplicate_modules", &NetlistFingerprint::get_duplicate_modules, py::arg("num_workers") = 0, R"(
+            Get groups of modules that share the same structure hash, i.e., modules that are likely instances of the same circuit.
+            The top module is not considered.
+
+            :param int num_workers: The maximum number of threads used to compute the structure hashes, ``0`` to use one thread per hardware thread.
+            :returns: A list of groups, each containing at least two modules.
+            :rtype: list[list[hal_py.Module]]
+        )");
+    }
+}    // namespace hal
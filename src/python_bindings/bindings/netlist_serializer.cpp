@@ -8,11 +8,83 @@ namespace hal
             HAL Netlist Serializer functions.
         )");
 
-        py_netlist_serializer.def("serialize_to_file", netlist_serializer::serialize_to_file, py::arg("netlist"), py::arg("hal_file"), R"(
+        py::enum_<netlist_serializer::Format> py_format(py_netlist_serializer, "Format", R"(
+            The formats of a ``.hal`` file.
+        )");
+
+        py_format.value("json", netlist_serializer::Format::json, R"(Human-readable JSON document.)")
+            .value("binary", netlist_serializer::Format::binary, R"(Memory-mappable binary container.)")
+            .export_values();
+
+        py::class_<netlist_serializer::WriteOptions> py_write_options(py_netlist_serializer, "WriteOptions", R"(
+            Options controlling how a netlist is written to a ``.hal`` file.
+        )");
+
+        py_write_options.def(py::init<>(), R"(
+            Constructs default write options, i.e., compact and uncompressed JSON without progress reporting.
+        )");
+
+        py_write_options.def_readwrite("format", &netlist_serializer::WriteOptions::format, R"(
+            The format of the ``.hal`` file.
+
+            :type: hal_py.NetlistSerializer.Format
+        )");
+
+        py_write_options.def_readwrite("pretty", &netlist_serializer::WriteOptions::pretty, R"(
+            Indent JSON files for readability instead of writing them compactly.
+
+            :type: bool
+        )");
+
+        py_write_options.def_readwrite("compress", &netlist_serializer::WriteOptions::compress, R"(
+            Compress JSON files using gzip. Compressed files are detected automatically when deserializing.
+
+            :type: bool
+        )");
+
+        py_write_options.def_readwrite("progress_callback", &netlist_serializer::WriteOptions::progress_callback, R"(
+            Called repeatedly while writing a JSON file with the number of gates, nets, and modules written so far and their total number.
+
+            :type: Callable[[int, int], None]
+        )");
+
+        py::class_<netlist_serializer::ReadOptions> py_read_options(py_netlist_serializer, "ReadOptions", R"(
+            Options controlling how a netlist is read from a ``.hal`` file.
+        )");
+
+        py_read_options.def(py::init<>(), R"(
+            Constructs default read options, i.e., the file is read completely.
+        )");
+
+        py_read_options.def_readwrite("lazy", &netlist_serializer::ReadOptions::lazy, R"(
+            Load the module hierarchy and the data entries of gates and nets only once they are accessed for the first time.
+            The ``.hal`` file must not be modified while content is still deferred.
+
+            :type: bool
+        )");
+
+        py_netlist_serializer.def("serialize_to_file",
+                                  py::overload_cast<const Netlist*, const std::filesystem::path&, const netlist_serializer::WriteOptions&>(netlist_serializer::serialize_to_file),
+                                  py::arg("netlist"),
+                                  py::arg("hal_file"),
+                                  py::arg("options"),
+                                  R"(
+            Serializes a netlist into a ``.hal`` file using the given write options.
+            The netlist is written incrementally, hence memory usage does not grow with the size of the file.
+        
+            :param hal_py.Netlist netlist: The netlist to serialize.
+            :param pathlib.Path hal_file: The path to the ``.hal`` file.
+            :param hal_py.NetlistSerializer.WriteOptions options: The write options.
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_serializer.def("serialize_to_file", py::overload_cast<const Netlist*, const std::filesystem::path&, netlist_serializer::Format>(netlist_serializer::serialize_to_file), py::arg("netlist"), py::arg("hal_file"), py::arg("format") = netlist_serializer::Format::json, R"(
             Serializes a netlist into a ``.hal`` file.
         
             :param hal_py.Netlist netlist: The netlist to serialize.
             :param pathlib.Path hal_file: The path to the ``.hal`` file.
+            :param hal_py.NetlistSerializer.Format format: The format of the ``.hal`` file. Defaults to ``json``.
             :returns: ``True`` on success, ``False`` otherwise.
             :rtype: bool
         )");
@@ -25,8 +97,47 @@ namespace hal
             R"(
                 Deserializes a netlist from a ``.hal`` file using the provided gate library.
                 If no gate library is provided, a gate library path must be specified within the ``.hal`` file.
+                The format of the file is detected automatically.
+            
+                :param pathlib.Path hal_file: The path to the ``.hal`` file.
+                :param hal_py.GateLibrary gate_lib: The gate library. Defaults to ``None``.
+                :returns: The deserialized netlist on success, ``None`` otherwise.
+                :rtype: hal_py.Netlist or None
+            )");
+
+        py_netlist_serializer.def(
+            "deserialize_from_file",
+            [](const std::filesystem::path& hal_file, GateLibrary* gate_lib, const netlist_serializer::ReadOptions& options) {
+                return std::shared_ptr<Netlist>(netlist_serializer::deserialize_from_file(hal_file, gate_lib, options));
+            },
+            py::arg("hal_file"),
+            py::arg("gate_lib"),
+            py::arg("options"),
+            R"(
+                Deserializes a netlist from a ``.hal`` file using the provided gate library and the given read options.
+                In lazy mode, modules and data entries are only read from the file once they are accessed for the first time.
             
                 :param pathlib.Path hal_file: The path to the ``.hal`` file.
+                :param hal_py.GateLibrary gate_lib: The gate library, may be ``None``.
+                :param hal_py.NetlistSerializer.ReadOptions options: The read options.
+                :returns: The deserialized netlist on success, ``None`` otherwise.
+                :rtype: hal_py.Netlist or None
+            )");
+
+        py_netlist_serializer.def(
+            "deserialize_from_journal",
+            [](const std::filesystem::path& hal_file, const std::filesystem::path& journal_file, GateLibrary* gate_lib = nullptr) {
+                return std::shared_ptr<Netlist>(netlist_serializer::deserialize_from_journal(hal_file, journal_file, gate_lib));
+            },
+            py::arg("hal_file"),
+            py::arg("journal_file"),
+            py::arg("gate_lib") = nullptr,
+            R"(
+                Deserializes a netlist from a ``.hal`` file and replays the entries of a journal file on top of it.
+                A truncated last entry, as left by an interrupted write, is skipped.
+            
+                :param pathlib.Path hal_file: The path to the ``.hal`` file the journal is based on.
+                :param pathlib.Path journal_file: The path to the journal file.
                 :param hal_py.GateLibrary gate_lib: The gate library. Defaults to ``None``.
                 :returns: The deserialized netlist on success, ``None`` otherwise.
                 :rtype: hal_py.Netlist or None
@@ -0,0 +1,108 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void netlist_snapshot_init(py::module& m)
+    {
+        py::class_<NetlistSnapshot> py_netlist_snapshot(m, "NetlistSnapshot", R"(
+            An immutable snapshot of the connectivity of a netlist.
+            Gates and nets are assigned dense indices and their connections are stored in compressed sparse row (CSR) arrays together with the type of the connecting pin.
+            The snapshot does not track later modifications of the netlist and must be rebuilt after the netlist has been changed.
+        )");
+
+        py_netlist_snapshot.def(py::init<const Netlist&, u32>(), py::arg("netlist"), py::arg("num_workers") = 0, py::keep_alive<1, 2>(), R"(
+            Build a snapshot of the connectivity of the given netlist.
+            The netlist must not be modified while the snapshot is built.
+
+            :param hal_py.Netlist netlist: The netlist.
+            :param int num_workers: The maximum number of threads used to build the snapshot, ``0`` to use one thread per hardware thread.
+        )");
+
+        py_netlist_snapshot.def_property_readonly("num_gates", &NetlistSnapshot::get_num_gates, R"(
+            The number of gates in the snapshot.
+
+            :type: int
+        )");
+
+        py_netlist_snapshot.def("get_num_gates", &NetlistSnapshot::get_num_gates, R"(
+            Get the number of gates in the snapshot.
+
+            :returns: The number of gates.
+            :rtype: int
+        )");
+
+        py_netlist_snapshot.def_property_readonly("num_nets", &NetlistSnapshot::get_num_nets, R"(
+            The number of nets in the snapshot.
+
+            :type: int
+        )");
+
+        py_netlist_snapshot.def("get_num_nets", &NetlistSnapshot::get_num_nets, R"(
+            Get the number of nets in the snapshot.
+
+            :returns: The number of nets.
+            :rtype: int
+        )");
+
+        py_netlist_snapshot.def(
+            "get_gate_index",
+            [](const NetlistSnapshot& self, const Gate* gate) -> std::optional<u32> {
+                if (const u32 index = self.get_gate_index(gate); index != NetlistSnapshot::INVALID_INDEX)
+                {
+                    return index;
+                }
+                return std::nullopt;
+            },
+            py::arg("gate"),
+            R"(
+            Get the index of the given gate.
+
+            :param hal_py.Gate gate: The gate.
+            :returns: The index of the gate, or ``None`` if the gate is not part of the snapshot.
+            :rtype: int or None
+        )");
+
+        py_netlist_snapshot.def(
+            "get_net_index",
+            [](const NetlistSnapshot& self, const Net* net) -> std::optional<u32> {
+                if (const u32 index = self.get_net_index(net); index != NetlistSnapshot::INVALID_INDEX)
+                {
+                    return index;
+                }
+                return std::nullopt;
+            },
+            py::arg("net"),
+            R"(
+            Get the index of the given net.
+
+            :param hal_py.Net net: The net.
+            :returns: The index of the net, or ``None`` if the net is not part of the snapshot.
+            :rtype: int or None
+        )");
+
+        py_netlist_snapshot.def("get_gate", &NetlistSnapshot::get_gate, py::arg("gate_index"), R"(
+            Get the gate at the given index.
+
+            :param int gate_index: The index of the gate.
+            :returns: The gate.
+            :rtype: hal_py.Gate
+        )");
+
+        py_netlist_snapshot.def("get_net", &NetlistSnapshot::get_net, py::arg("net_index"), R"(
+            Get the net at the given index.
+
+            :param int net_index: The index of the net.
+            :returns: The net.
+            :rtype: hal_py.Net
+        )");
+
+        py_netlist_snapshot.def("has_gate_property", &NetlistSnapshot::has_gate_property, py::arg("gate_index"), py::arg("property"), R"(
+            Check whether the gate type of the gate at the given index has the given property.
+
+            :param int gate_index: The index of the gate.
+            :param hal_py.GateTypeProperty property: The property.
+            :returns: ``True`` if the gate type has the property, ``False`` otherwise.
+            :rtype: bool
+        )");
+    }
+}    // namespace hal
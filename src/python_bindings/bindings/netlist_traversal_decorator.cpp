@@ -336,6 +336,38 @@ namespace hal
             :rtype: dict[hal_py.Gate,set[hal_py.Gate]] or None
         )");
 
+        py_netlist_traversal_decorator.def(
+            "get_next_sequential_gates_map",
+            [](NetlistTraversalDecorator& self, const NetlistSnapshot& snapshot, bool successors, const std::set<PinType>& forbidden_pins, u32 num_workers) -> std::optional<std::map<Gate*, std::set<Gate*>>> {
+                auto res = self.get_next_sequential_gates_map(snapshot, successors, forbidden_pins, num_workers);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while getting next sequential gates:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("snapshot"),
+            py::arg("successors"),
+            py::arg("forbidden_pins"),
+            py::arg("num_workers") = 0,
+            R"(
+            Get the next sequential gates for all sequential gates in the netlist by traversing the connectivity snapshot.
+            Compute a dict from a sequential gate to all its successors.
+            Stop traversal at all sequential gates, but only adds those to the result that have not been reached through a pin of one of the forbidden types.
+            The sequential gates are distributed across the given number of worker threads.
+
+            :param hal_py.NetlistSnapshot snapshot: A snapshot of the netlist.
+            :param bool successors: Set ``True`` to get successors, set ``False`` to get predecessors.
+            :param set[hal_py.PinType] forbidden_pins: Sequential gates reached through these pins will not be part of the result.
+            :param int num_workers: The maximum number of worker threads, ``0`` to use one thread per hardware thread. Defaults to ``0``.
+            :returns: A dict from each sequential gate to all its sequential successors on success, ``None`` otherwise.
+            :rtype: dict[hal_py.Gate,set[hal_py.Gate]] or None
+        )");
+
         py_netlist_traversal_decorator.def(
             "get_next_combinational_gates",
             [](NetlistTraversalDecorator& self, const Net* net, bool successors, const std::set<PinType>& forbidden_pins) -> std::optional<std::set<Gate*>> {
@@ -122,6 +122,76 @@ namespace hal
             :param str gl_path: The path to the gate library file.
         )");
 
+        py_project_manager.def("set_netlist_format", &ProjectManager::set_netlist_format, py::arg("format"), R"(
+            Set the format in which the netlist is saved by :func:`serialize_project`.
+            Projects are opened regardless of the format of their netlist file.
+
+            :param hal_py.NetlistSerializer.Format format: The netlist file format.
+        )");
+
+        py_project_manager.def("get_netlist_format", &ProjectManager::get_netlist_format, R"(
+            Get the format in which the netlist is saved by :func:`serialize_project`.
+
+            :returns: The netlist file format.
+            :rtype: hal_py.NetlistSerializer.Format
+        )");
+
+        py_project_manager.def("set_netlist_write_options", &ProjectManager::set_netlist_write_options, py::arg("options"), R"(
+            Set the options used to write the netlist file in :func:`serialize_project`.
+            This includes the netlist file format set by :func:`set_netlist_format`.
+
+            :param hal_py.NetlistSerializer.WriteOptions options: The netlist write options.
+        )");
+
+        py_project_manager.def("get_netlist_write_options", &ProjectManager::get_netlist_write_options, R"(
+            Get the options used to write the netlist file in :func:`serialize_project`.
+
+            :returns: The netlist write options.
+            :rtype: hal_py.NetlistSerializer.WriteOptions
+        )");
+
+        py_project_manager.def("set_netlist_read_options", &ProjectManager::set_netlist_read_options, py::arg("options"), R"(
+            Set the options used to read the netlist file when opening a project.
+            In lazy mode, the groupings of the project are read once they are accessed for the first time as well.
+
+            :param hal_py.NetlistSerializer.ReadOptions options: The netlist read options.
+        )");
+
+        py_project_manager.def("get_netlist_read_options", &ProjectManager::get_netlist_read_options, R"(
+            Get the options used to read the netlist file when opening a project.
+
+            :returns: The netlist read options.
+            :rtype: hal_py.NetlistSerializer.ReadOptions
+        )");
+
+        py_project_manager.def("set_journal_enabled", &ProjectManager::set_journal_enabled, py::arg("enable"), R"(
+            Enable or disable journaled saving of the netlist in :func:`serialize_project`.
+            If enabled, saving the project appends the gates, nets, and modules that have been changed since the last save to a journal file instead of rewriting the entire netlist file.
+            Changes to data entries and groupings only become persistent with the next full save.
+
+            :param bool enable: True to enable journaled saving, False to disable it.
+        )");
+
+        py_project_manager.def("is_journal_enabled", &ProjectManager::is_journal_enabled, R"(
+            Check whether journaled saving of the netlist is enabled.
+
+            :returns: True if journaled saving is enabled, False otherwise.
+            :rtype: bool
+        )");
+
+        py_project_manager.def("set_journal_compaction_threshold", &ProjectManager::set_journal_compaction_threshold, py::arg("threshold"), R"(
+            Set the number of journal entries after which the netlist file is rewritten entirely on the next save.
+
+            :param int threshold: The maximum number of journal entries.
+        )");
+
+        py_project_manager.def("get_journal_compaction_threshold", &ProjectManager::get_journal_compaction_threshold, R"(
+            Get the number of journal entries after which the netlist file is rewritten entirely on the next save.
+
+            :returns: The maximum number of journal entries.
+            :rtype: int
+        )");
+
         py_project_manager.def("serialize_project", &ProjectManager::serialize_project, py::arg("netlist"), py::arg("shadow") = false, R"(
             Serialize the netlist and all dependent data to the project directory.
 
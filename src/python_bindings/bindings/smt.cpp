@@ -328,6 +328,68 @@ namespace hal
             :rtype: bool
         )");
 
+        py::class_<SMT::BatchStatistics> py_smt_batch_statistics(py_smt, "BatchStatistics", R"(
+            Represents the statistics collected while processing a batch of SMT queries. All times are given in milliseconds.
+        )");
+
+        py_smt_batch_statistics.def(py::init<>(), R"(
+            Constructs empty batch statistics.
+        )");
+
+        py_smt_batch_statistics.def_readwrite("workers", &SMT::BatchStatistics::workers, R"(
+            The number of workers that processed the batch.
+
+            :type: int
+        )");
+
+        py_smt_batch_statistics.def_readwrite("queries", &SMT::BatchStatistics::queries, R"(
+            The number of queries in the batch.
+
+            :type: int
+        )");
+
+        py_smt_batch_statistics.def_readwrite("timeouts", &SMT::BatchStatistics::timeouts, R"(
+            The number of queries that did not yield a result within the timeout, i.e., that returned an unknown result.
+
+            :type: int
+        )");
+
+        py_smt_batch_statistics.def_readwrite("errors", &SMT::BatchStatistics::errors, R"(
+            The number of queries that failed with an error.
+
+            :type: int
+        )");
+
+        py_smt_batch_statistics.def_readwrite("wall_time", &SMT::BatchStatistics::wall_time, R"(
+            The time from submitting the batch until all queries have been processed.
+
+            :type: float
+        )");
+
+        py_smt_batch_statistics.def_readwrite("total_queue_time", &SMT::BatchStatistics::total_queue_time, R"(
+            The accumulated time queries waited for a free worker.
+
+            :type: float
+        )");
+
+        py_smt_batch_statistics.def_readwrite("max_queue_time", &SMT::BatchStatistics::max_queue_time, R"(
+            The longest time a single query waited for a free worker.
+
+            :type: float
+        )");
+
+        py_smt_batch_statistics.def_readwrite("total_solve_time", &SMT::BatchStatistics::total_solve_time, R"(
+            The accumulated time spent solving queries.
+
+            :type: float
+        )");
+
+        py_smt_batch_statistics.def_readwrite("max_solve_time", &SMT::BatchStatistics::max_solve_time, R"(
+            The longest time spent solving a single query.
+
+            :type: float
+        )");
+
         py::class_<SMT::Solver> py_smt_solver(py_smt, "Solver", R"(
             Provides an interface to query SMT solvers for a list of constraints, i.e. statements that have to be equal. To this end, we translate constraints to a SMT-LIB v2 string representation and query solvers with a defined configuration, i.e., chosen solver, model generation etc.
         )");
@@ -457,6 +519,207 @@ namespace hal
             :rtype: hal_py.SMT.Result or str
         )");
 
+        py_smt_solver.def_static(
+            "query_batch",
+            [](const std::vector<std::vector<SMT::Constraint>>& constraint_sets, const SMT::QueryConfig& config, u32 num_workers)
+                -> std::pair<std::vector<std::optional<SMT::SolverResult>>, SMT::BatchStatistics> {
+                SMT::BatchStatistics statistics;
+                auto results = SMT::Solver::query_batch(constraint_sets, config, num_workers, &statistics);
+
+                std::vector<std::optional<SMT::SolverResult>> py_results;
+                py_results.reserve(results.size());
+                for (auto& res : results)
+                {
+                    if (res.is_ok())
+                    {
+                        py_results.push_back(res.get());
+                    }
+                    else
+                    {
+                        log_error("python_context", "{}", res.get_error().get());
+                        py_results.push_back(std::nullopt);
+                    }
+                }
+                return {py_results, statistics};
+            },
+            py::arg("constraint_sets"),
+            py::arg("config")      = SMT::QueryConfig(),
+            py::arg("num_workers") = 0,
+            R"(
+            Queries an SMT solver for each of the given constraint sets using a bounded pool of worker threads.
+            The timeout of the query configuration applies to each query individually and the results are returned in the order of the constraint sets.
+
+            :param list[list[hal_py.SMT.Constraint]] constraint_sets: The independent constraint sets to query.
+            :param hal_py.SMT.QueryConfig config: The SMT solver query configuration.
+            :param int num_workers: The maximum number of workers, 0 to use one worker per hardware thread.
+            :returns: A tuple of the list of results (None for failed queries) and the statistics of the batch.
+            :rtype: tuple(list[hal_py.SMT.SolverResult or None],hal_py.SMT.BatchStatistics)
+        )");
+
+        py::class_<SMT::SolverSession> py_smt_solver_session(py_smt, "SolverSession", R"(
+            Provides a persistent, incremental interface to the linked Z3 library. In contrast to the Solver, a session keeps a single solver instance alive across queries, asserts constraints incrementally, and reuses translated terms between queries.
+        )");
+
+        py_smt_solver_session.def(py::init<const SMT::QueryConfig&>(), py::arg("config") = SMT::QueryConfig(), R"(
+            Constructs a solver session with the specified query configuration.
+            Only the model generation and timeout settings are considered, the session always uses the linked Z3 library.
+
+            :param hal_py.SMT.QueryConfig config: The SMT solver query configuration.
+        )");
+
+        py_smt_solver_session.def_property_readonly("config", &SMT::SolverSession::get_config, R"(
+            The query configuration of the session.
+
+            :type: hal_py.SMT.QueryConfig
+        )");
+
+        py_smt_solver_session.def("get_config", &SMT::SolverSession::get_config, R"(
+            Returns the query configuration of the session.
+
+            :returns: The query configuration.
+            :rtype: hal_py.SMT.QueryConfig
+        )");
+
+        py_smt_solver_session.def(
+            "add_constraint",
+            [](SMT::SolverSession& self, const SMT::Constraint& constraint) -> bool {
+                auto res = self.add_constraint(constraint);
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+            },
+            py::arg("constraint"),
+            R"(
+            Adds a constraint to the current scope of the session.
+
+            :param hal_py.SMT.Constraint constraint: The constraint.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def(
+            "add_constraints",
+            [](SMT::SolverSession& self, const std::vector<SMT::Constraint>& constraints) -> bool {
+                auto res = self.add_constraints(constraints);
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+            },
+            py::arg("constraints"),
+            R"(
+            Adds a list of constraints to the current scope of the session.
+            Either all constraints are added or, in case one of them cannot be translated, none of them.
+
+            :param list[hal_py.SMT.Constraint] constraints: The constraints.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def("push", &SMT::SolverSession::push, R"(
+            Opens a new scope. All constraints added afterwards are retracted by the matching call to pop.
+        )");
+
+        py_smt_solver_session.def(
+            "pop",
+            [](SMT::SolverSession& self, u32 levels) -> bool {
+                auto res = self.pop(levels);
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+            },
+            py::arg("levels") = 1,
+            R"(
+            Closes the specified number of scopes and retracts all constraints that have been added within them.
+
+            :param int levels: The number of scopes to close.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_smt_solver_session.def_property_readonly("scope_level", &SMT::SolverSession::get_scope_level, R"(
+            The number of currently open scopes.
+
+            :type: int
+        )");
+
+        py_smt_solver_session.def("get_scope_level", &SMT::SolverSession::get_scope_level, R"(
+            Returns the number of currently open scopes.
+
+            :returns: The number of open scopes.
+            :rtype: int
+        )");
+
+        py_smt_solver_session.def(
+            "query",
+            [](SMT::SolverSession& self, const std::vector<SMT::Constraint>& assumptions) -> std::optional<SMT::SolverResult> {
+                auto res = self.query(assumptions);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("assumptions") = std::vector<SMT::Constraint>(),
+            R"(
+            Checks the satisfiability of all active constraints of the session.
+            Additional assumptions are only considered for this query and are retracted afterwards.
+
+            :param list[hal_py.SMT.Constraint] assumptions: The (optional) constraints that are only active during this query.
+            :returns: The result on success, None otherwise.
+            :rtype: hal_py.SMT.SolverResult or None
+        )");
+
+        py_smt_solver_session.def("reset", &SMT::SolverSession::reset, R"(
+            Removes all constraints and scopes from the session while keeping the solver instance alive.
+        )");
+
+        py_smt_solver_session.def("get_query_count", &SMT::SolverSession::get_query_count, R"(
+            Returns the number of queries issued within this session.
+
+            :returns: The number of queries.
+            :rtype: int
+        )");
+
+        py_smt_solver_session.def("get_term_cache_hits", &SMT::SolverSession::get_term_cache_hits, R"(
+            Returns the number of Boolean function translations that have been served from the term cache.
+
+            :returns: The number of cache hits.
+            :rtype: int
+        )");
+
+        py_smt_solver_session.def("get_term_cache_misses", &SMT::SolverSession::get_term_cache_misses, R"(
+            Returns the number of Boolean function translations that had to be computed.
+
+            :returns: The number of cache misses.
+            :rtype: int
+        )");
+
+        py_smt_solver_session.def("clear_term_cache", &SMT::SolverSession::clear_term_cache, R"(
+            Clears the cache of translated Boolean functions.
+        )");
+
         py::class_<SMT::SymbolicState> py_smt_symbolic_state(py_smt, "SymbolicState", R"(
            Represents the data structure that keeps track of symbolic variable values (e.g., required for symbolic simplification).
         )");
@@ -75,6 +75,10 @@ namespace hal
 
         netlist_modification_decorator_init(m);
 
+        netlist_snapshot_init(m);
+
+        netlist_fingerprint_init(m);
+
         netlist_traversal_decorator_init(m);
 
         log_init(m);
@@ -0,0 +1,133 @@
+#include "hal_core/netlist/boolean_function.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+/*
+ * Microbenchmark for the memory footprint and the per-node cost of common Boolean function operations.
+ * Only uses the public BooleanFunction API, so it can be run against different node layouts for comparison.
+ *
+ * Usage: benchmark-boolean_function_nodes [num_nodes]
+ */
+
+namespace
+{
+    std::atomic<std::size_t> allocated_bytes{0};
+    std::atomic<std::size_t> allocation_count{0};
+}    // namespace
+
+void* operator new(std::size_t size)
+{
+    allocated_bytes += size;
+    allocation_count++;
+    if (void* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace hal
+{
+    namespace
+    {
+        /**
+         * Builds a function of roughly the requested size that mixes operations, variables, and constants.
+         */
+        BooleanFunction build_function(u32 num_nodes)
+        {
+            auto function = BooleanFunction::Var("net_0");
+            for (u32 i = 1; function.get_nodes().size() + 4 <= num_nodes; i++)
+            {
+                auto operand = BooleanFunction::Var("net_" + std::to_string(i % 512));
+                switch (i % 4)
+                {
+                    case 0:
+                        function = std::move(function) & (std::move(operand) | BooleanFunction::Const(i & 1, 1));
+                        break;
+                    case 1:
+                        function = std::move(function) | (std::move(operand) ^ BooleanFunction::Const(0, 1));
+                        break;
+                    case 2:
+                        function = std::move(function) ^ ~std::move(operand);
+                        break;
+                    default:
+                        function = ~(std::move(function) & std::move(operand));
+                        break;
+                }
+            }
+            return function;
+        }
+
+        template<typename F>
+        void measure(const std::string& name, u64 num_nodes, u32 repetitions, F&& f)
+        {
+            const auto bytes_before       = allocated_bytes.load();
+            const auto allocations_before = allocation_count.load();
+            const auto begin              = std::chrono::steady_clock::now();
+            for (u32 i = 0; i < repetitions; i++)
+            {
+                f();
+            }
+            const auto end = std::chrono::steady_clock::now();
+
+            const double total_nodes = (double)num_nodes * repetitions;
+            const double ns          = std::chrono::duration<double, std::nano>(end - begin).count();
+            std::printf("%-20s %12.2f ns/node %12.2f allocs/node %12.2f bytes/node\n",
+                        name.c_str(),
+                        ns / total_nodes,
+                        (allocation_count.load() - allocations_before) / total_nodes,
+                        (allocated_bytes.load() - bytes_before) / total_nodes);
+        }
+    }    // namespace
+}    // namespace hal
+
+int main(int argc, char** argv)
+{
+    using namespace hal;
+
+    const u32 num_nodes = (argc > 1) ? std::stoul(argv[1]) : 10000;
+
+    const auto function = build_function(num_nodes);
+    const u64 size      = function.get_nodes().size();
+
+    std::printf("sizeof(BooleanFunction::Node): %zu bytes\n", sizeof(BooleanFunction::Node));
+    std::printf("function size: %lu nodes\n\n", (unsigned long)size);
+
+    measure("clone", size, 200, [&function]() { volatile auto n = function.clone().get_nodes().size(); (void)n; });
+
+    measure("copy construct", size, 200, [&function]() {
+        const BooleanFunction copy(function);
+        volatile auto n = copy.get_nodes().size();
+        (void)n;
+    });
+
+    measure("substitute (rename)", size, 20, [&function]() {
+        volatile auto n = function.substitute("net_1", "net_renamed").get_nodes().size();
+        (void)n;
+    });
+
+    measure("compare", size, 200, [&function]() {
+        const auto copy  = function.clone();
+        volatile auto eq = (copy == function);
+        (void)eq;
+    });
+
+    measure("simplify_local", size, 2, [&function]() { volatile auto n = function.simplify_local().get_nodes().size(); (void)n; });
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/id_allocator.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+
+#include <chrono>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+/*
+ * Benchmark for the bookkeeping of object IDs when creating and deleting large numbers of objects.
+ * Compares the IdAllocator against the previous set-based bookkeeping, which is reproduced here for reference,
+ * and measures the creation and deletion of nets in a netlist.
+ *
+ * Usage: benchmark-id_allocation [num_ids] [num_nets]
+ */
+
+namespace hal
+{
+    namespace
+    {
+        /**
+         * The set-based bookkeeping previously used by netlists, modules, and gate types.
+         */
+        struct SetIdTracker
+        {
+            u32 next_id = 1;
+            std::set<u32> used_ids;
+            std::set<u32> free_ids;
+
+            u32 get_unique_id()
+            {
+                if (!free_ids.empty())
+                {
+                    return *(free_ids.begin());
+                }
+                while (used_ids.find(next_id) != used_ids.end())
+                {
+                    next_id++;
+                }
+                return next_id;
+            }
+
+            void reserve(u32 id)
+            {
+                if (auto free_id_it = free_ids.find(id); free_id_it != free_ids.end())
+                {
+                    free_ids.erase(free_id_it);
+                }
+                used_ids.insert(id);
+            }
+
+            void release(u32 id)
+            {
+                free_ids.insert(id);
+                used_ids.erase(id);
+            }
+        };
+
+        template<typename F>
+        double measure(F&& f)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(end - begin).count();
+        }
+
+        template<typename T>
+        void run_tracker(const std::string& name, u32 num_ids)
+        {
+            T tracker;
+            const double create = measure([&]() {
+                for (u32 i = 0; i < num_ids; i++)
+                {
+                    tracker.reserve(tracker.get_unique_id());
+                }
+            });
+            const double remove = measure([&]() {
+                // delete every other object first to fragment the ID space
+                for (u32 id = 2; id <= num_ids; id += 2)
+                {
+                    tracker.release(id);
+                }
+                for (u32 id = 1; id <= num_ids; id += 2)
+                {
+                    tracker.release(id);
+                }
+            });
+            const double recreate = measure([&]() {
+                for (u32 i = 0; i < num_ids; i++)
+                {
+                    tracker.reserve(tracker.get_unique_id());
+                }
+            });
+            std::printf("%-14s create %8.2f ns/id   delete %8.2f ns/id   recreate %8.2f ns/id\n", name.c_str(), create / num_ids, remove / num_ids, recreate / num_ids);
+        }
+    }    // namespace
+}    // namespace hal
+
+int main(int argc, char** argv)
+{
+    using namespace hal;
+
+    const u32 num_ids  = (argc > 1) ? std::stoul(argv[1]) : 10000000;
+    const u32 num_nets = (argc > 2) ? std::stoul(argv[2]) : 100000;
+
+    std::printf("ID bookkeeping for %u objects\n", num_ids);
+    run_tracker<SetIdTracker>("std::set", num_ids);
+    run_tracker<IdAllocator>("IdAllocator", num_ids);
+
+    std::printf("\nnetlist with %u nets\n", num_nets);
+    GateLibrary gate_library("", "benchmark_library");
+    auto nl = netlist_factory::create_netlist(&gate_library);
+    std::vector<Net*> nets;
+    nets.reserve(num_nets);
+    const double create = measure([&]() {
+        for (u32 i = 0; i < num_nets; i++)
+        {
+            nets.push_back(nl->create_net("net"));
+        }
+    });
+    const double remove = measure([&]() {
+        for (Net* net : nets)
+        {
+            nl->delete_net(net);
+        }
+    });
+    std::printf("%-14s create %8.2f ns/net  delete %8.2f ns/net\n", "Netlist", create / num_nets, remove / num_nets);
+
+    return 0;
+}
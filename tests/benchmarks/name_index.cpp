@@ -0,0 +1,85 @@
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+ * Benchmark for the lookup of gates by name.
+ * Builds a netlist of unconnected gates with hierarchical names and compares exact and wildcard lookups with and without the name index of the netlist.
+ *
+ * Usage: benchmark-name_index [num_gates] [num_queries]
+ */
+
+namespace hal
+{
+    namespace
+    {
+        template<typename F>
+        double measure(F&& f)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(end - begin).count();
+        }
+    }    // namespace
+}    // namespace hal
+
+int main(int argc, char** argv)
+{
+    using namespace hal;
+
+    const u32 num_gates   = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    const u32 num_queries = (argc > 2) ? std::stoul(argv[2]) : 100;
+
+    GateLibrary gate_library("", "benchmark_library");
+    GateType* gate_type = gate_library.create_gate_type("AND", {GateTypeProperty::combinational, GateTypeProperty::c_and});
+    gate_type->create_pin("I", PinDirection::input);
+    gate_type->create_pin("O", PinDirection::output);
+
+    auto nl = netlist_factory::create_netlist(&gate_library);
+    for (u32 i = 0; i < num_gates; i++)
+    {
+        nl->create_gate(gate_type, "core/unit_" + std::to_string(i % 97) + "/reg_" + std::to_string(i));
+    }
+
+    const auto run_queries = [&](u64& num_results) {
+        const double exact = measure([&]() {
+            for (u32 q = 0; q < num_queries; q++)
+            {
+                num_results += nl->get_gates_by_name("core/unit_" + std::to_string(q % 97) + "/reg_" + std::to_string(q * 7919 % num_gates)).size();
+            }
+        });
+        const double pattern = measure([&]() {
+            for (u32 q = 0; q < num_queries; q++)
+            {
+                num_results += nl->get_gates_by_name_pattern("*/reg_" + std::to_string(q * 7919 % num_gates) + "*").size();
+            }
+        });
+        return std::make_pair(exact / num_queries, pattern / num_queries);
+    };
+
+    u64 results_scan = 0;
+    const auto [exact_scan, pattern_scan] = run_queries(results_scan);
+
+    const double build = measure([&]() { nl->enable_name_index(); });
+
+    u64 results_index = 0;
+    const auto [exact_index, pattern_index] = run_queries(results_index);
+
+    std::printf("%u gates, %u queries\n", num_gates, num_queries);
+    std::printf("build index              %10.2f ms\n", build / 1e6);
+    std::printf("exact   without index    %10.2f us/query\n", exact_scan / 1e3);
+    std::printf("exact   with index       %10.2f us/query\n", exact_index / 1e3);
+    std::printf("pattern without index    %10.2f us/query\n", pattern_scan / 1e3);
+    std::printf("pattern with index       %10.2f us/query\n", pattern_index / 1e3);
+    std::printf("results equal: %s\n", (results_scan == results_index) ? "yes" : "no");
+
+    return (results_scan == results_index) ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+ * Benchmark for the deep copy of netlists.
+ * Builds a netlist of gates in which every gate drives a net connected to input j of the j-th succeeding gate and distributes the gates over a two-level module hierarchy.
+ * Compares Netlist::copy using one and all hardware threads against re-creating the netlist through the public API within a bulk edit, which is reproduced here for reference.
+ *
+ * Usage: benchmark-netlist_copy [num_gates] [fan_out] [num_modules]
+ */
+
+namespace hal
+{
+    namespace
+    {
+        template<typename F>
+        double measure(F&& f)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(end - begin).count();
+        }
+
+        /**
+         * Copy a netlist by re-creating all of its nets, gates, connections, and modules through the public API.
+         */
+        std::unique_ptr<Netlist> copy_via_public_api(const Netlist* nl)
+        {
+            auto c_nl = netlist_factory::create_netlist(nl->get_gate_library());
+            c_nl->begin_bulk_edit();
+
+            for (const Net* net : nl->get_nets())
+            {
+                c_nl->create_net(net->get_id(), net->get_name());
+            }
+
+            for (const Gate* gate : nl->get_gates())
+            {
+                Gate* c_gate = c_nl->create_gate(gate->get_id(), gate->get_type(), gate->get_name(), gate->get_location_x(), gate->get_location_y());
+                for (const Endpoint* ep : gate->get_fan_in_endpoints())
+                {
+                    c_nl->get_net_by_id(ep->get_net()->get_id())->add_destination(c_gate, ep->get_pin());
+                }
+                for (const Endpoint* ep : gate->get_fan_out_endpoints())
+                {
+                    c_nl->get_net_by_id(ep->get_net()->get_id())->add_source(c_gate, ep->get_pin());
+                }
+            }
+
+            for (const Module* module : nl->get_modules())
+            {
+                if (module->is_top_module())
+                {
+                    continue;
+                }
+
+                std::vector<Gate*> c_gates;
+                for (const Gate* gate : module->get_gates())
+                {
+                    c_gates.push_back(c_nl->get_gate_by_id(gate->get_id()));
+                }
+                c_nl->create_module(module->get_id(), module->get_name(), c_nl->get_top_module(), c_gates);
+            }
+
+            for (const Module* module : nl->get_modules())
+            {
+                if (!module->is_top_module())
+                {
+                    c_nl->get_module_by_id(module->get_id())->set_parent_module(c_nl->get_module_by_id(module->get_parent_module()->get_id()));
+                }
+            }
+
+            c_nl->end_bulk_edit();
+            return c_nl;
+        }
+    }    // namespace
+}    // namespace hal
+
+int main(int argc, char** argv)
+{
+    using namespace hal;
+
+    const u32 num_gates   = (argc > 1) ? std::stoul(argv[1]) : 200000;
+    const u32 fan_out     = (argc > 2) ? std::stoul(argv[2]) : 4;
+    const u32 num_modules = (argc > 3) ? std::stoul(argv[3]) : 64;
+
+    GateLibrary gate_library("", "benchmark_library");
+    GateType* gate_type = gate_library.create_gate_type("AND", {GateTypeProperty::combinational, GateTypeProperty::c_and});
+    std::vector<GatePin*> in_pins;
+    for (u32 j = 0; j < fan_out; j++)
+    {
+        in_pins.push_back(gate_type->create_pin("I" + std::to_string(j), PinDirection::input).get());
+    }
+    GatePin* out = gate_type->create_pin("O", PinDirection::output).get();
+
+    auto nl = netlist_factory::create_netlist(&gate_library);
+    nl->begin_bulk_edit();
+
+    std::vector<Gate*> gates;
+    gates.reserve(num_gates);
+    for (u32 i = 0; i < num_gates; i++)
+    {
+        gates.push_back(nl->create_gate(gate_type, "gate_" + std::to_string(i)));
+        gates.back()->set_data("generic", "INIT", "bit_vector", "8000");
+    }
+    for (u32 i = 0; i < num_gates; i++)
+    {
+        Net* net = nl->create_net("net_" + std::to_string(i));
+        net->add_source(gates[i], out);
+        for (u32 j = 0; j < fan_out && i + j + 1 < num_gates; j++)
+        {
+            net->add_destination(gates[i + j + 1], in_pins[j]);
+        }
+    }
+
+    // every module holds a contiguous slice of the gates, half of which is moved into a submodule
+    const u32 slice = num_gates / (2 * num_modules);
+    for (u32 m = 0; m < num_modules && slice > 0; m++)
+    {
+        std::vector<Gate*> outer(gates.begin() + 2 * m * slice, gates.begin() + (2 * m + 1) * slice);
+        std::vector<Gate*> inner(gates.begin() + (2 * m + 1) * slice, gates.begin() + (2 * m + 2) * slice);
+        Module* module = nl->create_module("module_" + std::to_string(m), nl->get_top_module(), outer);
+        nl->create_module("submodule_" + std::to_string(m), module, inner);
+    }
+
+    nl->end_bulk_edit();
+
+    std::unique_ptr<Netlist> reference_copy;
+    const double reference = measure([&]() { reference_copy = copy_via_public_api(nl.get()); });
+
+    std::unique_ptr<Netlist> serial_copy;
+    const double serial = measure([&]() { serial_copy = nl->copy(1).get(); });
+
+    std::unique_ptr<Netlist> parallel_copy;
+    const double parallel = measure([&]() { parallel_copy = nl->copy(0).get(); });
+
+    const bool equal = (*serial_copy == *nl) && (*parallel_copy == *nl);
+
+    std::printf("%u gates, %u nets, %u modules\n", num_gates, num_gates, (u32)nl->get_modules().size());
+    std::printf("public api %10.2f ms %10.2f ns/gate\n", reference / 1e6, reference / num_gates);
+    std::printf("copy(1)    %10.2f ms %10.2f ns/gate\n", serial / 1e6, serial / num_gates);
+    std::printf("copy(0)    %10.2f ms %10.2f ns/gate\n", parallel / 1e6, parallel / num_gates);
+    std::printf("copies equal to original: %s\n", equal ? "yes" : "no");
+
+    return equal ? 0 : 1;
+}
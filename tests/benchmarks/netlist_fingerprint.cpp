@@ -0,0 +1,146 @@
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/netlist_fingerprint.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+ * Benchmark for the structural fingerprint and the equality check of netlists.
+ * Builds a netlist of gates in which every gate drives a net connected to input j of the j-th succeeding gate and distributes the gates over modules of equal structure.
+ * Compares Netlist::operator== against the previous net-by-net comparison, which is reproduced here for reference, and measures building the fingerprint, updating it after a single change, and finding duplicated modules.
+ *
+ * Usage: benchmark-netlist_fingerprint [num_gates] [fan_out] [num_modules]
+ */
+
+namespace hal
+{
+    namespace
+    {
+        template<typename F>
+        double measure(F&& f)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(end - begin).count();
+        }
+
+        /**
+         * Compare two netlists by comparing every net including its source and destination gates, followed by the recursive comparison of the modules.
+         */
+        bool equal_via_nets(const Netlist* nl_1, const Netlist* nl_2)
+        {
+            const auto equal_endpoints = [](const std::vector<Endpoint*>& eps_1, const std::vector<Endpoint*>& eps_2) {
+                for (const Endpoint* ep_1 : eps_1)
+                {
+                    if (std::find_if(eps_2.begin(), eps_2.end(), [ep_1](const Endpoint* ep_2) { return *ep_1->get_pin() == *ep_2->get_pin() && *ep_1->get_gate() == *ep_2->get_gate(); })
+                        == eps_2.end())
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            for (const Net* net : nl_2->get_nets())
+            {
+                const Net* own_net = nl_1->get_net_by_id(net->get_id());
+                if (own_net == nullptr || own_net->get_name() != net->get_name() || own_net->is_global_input_net() != net->is_global_input_net()
+                    || own_net->is_global_output_net() != net->is_global_output_net() || !equal_endpoints(own_net->get_sources(), net->get_sources())
+                    || !equal_endpoints(own_net->get_destinations(), net->get_destinations()))
+                {
+                    return false;
+                }
+            }
+            return *nl_1->get_top_module() == *nl_2->get_top_module();
+        }
+    }    // namespace
+}    // namespace hal
+
+int main(int argc, char** argv)
+{
+    using namespace hal;
+
+    const u32 num_gates   = (argc > 1) ? std::stoul(argv[1]) : 200000;
+    const u32 fan_out     = (argc > 2) ? std::stoul(argv[2]) : 4;
+    const u32 num_modules = (argc > 3) ? std::stoul(argv[3]) : 64;
+
+    GateLibrary gate_library("", "benchmark_library");
+    GateType* gate_type = gate_library.create_gate_type("AND", {GateTypeProperty::combinational, GateTypeProperty::c_and});
+    std::vector<GatePin*> in_pins;
+    for (u32 j = 0; j < fan_out; j++)
+    {
+        in_pins.push_back(gate_type->create_pin("I" + std::to_string(j), PinDirection::input).get());
+    }
+    GatePin* out = gate_type->create_pin("O", PinDirection::output).get();
+
+    auto nl = netlist_factory::create_netlist(&gate_library);
+    nl->begin_bulk_edit();
+
+    std::vector<Gate*> gates;
+    gates.reserve(num_gates);
+    for (u32 i = 0; i < num_gates; i++)
+    {
+        gates.push_back(nl->create_gate(gate_type, "gate_" + std::to_string(i)));
+    }
+    for (u32 i = 0; i < num_gates; i++)
+    {
+        Net* net = nl->create_net("net_" + std::to_string(i));
+        net->add_source(gates[i], out);
+        for (u32 j = 0; j < fan_out && i + j + 1 < num_gates; j++)
+        {
+            net->add_destination(gates[i + j + 1], in_pins[j]);
+        }
+    }
+
+    // every module holds a contiguous slice of the gates
+    const u32 slice = num_gates / num_modules;
+    for (u32 m = 0; m < num_modules && slice > 0; m++)
+    {
+        nl->create_module("module_" + std::to_string(m), nl->get_top_module(), std::vector<Gate*>(gates.begin() + m * slice, gates.begin() + (m + 1) * slice));
+    }
+
+    nl->end_bulk_edit();
+
+    auto c_nl = nl->copy(0).get();
+
+    bool reference_equal = false;
+    const double reference = measure([&]() { reference_equal = equal_via_nets(nl.get(), c_nl.get()); });
+
+    bool equal = false;
+    const double equality = measure([&]() { equal = (*nl == *c_nl); });
+
+    std::unique_ptr<NetlistFingerprint> fp;
+    const double serial = measure([&]() { fp = std::make_unique<NetlistFingerprint>(nl.get(), 1); });
+    fp.reset();
+    const double parallel = measure([&]() { fp = std::make_unique<NetlistFingerprint>(nl.get(), 0); });
+
+    const u64 hash = fp->get_hash();
+    gates[num_gates / 2]->set_name("renamed");
+    u64 updated_hash = 0;
+    const double update = measure([&]() { updated_hash = fp->get_hash(); });
+
+    std::vector<std::vector<Module*>> duplicates;
+    const double dedupe = measure([&]() { duplicates = fp->get_duplicate_modules(0); });
+
+    std::printf("%u gates, %u nets, %u modules\n", num_gates, num_gates, (u32)nl->get_modules().size());
+    std::printf("previous ==      %10.2f ms %10.2f ns/gate\n", reference / 1e6, reference / num_gates);
+    std::printf("operator==       %10.2f ms %10.2f ns/gate\n", equality / 1e6, equality / num_gates);
+    std::printf("fingerprint(1)   %10.2f ms %10.2f ns/gate\n", serial / 1e6, serial / num_gates);
+    std::printf("fingerprint(0)   %10.2f ms %10.2f ns/gate\n", parallel / 1e6, parallel / num_gates);
+    std::printf("update after set %10.2f us\n", update / 1e3);
+    std::printf("duplicates       %10.2f ms, %u groups\n", dedupe / 1e6, (u32)duplicates.size());
+
+    const bool ok = equal && reference_equal && hash != updated_hash;
+    std::printf("results consistent: %s\n", ok ? "yes" : "no");
+
+    return ok ? 0 : 1;
+}
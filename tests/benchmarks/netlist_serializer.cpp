@@ -0,0 +1,119 @@
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/*
+ * Benchmark for saving and loading netlists in the JSON and the binary `.hal` format.
+ * Builds a netlist of gates in which every gate drives a net connected to input j of the j-th succeeding gate, attaches a custom Boolean function and a data entry to every 16th gate, and distributes the gates over modules.
+ * Measures serialization and deserialization in both formats and checks that both deserialized netlists equal the original one.
+ * The gate library is passed explicitly, i.e., the files are not loadable without it.
+ *
+ * Usage: benchmark-netlist_serializer [num_gates] [fan_out] [num_modules] [directory]
+ */
+
+namespace hal
+{
+    namespace
+    {
+        template<typename F>
+        double measure(F&& f)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::milli>(end - begin).count();
+        }
+    }    // namespace
+}    // namespace hal
+
+int main(int argc, char** argv)
+{
+    using namespace hal;
+
+    const u32 num_gates                 = (argc > 1) ? std::stoul(argv[1]) : 200000;
+    const u32 fan_out                   = (argc > 2) ? std::stoul(argv[2]) : 4;
+    const u32 num_modules               = (argc > 3) ? std::stoul(argv[3]) : 64;
+    const std::filesystem::path out_dir = (argc > 4) ? std::filesystem::path(argv[4]) : std::filesystem::temp_directory_path();
+
+    GateLibrary gate_library("", "benchmark_library");
+    GateType* gate_type = gate_library.create_gate_type("AND", {GateTypeProperty::combinational, GateTypeProperty::c_and});
+    std::vector<GatePin*> in_pins;
+    BooleanFunction function = BooleanFunction::Var("I0");
+    for (u32 j = 0; j < fan_out; j++)
+    {
+        in_pins.push_back(gate_type->create_pin("I" + std::to_string(j), PinDirection::input).get());
+        if (j > 0)
+        {
+            function = BooleanFunction::And(std::move(function), BooleanFunction::Var("I" + std::to_string(j)), 1).get();
+        }
+    }
+    GatePin* out = gate_type->create_pin("O", PinDirection::output).get();
+
+    auto nl = netlist_factory::create_netlist(&gate_library);
+    nl->begin_bulk_edit();
+
+    std::vector<Gate*> gates;
+    gates.reserve(num_gates);
+    for (u32 i = 0; i < num_gates; i++)
+    {
+        Gate* gate = nl->create_gate(gate_type, "gate_" + std::to_string(i));
+        if (i % 16 == 0)
+        {
+            gate->add_boolean_function("custom", function);
+            gate->set_data("benchmark", "index", "int", std::to_string(i));
+        }
+        gates.push_back(gate);
+    }
+    for (u32 i = 0; i < num_gates; i++)
+    {
+        Net* net = nl->create_net("net_" + std::to_string(i));
+        net->add_source(gates[i], out);
+        for (u32 j = 0; j < fan_out && i + j + 1 < num_gates; j++)
+        {
+            net->add_destination(gates[i + j + 1], in_pins[j]);
+        }
+    }
+
+    // every module holds a contiguous slice of the gates
+    const u32 slice = num_gates / num_modules;
+    for (u32 m = 0; m < num_modules && slice > 0; m++)
+    {
+        nl->create_module("module_" + std::to_string(m), nl->get_top_module(), std::vector<Gate*>(gates.begin() + m * slice, gates.begin() + (m + 1) * slice));
+    }
+
+    nl->end_bulk_edit();
+
+    const std::filesystem::path json_file   = out_dir / "benchmark_netlist_json.hal";
+    const std::filesystem::path binary_file = out_dir / "benchmark_netlist_binary.hal";
+
+    bool ok                = true;
+    const double json_save = measure([&]() { ok &= netlist_serializer::serialize_to_file(nl.get(), json_file, netlist_serializer::Format::json); });
+    const double bin_save  = measure([&]() { ok &= netlist_serializer::serialize_to_file(nl.get(), binary_file, netlist_serializer::Format::binary); });
+
+    std::unique_ptr<Netlist> json_nl;
+    std::unique_ptr<Netlist> bin_nl;
+    const double json_load = measure([&]() { json_nl = netlist_serializer::deserialize_from_file(json_file, &gate_library); });
+    const double bin_load  = measure([&]() { bin_nl = netlist_serializer::deserialize_from_file(binary_file, &gate_library); });
+    ok &= json_nl != nullptr && bin_nl != nullptr && *json_nl == *nl && *bin_nl == *nl;
+
+    std::printf("%u gates, %u nets, %u modules\n", num_gates, num_gates, (u32)nl->get_modules().size());
+    std::printf("json   save %10.2f ms, load %10.2f ms, %8.2f MiB\n", json_save, json_load, std::filesystem::file_size(json_file) / 1048576.0);
+    std::printf("binary save %10.2f ms, load %10.2f ms, %8.2f MiB\n", bin_save, bin_load, std::filesystem::file_size(binary_file) / 1048576.0);
+    std::printf("results consistent: %s\n", ok ? "yes" : "no");
+
+    std::filesystem::remove(json_file);
+    std::filesystem::remove(binary_file);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,145 @@
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+/*
+ * Benchmark for the memory footprint and traversal speed of the netlist object storage.
+ * Builds a netlist of gates in which every gate drives a net connected to input j of the j-th succeeding gate, i.e., 
+ * every net has a fixed number of destinations, then traverses and destroys it. Heap usage is measured by counting the bytes requested from the global allocator.
+ *
+ * Usage: benchmark-netlist_storage [num_gates] [fan_out]
+ */
+
+namespace
+{
+    std::atomic<std::size_t> allocated_bytes{0};
+    std::atomic<std::size_t> allocation_count{0};
+}    // namespace
+
+void* operator new(std::size_t size)
+{
+    allocated_bytes += size;
+    allocation_count++;
+    if (void* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace hal
+{
+    namespace
+    {
+        template<typename F>
+        double measure(F&& f)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(end - begin).count();
+        }
+    }    // namespace
+}    // namespace hal
+
+int main(int argc, char** argv)
+{
+    using namespace hal;
+
+    const u32 num_gates = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    const u32 fan_out   = (argc > 2) ? std::stoul(argv[2]) : 4;
+
+    GateLibrary gate_library("", "benchmark_library");
+    GateType* gate_type = gate_library.create_gate_type("AND", {GateTypeProperty::combinational, GateTypeProperty::c_and});
+    std::vector<GatePin*> in_pins;
+    for (u32 j = 0; j < fan_out; j++)
+    {
+        in_pins.push_back(gate_type->create_pin("I" + std::to_string(j), PinDirection::input).get());
+    }
+    GatePin* out = gate_type->create_pin("O", PinDirection::output).get();
+
+    auto nl = netlist_factory::create_netlist(&gate_library);
+
+    // the nets are connected without module checks, which are not part of the measured storage
+    nl->enable_automatic_net_checks(false);
+
+    const auto bytes_before       = allocated_bytes.load();
+    const auto allocations_before = allocation_count.load();
+    std::vector<Gate*> gates;
+    gates.reserve(num_gates);
+    const double create = measure([&]() {
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            gates.push_back(nl->create_gate(gate_type, "gate"));
+        }
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            Net* net = nl->create_net("net");
+            net->add_source(gates[i], out);
+            for (u32 j = 0; j < fan_out && i + j + 1 < num_gates; j++)
+            {
+                net->add_destination(gates[i + j + 1], in_pins[j]);
+            }
+        }
+    });
+    const double bytes       = allocated_bytes.load() - bytes_before;
+    const double allocations = allocation_count.load() - allocations_before;
+
+    u64 checksum          = 0;
+    const double traverse = measure([&]() {
+        for (u32 r = 0; r < 10; r++)
+        {
+            for (const Gate* gate : nl->get_gates())
+            {
+                for (const Endpoint* ep : gate->get_fan_out_endpoints())
+                {
+                    for (const Endpoint* dst : ep->get_net()->get_destinations())
+                    {
+                        checksum += dst->get_gate()->get_id();
+                    }
+                }
+            }
+        }
+    });
+
+    const double lookup = measure([&]() {
+        for (u32 r = 0; r < 10; r++)
+        {
+            for (u32 id = 1; id <= num_gates; id++)
+            {
+                checksum += nl->is_gate_in_netlist(nl->get_gate_by_id(id));
+            }
+        }
+    });
+
+    const double teardown = measure([&]() { nl.reset(); });
+
+    std::printf("%u gates, %u nets\n", num_gates, num_gates);
+    std::printf("create     %10.2f ns/gate %10.2f bytes/gate %8.2f allocs/gate\n", create / num_gates, bytes / num_gates, allocations / num_gates);
+    std::printf("traverse   %10.2f ns/gate\n", traverse / (10.0 * num_gates));
+    std::printf("lookup     %10.2f ns/gate\n", lookup / (10.0 * num_gates));
+    std::printf("teardown   %10.2f ns/gate\n", teardown / num_gates);
+    std::printf("(checksum %lu)\n", (unsigned long)checksum);
+
+    return 0;
+}
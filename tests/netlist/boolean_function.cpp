@@ -1,10 +1,16 @@
 #include "netlist_test_utils.h"
 #include "gtest/gtest.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/boolean_function_dag.h"
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+#include "hal_core/netlist/boolean_function/simplification_cache.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/netlist/boolean_function/types.h"
 
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include <type_traits>
 #include <variant>
 
@@ -41,6 +47,61 @@ namespace hal {
         EXPECT_EQ( std::is_move_assignable<BooleanFunction>::value, true);
     }
 
+    TEST(BooleanFunction, NodeLayout) {
+        EXPECT_EQ(sizeof(BooleanFunction::Node), 8);
+        EXPECT_TRUE(std::is_trivially_copyable<BooleanFunction::Node>::value);
+
+        {
+            // variables are interned, i.e., equal names share the same ID
+            const auto a = BooleanFunction::Node::Variable("A", 1);
+            EXPECT_EQ(a, BooleanFunction::Node::Variable(std::string("A"), 1));
+            EXPECT_NE(a, BooleanFunction::Node::Variable("A", 2));
+            EXPECT_NE(a, BooleanFunction::Node::Variable("B", 1));
+            EXPECT_EQ(a.variable(), "A");
+            EXPECT_EQ(a.get_variable_name().get(), "A");
+            EXPECT_TRUE(a.has_variable_name("A"));
+
+            // the order of variables follows their names and not the order of interning
+            EXPECT_LT(BooleanFunction::Node::Variable("node_layout_z", 1), BooleanFunction::Node::Variable("node_layout_a", 2));
+            EXPECT_FALSE(BooleanFunction::Node::Variable("node_layout_y", 1) < BooleanFunction::Node::Variable("node_layout_b", 1));
+        }
+        {
+            // constants are packed into the node or interned if they are wide
+            for (const u16 size : {1, 16, 17, 64, 200}) {
+                std::vector<BooleanFunction::Value> values;
+                for (u16 i = 0; i < size; i++) {
+                    values.push_back(std::vector<BooleanFunction::Value>({BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE, BooleanFunction::Value::X, BooleanFunction::Value::Z})[(i * 7 + size) % 4]);
+                }
+                const auto node = BooleanFunction::Node::Constant(values);
+                EXPECT_EQ(node.size, size);
+                EXPECT_EQ(node.constant(), values);
+                EXPECT_EQ(node.get_constant_value().get(), values);
+                EXPECT_TRUE(node.has_constant_value(values));
+                EXPECT_EQ(node, BooleanFunction::Node::Constant(values));
+
+                auto other = values;
+                other.back() = (other.back() == BooleanFunction::Value::ONE) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+                EXPECT_NE(node, BooleanFunction::Node::Constant(other));
+                EXPECT_EQ(node < BooleanFunction::Node::Constant(other), values < other);
+            }
+            EXPECT_EQ(BooleanFunction::Const(0xdeadbeef, 32).get_constant_value_u64().get(), 0xdeadbeef);
+            EXPECT_TRUE(BooleanFunction::Node::Constant({BooleanFunction::Value::ONE, BooleanFunction::Value::ZERO}).has_constant_value(1));
+        }
+        {
+            const auto index = BooleanFunction::Node::Index(1337, 16);
+            EXPECT_EQ(index.index(), 1337);
+            EXPECT_EQ(index.get_index_value().get(), 1337);
+            EXPECT_LT(BooleanFunction::Node::Index(3, 16), index);
+        }
+        {
+            // cloning a function copies the node arena as a whole
+            const auto function = BooleanFunction::Var("A", 24) & BooleanFunction::Const(0xabcdef, 24);
+            const auto clone    = function.clone();
+            EXPECT_EQ(clone, function);
+            EXPECT_EQ(clone.get_nodes(), function.get_nodes());
+        }
+    }
+
     TEST(BooleanFunction, Operator) {
         const auto a = BooleanFunction::Var("A"),
                    b = BooleanFunction::Var("B"),
@@ -142,7 +203,7 @@ namespace hal {
             EXPECT_EQ(expected, BooleanFunction::to_string(value, 10).get());
         }
 
-        const auto res_137 = BooleanFunction::to_string(BooleanFunction::Const(137, 16).get_top_level_node().constant, 10);
+        const auto res_137 = BooleanFunction::to_string(BooleanFunction::Const(137, 16).get_top_level_node().constant(), 10);
         ASSERT_TRUE(res_137.is_ok());
         EXPECT_EQ(res_137.get(), "137");
     }
@@ -1176,6 +1237,140 @@ namespace hal {
         }
     }
 
+    TEST(BooleanFunction, CompiledEvaluate) {
+        const auto a = BooleanFunction::Var("A", 3),
+                   b = BooleanFunction::Var("B", 3),
+                   c = BooleanFunction::Var("C", 1);
+
+        using Value = BooleanFunction::Value;
+
+        const std::vector<BooleanFunction> data = {
+            a.clone() & b.clone(),
+            a.clone() | b.clone(),
+            a.clone() ^ b.clone(),
+            ~a.clone(),
+            a.clone() + b.clone(),
+            a.clone() - b.clone(),
+            a.clone() * b.clone(),
+            BooleanFunction::Concat(a.clone(), b.clone(), 6).get(),
+            BooleanFunction::Slice(a.clone(), BooleanFunction::Index(1, 3), BooleanFunction::Index(2, 3), 2).get(),
+            BooleanFunction::Zext(a.clone(), BooleanFunction::Index(5, 5), 5).get(),
+            BooleanFunction::Sext(a.clone(), BooleanFunction::Index(5, 5), 5).get(),
+            BooleanFunction::Shl(a.clone(), BooleanFunction::Index(1, 3), 3).get(),
+            BooleanFunction::Lshr(a.clone(), BooleanFunction::Index(2, 3), 3).get(),
+            BooleanFunction::Ashr(a.clone(), BooleanFunction::Index(1, 3), 3).get(),
+            BooleanFunction::Rol(a.clone(), BooleanFunction::Index(1, 3), 3).get(),
+            BooleanFunction::Ror(a.clone(), BooleanFunction::Index(1, 3), 3).get(),
+            BooleanFunction::Eq(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ule(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ult(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Sle(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Slt(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ite(c.clone(), a.clone(), b.clone(), 3).get(),
+            (a.clone() & BooleanFunction::Const(5, 3)) | (~b.clone() ^ a.clone()),
+        };
+
+        const auto to_values = [](u32 value, u32 size) {
+            std::vector<Value> values;
+            for (u32 i = 0; i < size; i++) {
+                values.push_back(((value >> i) & 1) ? Value::ONE : Value::ZERO);
+            }
+            return values;
+        };
+
+        for (const auto& function: data) {
+            const auto compiled = CompiledBooleanFunction::compile(function);
+            ASSERT_TRUE(compiled.is_ok());
+            ASSERT_EQ(compiled.get().size(), function.size());
+
+            for (u32 i = 0; i < 128; i++) {
+                std::unordered_map<std::string, std::vector<Value>> input = {{"A", to_values(i, 3)}, {"B", to_values(i >> 3, 3)}, {"C", to_values(i >> 6, 1)}};
+                EXPECT_EQ(function.evaluate(input).get(), compiled.get().evaluate(input).get()) << function.to_string();
+            }
+        }
+    }
+
+    TEST(BooleanFunction, CompiledEvaluateBitsliced) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C"),
+                   d = BooleanFunction::Var("D");
+
+        using Value = BooleanFunction::Value;
+        using Word = CompiledBooleanFunction::Word;
+
+        const auto function = ((a.clone() & b.clone()) | (~c.clone() ^ d.clone())) & ~(a.clone() | d.clone());
+        const auto compiled = CompiledBooleanFunction::compile(function, {"D", "C", "B", "A"});
+        ASSERT_TRUE(compiled.is_ok());
+        EXPECT_EQ(compiled.get().get_variables(), std::vector<std::string>({"D", "C", "B", "A"}));
+        EXPECT_EQ(compiled.get().get_input_size(), 4);
+
+        // every lane holds one assignment of the truth table (wrapped around after 16 rows)
+        std::vector<Word> inputs(4);
+        for (u32 lane = 0; lane < CompiledBooleanFunction::LANES; lane++) {
+            for (u32 i = 0; i < 4; i++) {
+                inputs[i].set(lane, ((lane >> i) & 1) ? Value::ONE : Value::ZERO);
+            }
+        }
+
+        const auto outputs = compiled.get().evaluate(inputs);
+        ASSERT_TRUE(outputs.is_ok());
+        ASSERT_EQ(outputs.get().size(), 1);
+
+        for (u32 lane = 0; lane < CompiledBooleanFunction::LANES; lane++) {
+            std::unordered_map<std::string, Value> input;
+            input["D"] = inputs[0].get(lane);
+            input["C"] = inputs[1].get(lane);
+            input["B"] = inputs[2].get(lane);
+            input["A"] = inputs[3].get(lane);
+            EXPECT_EQ(function.evaluate(input).get(), outputs.get()[0].get(lane));
+        }
+
+        // a caller-owned register file yields the same outputs and may be reused
+        std::vector<Word> registers;
+        for (u32 i = 0; i < 2; i++) {
+            Word output;
+            compiled.get().evaluate(inputs.data(), &output, registers);
+            EXPECT_EQ(output, outputs.get()[0]);
+        }
+
+        // input sizes are checked
+        EXPECT_TRUE(compiled.get().evaluate(std::vector<Word>(3)).is_error());
+        // the variable order must be complete
+        EXPECT_TRUE(CompiledBooleanFunction::compile(function, {"A", "B"}).is_error());
+        // division is not supported
+        EXPECT_TRUE(CompiledBooleanFunction::compile(BooleanFunction::Udiv(a.clone(), b.clone(), 1).get()).is_error());
+    }
+
+    TEST(BooleanFunction, CompiledEvaluateUnknown) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B");
+
+        using Value = BooleanFunction::Value;
+
+        const std::vector<std::tuple<BooleanFunction, std::unordered_map<std::string, Value>, Value>> data = {
+            {a & b, {{"A", Value::ZERO}, {"B", Value::X}}, Value::ZERO},
+            {a & b, {{"A", Value::ONE}, {"B", Value::X}}, Value::X},
+            {a & b, {{"A", Value::ONE}, {"B", Value::Z}}, Value::X},
+            {a | b, {{"A", Value::ONE}, {"B", Value::Z}}, Value::ONE},
+            {a | b, {{"A", Value::ZERO}, {"B", Value::X}}, Value::X},
+            {a ^ b, {{"A", Value::ONE}, {"B", Value::X}}, Value::X},
+            {~a, {{"A", Value::Z}}, Value::Z},
+            {~a, {{"A", Value::X}}, Value::X},
+            {a + b, {{"A", Value::ONE}, {"B", Value::X}}, Value::X},
+            {BooleanFunction::Eq(a.clone(), b.clone(), 1).get(), {{"A", Value::X}, {"B", Value::X}}, Value::ONE},
+            {BooleanFunction::Ite(a.clone(), b.clone(), ~b.clone(), 1).get(), {{"A", Value::X}, {"B", Value::ONE}}, Value::X},
+            // unassigned variables are treated as X
+            {a & b, {{"A", Value::ONE}}, Value::X},
+        };
+
+        for (const auto& [function, input, expected]: data) {
+            const auto compiled = CompiledBooleanFunction::compile(function);
+            ASSERT_TRUE(compiled.is_ok());
+            EXPECT_EQ(expected, compiled.get().evaluate(input).get()) << function.to_string();
+        }
+    }
+
     TEST(BooleanFunction, TruthTable) {
         const auto a = BooleanFunction::Var("A"),
                    b = BooleanFunction::Var("B"),
@@ -1206,6 +1401,66 @@ namespace hal {
         }
     }
 
+    TEST(BooleanFunction, PackedTruthTable) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C");
+
+        using Value = BooleanFunction::Value;
+
+        {
+            // small functions occupy a single (masked) word
+            const auto res = (~((a & b) | c)).compute_packed_truth_table({"C", "B", "A"});
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), std::vector<std::vector<u64>>({{0b00010101}}));
+        }
+        {
+            // packed and unpacked truth tables agree
+            std::vector<BooleanFunction> vars;
+            for (u32 i = 0; i < 8; i++) {
+                vars.push_back(BooleanFunction::Var("I" + std::to_string(i)));
+            }
+            const auto function = ((vars[0] & vars[7]) ^ (vars[1] | ~vars[6])) & ((vars[2] ^ vars[5]) | (vars[3] & vars[4]));
+
+            const auto packed = function.compute_packed_truth_table();
+            const auto unpacked = function.compute_truth_table();
+            ASSERT_TRUE(packed.is_ok());
+            ASSERT_TRUE(unpacked.is_ok());
+            ASSERT_EQ(packed.get().size(), 1);
+            ASSERT_EQ(packed.get().front().size(), 4);
+            for (u32 row = 0; row < 256; row++) {
+                const auto bit = (packed.get().front()[row / 64] >> (row % 64)) & 1;
+                EXPECT_EQ(unpacked.get().front()[row], bit ? Value::ONE : Value::ZERO);
+            }
+        }
+        {
+            // up to 20 variables are supported
+            BooleanFunction function = BooleanFunction::Var("I0");
+            for (u32 i = 1; i < 20; i++) {
+                function = function ^ BooleanFunction::Var("I" + std::to_string(i));
+            }
+            std::vector<std::string> order;
+            for (u32 i = 0; i < 20; i++) {
+                order.push_back("I" + std::to_string(i));
+            }
+
+            const auto res = function.compute_packed_truth_table(order);
+            ASSERT_TRUE(res.is_ok());
+            ASSERT_EQ(res.get().front().size(), 1 << 14);
+            for (const u32 row : {0u, 1u, 3u, 0x12345u, 0xFFFFFu}) {
+                const auto bit = (res.get().front()[row / 64] >> (row % 64)) & 1;
+                EXPECT_EQ(bit, __builtin_popcount(row) & 1);
+            }
+
+            EXPECT_TRUE((function ^ BooleanFunction::Var("I20")).compute_packed_truth_table().is_error());
+        }
+        {
+            // X values cannot be packed
+            EXPECT_TRUE((a & BooleanFunction::Const(Value::X)).compute_packed_truth_table().is_error());
+            EXPECT_TRUE(BooleanFunction::Var("A", 2).compute_packed_truth_table().is_error());
+        }
+    }
+
     TEST(BooleanFunction, SimplificationVsTruthTable) {
         const auto  a = BooleanFunction::Var("A"),
                     b = BooleanFunction::Var("B"),
@@ -1248,6 +1503,16 @@ namespace hal {
         }
     }
 
+    TEST(BooleanFunction, SolverLibraryErrors) {
+        if (!SMT::Solver::has_local_solver_for(SMT::SolverType::Z3, SMT::SolverCall::Library)) {
+            GTEST_SKIP() << "Z3 library is not linked";
+        }
+
+        // Z3 reports errors within its output, which must not be parsed as a solver result
+        const auto config = SMT::QueryConfig().with_solver(SMT::SolverType::Z3).with_call(SMT::SolverCall::Library).with_local_solver();
+        EXPECT_TRUE(SMT::Solver::query_local_with_smt2(config, "(declare-const a (_ BitVec 1))\n(assert (= a undeclared))\n(check-sat)").is_error());
+    }
+
     TEST(BooleanFunction, SatisfiableConstraint) {
         const auto  a = BooleanFunction::Var("A"),
                     b = BooleanFunction::Var("B"),
@@ -1322,7 +1587,7 @@ namespace hal {
         for (auto&& constraints : formulas) {
             const auto solver = SMT::Solver(std::move(constraints));
 
-            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}}) {
+            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}, {SMT::SolverType::Z3, SMT::SolverCall::Library}}) {
                 if (!SMT::Solver::has_local_solver_for(solver_type, solver_call)) {
                     continue;
                 }
@@ -1330,6 +1595,7 @@ namespace hal {
                 auto result = solver.query(
                     SMT::QueryConfig()
                         .with_solver(solver_type)
+                        .with_call(solver_call)
                         .with_local_solver()
                         .with_model_generation()
                         .with_timeout(1000)
@@ -1454,7 +1720,7 @@ namespace hal {
 
         for (auto&& constraints : formulas) {
             const auto solver = SMT::Solver(std::move(constraints));
-            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}}) {
+            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}, {SMT::SolverType::Z3, SMT::SolverCall::Library}}) {
                 if (!SMT::Solver::has_local_solver_for(solver_type, solver_call)) {
                     continue;
                 }
@@ -1462,6 +1728,7 @@ namespace hal {
                 auto result = solver.query(
                     SMT::QueryConfig()
                         .with_solver(solver_type)
+                        .with_call(solver_call)
                         .with_local_solver()
                         .with_model_generation()
                         .with_timeout(1000)
@@ -1501,7 +1768,7 @@ namespace hal {
         for (auto&& [constraints, model] : formulas) {
             const auto solver = SMT::Solver(std::move(constraints));
 
-            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}}) {
+            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}, {SMT::SolverType::Z3, SMT::SolverCall::Library}}) {
                 if (!SMT::Solver::has_local_solver_for(solver_type, solver_call)) {
                     continue;
                 }
@@ -1509,6 +1776,7 @@ namespace hal {
                 auto result = solver.query(
                     SMT::QueryConfig()
                         .with_solver(solver_type)
+                        .with_call(solver_call)
                         .with_local_solver()
                         .with_model_generation()
                         .with_timeout(1000)
@@ -1628,7 +1896,7 @@ namespace hal {
         for (auto&& [constraints, model] : formulas) {
             const auto solver = SMT::Solver(std::move(constraints));
 
-            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}}) {
+            for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}, {SMT::SolverType::Z3, SMT::SolverCall::Library}}) {
                 if (!SMT::Solver::has_local_solver_for(solver_type, solver_call)) {
                     continue;
                 }
@@ -1636,6 +1904,7 @@ namespace hal {
                 auto result = solver.query(
                     SMT::QueryConfig()
                         .with_solver(solver_type)
+                        .with_call(solver_call)
                         .with_local_solver()
                         .with_model_generation()
                         .with_timeout(1000)
@@ -1648,4 +1917,382 @@ namespace hal {
             }
         }
     }
+
+    TEST(BooleanFunction, SolverSession) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C", 4),
+                   d = BooleanFunction::Var("D", 4),
+                  _0 = BooleanFunction::Const(0, 1),
+                  _1 = BooleanFunction::Const(1, 1);
+
+        {
+            // incremental constraints with scopes
+            auto session = SMT::SolverSession(SMT::QueryConfig().with_model_generation().with_timeout(1000));
+
+            ASSERT_TRUE(session.add_constraint(SMT::Constraint(a.clone() | b.clone(), _1.clone())).is_ok());
+            auto result = session.query();
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+
+            session.push();
+            EXPECT_EQ(session.get_scope_level(), 1);
+            ASSERT_TRUE(session.add_constraints({SMT::Constraint(a.clone(), _0.clone()), SMT::Constraint(b.clone(), _0.clone())}).is_ok());
+            result = session.query();
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_unsat());
+
+            ASSERT_TRUE(session.pop().is_ok());
+            EXPECT_EQ(session.get_scope_level(), 0);
+            EXPECT_TRUE(session.pop().is_error());
+
+            result = session.query({SMT::Constraint(a.clone(), _0.clone())});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+            ASSERT_TRUE(result.get().model.has_value());
+            EXPECT_EQ(result.get().model->evaluate(b.clone()).get(), _1);
+
+            // assumptions are retracted after the query
+            result = session.query({SMT::Constraint(b.clone(), _0.clone())});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+            EXPECT_EQ(result.get().model->evaluate(a.clone()).get(), _1);
+
+            EXPECT_EQ(session.get_query_count(), 4);
+
+            session.reset();
+            result = session.query({SMT::Constraint(a.clone(), _0.clone()), SMT::Constraint(b.clone(), _0.clone())});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+
+            // a reset discards the declared variables, hence a name may be used with a different size afterwards
+            session.reset();
+            result = session.query({SMT::Constraint(BooleanFunction::Var("A", 8), BooleanFunction::Const(0x5A, 8))});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+            EXPECT_EQ(*result.get().model, SMT::Model({{"A", {0x5A, 8}}}));
+        }
+        {
+            // models and operations agree with the SMT-LIB based solver
+            auto session = SMT::SolverSession(SMT::QueryConfig().with_model_generation().with_timeout(1000));
+
+            auto result = session.query({
+                SMT::Constraint(BooleanFunction::Srem(c.clone(), d.clone(), 4).get(), BooleanFunction::Const(13, 4)),
+                SMT::Constraint(c.clone(), BooleanFunction::Const(9, 4)),
+                SMT::Constraint(BooleanFunction::Slt(BooleanFunction::Const(0, 4), d.clone(), 1).get()),
+            });
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+            EXPECT_EQ(*result.get().model, SMT::Model({{"C", {9, 4}}, {"D", {4, 4}}}));
+
+            result = session.query({
+                SMT::Constraint(BooleanFunction::Ashr(c.clone(), BooleanFunction::Index(1, 4), 4).get(), BooleanFunction::Const(0xC, 4)),
+                SMT::Constraint(BooleanFunction::Zext(BooleanFunction::Slice(c.clone(), BooleanFunction::Index(0, 4), BooleanFunction::Index(0, 4), 1).get(), BooleanFunction::Index(4, 4), 4).get(), BooleanFunction::Const(1, 4)),
+            });
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+            EXPECT_EQ(*result.get().model, SMT::Model({{"C", {9, 4}}}));
+
+            // X and Z values cannot be translated
+            EXPECT_TRUE(session.add_constraint(SMT::Constraint(a.clone(), BooleanFunction::Const(BooleanFunction::Value::X))).is_error());
+            // a variable name cannot be reused with a different size, as the model would not be able to tell them apart
+            EXPECT_TRUE(session.add_constraint(SMT::Constraint(BooleanFunction::Var("C", 8), BooleanFunction::Const(1, 8))).is_error());
+        }
+        {
+            // repeated sub-terms are served from the term cache
+            auto session = SMT::SolverSession();
+
+            const auto f = (a.clone() & b.clone()) ^ (a.clone() | b.clone());
+            for (u32 i = 0; i < 10; i++) {
+                auto result = session.query({SMT::Constraint(f.clone(), _1.clone())});
+                ASSERT_TRUE(result.is_ok());
+                EXPECT_TRUE(result.get().is_sat());
+                EXPECT_FALSE(result.get().model.has_value());
+            }
+            EXPECT_EQ(session.get_term_cache_misses(), 2);
+            EXPECT_EQ(session.get_term_cache_hits(), 18);
+
+            session.clear_term_cache();
+            ASSERT_TRUE(session.query({SMT::Constraint(f.clone(), _1.clone())}).is_ok());
+            EXPECT_EQ(session.get_term_cache_misses(), 4);
+        }
+    }
+
+    TEST(BooleanFunction, QueryBatch) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C", 4),
+                   d = BooleanFunction::Var("D", 4),
+                  _0 = BooleanFunction::Const(0, 1),
+                  _1 = BooleanFunction::Const(1, 1);
+
+        auto constraint_sets = std::vector<std::vector<SMT::Constraint>>();
+        for (u32 i = 0; i < 16; i++) {
+            // satisfiable
+            constraint_sets.push_back({
+                SMT::Constraint(BooleanFunction::Add(c.clone(), d.clone(), 4).get(), BooleanFunction::Const(i, 4)),
+                SMT::Constraint(c.clone(), BooleanFunction::Const(i ^ 0x5, 4)),
+            });
+            // unsatisfiable
+            constraint_sets.push_back({
+                SMT::Constraint(a.clone() & b.clone(), _1.clone()),
+                SMT::Constraint(b.clone(), _0.clone()),
+            });
+        }
+        // not translatable
+        constraint_sets.push_back({SMT::Constraint(a.clone(), BooleanFunction::Const(BooleanFunction::Value::X))});
+
+        for (auto&& [solver_type, solver_call] : std::vector<std::pair<SMT::SolverType, SMT::SolverCall>>{{SMT::SolverType::Z3, SMT::SolverCall::Binary}, {SMT::SolverType::Z3, SMT::SolverCall::Library}}) {
+            if (!SMT::Solver::has_local_solver_for(solver_type, solver_call)) {
+                continue;
+            }
+
+            const auto config = SMT::QueryConfig()
+                .with_solver(solver_type)
+                .with_call(solver_call)
+                .with_local_solver()
+                .with_model_generation()
+                .with_timeout(1000);
+
+            SMT::BatchStatistics statistics;
+            const auto results = SMT::Solver::query_batch(constraint_sets, config, 4, &statistics);
+            ASSERT_EQ(results.size(), constraint_sets.size());
+
+            for (u32 i = 0; i < 32; i++) {
+                ASSERT_TRUE(results.at(i).is_ok());
+                const auto expected = SMT::Solver(constraint_sets.at(i)).query(config);
+                ASSERT_TRUE(expected.is_ok());
+                EXPECT_EQ(results.at(i).get().type, expected.get().type);
+                EXPECT_EQ(results.at(i).get().model, expected.get().model);
+            }
+            EXPECT_TRUE(results.at(32).is_error());
+
+            EXPECT_EQ(statistics.workers, 4);
+            EXPECT_EQ(statistics.queries, 33);
+            EXPECT_EQ(statistics.errors, 1);
+            EXPECT_EQ(statistics.timeouts, 0);
+            EXPECT_GE(statistics.wall_time, statistics.max_solve_time);
+            EXPECT_GE(statistics.total_solve_time, statistics.max_solve_time);
+        }
+
+        if (SMT::Solver::has_local_solver_for(SMT::SolverType::Z3, SMT::SolverCall::Library)) {
+            // independent queries may use the same variable name with different sizes, even if answered by the same worker
+            const auto config = SMT::QueryConfig()
+                .with_solver(SMT::SolverType::Z3)
+                .with_call(SMT::SolverCall::Library)
+                .with_local_solver()
+                .with_model_generation()
+                .with_timeout(1000);
+
+            const auto results = SMT::Solver::query_batch({
+                {SMT::Constraint(BooleanFunction::Var("E", 1), BooleanFunction::Const(1, 1))},
+                {SMT::Constraint(BooleanFunction::Var("E", 32), BooleanFunction::Const(0xCAFE, 32))},
+            }, config, 1);
+            ASSERT_EQ(results.size(), 2);
+            ASSERT_TRUE(results.at(0).is_ok());
+            ASSERT_TRUE(results.at(1).is_ok());
+            EXPECT_EQ(*results.at(0).get().model, SMT::Model({{"E", {1, 1}}}));
+            EXPECT_EQ(*results.at(1).get().model, SMT::Model({{"E", {0xCAFE, 32}}}));
+        }
+
+        {
+            SMT::BatchStatistics statistics;
+            EXPECT_TRUE(SMT::Solver::query_batch({}, SMT::QueryConfig(), 0, &statistics).empty());
+            EXPECT_EQ(statistics.workers, 1);
+            EXPECT_EQ(statistics.queries, 0);
+        }
+    }
+
+    TEST(BooleanFunction, DAG) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C", 4),
+                  _0 = BooleanFunction::Const(0, 1),
+                  _1 = BooleanFunction::Const(1, 1);
+
+        {
+            // round trip between reverse-polish notation and DAG
+            BooleanFunctionDAG dag;
+            const auto function = (a.clone() & b.clone()) | (~(a.clone() & b.clone()) ^ BooleanFunction::Slice(c.clone(), BooleanFunction::Index(2, 4), BooleanFunction::Index(2, 4), 1).get());
+            const auto root = dag.add(function);
+            ASSERT_TRUE(root.is_ok());
+            // the shared sub-expression (A & B) is stored only once
+            EXPECT_EQ(dag.size(), function.get_nodes().size() - 4);
+            EXPECT_EQ(dag.get_expanded_size(root.get()), function.get_nodes().size());
+            EXPECT_EQ(dag.get_variable_names(root.get()), std::set<std::string>({"A", "B", "C"}));
+
+            const auto converted = dag.to_boolean_function(root.get());
+            ASSERT_TRUE(converted.is_ok());
+            EXPECT_EQ(converted.get(), function);
+            EXPECT_TRUE(dag.to_boolean_function(root.get(), function.get_nodes().size() - 1).is_error());
+
+            // adding the same function again does not create any new nodes
+            EXPECT_EQ(dag.add(function.clone()).get(), root.get());
+            EXPECT_EQ(dag.size(), function.get_nodes().size() - 4);
+
+            EXPECT_TRUE(dag.add(BooleanFunction()).is_error());
+            EXPECT_TRUE(dag.add_node(BooleanFunction::Node::Operation(BooleanFunction::NodeType::And, 1), {root.get()}).is_error());
+            EXPECT_TRUE(dag.to_boolean_function(dag.size()).is_error());
+        }
+        {
+            // reconvergent chain: each stage uses the previous stage twice
+            BooleanFunctionDAG dag;
+            auto stage = dag.add(a.clone()).get();
+            for (u32 i = 0; i < 64; i++) {
+                const auto next = dag.add((BooleanFunction::Var("X") & BooleanFunction::Var("Y")) ^ b.clone(), {{"X", stage}, {"Y", stage}});
+                ASSERT_TRUE(next.is_ok());
+                stage = next.get();
+            }
+            EXPECT_EQ(dag.get_size(stage), 2 + 2 * 64);
+            EXPECT_EQ(dag.get_expanded_size(stage), std::numeric_limits<u64>::max());
+            EXPECT_TRUE(dag.to_boolean_function(stage, 1 << 20).is_error());
+            EXPECT_EQ(dag.get_variable_names(stage), std::set<std::string>({"A", "B"}));
+
+            // evaluation visits every node only once
+            EXPECT_EQ(dag.evaluate(stage, {{"A", {BooleanFunction::Value::ONE}}, {"B", {BooleanFunction::Value::ZERO}}}).get(), std::vector<BooleanFunction::Value>({BooleanFunction::Value::ONE}));
+            EXPECT_EQ(dag.evaluate(stage, {{"A", {BooleanFunction::Value::ONE}}, {"B", {BooleanFunction::Value::ONE}}}).get(), std::vector<BooleanFunction::Value>({BooleanFunction::Value::ONE}));
+            EXPECT_EQ(dag.evaluate(stage, {{"A", {BooleanFunction::Value::ZERO}}, {"B", {BooleanFunction::Value::ONE}}}).get(), std::vector<BooleanFunction::Value>({BooleanFunction::Value::ZERO}));
+            EXPECT_TRUE(dag.evaluate(stage, {{"A", {BooleanFunction::Value::ONE}}}).is_error());
+
+            // (X & X) ^ B simplifies to X ^ B in every stage, so the simplified chain is at most linear
+            const auto simplified = dag.simplify(stage);
+            ASSERT_TRUE(simplified.is_ok());
+            EXPECT_LE(dag.get_expanded_size(simplified.get()), 2 * 64 + 1);
+            for (const auto& [value_a, value_b] : std::vector<std::pair<BooleanFunction::Value, BooleanFunction::Value>>{{BooleanFunction::Value::ZERO, BooleanFunction::Value::ZERO}, {BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE}, {BooleanFunction::Value::ONE, BooleanFunction::Value::ZERO}, {BooleanFunction::Value::ONE, BooleanFunction::Value::ONE}}) {
+                const std::unordered_map<std::string, std::vector<BooleanFunction::Value>> inputs = {{"A", {value_a}}, {"B", {value_b}}};
+                EXPECT_EQ(dag.evaluate(simplified.get(), inputs).get(), dag.evaluate(stage, inputs).get());
+            }
+
+            // substituting B = 0 collapses the chain to A
+            const auto substituted = dag.substitute(stage, {{"B", dag.add(_0.clone()).get()}});
+            ASSERT_TRUE(substituted.is_ok());
+            EXPECT_EQ(dag.to_boolean_function(dag.simplify(substituted.get()).get()).get(), a);
+            EXPECT_TRUE(dag.substitute(stage, {{"B", dag.add(c.clone()).get()}}).is_error());
+        }
+        {
+            // simplification matches the simplification of the expanded function
+            const std::vector<BooleanFunction> functions = {
+                (a.clone() & _1.clone()) | (b.clone() & _0.clone()),
+                ~(~a.clone()) ^ (a.clone() | a.clone()),
+                BooleanFunction::Add(c.clone(), BooleanFunction::Const(0, 4), 4).get() | c.clone(),
+                BooleanFunction::Ite(_1.clone(), a.clone() & b.clone(), b.clone(), 1).get(),
+            };
+            for (const auto& function : functions) {
+                BooleanFunctionDAG dag;
+                const auto simplified = dag.simplify(dag.add(function).get());
+                ASSERT_TRUE(simplified.is_ok());
+                EXPECT_EQ(dag.to_boolean_function(simplified.get()).get(), function.simplify_local());
+            }
+        }
+    }
+
+    TEST(BooleanFunction, SimplificationCache) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C"),
+                   d = BooleanFunction::Var("D"),
+                  _1 = BooleanFunction::Const(1, 1);
+
+        std::atomic<u32> calls = 0;
+        const auto simplifier = [&calls](const BooleanFunction& function) {
+            calls++;
+            return function.simplify_local();
+        };
+
+        {
+            // repeated and renamed functions are answered from the cache
+            SimplificationCache cache;
+            const auto function = (a.clone() & b.clone()) & _1.clone();
+
+            EXPECT_EQ(cache.simplify(function, simplifier), a.clone() & b.clone());
+            EXPECT_EQ(cache.simplify(function, simplifier), a.clone() & b.clone());
+            EXPECT_EQ(cache.simplify((c.clone() & d.clone()) & _1.clone(), simplifier), c.clone() & d.clone());
+            EXPECT_EQ(calls, 1);
+
+            auto statistics = cache.get_statistics();
+            EXPECT_EQ(statistics.hits, 2);
+            EXPECT_EQ(statistics.misses, 1);
+            EXPECT_EQ(statistics.entries, 1);
+
+            // renaming that changes the order of the variables yields a different canonical form
+            EXPECT_EQ(cache.simplify((b.clone() & a.clone()) & _1.clone(), simplifier), (b.clone() & a.clone()).simplify_local());
+            EXPECT_EQ(calls, 2);
+
+            // variables of different sizes do not share entries
+            const auto wide = BooleanFunction::Var("A", 4) & BooleanFunction::Var("B", 4);
+            EXPECT_EQ(cache.simplify(wide, simplifier), wide.simplify_local());
+            EXPECT_EQ(calls, 3);
+
+            cache.clear();
+            statistics = cache.get_statistics();
+            EXPECT_EQ(statistics.hits, 0);
+            EXPECT_EQ(statistics.misses, 0);
+            EXPECT_EQ(statistics.entries, 0);
+        }
+        {
+            // least recently used entries are evicted once the capacity is exceeded
+            calls = 0;
+            SimplificationCache cache(2);
+            cache.simplify(a.clone() & b.clone(), simplifier);
+            cache.simplify(a.clone() | b.clone(), simplifier);
+            cache.simplify(a.clone() & b.clone(), simplifier);
+            cache.simplify(a.clone() ^ b.clone(), simplifier);
+            EXPECT_EQ(calls, 3);
+            EXPECT_EQ(cache.get_statistics().evictions, 1);
+            EXPECT_EQ(cache.get_statistics().entries, 2);
+
+            cache.simplify(a.clone() & b.clone(), simplifier);
+            EXPECT_EQ(calls, 3);
+            cache.simplify(a.clone() | b.clone(), simplifier);
+            EXPECT_EQ(calls, 4);
+
+            cache.set_capacity(1);
+            EXPECT_EQ(cache.get_capacity(), 1);
+            EXPECT_EQ(cache.get_statistics().entries, 1);
+
+            // a disabled cache is bypassed entirely
+            cache.set_enabled(false);
+            EXPECT_FALSE(cache.is_enabled());
+            cache.simplify(a.clone() | b.clone(), simplifier);
+            EXPECT_EQ(calls, 5);
+            EXPECT_EQ(cache.get_statistics().hits, 2);
+        }
+        {
+            // concurrent simplification of the same functions
+            calls = 0;
+            SimplificationCache cache;
+            std::vector<std::thread> threads;
+            for (u32 t = 0; t < 4; t++)
+            {
+                threads.emplace_back([&]() {
+                    for (u32 i = 0; i < 100; i++)
+                    {
+                        const auto function = BooleanFunction::Var("x" + std::to_string(i % 10)) & BooleanFunction::Var("y" + std::to_string(i % 10)) & _1.clone();
+                        EXPECT_EQ(cache.simplify(function, simplifier).get_variable_names().size(), 2);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            const auto statistics = cache.get_statistics();
+            EXPECT_EQ(statistics.hits + statistics.misses, 400);
+            EXPECT_EQ(statistics.entries, 1);
+        }
+        {
+            // simplify() transparently uses the global cache
+            auto& cache = SimplificationCache::get_global_cache();
+            cache.clear();
+            const auto function = (a.clone() | ~a.clone()) & (c.clone() & _1.clone());
+            const auto simplified = function.simplify();
+            EXPECT_EQ(function.simplify(), simplified);
+            EXPECT_EQ(cache.get_statistics().hits, 1);
+
+            cache.set_enabled(false);
+            EXPECT_EQ(function.simplify(), simplified);
+            cache.set_enabled(true);
+            cache.clear();
+        }
+    }
 } //namespace hal
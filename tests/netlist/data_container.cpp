@@ -233,4 +233,81 @@ TEST_F(DataContainerTest, check_get_data)
 
     TEST_END
 }
+
+/**
+     * Testing the typed storage of data entries, i.e., that values are stored in their typed representation and still convert back to exactly the string they were set from.
+     *
+     * Functions: set_data, get_data, get_data_value, get_data_type, get_num_data_entries, DataValue::from_string, DataSymbol::find
+     */
+TEST_F(DataContainerTest, check_typed_data)
+{
+    TEST_START
+    {
+        // Values are stored according to their data type and convert back losslessly
+        TestDataContainer d_cont;
+        const std::vector<std::tuple<std::string, std::string, DataValue::Kind>> entries = {{"integer", "-42", DataValue::Kind::integer},
+                                                                                          {"integer", "007", DataValue::Kind::string},
+                                                                                          {"integer", "99999999999999999999", DataValue::Kind::string},
+                                                                                          {"bit_vector", "00e8", DataValue::Kind::bit_vector},
+                                                                                          {"bit_vector", "DEADBEEFDEADBEEFDEADBEEF0", DataValue::Kind::bit_vector},
+                                                                                          {"bit_vector", "aB", DataValue::Kind::string},
+                                                                                          {"bit_vector", "0x12", DataValue::Kind::string},
+                                                                                          {"string", "short", DataValue::Kind::string},
+                                                                                          {"string", "a string that does not fit inline", DataValue::Kind::string}};
+
+        for (u32 i = 0; i < entries.size(); i++)
+        {
+            const auto& [data_type, value, kind] = entries[i];
+            EXPECT_TRUE(d_cont.set_data("category", "key_" + std::to_string(i), data_type, value));
+
+            const DataValue* stored = d_cont.get_data_value(DataSymbol("category"), DataSymbol("key_" + std::to_string(i)));
+            ASSERT_NE(stored, nullptr);
+            EXPECT_EQ(stored->get_kind(), kind);
+            EXPECT_EQ(stored->to_string(), value);
+            EXPECT_EQ(d_cont.get_data_type(DataSymbol("category"), DataSymbol("key_" + std::to_string(i))), DataSymbol(data_type));
+            EXPECT_EQ(d_cont.get_data("category", "key_" + std::to_string(i)), std::make_tuple(data_type, value));
+        }
+        EXPECT_EQ(d_cont.get_num_data_entries(), entries.size());
+
+        // Typed accessors
+        EXPECT_EQ(d_cont.get_data_value(DataSymbol("category"), DataSymbol("key_0"))->get_integer(), -42);
+        const DataValue* bits = d_cont.get_data_value(DataSymbol("category"), DataSymbol("key_4"));
+        EXPECT_EQ(bits->get_num_digits(), 25);
+        EXPECT_EQ(bits->get_digit(0), 0x0);
+        EXPECT_EQ(bits->get_digit(1), 0xF);
+        EXPECT_EQ(bits->get_digit(24), 0xD);
+
+        // Copies compare equal and are independent of the original
+        TestDataContainer d_copy = d_cont;
+        EXPECT_TRUE(d_copy == d_cont);
+        EXPECT_TRUE(d_copy.set_data("category", "key_4", "bit_vector", "DEADBEEFDEADBEEFDEADBEEF1"));
+        EXPECT_TRUE(d_copy != d_cont);
+        EXPECT_EQ(d_cont.get_data("category", "key_4"), std::make_tuple("bit_vector", "DEADBEEFDEADBEEFDEADBEEF0"));
+        TestDataContainer d_assigned;
+        d_assigned = d_cont;
+        EXPECT_TRUE(d_assigned == d_cont);
+
+        // The same value stored with different representations is still equal
+        EXPECT_EQ(DataValue::from_string("integer", "12"), DataValue::from_string("string", "12"));
+        EXPECT_NE(DataValue::from_string("bit_vector", "12"), DataValue::from_string("integer", "13"));
+    }
+    {
+        // The typed interface works on the same entries as the string interface
+        TestDataContainer d_cont;
+        EXPECT_TRUE(d_cont.set_data(DataSymbol("typed_category"), DataSymbol("typed_key"), DataSymbol("integer"), DataValue(i64(1337))));
+        EXPECT_TRUE(d_cont.has_data("typed_category", "typed_key"));
+        EXPECT_EQ(d_cont.get_data("typed_category", "typed_key"), std::make_tuple("integer", "1337"));
+        EXPECT_EQ(d_cont.get_data_value(DataSymbol("typed_category"), DataSymbol("other_key")), nullptr);
+    }
+    {
+        // Looking up strings that have never been interned does not intern them
+        TestDataContainer d_cont;
+        EXPECT_FALSE(d_cont.has_data("never_interned_category", "never_interned_key"));
+        EXPECT_FALSE(DataSymbol::find("never_interned_category").has_value());
+        EXPECT_TRUE(DataSymbol::find("typed_category").has_value());
+        EXPECT_EQ(DataSymbol("typed_category").str(), "typed_category");
+        EXPECT_TRUE(DataSymbol().empty());
+    }
+    TEST_END
+}
 }
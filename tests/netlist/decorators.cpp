@@ -3,11 +3,13 @@
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_snapshot.h"
 #include "hal_core/netlist/boolean_function.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/boolean_function_decorator.h"
 #include "hal_core/netlist/decorators/netlist_modification_decorator.h"
 #include "hal_core/netlist/decorators/netlist_traversal_decorator.h"
+#include "hal_core/netlist/decorators/subgraph_netlist_decorator.h"
 #include "netlist_test_utils.h"
 
 
@@ -1053,7 +1055,123 @@ namespace hal {
                     EXPECT_EQ(res2.get(), std::set<Gate*>({or4, and1, and2, inv6}));
                 }
             }
+            {
+                // test NetlistTraversalDecorator on a NetlistSnapshot against the netlist-based traversal
+                const auto trav_dec = NetlistTraversalDecorator(*(nl.get()));
+                const NetlistSnapshot snapshot(*(nl.get()), 4);
+
+                const std::vector<std::set<PinType>> forbidden_pin_sets = {{}, {PinType::enable, PinType::reset, PinType::set, PinType::clock}, {PinType::none}};
+                for (const bool successors : {true, false})
+                {
+                    for (const auto& forbidden_pins : forbidden_pin_sets)
+                    {
+                        for (const auto* g : nl->get_gates())
+                        {
+                            EXPECT_EQ(trav_dec.get_next_sequential_gates(snapshot, g, successors, forbidden_pins).get(), trav_dec.get_next_sequential_gates(g, successors, forbidden_pins).get());
+                            EXPECT_EQ(trav_dec.get_next_combinational_gates(snapshot, g, successors, forbidden_pins).get(), trav_dec.get_next_combinational_gates(g, successors, forbidden_pins).get());
+                        }
+                        for (const auto* n : nl->get_nets())
+                        {
+                            EXPECT_EQ(trav_dec.get_next_sequential_gates(snapshot, n, successors, forbidden_pins).get(), trav_dec.get_next_sequential_gates(n, successors, forbidden_pins).get());
+                            EXPECT_EQ(trav_dec.get_next_combinational_gates(snapshot, n, successors, forbidden_pins).get(), trav_dec.get_next_combinational_gates(n, successors, forbidden_pins).get());
+                        }
+
+                        const auto res = trav_dec.get_next_sequential_gates_map(snapshot, successors, forbidden_pins, 3);
+                        ASSERT_TRUE(res.is_ok());
+                        EXPECT_EQ(res.get(), trav_dec.get_next_sequential_gates_map(successors, forbidden_pins).get());
+                    }
+                }
+
+                // snapshot of another netlist
+                auto other_nl = test_utils::create_empty_netlist();
+                const NetlistSnapshot other_snapshot(*(other_nl.get()));
+                EXPECT_TRUE(trav_dec.get_next_sequential_gates(other_snapshot, dff0, true).is_error());
+                EXPECT_TRUE(trav_dec.get_next_sequential_gates_map(other_snapshot, true, {}).is_error());
+
+                // gate created after the snapshot has been taken
+                auto* late_gate = nl->create_gate(gl->get_gate_type_by_name("INV"), "late");
+                EXPECT_TRUE(trav_dec.get_next_combinational_gates(snapshot, late_gate, true).is_error());
+                EXPECT_TRUE(trav_dec.get_next_sequential_gates(snapshot, (Gate*)nullptr, true).is_error());
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test SubgraphNetlistDecorator with a hash-consed DAG.
+     */
+    TEST_F(DecoratorTest, check_subgraph_netlist_decorator_dag)
+    {
+        TEST_START
+        {
+            // reconvergent chain in which every stage computes (prev & in) ^ (prev | in)
+            std::unique_ptr<Netlist> nl_owner = test_utils::create_empty_netlist();
+            auto* nl = nl_owner.get();
+            ASSERT_NE(nl, nullptr);
+            const auto* gl = nl->get_gate_library();
+
+            Net* in = nl->create_net("in");
+            ASSERT_NE(in, nullptr);
+            nl->mark_global_input_net(in);
+            Net* stage_in = nl->create_net("stage_in");
+            ASSERT_NE(stage_in, nullptr);
+            nl->mark_global_input_net(stage_in);
+
+            Net* prev = stage_in;
+
+            std::vector<Gate*> gates;
+            std::vector<Net*> stages;
+            for (u32 i = 0; i < 32; i++)
+            {
+                auto* and_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and_" + std::to_string(i));
+                ASSERT_NE(and_gate, nullptr);
+                auto* or_gate = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or_" + std::to_string(i));
+                ASSERT_NE(or_gate, nullptr);
+                auto* xor_gate = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor_" + std::to_string(i));
+                ASSERT_NE(xor_gate, nullptr);
+
+                ASSERT_NE(prev->add_destination(and_gate, "I0"), nullptr);
+                ASSERT_NE(in->add_destination(and_gate, "I1"), nullptr);
+                ASSERT_NE(prev->add_destination(or_gate, "I0"), nullptr);
+                ASSERT_NE(in->add_destination(or_gate, "I1"), nullptr);
+                ASSERT_NE(test_utils::connect(nl, and_gate, "O", xor_gate, "I0"), nullptr);
+                ASSERT_NE(test_utils::connect(nl, or_gate, "O", xor_gate, "I1"), nullptr);
+
+                prev = nl->create_net("stage_" + std::to_string(i));
+                ASSERT_NE(prev, nullptr);
+                ASSERT_NE(prev->add_source(xor_gate, "O"), nullptr);
+
+                gates.insert(gates.end(), {and_gate, or_gate, xor_gate});
+                stages.push_back(prev);
+            }
+
+            const auto sub_dec = SubgraphNetlistDecorator(*nl);
+
+            // the DAG holds both inputs and three operations per stage instead of an exponentially large expression
+            BooleanFunctionDAG dag;
+            auto root_res = sub_dec.get_subgraph_function_dag(gates, stages.back(), dag);
+            ASSERT_TRUE(root_res.is_ok());
+            EXPECT_EQ(dag.get_size(root_res.get()), 2 + 3 * 32);
+            EXPECT_GT(dag.get_expanded_size(root_res.get()), u64(1) << 32);
+            EXPECT_EQ(dag.get_variable_names(root_res.get()),
+                      std::set<std::string>({BooleanFunctionNetDecorator(*in).get_boolean_variable_name(), BooleanFunctionNetDecorator(*stage_in).get_boolean_variable_name()}));
+
+            // for a prefix of the chain, the DAG expands to the same function as the reverse-polish notation
+            const std::vector<Gate*> prefix(gates.begin(), gates.begin() + 3 * 4);
+            auto expected_res = sub_dec.get_subgraph_function(prefix, stages.at(3));
+            ASSERT_TRUE(expected_res.is_ok());
+            auto prefix_res = sub_dec.get_subgraph_function_dag(prefix, stages.at(3), dag);
+            ASSERT_TRUE(prefix_res.is_ok());
+            EXPECT_EQ(dag.to_boolean_function(prefix_res.get()).get(), expected_res.get());
+
+            // nets driven from outside of the subgraph become variables
+            auto outside_res = sub_dec.get_subgraph_function_dag(prefix, stages.back(), dag);
+            ASSERT_TRUE(outside_res.is_ok());
+            EXPECT_EQ(dag.to_boolean_function(outside_res.get()).get(), BooleanFunctionNetDecorator(*stages.back()).get_boolean_variable());
+
+            EXPECT_TRUE(sub_dec.get_subgraph_function_dag(std::vector<Gate*>(), stages.back(), dag).is_error());
+            EXPECT_TRUE(sub_dec.get_subgraph_function_dag(std::vector<Gate*>(), nullptr, dag).is_error());
         }
         TEST_END
     }
-}
\ No newline at end of file
+}
@@ -1340,4 +1340,54 @@ namespace hal
         }
         TEST_END
     }
+
+    /**
+     * Testing the views on predecessors and successors, which iterate over neighboring endpoints without copying them.
+     *
+     * Functions: get_predecessors_view, get_successors_view
+     */
+    TEST_F(GateTest, check_neighbor_views)
+    {
+        TEST_START
+        {
+            auto nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+
+            for (const Gate* gate : nl->get_gates())
+            {
+                EXPECT_EQ(gate->get_predecessors_view().to_vector(), gate->get_predecessors());
+                EXPECT_EQ(gate->get_successors_view().to_vector(), gate->get_successors());
+
+                auto filter = [](const GatePin* pin, const Endpoint* ep) { return pin->get_name() == "I1" || ep->get_gate()->get_type()->get_name() == "BUF"; };
+                EXPECT_EQ(gate->get_predecessors_view(filter).to_vector(), gate->get_predecessors(filter));
+                EXPECT_EQ(gate->get_successors_view(filter).to_vector(), gate->get_successors(filter));
+            }
+
+            // gate 0 is driven by gate 3 and gate 2 and drives gate 4 and gate 5
+            Gate* gate_0 = nl->get_gate_by_id(MIN_GATE_ID + 0);
+            std::set<Gate*> predecessors;
+            for (Endpoint* ep : gate_0->get_predecessors_view())
+            {
+                predecessors.insert(ep->get_gate());
+            }
+            EXPECT_EQ(predecessors, std::set<Gate*>({nl->get_gate_by_id(MIN_GATE_ID + 2), nl->get_gate_by_id(MIN_GATE_ID + 3)}));
+            EXPECT_EQ(gate_0->get_successors_view().size(), 2);
+
+            // gates without fan-in or fan-out nets
+            Gate* unconnected = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("AND2"), "unconnected");
+            EXPECT_TRUE(unconnected->get_predecessors_view().empty());
+            EXPECT_TRUE(unconnected->get_successors_view().empty());
+
+            // fan-in nets without sources are skipped
+            Net* floating = nl->create_net("floating");
+            floating->add_destination(unconnected, "I0");
+            Net* driven = nl->create_net("driven");
+            Gate* gate_8 = nl->get_gate_by_id(MIN_GATE_ID + 8);
+            driven->add_source(gate_8, "O");
+            driven->add_destination(unconnected, "I1");
+            ASSERT_EQ(unconnected->get_predecessors_view().size(), 1);
+            EXPECT_EQ((*unconnected->get_predecessors_view().begin())->get_gate(), gate_8);
+        }
+        TEST_END
+    }
 }    // namespace hal
@@ -4,6 +4,8 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "netlist_test_utils.h"
 
+#include <random>
+
 namespace hal {
 
     using test_utils::MIN_MODULE_ID;
@@ -1348,4 +1350,262 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing that assigning multiple gates at once moves all gates before any gate event is sent, and that the
+     * gate_removed and gate_assigned events are then sent pairwise in the order of the given gates.
+     *
+     * Functions: assign_gates
+     */
+    TEST_F(ModuleTest, check_assign_gates_event_order) {
+        TEST_START
+            auto nl = test_utils::create_empty_netlist();
+            GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+            std::vector<Gate*> gates;
+            for (u32 i = 0; i < 4; i++)
+            {
+                gates.push_back(nl->create_gate(buf, "gate_" + std::to_string(i)));
+            }
+            Module* prev_mod = nl->create_module("prev_mod", nl->get_top_module(), gates);
+            Module* test_mod = nl->create_module("test_mod", nl->get_top_module());
+            std::vector<Gate*> moved_gates = {gates[2], gates[0], gates[1]};
+
+            // record the gate events and whether all gates had already been moved when each event was sent
+            std::vector<std::tuple<ModuleEvent::event, Module*, u32>> events;
+            bool moved_before_events = true;
+            std::function<void(ModuleEvent::event, Module*, u32)> cb = [&](ModuleEvent::event ev, Module* m, u32 id) {
+                if (ev != ModuleEvent::event::gate_removed && ev != ModuleEvent::event::gate_assigned)
+                {
+                    return;
+                }
+                events.emplace_back(ev, m, id);
+                for (Gate* g : moved_gates)
+                {
+                    moved_before_events &= (g->get_module() == test_mod) && !prev_mod->contains_gate(g);
+                }
+                moved_before_events &= (prev_mod->get_gates() == std::vector<Gate*>({gates[3]}));
+            };
+            nl->get_event_handler()->register_callback("assign_gates_event_order", cb);
+
+            ASSERT_TRUE(test_mod->assign_gates(moved_gates));
+
+            nl->get_event_handler()->unregister_callback("assign_gates_event_order");
+
+            std::vector<std::tuple<ModuleEvent::event, Module*, u32>> expected_events;
+            for (Gate* g : moved_gates)
+            {
+                expected_events.emplace_back(ModuleEvent::event::gate_removed, prev_mod, g->get_id());
+                expected_events.emplace_back(ModuleEvent::event::gate_assigned, test_mod, g->get_id());
+            }
+            EXPECT_EQ(events, expected_events);
+            EXPECT_TRUE(moved_before_events);
+            EXPECT_TRUE(test_utils::vectors_have_same_content(test_mod->get_gates(), moved_gates));
+        TEST_END
+    }
+
+    /**
+     * Testing the views on the gates of a module, which iterate over the gates of the module and its submodules without copying them.
+     *
+     * Functions: get_gates_view
+     */
+    TEST_F(ModuleTest, check_gates_view) {
+        TEST_START
+            auto nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+            Module* top = nl->get_top_module();
+
+            // top
+            //  |- mod_a (gates 0, 1)
+            //  |   |- mod_c (empty)
+            //  |   |   '- mod_d (gate 2)
+            //  |   '- mod_e (gate 3)
+            //  '- mod_b (gate 4)
+            Module* mod_a = nl->create_module("mod_a", top, {nl->get_gate_by_id(MIN_GATE_ID + 0), nl->get_gate_by_id(MIN_GATE_ID + 1)});
+            Module* mod_b = nl->create_module("mod_b", top, {nl->get_gate_by_id(MIN_GATE_ID + 4)});
+            Module* mod_c = nl->create_module("mod_c", mod_a);
+            nl->create_module("mod_d", mod_c, {nl->get_gate_by_id(MIN_GATE_ID + 2)});
+            nl->create_module("mod_e", mod_a, {nl->get_gate_by_id(MIN_GATE_ID + 3)});
+
+            for (const Module* mod : nl->get_modules())
+            {
+                EXPECT_EQ(mod->get_gates_view().to_vector(), mod->get_gates());
+                EXPECT_EQ(mod->get_gates_view(true).to_vector(), mod->get_gates(nullptr, true));
+
+                auto filter = [](const Gate* g) { return g->get_id() % 2 == 0; };
+                EXPECT_EQ(mod->get_gates_view(filter).to_vector(), mod->get_gates(filter));
+                EXPECT_EQ(mod->get_gates_view(filter, true).to_vector(), mod->get_gates(filter, true));
+            }
+
+            EXPECT_EQ(top->get_gates_view(true).size(), nl->get_gates().size());
+            EXPECT_EQ(mod_a->get_gates_view(true).size(), 4);
+            EXPECT_TRUE(mod_c->get_gates_view().empty());
+            EXPECT_EQ(mod_c->get_gates_view(true).size(), 1);
+            EXPECT_EQ(mod_b->get_gates_view(true).size(), 1);
+            EXPECT_TRUE(mod_a->get_gates_view([](const Gate*) { return false; }, true).empty());
+
+            // the views follow changes of the module hierarchy
+            mod_c->set_parent_module(top);
+            nl->delete_module(mod_a);
+            for (const Module* mod : nl->get_modules())
+            {
+                EXPECT_EQ(mod->get_gates_view(true).to_vector(), mod->get_gates(nullptr, true));
+            }
+            EXPECT_TRUE(test_utils::vectors_have_same_content(top->get_gates_view(true).to_vector(), nl->get_gates()));
+            EXPECT_EQ(mod_c->get_gates_view(true).to_vector(), std::vector<Gate*>({nl->get_gate_by_id(MIN_GATE_ID + 2)}));
+        TEST_END
+    }
+    /**
+     * Stress testing the incremental classification of module nets by randomly editing the netlist and comparing the nets, input nets, output nets, and
+     * internal nets of all modules to those obtained by a full recomputation.
+     *
+     * Functions: get_nets, get_input_nets, get_output_nets, get_internal_nets, update_nets
+     */
+    TEST_F(ModuleTest, check_incremental_net_classification) {
+        TEST_START
+            auto nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+            GateType* buf  = nl->get_gate_library()->get_gate_type_by_name("BUF");
+
+            std::mt19937 rng(42);
+            auto random = [&rng](u32 size) { return std::uniform_int_distribution<u32>(0, size - 1)(rng); };
+
+            // every net is driven by one gate and has a random number of destinations
+            std::vector<Gate*> gates;
+            for (u32 i = 0; i < 200; i++)
+            {
+                gates.push_back(nl->create_gate((i % 3 == 0) ? buf : and2, "gate_" + std::to_string(i)));
+            }
+            for (Gate* gate : gates)
+            {
+                Net* net = nl->create_net("net_" + std::to_string(gate->get_id()));
+                net->add_source(gate, "O");
+            }
+            for (Gate* gate : gates)
+            {
+                for (GatePin* pin : gate->get_type()->get_input_pins())
+                {
+                    if (random(8) != 0)
+                    {
+                        gates.at(random(gates.size()))->get_fan_out_net("O")->add_destination(gate, pin);
+                    }
+                }
+            }
+            for (u32 i = 0; i < 10; i++)
+            {
+                nl->mark_global_input_net(gates.at(random(gates.size()))->get_fan_out_net("O"));
+                nl->mark_global_output_net(gates.at(random(gates.size()))->get_fan_out_net("O"));
+            }
+
+            auto check_against_recomputation = [&nl]() {
+                for (Module* mod : nl->get_modules())
+                {
+                    const std::unordered_set<Net*> nets          = mod->get_nets();
+                    const std::unordered_set<Net*> input_nets    = mod->get_input_nets();
+                    const std::unordered_set<Net*> output_nets   = mod->get_output_nets();
+                    const std::unordered_set<Net*> internal_nets = mod->get_internal_nets();
+
+                    mod->update_nets();
+                    EXPECT_EQ(nets, mod->get_nets()) << "module " << mod->get_name();
+                    EXPECT_EQ(input_nets, mod->get_input_nets()) << "module " << mod->get_name();
+                    EXPECT_EQ(output_nets, mod->get_output_nets()) << "module " << mod->get_name();
+                    EXPECT_EQ(internal_nets, mod->get_internal_nets()) << "module " << mod->get_name();
+                }
+            };
+
+            for (u32 round = 0; round < 20; round++)
+            {
+                // every third round is performed as a bulk edit
+                const bool bulk_edit = (round % 3 == 2);
+                if (bulk_edit)
+                {
+                    nl->begin_bulk_edit();
+                }
+
+                for (u32 step = 0; step < 50; step++)
+                {
+                    std::vector<Module*> modules = nl->get_modules();
+                    Module* mod                  = modules.at(random(modules.size()));
+                    const u32 op                 = random(10);
+
+                    if (op < 4 || modules.size() < 4)
+                    {
+                        // assign a handful of random gates to a random module, creating a new one every now and then
+                        std::vector<Gate*> to_assign;
+                        for (u32 i = random(20); i > 0; i--)
+                        {
+                            Gate* gate = gates.at(random(gates.size()));
+                            if (gate->get_module() != mod && std::find(to_assign.begin(), to_assign.end(), gate) == to_assign.end())
+                            {
+                                to_assign.push_back(gate);
+                            }
+                        }
+                        if (random(4) == 0)
+                        {
+                            nl->create_module("mod_" + std::to_string(round) + "_" + std::to_string(step), mod, to_assign);
+                        }
+                        else if (!to_assign.empty())
+                        {
+                            EXPECT_TRUE(mod->assign_gates(to_assign));
+                        }
+                    }
+                    else if (op < 6)
+                    {
+                        // move a random module below another random module
+                        if (Module* parent = modules.at(random(modules.size())); !mod->is_top_module() && parent != mod)
+                        {
+                            EXPECT_TRUE(mod->set_parent_module(parent));
+                        }
+                    }
+                    else if (op < 8)
+                    {
+                        // reconnect a random input pin
+                        Gate* gate    = gates.at(random(gates.size()));
+                        GatePin* pin  = gate->get_type()->get_input_pins().at(random(gate->get_type()->get_input_pins().size()));
+                        Net* new_net  = gates.at(random(gates.size()))->get_fan_out_net("O");
+                        if (Net* net = gate->get_fan_in_net(pin); net != nullptr)
+                        {
+                            EXPECT_TRUE(net->remove_destination(gate, pin));
+                        }
+                        EXPECT_NE(new_net->add_destination(gate, pin), nullptr);
+                    }
+                    else if (op < 9)
+                    {
+                        // disconnect and reconnect the source of a random net
+                        Gate* gate = gates.at(random(gates.size()));
+                        Net* net   = gate->get_fan_out_net("O");
+                        EXPECT_TRUE(net->remove_source(gate, "O"));
+                        EXPECT_NE(net->add_source(gate, "O"), nullptr);
+                    }
+                    else if (!mod->is_top_module())
+                    {
+                        EXPECT_TRUE(nl->delete_module(mod));
+                    }
+                }
+
+                if (bulk_edit)
+                {
+                    EXPECT_TRUE(nl->end_bulk_edit().is_ok());
+                }
+
+                check_against_recomputation();
+            }
+
+            // deleting gates and nets removes their endpoints from all modules
+            for (u32 i = 0; i < 50; i++)
+            {
+                Gate* gate = gates.at(random(gates.size()));
+                if (i % 2 == 0)
+                {
+                    EXPECT_TRUE(nl->delete_net(gate->get_fan_out_net("O")));
+                    EXPECT_NE(nl->create_net("new_net_" + std::to_string(i))->add_source(gate, "O"), nullptr);
+                }
+                else
+                {
+                    gates.erase(std::find(gates.begin(), gates.end(), gate));
+                    EXPECT_TRUE(nl->delete_gate(gate));
+                }
+            }
+            check_against_recomputation();
+        TEST_END
+    }
 } //namespace hal
@@ -1040,4 +1040,38 @@ namespace hal {
 
         TEST_END
     }
+
+    /**
+     * Testing the views on sources and destinations, which iterate over the endpoints of a net without copying them.
+     *
+     * Functions: get_sources_view, get_destinations_view
+     */
+    TEST_F(NetTest, check_endpoint_views) {
+        TEST_START
+            auto nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+
+            for (const Net* net : nl->get_nets())
+            {
+                EXPECT_EQ(net->get_sources_view().to_vector(), net->get_sources());
+                EXPECT_EQ(net->get_destinations_view().to_vector(), net->get_destinations());
+                EXPECT_EQ(net->get_sources_view().size(), net->get_num_of_sources());
+                EXPECT_EQ(net->get_destinations_view().empty(), net->get_destinations().empty());
+
+                auto filter = [](const Endpoint* ep) { return ep->get_pin()->get_name() != "I0"; };
+                EXPECT_EQ(net->get_destinations_view(filter).to_vector(), net->get_destinations(filter));
+                EXPECT_EQ(net->get_destinations_view(filter).size(), net->get_num_of_destinations(filter));
+            }
+
+            // the destinations of net 045 are gate 4 (I) and gate 5 (I0)
+            Net* net_0_4_5 = nl->get_net_by_id(MIN_NET_ID + 045);
+            std::vector<Gate*> gates;
+            for (Endpoint* ep : net_0_4_5->get_destinations_view([](const Endpoint* ep) { return ep->get_pin()->get_name() == "I0"; }))
+            {
+                gates.push_back(ep->get_gate());
+            }
+            EXPECT_EQ(gates, std::vector<Gate*>({nl->get_gate_by_id(MIN_GATE_ID + 5)}));
+            EXPECT_TRUE(net_0_4_5->get_destinations_view([](const Endpoint*) { return false; }).empty());
+        TEST_END
+    }
 } //namespace hal
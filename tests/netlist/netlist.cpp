@@ -2,9 +2,16 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/grouping.h"
+#include "hal_core/netlist/netlist_bulk_edit.h"
+#include "hal_core/netlist/netlist_fingerprint.h"
+#include "hal_core/netlist/name_index.h"
+#include "hal_core/netlist/netlist_snapshot.h"
 #include "netlist_test_utils.h"
 #include "gate_library_test_utils.h"
 
+#include <atomic>
+#include <thread>
+
 namespace hal {
     using test_utils::MIN_NETLIST_ID;
     using test_utils::MIN_MODULE_ID;
@@ -296,6 +303,82 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the bookkeeping of used and freed IDs
+     *
+     * Functions: get_unique_gate_id, get_used_gate_ids, get_free_gate_ids, set_used_gate_ids, set_free_gate_ids, IdAllocator
+     */
+    TEST_F(NetlistTest, check_id_tracking) {
+        TEST_START
+            {
+                // freed IDs are reused smallest first, otherwise IDs follow the highest ID handed out so far
+                auto nl = test_utils::create_empty_netlist();
+                GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+                std::vector<Gate*> gates;
+                for (u32 i = 0; i < 200; i++)
+                {
+                    gates.push_back(nl->create_gate(buf, "gate_" + std::to_string(i)));
+                    ASSERT_NE(gates.back(), nullptr);
+                    EXPECT_EQ(gates.back()->get_id(), i + 1);
+                }
+                nl->delete_gate(gates.at(149));
+                nl->delete_gate(gates.at(9));
+                nl->delete_gate(gates.at(99));
+                EXPECT_EQ(nl->get_free_gate_ids(), std::set<u32>({10, 100, 150}));
+                EXPECT_EQ(nl->get_used_gate_ids().size(), 197);
+                EXPECT_EQ(nl->get_unique_gate_id(), 10);
+                EXPECT_EQ(nl->create_gate(buf, "gate_a")->get_id(), 10);
+                EXPECT_EQ(nl->create_gate(100, buf, "gate_b")->get_id(), 100);
+                EXPECT_EQ(nl->get_unique_gate_id(), 150);
+                EXPECT_EQ(nl->create_gate(buf, "gate_c")->get_id(), 150);
+                EXPECT_TRUE(nl->get_free_gate_ids().empty());
+                EXPECT_EQ(nl->get_unique_gate_id(), 201);
+
+                // sparse IDs far beyond the used range
+                EXPECT_NE(nl->create_gate(4000000000u, buf, "gate_d"), nullptr);
+                {
+                    NO_COUT_TEST_BLOCK;
+                    EXPECT_EQ(nl->create_gate(4000000000u, buf, "gate_e"), nullptr);
+                }
+                EXPECT_EQ(nl->get_unique_gate_id(), 201);
+                EXPECT_EQ(*nl->get_used_gate_ids().rbegin(), 4000000000u);
+
+                // the bookkeeping can be restored from sets
+                auto other = test_utils::create_empty_netlist();
+                other->set_used_gate_ids(nl->get_used_gate_ids());
+                other->set_free_gate_ids({7, 3});
+                other->set_next_gate_id(nl->get_next_gate_id());
+                EXPECT_EQ(other->get_used_gate_ids(), nl->get_used_gate_ids());
+                EXPECT_EQ(other->get_free_gate_ids(), std::set<u32>({3, 7}));
+                EXPECT_EQ(other->get_unique_gate_id(), 3);
+            }
+            {
+                // stale entries of reused IDs are skipped
+                IdAllocator ids;
+                for (u32 id = 1; id <= 1000; id++)
+                {
+                    EXPECT_TRUE(ids.reserve(id));
+                }
+                EXPECT_FALSE(ids.reserve(500));
+                for (u32 id = 1000; id >= 1; id--)
+                {
+                    EXPECT_TRUE(ids.release(id));
+                    EXPECT_TRUE(ids.reserve(id));
+                    EXPECT_TRUE(ids.release(id));
+                }
+                EXPECT_FALSE(ids.release(1));
+                EXPECT_EQ(ids.get_num_used_ids(), 0);
+                for (u32 id = 1; id <= 1000; id++)
+                {
+                    ASSERT_EQ(ids.get_unique_id(), id);
+                    EXPECT_TRUE(ids.reserve(id));
+                }
+                EXPECT_TRUE(ids.get_free_ids().empty());
+                EXPECT_EQ(ids.get_unique_id(), 1001);
+            }
+        TEST_END
+    }
+
     /**
      * Testing get_num_of_gates function
      *
@@ -436,6 +519,93 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the pooled storage of gates, nets, and endpoints under many creations and deletions
+     *
+     * Functions: create_gate, delete_gate, create_net, delete_net, get_gate_by_id, get_net_by_id, is_gate_in_netlist, is_net_in_netlist
+     */
+    TEST_F(NetlistTest, check_object_storage) {
+        TEST_START
+            auto nl = test_utils::create_empty_netlist();
+            GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+
+            // build a chain of buffers
+            std::vector<Gate*> gates;
+            std::vector<Net*> nets;
+            for (u32 i = 0; i < 1000; i++)
+            {
+                gates.push_back(nl->create_gate(buf, "gate_" + std::to_string(i)));
+                ASSERT_NE(gates.back(), nullptr);
+                if (i > 0)
+                {
+                    nets.push_back(test_utils::connect(nl.get(), gates.at(i - 1), "O", gates.at(i), "I"));
+                    ASSERT_NE(nets.back(), nullptr);
+                }
+            }
+
+            // delete every third gate and every fifth net
+            std::set<Gate*> deleted_gates;
+            std::set<Net*> deleted_nets;
+            for (u32 i = 0; i < gates.size(); i += 3)
+            {
+                EXPECT_TRUE(nl->delete_gate(gates.at(i)));
+                deleted_gates.insert(gates.at(i));
+            }
+            for (u32 i = 0; i < nets.size(); i += 5)
+            {
+                EXPECT_TRUE(nl->delete_net(nets.at(i)));
+                deleted_nets.insert(nets.at(i));
+            }
+
+            // pointers to deleted objects are rejected, remaining objects are found by pointer and ID
+            for (Gate* gate : gates)
+            {
+                if (deleted_gates.find(gate) != deleted_gates.end())
+                {
+                    EXPECT_FALSE(nl->is_gate_in_netlist(gate));
+                    EXPECT_FALSE(nl->delete_gate(gate));
+                }
+                else
+                {
+                    EXPECT_TRUE(nl->is_gate_in_netlist(gate));
+                    EXPECT_EQ(nl->get_gate_by_id(gate->get_id()), gate);
+                }
+            }
+            for (Net* net : nets)
+            {
+                if (deleted_nets.find(net) != deleted_nets.end())
+                {
+                    EXPECT_FALSE(nl->is_net_in_netlist(net));
+                }
+                else
+                {
+                    EXPECT_TRUE(nl->is_net_in_netlist(net));
+                    EXPECT_EQ(nl->get_net_by_id(net->get_id()), net);
+                    for (const Endpoint* ep : net->get_destinations())
+                    {
+                        EXPECT_EQ(ep->get_net(), net);
+                        EXPECT_TRUE(nl->is_gate_in_netlist(ep->get_gate()));
+                    }
+                }
+            }
+            EXPECT_EQ(nl->get_gates().size(), gates.size() - deleted_gates.size());
+            EXPECT_EQ(nl->get_nets().size(), nets.size() - deleted_nets.size());
+            EXPECT_EQ(std::set<Gate*>(nl->get_gates().begin(), nl->get_gates().end()).size(), nl->get_gates().size());
+
+            // freed slots and IDs are reused
+            Gate* new_gate = nl->create_gate(buf, "gate_new");
+            ASSERT_NE(new_gate, nullptr);
+            EXPECT_EQ(new_gate->get_id(), 1);
+            EXPECT_EQ(nl->get_gate_by_id(1), new_gate);
+            EXPECT_TRUE(nl->is_gate_in_netlist(new_gate));
+
+            // objects of other netlists are rejected
+            auto other = test_utils::create_empty_netlist();
+            EXPECT_FALSE(other->is_gate_in_netlist(new_gate));
+            EXPECT_FALSE(other->is_net_in_netlist(nets.back()));
+        TEST_END
+    }
+
     /**
      * Testing the function is_gate_in_netlist
      *
@@ -1698,4 +1868,791 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing bulk edits, which defer the classification of module nets and hold back net events until the bulk edit ends.
+     *
+     * Functions: begin_bulk_edit, end_bulk_edit, is_bulk_edit_active, NetlistBulkEdit
+     */
+    TEST_F(NetlistTest, check_bulk_edit) {
+        TEST_START
+            // builds a net with many destinations spread across nested modules, moves and disconnects some endpoints, and deletes a module input net
+            auto build = [](Netlist* nl) {
+                GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+                Module* top   = nl->get_top_module();
+                Module* mod_a = nl->create_module("mod_a", top);
+                Module* mod_b = nl->create_module("mod_b", mod_a);
+
+                Gate* drv = nl->create_gate(buf, "drv");
+                Net* clk  = nl->create_net("clk");
+                clk->add_source(drv, "O");
+
+                std::vector<Gate*> gates;
+                for (u32 i = 0; i < 60; i++)
+                {
+                    Gate* g = nl->create_gate(buf, "buf_" + std::to_string(i));
+                    clk->add_destination(g, "I");
+                    if (i % 3 == 1)
+                    {
+                        mod_a->assign_gate(g);
+                    }
+                    else if (i % 3 == 2)
+                    {
+                        mod_b->assign_gate(g);
+                    }
+                    gates.push_back(g);
+                }
+
+                // drive further buffers from some of the destinations and expose one output
+                for (u32 i = 0; i < gates.size(); i += 4)
+                {
+                    Gate* sink = nl->create_gate(buf, "sink_" + std::to_string(i));
+                    mod_a->assign_gate(sink);
+                    test_utils::connect(nl, gates.at(i), "O", sink, "I", "chain_" + std::to_string(i));
+                }
+                test_utils::connect_global_out(nl, gates.back(), "O", "out");
+
+                // disconnect a few destinations again and move a gate between modules
+                for (u32 i = 0; i < gates.size(); i += 7)
+                {
+                    if (clk->is_a_destination(gates.at(i), "I"))
+                    {
+                        clk->remove_destination(gates.at(i), "I");
+                    }
+                }
+                top->assign_gate(gates.at(2));
+
+                // a net that is an input of a module for a short time only
+                Gate* drv_2 = nl->create_gate(buf, "drv_2");
+                Net* tmp    = test_utils::connect(nl, drv_2, "O", gates.at(7), "I", "tmp");
+                nl->delete_net(tmp);
+            };
+
+            // captures the input, output, and internal nets and the number of pins of every module
+            auto describe = [](const Netlist* nl) {
+                std::map<std::string, std::tuple<std::set<std::string>, std::set<std::string>, std::set<std::string>, size_t>> result;
+                for (const Module* mod : nl->get_modules())
+                {
+                    auto& [inputs, outputs, internals, num_pins] = result[mod->get_name()];
+                    for (const Net* net : mod->get_input_nets())
+                    {
+                        inputs.insert(net->get_name());
+                    }
+                    for (const Net* net : mod->get_output_nets())
+                    {
+                        outputs.insert(net->get_name());
+                    }
+                    for (const Net* net : mod->get_internal_nets())
+                    {
+                        internals.insert(net->get_name());
+                    }
+                    num_pins = mod->get_pins().size();
+                }
+                return result;
+            };
+
+            // module nets after a bulk edit match those obtained with immediate updates
+            {
+                auto nl_ref = test_utils::create_empty_netlist();
+                build(nl_ref.get());
+
+                auto nl = test_utils::create_empty_netlist();
+                {
+                    NetlistBulkEdit bulk_edit(nl.get());
+                    EXPECT_TRUE(nl->is_bulk_edit_active());
+                    build(nl.get());
+
+                    // module nets are not updated yet
+                    Module* mod_b = nl->get_modules([](const Module* m) { return m->get_name() == "mod_b"; }).front();
+                    EXPECT_TRUE(mod_b->get_input_nets().empty());
+
+                    EXPECT_TRUE(bulk_edit.commit().is_ok());
+                    EXPECT_FALSE(nl->is_bulk_edit_active());
+                }
+
+                EXPECT_EQ(describe(nl.get()), describe(nl_ref.get()));
+                EXPECT_FALSE(std::get<0>(describe(nl.get()).at("mod_b")).empty());
+            }
+
+            // net events are held back until the outermost bulk edit ends and canceled out if an endpoint is removed again
+            {
+                auto nl      = test_utils::create_empty_netlist();
+                GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+                Gate* g_0     = nl->create_gate(buf, "g_0");
+                Gate* g_1     = nl->create_gate(buf, "g_1");
+                Gate* g_2     = nl->create_gate(buf, "g_2");
+                Net* net      = nl->create_net("net");
+
+                test_utils::EventListener<void, NetEvent::event, Net*, u32> listener;
+                nl->get_event_handler()->register_callback("bulk_edit_listener", listener.get_callback());
+
+                {
+                    NetlistBulkEdit bulk_edit(nl.get());
+                    ASSERT_NE(net->add_source(g_0, "O"), nullptr);
+                    ASSERT_NE(net->add_destination(g_1, "I"), nullptr);
+                    ASSERT_NE(net->add_destination(g_2, "I"), nullptr);
+                    EXPECT_TRUE(net->remove_destination(g_2, "I"));
+                    EXPECT_EQ(listener.get_event_count(), 0);
+
+                    // a nested bulk edit does not send any events
+                    nl->begin_bulk_edit();
+                    EXPECT_TRUE(nl->end_bulk_edit().is_ok());
+                    EXPECT_TRUE(nl->is_bulk_edit_active());
+                    EXPECT_EQ(listener.get_event_count(), 0);
+
+                    EXPECT_TRUE(bulk_edit.commit().is_ok());
+                    EXPECT_EQ(listener.get_event_count(), 2);
+                    EXPECT_EQ(listener.get_last_parameters(), std::make_tuple(NetEvent::event::dst_added, net, g_1->get_id()));
+
+                    // committing twice has no effect
+                    EXPECT_TRUE(bulk_edit.commit().is_ok());
+                    EXPECT_EQ(listener.get_event_count(), 2);
+                }
+
+                // ending a bulk edit that has not been started fails
+                EXPECT_TRUE(nl->end_bulk_edit().is_error());
+
+                nl->get_event_handler()->unregister_callback("bulk_edit_listener");
+            }
+            // removing an endpoint only cancels out the addition of an endpoint at the same pin
+            {
+                auto nl        = test_utils::create_empty_netlist();
+                GateType* buf  = nl->get_gate_library()->get_gate_type_by_name("BUF");
+                GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+                Gate* g_0      = nl->create_gate(buf, "g_0");
+                Gate* g_1      = nl->create_gate(and2, "g_1");
+                Net* net       = nl->create_net("net");
+                ASSERT_NE(net->add_source(g_0, "O"), nullptr);
+                ASSERT_NE(net->add_destination(g_1, "I0"), nullptr);
+
+                test_utils::EventListener<void, NetEvent::event, Net*, u32> listener;
+                nl->get_event_handler()->register_callback("bulk_edit_listener", listener.get_callback());
+
+                {
+                    NetlistBulkEdit bulk_edit(nl.get());
+                    ASSERT_NE(net->add_destination(g_1, "I1"), nullptr);
+                    EXPECT_TRUE(net->remove_destination(g_1, "I0"));
+                }
+                EXPECT_EQ(listener.get_event_count(), 2);
+                EXPECT_EQ(listener.get_last_parameters(), std::make_tuple(NetEvent::event::dst_removed, net, g_1->get_id()));
+
+                nl->get_event_handler()->unregister_callback("bulk_edit_listener");
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the delivery of coalesced events to batch callbacks.
+     *
+     * Functions: register_batch_callback, begin_batch, end_batch, is_batch_active
+     */
+    TEST_F(NetlistTest, check_event_batching) {
+        TEST_START
+            auto nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            EventHandler* handler = nl->get_event_handler();
+            GateType* buf         = nl->get_gate_library()->get_gate_type_by_name("BUF");
+
+            std::vector<std::vector<NetBatchedEvent>> net_batches;
+            std::vector<std::vector<GateBatchedEvent>> gate_batches;
+            handler->register_batch_callback("batch_listener", std::function<void(const std::vector<NetBatchedEvent>&)>([&net_batches](const auto& events) { net_batches.push_back(events); }));
+            handler->register_batch_callback("batch_listener", std::function<void(const std::vector<GateBatchedEvent>&)>([&gate_batches](const auto& events) { gate_batches.push_back(events); }));
+
+            u32 num_single_events = 0;
+            handler->register_callback("single_listener", std::function<void(NetEvent::event, Net*, u32)>([&num_single_events](NetEvent::event, Net*, u32) { num_single_events++; }));
+
+            {
+                // outside of a batch, every event is delivered as a batch of its own
+                Net* net = nl->create_net("net");
+                ASSERT_EQ(net_batches.size(), 1);
+                ASSERT_EQ(net_batches.at(0).size(), 1);
+                EXPECT_EQ(net_batches.at(0).at(0).event, NetEvent::event::created);
+                EXPECT_EQ(net_batches.at(0).at(0).object, net);
+                EXPECT_EQ(net_batches.at(0).at(0).object_id, net->get_id());
+                net_batches.clear();
+                gate_batches.clear();
+                num_single_events = 0;
+
+                // within a batch, equal events of the same object are coalesced, while per-event callbacks are executed immediately
+                std::vector<Gate*> gates;
+                handler->begin_batch();
+                EXPECT_TRUE(handler->is_batch_active());
+                for (u32 i = 0; i < 100; i++)
+                {
+                    gates.push_back(nl->create_gate(buf, "gate_" + std::to_string(i)));
+                    ASSERT_NE(net->add_destination(gates.back(), "I"), nullptr);
+                    net->set_name("net_" + std::to_string(i % 2));
+                }
+                EXPECT_EQ(num_single_events, 200);
+
+                // nested batches do not deliver anything
+                handler->begin_batch();
+                handler->end_batch();
+                EXPECT_TRUE(net_batches.empty());
+                EXPECT_TRUE(gate_batches.empty());
+
+                handler->end_batch();
+                EXPECT_FALSE(handler->is_batch_active());
+                ASSERT_EQ(net_batches.size(), 1);
+                ASSERT_EQ(net_batches.at(0).size(), 2);
+                EXPECT_EQ(net_batches.at(0).at(0).event, NetEvent::event::dst_added);
+                EXPECT_EQ(net_batches.at(0).at(0).object, net);
+                ASSERT_EQ(net_batches.at(0).at(0).associated_data.size(), 100);
+                EXPECT_EQ(net_batches.at(0).at(0).associated_data.back(), gates.back()->get_id());
+                EXPECT_EQ(net_batches.at(0).at(1).event, NetEvent::event::name_changed);
+                ASSERT_EQ(gate_batches.size(), 1);
+                EXPECT_EQ(gate_batches.at(0).size(), 100);
+                net_batches.clear();
+                gate_batches.clear();
+
+                // objects created and removed within a batch vanish, objects only removed keep their removal event
+                handler->begin_batch();
+                Gate* temp_gate = nl->create_gate(buf, "temp_gate");
+                temp_gate->set_name("temp_gate_renamed");
+                EXPECT_TRUE(nl->delete_gate(temp_gate));
+                const u32 removed_id = gates.front()->get_id();
+                EXPECT_TRUE(nl->delete_gate(gates.front()));
+                handler->end_batch();
+                ASSERT_EQ(gate_batches.size(), 1);
+                ASSERT_EQ(gate_batches.at(0).size(), 1);
+                EXPECT_EQ(gate_batches.at(0).at(0).event, GateEvent::event::removed);
+                EXPECT_EQ(gate_batches.at(0).at(0).object_id, removed_id);
+                ASSERT_EQ(net_batches.size(), 1);
+                ASSERT_EQ(net_batches.at(0).size(), 1);
+                EXPECT_EQ(net_batches.at(0).at(0).event, NetEvent::event::dst_removed);
+                EXPECT_EQ(net_batches.at(0).at(0).associated_data, std::vector<u32>({removed_id}));
+                net_batches.clear();
+                gate_batches.clear();
+
+                // bulk edits deliver their events as a single batch
+                {
+                    NetlistBulkEdit bulk_edit(nl.get());
+                    EXPECT_TRUE(handler->is_batch_active());
+                    for (u32 i = 1; i < gates.size(); i++)
+                    {
+                        EXPECT_TRUE(net->remove_destination(gates.at(i), "I"));
+                    }
+                }
+                EXPECT_FALSE(handler->is_batch_active());
+                ASSERT_EQ(net_batches.size(), 1);
+                ASSERT_EQ(net_batches.at(0).size(), 1);
+                EXPECT_EQ(net_batches.at(0).at(0).associated_data.size(), gates.size() - 1);
+
+                // ending a batch that has not been started has no effect
+                handler->end_batch();
+                EXPECT_FALSE(handler->is_batch_active());
+            }
+
+            handler->unregister_callback("batch_listener");
+            handler->unregister_callback("single_listener");
+            net_batches.clear();
+            nl->create_net("another_net");
+            EXPECT_TRUE(net_batches.empty());
+        TEST_END
+    }
+
+    /**
+     * Testing the deep copy of a netlist using one and multiple threads, including the classification of module nets and the independence of the copy from the original netlist.
+     *
+     * Functions: copy
+     */
+    TEST_F(NetlistTest, check_copy)
+    {
+        TEST_START
+        const auto get_ids = [](const auto& nets) {
+            std::set<u32> ids;
+            for (const Net* net : nets)
+            {
+                ids.insert(net->get_id());
+            }
+            return ids;
+        };
+
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+            Module* mod_0 = nl->create_module("mod_0", nl->get_top_module(), {nl->get_gate_by_id(MIN_GATE_ID + 0), nl->get_gate_by_id(MIN_GATE_ID + 1), nl->get_gate_by_id(MIN_GATE_ID + 3)});
+            Module* mod_1 = nl->create_module("mod_1", mod_0, {nl->get_gate_by_id(MIN_GATE_ID + 3)});
+            mod_1->set_type("sub");
+            mod_0->set_data("category", "key", "string", "value");
+            nl->get_top_module()->set_name("renamed_top");
+            nl->get_gate_by_id(MIN_GATE_ID + 0)->set_data("category", "key", "bit_vector", "ABCD");
+            nl->get_net_by_id(MIN_NET_ID + 13)->set_data("category", "key", "integer", "13");
+            nl->create_grouping("grouping")->assign_gate_by_id(MIN_GATE_ID + 5);
+            nl->mark_gnd_gate(nl->get_gate_by_id(MIN_GATE_ID + 1));
+            nl->mark_global_input_net(nl->get_net_by_id(MIN_NET_ID + 20));
+
+            for (u32 num_workers : {1u, 4u})
+            {
+                auto res = nl->copy(num_workers);
+                ASSERT_TRUE(res.is_ok());
+                std::unique_ptr<Netlist> c_nl = res.get();
+
+                EXPECT_TRUE(*c_nl == *nl);
+                EXPECT_EQ(c_nl->get_top_module()->get_name(), "renamed_top");
+                for (const Module* module : nl->get_modules())
+                {
+                    const Module* c_module = c_nl->get_module_by_id(module->get_id());
+                    ASSERT_NE(c_module, nullptr);
+                    EXPECT_EQ(c_module->get_parent_module() == nullptr, module->get_parent_module() == nullptr);
+                    EXPECT_EQ(get_ids(c_module->get_input_nets()), get_ids(module->get_input_nets()));
+                    EXPECT_EQ(get_ids(c_module->get_output_nets()), get_ids(module->get_output_nets()));
+                    EXPECT_EQ(get_ids(c_module->get_internal_nets()), get_ids(module->get_internal_nets()));
+                    EXPECT_EQ(c_module->get_pins().size(), module->get_pins().size());
+                }
+                for (const Gate* gate : nl->get_gates())
+                {
+                    const Gate* c_gate = c_nl->get_gate_by_id(gate->get_id());
+                    ASSERT_NE(c_gate, nullptr);
+                    EXPECT_EQ(c_gate->get_module()->get_id(), gate->get_module()->get_id());
+                    for (const Endpoint* ep : c_gate->get_fan_in_endpoints())
+                    {
+                        EXPECT_EQ(ep->get_gate(), c_gate);
+                        EXPECT_TRUE(c_nl->is_net_in_netlist(ep->get_net()));
+                    }
+                }
+
+                // the copy is independent of the original netlist and can be modified as usual
+                Gate* c_gate = c_nl->get_gate_by_id(MIN_GATE_ID + 3);
+                EXPECT_TRUE(c_nl->delete_gate(c_gate));
+                EXPECT_NE(nl->get_gate_by_id(MIN_GATE_ID + 3), nullptr);
+                EXPECT_EQ(c_nl->get_gates().size() + 1, nl->get_gates().size());
+                Gate* new_gate = c_nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "new_gate");
+                ASSERT_NE(new_gate, nullptr);
+                EXPECT_EQ(c_nl->get_gate_by_id(new_gate->get_id()), new_gate);
+                EXPECT_NE(test_utils::connect(c_nl.get(), c_nl->get_gate_by_id(MIN_GATE_ID + 0), "O", new_gate, "I"), nullptr);
+                EXPECT_TRUE(c_nl->get_top_module()->get_internal_nets().size() > 0);
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Stress testing concurrent read access to the netlist, both without any modifications and while another thread modifies the netlist holding write access.
+     * Build with ThreadSanitizer (SANITIZE_THREAD) to detect data races.
+     *
+     * Functions: acquire_read_lock, acquire_write_lock, get_boolean_function, clear_caches
+     */
+    TEST_F(NetlistTest, check_concurrent_access) {
+        TEST_START
+            auto nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            GateType* lut2 = nl->get_gate_library()->get_gate_type_by_name("LUT2");
+            GateType* lut3 = nl->get_gate_library()->get_gate_type_by_name("LUT3");
+
+            // a chain of LUTs with few distinct configurations, so that threads share entries of the LUT function cache
+            std::vector<Gate*> luts;
+            for (u32 i = 0; i < 64; i++)
+            {
+                Gate* gate = nl->create_gate((i % 2 == 0) ? lut2 : lut3, "lut_" + std::to_string(i));
+                ASSERT_TRUE(gate->set_init_data({(i % 2 == 0) ? "8" : "e8"}).is_ok());
+                if (!luts.empty())
+                {
+                    ASSERT_NE(test_utils::connect(nl.get(), luts.back(), "O", gate, "I0"), nullptr);
+                }
+                luts.push_back(gate);
+            }
+            const Module* mod = nl->create_module("mod", nl->get_top_module(), std::vector<Gate*>(luts.begin(), luts.begin() + 32));
+
+            std::unordered_map<const Gate*, BooleanFunction> reference;
+            for (const Gate* gate : luts)
+            {
+                reference[gate] = gate->get_boolean_function("O");
+            }
+
+            const u32 num_threads = 4;
+            std::atomic<u32> num_mismatches = 0;
+            auto run_threads = [num_threads](const std::function<void(u32)>& f) {
+                std::vector<std::thread> threads;
+                for (u32 t = 0; t < num_threads; t++)
+                {
+                    threads.emplace_back(f, t);
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+            };
+
+            {
+                // concurrent reads without any synchronization, starting with an empty LUT function cache
+                nl->clear_caches();
+                run_threads([&](u32) {
+                    for (u32 round = 0; round < 20; round++)
+                    {
+                        for (const Gate* gate : luts)
+                        {
+                            if (gate->get_boolean_function("O") != reference.at(gate))
+                            {
+                                num_mismatches++;
+                            }
+                            if (gate->get_predecessors().size() != ((gate == luts.front()) ? 0 : 1))
+                            {
+                                num_mismatches++;
+                            }
+                        }
+                        if (nl->get_gates().size() != luts.size() || mod->get_gates().size() != 32)
+                        {
+                            num_mismatches++;
+                        }
+                    }
+                });
+                EXPECT_EQ(num_mismatches, 0);
+            }
+            {
+                // concurrent reads holding read access while another thread modifies the netlist holding write access
+                std::atomic<bool> done = false;
+                std::thread writer([&]() {
+                    for (u32 i = 0; i < 200; i++)
+                    {
+                        auto lock = nl->acquire_write_lock();
+                        Gate* gate = nl->create_gate(lut2, "temp_" + std::to_string(i));
+                        Net* net   = test_utils::connect(nl.get(), luts.at(i % luts.size()), "O", gate, "I1");
+                        gate->set_init_data({"6"});
+                        if (i % 3 == 0)
+                        {
+                            nl->clear_caches();
+                        }
+                        if (i % 2 == 0)
+                        {
+                            nl->delete_gate(gate);
+                            if (net->get_destinations().empty() && net->get_sources().empty())
+                            {
+                                nl->delete_net(net);
+                            }
+                        }
+                    }
+                    done = true;
+                });
+
+                run_threads([&](u32) {
+                    while (!done)
+                    {
+                        {
+                            auto lock = nl->acquire_read_lock();
+                            for (const Gate* gate : nl->get_gates())
+                            {
+                                const BooleanFunction function = gate->get_boolean_function("O");
+                                if (auto it = reference.find(gate); it != reference.end() && function != it->second)
+                                {
+                                    num_mismatches++;
+                                }
+                                for (const Endpoint* ep : gate->get_fan_in_endpoints())
+                                {
+                                    if (!nl->is_net_in_netlist(ep->get_net()))
+                                    {
+                                        num_mismatches++;
+                                    }
+                                }
+                            }
+                        }
+                        std::this_thread::yield();
+                    }
+                });
+
+                writer.join();
+                EXPECT_EQ(num_mismatches, 0);
+                EXPECT_EQ(nl->get_gates().size(), luts.size() + 100);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the connectivity snapshot, which stores gates and nets with dense indices and their connections in CSR arrays.
+     *
+     * Functions: NetlistSnapshot
+     */
+    TEST_F(NetlistTest, check_snapshot) {
+        TEST_START
+            std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+
+            // remove some objects so that IDs are no longer contiguous
+            nl->delete_gate(nl->get_gate_by_id(MIN_GATE_ID + 3));
+            nl->delete_net(nl->get_net_by_id(MIN_NET_ID + 20));
+
+            for (const u32 num_workers : {1, 4})
+            {
+                const NetlistSnapshot snapshot(*nl, num_workers);
+                EXPECT_EQ(&snapshot.get_netlist(), nl.get());
+                ASSERT_EQ(snapshot.get_num_gates(), nl->get_gates().size());
+                ASSERT_EQ(snapshot.get_num_nets(), nl->get_nets().size());
+
+                for (u32 i = 0; i < snapshot.get_num_gates(); i++)
+                {
+                    const Gate* g = snapshot.get_gate(i);
+                    EXPECT_EQ(snapshot.get_gate_index(g), i);
+                    EXPECT_EQ(snapshot.has_gate_property(i, GateTypeProperty::combinational), g->get_type()->has_property(GateTypeProperty::combinational));
+                    EXPECT_EQ(snapshot.has_gate_property(i, GateTypeProperty::sequential), g->get_type()->has_property(GateTypeProperty::sequential));
+
+                    const auto fan_in = snapshot.get_fan_in(i);
+                    ASSERT_EQ(fan_in.size(), g->get_fan_in_endpoints().size());
+                    for (u32 j = 0; j < fan_in.size(); j++)
+                    {
+                        const Endpoint* ep = g->get_fan_in_endpoints()[j];
+                        EXPECT_EQ(snapshot.get_net(fan_in[j].index), ep->get_net());
+                        EXPECT_EQ(fan_in[j].pin, ep->get_pin());
+                        EXPECT_EQ(fan_in[j].pin_type, ep->get_pin()->get_type());
+                    }
+
+                    const auto fan_out = snapshot.get_fan_out(i);
+                    ASSERT_EQ(fan_out.size(), g->get_fan_out_endpoints().size());
+                    for (u32 j = 0; j < fan_out.size(); j++)
+                    {
+                        EXPECT_EQ(snapshot.get_net(fan_out[j].index), g->get_fan_out_endpoints()[j]->get_net());
+                    }
+                }
+
+                for (u32 i = 0; i < snapshot.get_num_nets(); i++)
+                {
+                    const Net* n = snapshot.get_net(i);
+                    EXPECT_EQ(snapshot.get_net_index(n), i);
+
+                    std::vector<Endpoint*> sources = n->get_sources();
+                    ASSERT_EQ(snapshot.get_sources(i).size(), sources.size());
+                    for (u32 j = 0; j < sources.size(); j++)
+                    {
+                        EXPECT_EQ(snapshot.get_gate(snapshot.get_sources(i)[j].index), sources[j]->get_gate());
+                        EXPECT_EQ(snapshot.get_sources(i)[j].pin, sources[j]->get_pin());
+                    }
+
+                    std::vector<Endpoint*> destinations = n->get_destinations();
+                    ASSERT_EQ(snapshot.get_destinations(i).size(), destinations.size());
+                    for (u32 j = 0; j < destinations.size(); j++)
+                    {
+                        EXPECT_EQ(snapshot.get_gate(snapshot.get_destinations(i)[j].index), destinations[j]->get_gate());
+                        EXPECT_EQ(snapshot.get_destinations(i)[j].pin, destinations[j]->get_pin());
+                    }
+                }
+            }
+
+            // objects that are not part of the snapshot
+            const NetlistSnapshot snapshot(*nl);
+            std::unique_ptr<Netlist> other_nl = test_utils::create_example_netlist();
+            EXPECT_EQ(snapshot.get_gate_index(nullptr), NetlistSnapshot::INVALID_INDEX);
+            EXPECT_EQ(snapshot.get_gate_index(other_nl->get_gate_by_id(MIN_GATE_ID + 1)), NetlistSnapshot::INVALID_INDEX);
+            EXPECT_EQ(snapshot.get_net_index(other_nl->get_net_by_id(MIN_NET_ID + 13)), NetlistSnapshot::INVALID_INDEX);
+            EXPECT_EQ(snapshot.get_gate_index(nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("INV"), "late")), NetlistSnapshot::INVALID_INDEX);
+        TEST_END
+    }
+
+    /**
+     * Testing the incremental structural fingerprint of a netlist by comparing it against a fingerprint computed from scratch after every modification, as well as the structure hash and the detection of duplicated modules.
+     *
+     * Functions: NetlistFingerprint, get_hash, get_module_hash, get_modification_count, get_module_structure_hash, get_duplicate_modules
+     */
+    TEST_F(NetlistTest, check_fingerprint) {
+        TEST_START
+            {
+                std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+                Module* mod_0 = nl->create_module("mod_0", nl->get_top_module(), {nl->get_gate_by_id(MIN_GATE_ID + 0), nl->get_gate_by_id(MIN_GATE_ID + 1)});
+                Module* mod_1 = nl->create_module("mod_1", nl->get_top_module(), {nl->get_gate_by_id(MIN_GATE_ID + 3)});
+
+                NetlistFingerprint fp(nl.get(), 4);
+                const auto matches_fresh_fingerprint = [&nl, &fp]() {
+                    const NetlistFingerprint fresh(nl.get(), 1);
+                    for (const Module* module : nl->get_modules())
+                    {
+                        if (fp.get_module_hash(module) != fresh.get_module_hash(module))
+                        {
+                            return false;
+                        }
+                    }
+                    return fp.get_hash() == fresh.get_hash();
+                };
+
+                const u64 initial_hash  = fp.get_hash();
+                const u64 mod_0_hash    = fp.get_module_hash(mod_0);
+                const u64 mod_1_hash    = fp.get_module_hash(mod_1);
+                const u64 initial_count = fp.get_modification_count();
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                EXPECT_EQ(fp.get_gate_hash(nullptr), 0);
+                EXPECT_NE(fp.get_net_hash(nl->get_net_by_id(MIN_NET_ID + 13)), 0);
+
+                // equal netlists have equal fingerprints
+                {
+                    std::unique_ptr<Netlist> c_nl = nl->copy().get();
+                    EXPECT_TRUE(*c_nl == *nl);
+                    EXPECT_EQ(NetlistFingerprint(c_nl.get()).get_hash(), initial_hash);
+                    c_nl->get_net_by_id(MIN_NET_ID + 13)->set_name("renamed");
+                    EXPECT_FALSE(*c_nl == *nl);
+                    EXPECT_NE(NetlistFingerprint(c_nl.get()).get_hash(), initial_hash);
+                }
+
+                // only the hashes of modules containing the changed gate are recomputed, reverting a change restores the hash
+                Gate* gate_0 = nl->get_gate_by_id(MIN_GATE_ID + 0);
+                gate_0->set_name("renamed");
+                EXPECT_GT(fp.get_modification_count(), initial_count);
+                EXPECT_NE(fp.get_hash(), initial_hash);
+                EXPECT_NE(fp.get_module_hash(mod_0), mod_0_hash);
+                EXPECT_EQ(fp.get_module_hash(mod_1), mod_1_hash);
+                gate_0->set_name("gate_0");
+                EXPECT_EQ(fp.get_hash(), initial_hash);
+                EXPECT_EQ(fp.get_module_hash(mod_0), mod_0_hash);
+
+                Net* net_13 = nl->get_net_by_id(MIN_NET_ID + 13);
+                Endpoint* ep = net_13->get_destinations().front();
+                Gate* dst_gate = ep->get_gate();
+                GatePin* dst_pin = ep->get_pin();
+                ASSERT_TRUE(net_13->remove_destination(ep));
+                EXPECT_NE(fp.get_hash(), initial_hash);
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                ASSERT_NE(net_13->add_destination(dst_gate, dst_pin), nullptr);
+                EXPECT_TRUE(matches_fresh_fingerprint());
+
+                // arbitrary modifications are tracked
+                nl->mark_global_output_net(net_13);
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                nl->mark_vcc_gate(nl->get_gate_by_id(MIN_GATE_ID + 5));
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                Module* mod_2 = nl->create_module("mod_2", mod_0, {nl->get_gate_by_id(MIN_GATE_ID + 1), nl->get_gate_by_id(MIN_GATE_ID + 4)});
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                mod_2->set_type("sub");
+                mod_1->assign_gate(nl->get_gate_by_id(MIN_GATE_ID + 1));
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                nl->delete_module(mod_0);
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                nl->delete_gate(nl->get_gate_by_id(MIN_GATE_ID + 3));
+                nl->delete_net(nl->get_net_by_id(MIN_NET_ID + 20));
+                EXPECT_TRUE(matches_fresh_fingerprint());
+                Gate* new_gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "new_gate");
+                test_utils::connect(nl.get(), nl->get_gate_by_id(MIN_GATE_ID + 0), "O", new_gate, "I");
+                EXPECT_TRUE(matches_fresh_fingerprint());
+            }
+            {
+                // two instances of the same circuit with different names and IDs and a third, different circuit
+                std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+                const GateLibrary* gl = nl->get_gate_library();
+                std::vector<Module*> modules;
+                for (u32 i = 0; i < 3; i++)
+                {
+                    Gate* and_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and_" + std::to_string(i));
+                    Gate* buf_gate = nl->create_gate(gl->get_gate_type_by_name((i < 2) ? "BUF" : "INV"), "buf_" + std::to_string(i));
+                    test_utils::connect_global_in(nl.get(), and_gate, "I0");
+                    test_utils::connect_global_in(nl.get(), and_gate, "I1");
+                    test_utils::connect(nl.get(), and_gate, "O", buf_gate, "I");
+                    test_utils::connect_global_out(nl.get(), buf_gate, "O");
+                    modules.push_back(nl->create_module("instance_" + std::to_string(i), nl->get_top_module(), {and_gate, buf_gate}));
+                }
+
+                const NetlistFingerprint fp(nl.get());
+                EXPECT_EQ(fp.get_module_structure_hash(modules[0]), fp.get_module_structure_hash(modules[1]));
+                EXPECT_NE(fp.get_module_structure_hash(modules[0]), fp.get_module_structure_hash(modules[2]));
+                EXPECT_NE(fp.get_module_hash(modules[0]), fp.get_module_hash(modules[1]));
+
+                for (const u32 num_workers : {1, 4})
+                {
+                    const std::vector<std::vector<Module*>> duplicates = fp.get_duplicate_modules(num_workers);
+                    ASSERT_EQ(duplicates.size(), 1);
+                    EXPECT_EQ(duplicates.front(), std::vector<Module*>({modules[0], modules[1]}));
+                }
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the lookup of gates, nets, and modules by name and wildcard pattern, with and without the name index, including the update of the index on creation, deletion, and renaming of objects.
+     *
+     * Functions: enable_name_index, is_name_index_enabled, get_gates_by_name, get_gates_by_name_pattern, get_nets_by_name, get_nets_by_name_pattern, get_modules_by_name, get_modules_by_name_pattern
+     */
+    TEST_F(NetlistTest, check_name_index) {
+        TEST_START
+            // the same queries yield the same results with and without index
+            const auto check_queries = [](const Netlist* nl) {
+                for (const std::string pattern : {"*", "gate_*", "*_1*", "gate_?", "*ate_1", "net_*", "*top*", "*mod*", "?", "", "gate_0", "*_abc*", "g*e*4"})
+                {
+                    const auto as_set = [](const auto& objects) { return std::set(objects.begin(), objects.end()); };
+                    EXPECT_EQ(as_set(nl->get_gates_by_name_pattern(pattern)), as_set(nl->get_gates([&pattern](const Gate* g) { return NameIndex::matches_pattern(pattern, g->get_name()); })));
+                    EXPECT_EQ(as_set(nl->get_nets_by_name_pattern(pattern)), as_set(nl->get_nets([&pattern](const Net* n) { return NameIndex::matches_pattern(pattern, n->get_name()); })));
+                    EXPECT_EQ(as_set(nl->get_modules_by_name_pattern(pattern)), as_set(nl->get_modules([&pattern](const Module* m) { return NameIndex::matches_pattern(pattern, m->get_name()); })));
+                }
+                for (const Gate* gate : nl->get_gates())
+                {
+                    const std::vector<Gate*> gates = nl->get_gates_by_name(gate->get_name());
+                    EXPECT_NE(std::find(gates.begin(), gates.end(), gate), gates.end());
+                }
+                for (const Net* net : nl->get_nets())
+                {
+                    const std::vector<Net*> nets = nl->get_nets_by_name(net->get_name());
+                    EXPECT_NE(std::find(nets.begin(), nets.end(), net), nets.end());
+                }
+            };
+
+            {
+                EXPECT_TRUE(NameIndex::matches_pattern("*", ""));
+                EXPECT_TRUE(NameIndex::matches_pattern("a*b?c", "axxbyc"));
+                EXPECT_TRUE(NameIndex::matches_pattern("*abc", "ababc"));
+                EXPECT_FALSE(NameIndex::matches_pattern("a*b?c", "axxbc"));
+                EXPECT_FALSE(NameIndex::matches_pattern("abc", "abcd"));
+            }
+            {
+                std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+                nl->create_module("mod_0", nl->get_top_module(), {nl->get_gate_by_id(MIN_GATE_ID + 0)});
+                Gate* gate_1 = nl->get_gate_by_id(MIN_GATE_ID + 1);
+
+                EXPECT_FALSE(nl->is_name_index_enabled());
+                EXPECT_EQ(nl->get_gates_by_name("gate_1"), std::vector<Gate*>({gate_1}));
+                EXPECT_EQ(nl->get_gates_by_name("not_existing"), std::vector<Gate*>());
+                check_queries(nl.get());
+
+                nl->enable_name_index();
+                EXPECT_TRUE(nl->is_name_index_enabled());
+                EXPECT_EQ(nl->get_gates_by_name("gate_1"), std::vector<Gate*>({gate_1}));
+                EXPECT_EQ(nl->get_modules_by_name("mod_0").size(), 1);
+                check_queries(nl.get());
+
+                // the index follows modifications of the netlist
+                gate_1->set_name("gate_0");
+                EXPECT_EQ(nl->get_gates_by_name("gate_1"), std::vector<Gate*>());
+                EXPECT_EQ(nl->get_gates_by_name("gate_0"), std::vector<Gate*>({nl->get_gate_by_id(MIN_GATE_ID + 0), gate_1}));
+                nl->delete_gate(nl->get_gate_by_id(MIN_GATE_ID + 0));
+                EXPECT_EQ(nl->get_gates_by_name("gate_0"), std::vector<Gate*>({gate_1}));
+                Gate* new_gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "new_abc_gate");
+                EXPECT_EQ(nl->get_gates_by_name_pattern("*_abc*"), std::vector<Gate*>({new_gate}));
+                Net* new_net = nl->create_net("new_abc_net");
+                EXPECT_EQ(nl->get_nets_by_name_pattern("*abc*"), std::vector<Net*>({new_net}));
+                nl->delete_net(new_net);
+                EXPECT_EQ(nl->get_nets_by_name_pattern("*abc*"), std::vector<Net*>());
+                nl->get_top_module()->set_name("renamed_top");
+                EXPECT_EQ(nl->get_modules_by_name_pattern("renamed*"), std::vector<Module*>({nl->get_top_module()}));
+                check_queries(nl.get());
+
+                // many renames trigger the removal of unused names from the index
+                for (u32 i = 0; i < 5000; i++)
+                {
+                    new_gate->set_name("renamed_" + std::to_string(i));
+                }
+                EXPECT_EQ(nl->get_gates_by_name_pattern("renamed_*"), std::vector<Gate*>({new_gate}));
+                check_queries(nl.get());
+
+                // copies inherit the index
+                std::unique_ptr<Netlist> c_nl = nl->copy().get();
+                EXPECT_TRUE(c_nl->is_name_index_enabled());
+                check_queries(c_nl.get());
+
+                nl->enable_name_index(false);
+                EXPECT_FALSE(nl->is_name_index_enabled());
+                new_gate->set_name("after_disabling");
+                EXPECT_EQ(nl->get_gates_by_name("after_disabling"), std::vector<Gate*>({new_gate}));
+                check_queries(nl.get());
+
+                // objects that have been deleted or renamed while events were disabled are skipped by the stale index
+                nl->enable_name_index();
+                Module* stale_mod = nl->create_module("stale_mod", nl->get_top_module());
+                nl->get_event_handler()->event_enable_all(false);
+                nl->delete_module(stale_mod);
+                nl->delete_gate(gate_1);
+                new_gate->set_name("renamed_silently");
+                nl->get_event_handler()->event_enable_all(true);
+                EXPECT_EQ(nl->get_modules_by_name("stale_mod"), std::vector<Module*>());
+                EXPECT_EQ(nl->get_modules_by_name_pattern("stale*"), std::vector<Module*>());
+                EXPECT_EQ(nl->get_gates_by_name("gate_0"), std::vector<Gate*>());
+                EXPECT_EQ(nl->get_gates_by_name("after_disabling"), std::vector<Gate*>());
+
+                // rebuilding the index picks up the changes
+                nl->enable_name_index(false);
+                nl->enable_name_index();
+                EXPECT_EQ(nl->get_gates_by_name("renamed_silently"), std::vector<Gate*>({new_gate}));
+                check_queries(nl.get());
+            }
+        TEST_END
+    }
+
 } //namespace hal
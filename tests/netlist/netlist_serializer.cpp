@@ -7,11 +7,15 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+#include "hal_core/netlist/persistent/netlist_journal.h"
 #include "hal_core/plugin_system/plugin_manager.h"
 #include "gate_library_test_utils.h"
 #include "netlist_test_utils.h"
 
+#include <array>
 #include <filesystem>
+#include <fstream>
 
 namespace hal {
     using test_utils::MIN_GATE_ID;
@@ -240,6 +244,336 @@ namespace hal {
          TEST_END
      }
 
+     /**
+      * Testing the streaming deserialization of JSON files and its fallback to the document-based deserialization for legacy files
+      *
+      * Functions: deserialize_from_file, deserialize_from_string
+      */
+     TEST_F(NetlistSerializerTest, check_streaming_deserialize) {
+         TEST_START
+             {
+                 // Deserialize a netlist with enough Boolean functions to be parsed by multiple workers
+                 auto nl = create_example_serializer_netlist();
+                 for (u32 i = 0; i < 500; i++)
+                 {
+                     Gate* gate = nl->create_gate(100 + i, m_gl->get_gate_type_by_name("AND2"), "function_gate_" + std::to_string(i));
+                     gate->add_boolean_function("O_" + std::to_string(i % 4), BooleanFunction::from_string("(I0 & I1) | !I" + std::to_string(i % 2)).get());
+                 }
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+                 EXPECT_EQ(des_nl->get_gate_by_id(599)->get_boolean_function("O_3"), BooleanFunction::from_string("(I0 & I1) | !I1").get());
+             }
+             {
+                 // Deserialize a string in which the nets precede the gates they are connected to
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 std::ifstream hal_file_stream(test_hal_file_path);
+                 std::string hal_string((std::istreambuf_iterator<char>(hal_file_stream)), std::istreambuf_iterator<char>());
+
+                 const size_t gates_begin   = hal_string.find("\"gates\":");
+                 const size_t nets_begin    = hal_string.find(",\"nets\":");
+                 const size_t modules_begin = hal_string.find(",\"modules\":");
+                 ASSERT_TRUE(gates_begin < nets_begin && nets_begin < modules_begin && modules_begin != std::string::npos);
+                 std::string reordered = hal_string.substr(0, gates_begin) + hal_string.substr(nets_begin + 1, modules_begin - nets_begin - 1) + ","
+                                         + hal_string.substr(gates_begin, nets_begin - gates_begin) + hal_string.substr(modules_begin);
+
+                 auto des_nl = netlist_serializer::deserialize_from_string(reordered);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+             {
+                 // Deserialize a string of a legacy format version that connects gates by pin name
+                 NO_COUT_TEST_BLOCK;
+                 std::string hal_string = "{\"serialization_format_version\":11,\"netlist\":{\"gate_library\":\"" + m_gl->get_path().string()
+                                          + "\",\"id\":1,\"input_file\":\"\",\"design_name\":\"legacy\",\"device_name\":\"\","
+                                            "\"gates\":[{\"id\":1,\"name\":\"gate_0\",\"type\":\"BUF\"},{\"id\":2,\"name\":\"gate_1\",\"type\":\"BUF\"}],\"global_vcc\":[],\"global_gnd\":[],"
+                                            "\"nets\":[{\"id\":1,\"name\":\"net_0\",\"srcs\":[{\"gate_id\":1,\"pin_type\":\"O\"}],\"dsts\":[{\"gate_id\":2,\"pin_type\":\"I\"}]}],"
+                                            "\"global_in\":[],\"global_out\":[],\"modules\":[{\"id\":1,\"type\":\"\",\"name\":\"top_module\",\"parent\":0,\"gates\":[1,2]}]}}";
+
+                 auto des_nl = netlist_serializer::deserialize_from_string(hal_string);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_EQ(des_nl->get_design_name(), "legacy");
+                 ASSERT_NE(des_nl->get_net_by_id(1), nullptr);
+                 EXPECT_TRUE(des_nl->get_net_by_id(1)->is_a_source(des_nl->get_gate_by_id(1)));
+                 EXPECT_TRUE(des_nl->get_net_by_id(1)->is_a_destination(des_nl->get_gate_by_id(2)));
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the serialization of a netlist using write options, i.e., indented and compressed JSON files and progress reporting
+      *
+      * Functions: serialize_to_file, deserialize_from_file
+      */
+     TEST_F(NetlistSerializerTest, check_serialize_with_write_options) {
+         TEST_START
+             {
+                 // Serialize the example netlist with every combination of indentation and compression
+                 auto nl = create_example_serializer_netlist();
+                 const u64 total = nl->get_gates().size() + nl->get_nets().size() + nl->get_modules().size();
+
+                 for (const bool pretty : {false, true})
+                 {
+                     for (const bool compress : {false, true})
+                     {
+                         std::vector<std::pair<u64, u64>> progress;
+                         netlist_serializer::WriteOptions options;
+                         options.pretty            = pretty;
+                         options.compress          = compress;
+                         options.progress_callback = [&progress](u64 written, u64 num_objects) { progress.push_back({written, num_objects}); };
+
+                         std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                         ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path, options));
+                         ASSERT_FALSE(progress.empty());
+                         EXPECT_EQ(progress.back(), std::make_pair(total, total));
+
+                         // compressed files start with the gzip magic number
+                         std::ifstream hal_file_stream(test_hal_file_path, std::ios::binary);
+                         std::array<char, 2> magic;
+                         ASSERT_TRUE(hal_file_stream.read(magic.data(), magic.size()));
+                         EXPECT_EQ(magic[0] == '\x1f' && magic[1] == '\x8b', compress);
+
+                         // the compression is detected automatically
+                         auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                         ASSERT_NE(des_nl, nullptr);
+                         EXPECT_TRUE(*nl == *des_nl);
+                     }
+                 }
+             }
+             {
+                 // Deserialize a truncated compressed file
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+                 netlist_serializer::WriteOptions options;
+                 options.compress = true;
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path, options));
+                 std::filesystem::resize_file(test_hal_file_path, std::filesystem::file_size(test_hal_file_path) / 2);
+                 EXPECT_EQ(netlist_serializer::deserialize_from_file(test_hal_file_path), nullptr);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the serialization and deserialization of a netlist in the binary format and its equivalence to the JSON format
+      *
+      * Functions: serialize_to_file, deserialize_from_file, netlist_binary_serializer::is_binary_file
+      */
+     TEST_F(NetlistSerializerTest, check_binary_serialize_and_deserialize) {
+         TEST_START
+             {
+                 // Serialize the example netlist in both formats and compare the deserialized netlists with each other and with the original netlist
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path json_file_path = test_utils::create_sandbox_path("test_hal_file_json.hal");
+                 std::filesystem::path binary_file_path = test_utils::create_sandbox_path("test_hal_file_binary.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), json_file_path, netlist_serializer::Format::json));
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), binary_file_path, netlist_serializer::Format::binary));
+                 EXPECT_FALSE(netlist_binary_serializer::is_binary_file(json_file_path));
+                 EXPECT_TRUE(netlist_binary_serializer::is_binary_file(binary_file_path));
+
+                 // the format is detected automatically
+                 auto json_nl = netlist_serializer::deserialize_from_file(json_file_path);
+                 auto binary_nl = netlist_serializer::deserialize_from_file(binary_file_path);
+                 ASSERT_NE(json_nl, nullptr);
+                 ASSERT_NE(binary_nl, nullptr);
+                 EXPECT_TRUE(*nl == *binary_nl);
+                 EXPECT_TRUE(*json_nl == *binary_nl);
+                 EXPECT_EQ(binary_nl->get_top_module()->get_type(), "top_mod_type");
+                 EXPECT_NE(binary_nl->get_module_by_id(2)->get_pin_group_by_name("great_group"), nullptr);
+             }
+             {
+                 // Serialize Boolean functions with multi-bit variables and constants that exceed the size of packed constants
+                 auto nl = create_example_serializer_netlist();
+                 BooleanFunction wide = BooleanFunction::And(BooleanFunction::Var("A", 32), BooleanFunction::Const(0xDEADBEEF, 32), 32).get();
+                 nl->get_gate_by_id(5)->add_boolean_function("O_wide", wide);
+
+                 std::filesystem::path binary_file_path = test_utils::create_sandbox_path("test_hal_file_binary.hal");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), binary_file_path));
+                 auto binary_nl = netlist_binary_serializer::deserialize_from_file(binary_file_path);
+                 ASSERT_NE(binary_nl, nullptr);
+                 EXPECT_TRUE(*nl == *binary_nl);
+                 EXPECT_EQ(binary_nl->get_gate_by_id(5)->get_boolean_function("O_wide"), wide);
+             }
+             {
+                 // Serialize and deserialize an empty netlist
+                 auto nl = std::make_unique<Netlist>(m_gl);
+
+                 std::filesystem::path binary_file_path = test_utils::create_sandbox_path("test_hal_file_binary.hal");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), binary_file_path));
+                 auto binary_nl = netlist_binary_serializer::deserialize_from_file(binary_file_path);
+                 ASSERT_NE(binary_nl, nullptr);
+                 EXPECT_TRUE(*nl == *binary_nl);
+             }
+             {
+                 // Deserialize a truncated file
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path binary_file_path = test_utils::create_sandbox_path("test_hal_file_binary.hal");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), binary_file_path));
+                 std::filesystem::resize_file(binary_file_path, std::filesystem::file_size(binary_file_path) / 2);
+                 EXPECT_EQ(netlist_serializer::deserialize_from_file(binary_file_path), nullptr);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the journaled serialization of a netlist, i.e., appending the changes to a journal file and replaying them on top of a netlist file
+      *
+      * Functions: NetlistJournal, append_to_journal, deserialize_from_journal
+      */
+     TEST_F(NetlistSerializerTest, check_journal) {
+         TEST_START
+             {
+                 // Record two entries of changes and replay them after each entry
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 std::filesystem::path test_journal_file_path = test_utils::create_sandbox_path("test_hal_file.journal");
+                 std::filesystem::remove(test_journal_file_path);
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+
+                 NetlistJournal journal(nl.get());
+                 EXPECT_FALSE(journal.has_changes());
+
+                 // -- rename a gate, create a gate and a net, and delete a gate
+                 nl->get_gate_by_id(1)->set_name("gate_0_renamed");
+                 Gate* new_gate = nl->create_gate(100, m_gl->get_gate_type_by_name("BUF"), "new_gate");
+                 Net* new_net   = nl->create_net(100, "new_net");
+                 new_net->add_source(new_gate, "O");
+                 new_net->add_destination(nl->get_gate_by_id(9), "I1");
+                 nl->delete_gate(nl->get_gate_by_id(5));
+                 EXPECT_TRUE(journal.has_changes());
+                 ASSERT_TRUE(journal.append_to_file(test_journal_file_path));
+                 EXPECT_FALSE(journal.has_changes());
+
+                 auto des_nl = netlist_serializer::deserialize_from_journal(test_hal_file_path, test_journal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 // -- move gates into a new module, rename one of its pins, and mark a global output net
+                 Module* new_module = nl->create_module(100, "new_module", nl->get_module_by_id(2), {new_gate, nl->get_gate_by_id(9)});
+                 ASSERT_NE(new_module, nullptr);
+                 ASSERT_FALSE(new_module->get_pins().empty());
+                 EXPECT_TRUE(new_module->set_pin_name(new_module->get_pins().front(), "renamed_pin"));
+                 nl->mark_global_output_net(new_net);
+                 ASSERT_TRUE(journal.append_to_file(test_journal_file_path));
+
+                 des_nl = netlist_serializer::deserialize_from_journal(test_hal_file_path, test_journal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+                 EXPECT_NE(des_nl->get_module_by_id(100), nullptr);
+             }
+             {
+                 // Replay a journal whose last entry has been truncated
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 std::filesystem::path test_journal_file_path = test_utils::create_sandbox_path("test_hal_file.journal");
+                 std::filesystem::remove(test_journal_file_path);
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+
+                 NetlistJournal journal(nl.get());
+                 nl->get_gate_by_id(1)->set_name("gate_0_renamed");
+                 ASSERT_TRUE(journal.append_to_file(test_journal_file_path));
+                 const u64 first_entry_size = std::filesystem::file_size(test_journal_file_path);
+                 nl->get_gate_by_id(2)->set_name("gate_1_renamed");
+                 ASSERT_TRUE(journal.append_to_file(test_journal_file_path));
+                 std::filesystem::resize_file(test_journal_file_path, first_entry_size + 10);
+
+                 auto des_nl = netlist_serializer::deserialize_from_journal(test_hal_file_path, test_journal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_EQ(des_nl->get_gate_by_id(1)->get_name(), "gate_0_renamed");
+                 EXPECT_EQ(des_nl->get_gate_by_id(2)->get_name(), "gate_1");
+             }
+             {
+                 // Data changes are detected, but not recorded by the journal
+                 auto nl = create_example_serializer_netlist();
+                 NetlistJournal journal(nl.get());
+                 EXPECT_FALSE(journal.has_data_changes());
+                 EXPECT_TRUE(nl->get_gate_by_id(1)->set_data("category", "key", "string", "value"));
+                 EXPECT_FALSE(journal.has_changes());
+                 EXPECT_TRUE(journal.has_data_changes());
+                 journal.clear();
+                 EXPECT_FALSE(journal.has_data_changes());
+             }
+             {
+                 // The journal detaches itself from a destroyed netlist
+                 auto nl = create_example_serializer_netlist();
+                 NetlistJournal journal(nl.get());
+                 EXPECT_TRUE(journal.is_attached());
+                 nl.reset();
+                 EXPECT_FALSE(journal.is_attached());
+                 EXPECT_FALSE(journal.append_to_file(test_utils::create_sandbox_path("test_hal_file.journal")));
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the lazy deserialization of a netlist, i.e., loading the modules and data entries from the file once they are accessed for the first time
+      *
+      * Functions: deserialize_from_file, Netlist::has_deferred_content, Netlist::load_deferred_content
+      */
+     TEST_F(NetlistSerializerTest, check_lazy_deserialize) {
+         TEST_START
+             for (const netlist_serializer::Format format : {netlist_serializer::Format::json, netlist_serializer::Format::binary})
+             {
+                 // Load modules and data entries on first access
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path, format));
+
+                 netlist_serializer::ReadOptions options;
+                 options.lazy = true;
+                 auto des_nl  = netlist_serializer::deserialize_from_file(test_hal_file_path, nullptr, options);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(des_nl->has_deferred_content());
+                 const u64 num_data_changes = des_nl->get_num_data_changes();
+
+                 EXPECT_EQ(des_nl->get_gate_by_id(2)->get_data_map(), nl->get_gate_by_id(2)->get_data_map());
+                 EXPECT_EQ(des_nl->get_gate_by_id(1)->get_module()->get_id(), 2);
+                 EXPECT_EQ(des_nl->get_module_by_id(3)->get_type(), "test_mod_type_1");
+                 EXPECT_EQ(des_nl->get_module_by_id(2)->get_data("category", "key_3"), std::make_tuple(std::string("data_type"), std::string("test_value")));
+
+                 EXPECT_TRUE(*nl == *des_nl);
+                 EXPECT_FALSE(des_nl->has_deferred_content());
+                 EXPECT_EQ(des_nl->get_num_data_changes(), num_data_changes);
+             }
+             {
+                 // Skip deleted gates when loading the modules and load all deferred content before overwriting the file
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+
+                 netlist_serializer::ReadOptions options;
+                 options.lazy = true;
+                 auto des_nl  = netlist_serializer::deserialize_from_file(test_hal_file_path, nullptr, options);
+                 ASSERT_NE(des_nl, nullptr);
+
+                 ASSERT_TRUE(des_nl->delete_gate(des_nl->get_gate_by_id(1)));
+                 EXPECT_EQ(des_nl->get_module_by_id(2)->get_gates(nullptr, false), std::vector<Gate*>({des_nl->get_gate_by_id(4)}));
+
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(des_nl.get(), test_hal_file_path));
+                 EXPECT_FALSE(des_nl->has_deferred_content());
+
+                 auto re_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(re_nl, nullptr);
+                 EXPECT_TRUE(*des_nl == *re_nl);
+             }
+         TEST_END
+     }
+
      /**
       * Testing the serialization and deserialization of a netlist with invalid input
       *